@@ -20,12 +20,22 @@ import (
 	"fmt"
 	"log"
 	"net"
+	"net/http"
 	"os"
 	"os/signal"
 	"syscall"
+	"time"
 
+	"github.com/datacommonsorg/mixer/internal/batch"
+	"github.com/datacommonsorg/mixer/internal/compression"
+	"github.com/datacommonsorg/mixer/internal/diskcache"
+	"github.com/datacommonsorg/mixer/internal/gateway"
 	"github.com/datacommonsorg/mixer/internal/healthcheck"
+	"github.com/datacommonsorg/mixer/internal/limiter"
+	"github.com/datacommonsorg/mixer/internal/peer"
+	"github.com/datacommonsorg/mixer/internal/prefetch"
 	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/datacommonsorg/mixer/internal/rowcache"
 	"github.com/datacommonsorg/mixer/internal/server"
 	"golang.org/x/oauth2/google"
 
@@ -45,9 +55,40 @@ var (
 	bqDataset     = flag.String("bq_dataset", "", "DataCommons BigQuery dataset.")
 	baseTableName = flag.String("base_table", "", "Base cache Bigtable table.")
 	port          = flag.Int("port", 12345, "Port on which to run the server.")
+	httpPort      = flag.Int("http_port", 0, "Port on which to serve the HTTP/JSON API. Disabled when 0.")
 	useALTS       = flag.Bool("use_alts", false, "Whether to use ALTS server authentication")
 	bigqueryOnly  = flag.Bool("bigquery_only", false, "The service only serves sparql query")
 	schemaPath    = flag.String("schema_path", "/translator/mapping", "The directory that contains the schema mapping files")
+	// Compression
+	compressionThreshold = flag.Int("compression_threshold", compression.DefaultOptions.Threshold, "Responses smaller than this number of bytes are not compressed.")
+	compressionLevel     = flag.Int("compression_level", compression.DefaultOptions.Level, "The gzip level of compressed responses.")
+	// Row cache and peers
+	rowCacheMB            = flag.Int64("row_cache_mb", 0, "Size in MB of the in-memory cache of Bigtable rows. Disabled when 0.")
+	diskCacheDir          = flag.String("disk_cache_dir", "", "Local disk directory for the rows evicted from the row cache. Disabled when empty. Requires --row_cache_mb.")
+	diskCacheMB           = flag.Int64("disk_cache_mb", 10240, "Size in MB of the disk cache.")
+	prefetchRowsPerSecond = flag.Int("prefetch_rows_per_second", 0, "Budget of rows per second to prefetch into the row cache. Disabled when 0. Requires --row_cache_mb.")
+	peers                 = flag.String("peers", "", "Mixer replicas, including this one, that own partitions of the Bigtable rows. Either a comma separated list of host:port, or dns:///<host>:<port>, with the --peer_port of the replicas. Disabled when empty.")
+	peerSelf              = flag.String("peer_self", "", "The host:port of this replica as it appears in --peers.")
+	peerPort              = flag.Int("peer_port", 0, "Port on which to serve the row reads of the other replicas. Required with --peers. It must only be reachable by the replicas, not exposed with the public port.")
+	peerTimeout           = flag.Duration("peer_timeout", 500*time.Millisecond, "Time limit for reading rows from a peer before falling back to Bigtable.")
+	peerInterval          = flag.Duration("peer_refresh_interval", 30*time.Second, "How often the DNS name in --peers is resolved.")
+	// Bigtable load protection
+	btInitialConcurrency = flag.Int("bt_initial_concurrency", 0, "Initial limit of the concurrent reads per Bigtable table, like 64. The limit adapts to the latency. Disabled when 0.")
+	btMinConcurrency     = flag.Int("bt_min_concurrency", 4, "Minimum limit of the concurrent reads per Bigtable table.")
+	btMaxConcurrency     = flag.Int("bt_max_concurrency", 512, "Maximum limit of the concurrent reads per Bigtable table.")
+	btBatchMaxWait       = flag.Duration("bt_batch_max_wait", 0, "Maximum time a small Bigtable read waits to be merged with the reads of concurrent requests. The wait adapts to the load between --bt_batch_min_wait and this. Disabled when 0.")
+	btBatchMinWait       = flag.Duration("bt_batch_min_wait", 200*time.Microsecond, "Minimum time a small Bigtable read waits to be merged with the reads of concurrent requests.")
+	btBatchMaxRows       = flag.Int("bt_batch_max_rows", 200, "Number of rows that makes a merged Bigtable read start without waiting.")
+	branchLatencyBudget  = flag.Duration("branch_latency_budget", 0, "Time limit for reading the branch table. Slower reads trip the branch circuit breaker, and requests are served from the base table only. Disabled when 0.")
+	branchFailureRatio   = flag.Float64("branch_failure_ratio", 0.5, "Ratio of failed or slow branch reads that opens the circuit breaker.")
+	branchBreakerWindow  = flag.Int("branch_breaker_window", 20, "Number of recent branch reads considered by the circuit breaker.")
+	branchBreakerCool    = flag.Duration("branch_breaker_cooldown", 30*time.Second, "How long the branch circuit breaker stays open before a probe read.")
+	// Warm-up
+	warmupPrimeReads = flag.Int("warmup_prime_reads", 8, "Number of concurrent reads per Bigtable table to prime connections at start up.")
+	warmupHotKeys    = flag.String("warmup_hot_keys", "", "File of Bigtable row keys, one per line, to read at start up.")
+	warmupTimeout    = flag.Duration("warmup_timeout", time.Minute, "Time limit for priming connections and replaying hot keys.")
+	// Places
+	placeSnapshot = flag.String("place_snapshot", "", "CSV file of places with the columns dcid, types, latitude, longitude and population for the nearby places index. Missing values are read from the graph. Disabled when empty.")
 )
 
 const (
@@ -86,14 +127,14 @@ func main() {
 
 	var baseTable *bigtable.Table
 	var branchTable *bigtable.Table
-	var cache *server.Cache
+	var branchTableName string
 	if !*bigqueryOnly {
 		// Base cache
 		baseTable, err = server.NewBtTable(ctx, *storeProject, baseBtInstance, *baseTableName)
 		if err != nil {
 			log.Fatalf("Failed to create BigTable client: %v", err)
 		}
-		branchTableName, err := server.ReadBranchTableName(
+		branchTableName, err = server.ReadBranchTableName(
 			ctx, branchCacheVersionBucket, branchCacheVersionFile)
 		if err != nil {
 			log.Fatalf("Failed to read branch cache folder: %v", err)
@@ -103,12 +144,6 @@ func main() {
 		if err != nil {
 			log.Fatalf("Failed to create BigTable client: %v", err)
 		}
-
-		// Cache.
-		cache, err = server.NewCache(ctx, baseTable)
-		if err != nil {
-			log.Fatalf("Failed to create cache: %v", err)
-		}
 	}
 
 	// Metadata.
@@ -118,7 +153,64 @@ func main() {
 	}
 
 	// Create server object
-	s := server.NewServer(bqClient, baseTable, branchTable, metadata, cache)
+	// The cache is built as a warm-up step.
+	s := server.NewServer(bqClient, baseTable, branchTable, metadata, nil)
+	s.SetTableNames(*baseTableName, branchTableName)
+	if *rowCacheMB > 0 {
+		// Rows evicted from the row cache spill to the disk cache.
+		var onEvict func(string, []byte)
+		if *diskCacheDir != "" && !*bigqueryOnly {
+			disk, err := diskcache.Open(*diskCacheDir, *baseTableName, *diskCacheMB<<20)
+			if err != nil {
+				log.Fatalf("Failed to open disk cache: %v", err)
+			}
+			s.SetDiskCache(disk)
+			onEvict = disk.Add
+		}
+		s.SetRowCache(rowcache.New(*rowCacheMB<<20, onEvict))
+		if *prefetchRowsPerSecond > 0 {
+			p := prefetch.New(s.PrefetchRead, *prefetchRowsPerSecond)
+			p.Start(ctx)
+			s.SetPrefetcher(p)
+		}
+	}
+	// Each replica reads and caches the rows it owns, and reads the other rows
+	// from their owners.
+	if *peers != "" && !*bigqueryOnly {
+		if *peerPort == 0 {
+			log.Fatalf("--peer_port is required with --peers")
+		}
+		router := peer.NewRouter(*peerSelf, *peerTimeout)
+		if err := router.Discover(ctx, *peers, *peerInterval); err != nil {
+			log.Fatalf("Failed to discover mixer peers: %v", err)
+		}
+		s.SetPeers(router)
+	}
+
+	if *btInitialConcurrency > 0 {
+		s.SetLimiters(
+			limiter.NewLimiter(*btInitialConcurrency, *btMinConcurrency, *btMaxConcurrency),
+			limiter.NewLimiter(*btInitialConcurrency, *btMinConcurrency, *btMaxConcurrency))
+	}
+	if *btBatchMaxWait > 0 {
+		s.SetBatcher(batch.New(batch.Options{
+			MinWait: *btBatchMinWait,
+			MaxWait: *btBatchMaxWait,
+			MaxRows: *btBatchMaxRows,
+			Timeout: time.Minute,
+		}))
+	}
+	if *branchLatencyBudget > 0 {
+		if *branchBreakerWindow < 1 {
+			log.Fatalf("--branch_breaker_window must be at least 1")
+		}
+		s.SetBranchBreaker(limiter.NewBreaker("branch cache", limiter.BreakerOptions{
+			LatencyBudget: *branchLatencyBudget,
+			FailureRatio:  *branchFailureRatio,
+			Window:        *branchBreakerWindow,
+			Cooldown:      *branchBreakerCool,
+		}))
+	}
 
 	// Subscribe to cache update
 	if !*bigqueryOnly {
@@ -141,7 +233,51 @@ func main() {
 		}()
 	}
 
-	opts := []grpc.ServerOption{}
+	// The health check reports NOT_SERVING and RPCs are rejected until the
+	// warm-up steps are done.
+	healthService := healthcheck.NewHealthChecker()
+	if !*bigqueryOnly {
+		healthService.AddStep("build_cache", s.BuildCache)
+		healthService.AddStep("prime_connections", func(ctx context.Context) error {
+			ctx, cancel := context.WithTimeout(ctx, *warmupTimeout)
+			defer cancel()
+			if err := s.PrimeConnections(ctx, *warmupPrimeReads); err != nil {
+				log.Printf("Failed to prime Bigtable connections: %v", err)
+			}
+			return nil
+		})
+		if *placeSnapshot != "" {
+			healthService.AddStep("load_place_index", func(ctx context.Context) error {
+				return s.LoadPlaceIndex(ctx, *placeSnapshot)
+			})
+		}
+		if *warmupHotKeys != "" {
+			healthService.AddStep("replay_hot_keys", func(ctx context.Context) error {
+				ctx, cancel := context.WithTimeout(ctx, *warmupTimeout)
+				defer cancel()
+				rowKeys, err := server.ReadHotKeys(*warmupHotKeys)
+				if err == nil {
+					err = s.ReplayHotKeys(ctx, rowKeys)
+				}
+				if err != nil {
+					log.Printf("Failed to replay hot keys: %v", err)
+				}
+				return nil
+			})
+		}
+	}
+
+	opts := []grpc.ServerOption{
+		grpc.ChainUnaryInterceptor(healthService.UnaryInterceptor, s.ETagInterceptor),
+		grpc.StreamInterceptor(healthService.StreamInterceptor),
+	}
+
+	// Responses are compressed the same way as the requests, so clients opt in
+	// by sending compressed requests with "grpc-encoding: gzip".
+	compressor := compression.Register(compression.Options{
+		Threshold: *compressionThreshold,
+		Level:     *compressionLevel,
+	})
 
 	// Use ALTS server credential to bind to VM's private IPv6 interface.
 	if *useALTS {
@@ -155,15 +291,52 @@ func main() {
 	// Register reflection service on gRPC server.
 	reflection.Register(srv)
 
-	healthService := healthcheck.NewHealthChecker()
 	grpc_health_v1.RegisterHealthServer(srv, healthService)
 
+	// Serve HTTP/JSON in process, without going through ESP.
+	if *httpPort != 0 {
+		gw, err := gateway.New(s)
+		if err != nil {
+			log.Fatalf("Failed to create HTTP gateway: %v", err)
+		}
+		mux := http.NewServeMux()
+		mux.Handle("/healthz", healthService)
+		mux.Handle("/", healthService.Gate(compressor.Handler(gw)))
+		go func() {
+			err := http.ListenAndServe(fmt.Sprintf(":%d", *httpPort), mux)
+			if err != nil {
+				log.Fatalf("Failed to serve HTTP: %v", err)
+			}
+		}()
+	}
+
+	// The row reads of the other replicas bypass the request checks of the
+	// public API, so they are served on their own port.
+	if *peers != "" && !*bigqueryOnly {
+		peerLis, err := net.Listen("tcp", fmt.Sprintf(":%d", *peerPort))
+		if err != nil {
+			log.Fatalf("Failed to listen on peer port: %v", err)
+		}
+		peerSrv := grpc.NewServer()
+		pb.RegisterMixerPeerServer(peerSrv, s)
+		go func() {
+			if err := peerSrv.Serve(peerLis); err != nil {
+				log.Fatalf("Failed to serve peers: %v", err)
+			}
+		}()
+	}
+
 	// Listen on network
 	lis, err := net.Listen("tcp", fmt.Sprintf(":%d", *port))
 	if err != nil {
 		log.Fatalf("Failed to listen on network: %v", err)
 	}
-	fmt.Println("Mixer ready to serve!!")
+	go func() {
+		if err := healthService.Run(ctx); err != nil {
+			log.Fatalf("Failed to warm up: %v", err)
+		}
+		fmt.Println("Mixer ready to serve!!")
+	}()
 	if err := srv.Serve(lis); err != nil {
 		log.Fatalf("Failed to serve: %v", err)
 	}
@@ -0,0 +1,305 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Package ancestor is an in-memory index of the containedInPlace graph, to
+// resolve the ancestor chains of places without a read per hop.
+package ancestor
+
+import (
+	"context"
+	"sort"
+	"sync"
+)
+
+const (
+	// maxDepth bounds the chains, in case of a cycle in the graph.
+	maxDepth = 32
+	// Number of times Ancestors loads again when the index was reset while
+	// loading.
+	maxAttempts = 3
+)
+
+// Place is a parent place as read from the graph.
+type Place struct {
+	Dcid  string
+	Name  string
+	Types []string
+}
+
+// ReadFunc reads the direct parents of places, keyed by the child dcid.
+type ReadFunc func(ctx context.Context, dcids []string) (map[string][]Place, error)
+
+// Options control which ancestors are returned.
+type Options struct {
+	// Parents whose first type is one of these are neither returned nor
+	// walked through.
+	ExcludeTypes []string
+	// Only ancestors of these types are returned when set. The chain is still
+	// walked through the other ancestors.
+	Types []string
+	// When set, the chain ends at the level whose last parent, the one the
+	// chain continues from, satisfies StopAt.
+	StopAt func(Place) bool
+}
+
+type node struct {
+	place Place
+	// Parents sorted by dcid, descending.
+	parents []int32
+	loaded  bool
+}
+
+// Index is a parent array over interned place ids. The parents of a place
+// are read once, with the parents of all the other places at the same level,
+// and kept until the index is reset.
+//
+// Only places that are found in the graph are interned: the requested places
+// that have parents, and their ancestors. The index is dropped as a whole when
+// it reaches its size limit, and when the tables are swapped.
+type Index struct {
+	read      ReadFunc
+	maxPlaces int
+
+	mu    sync.RWMutex
+	ids   map[string]int32
+	nodes []node
+	// Incremented by each reset, so Ancestors can tell that the places it
+	// loaded were dropped.
+	generation int
+}
+
+// New returns an empty Index that reads parents with read, and holds up to
+// about maxPlaces places.
+func New(read ReadFunc, maxPlaces int) *Index {
+	return &Index{read: read, maxPlaces: maxPlaces, ids: map[string]int32{}}
+}
+
+// Reset drops all the places, e.g. after the tables are swapped.
+func (idx *Index) Reset() {
+	idx.mu.Lock()
+	defer idx.mu.Unlock()
+	idx.reset()
+}
+
+// reset drops all the places. Requires the lock.
+func (idx *Index) reset() {
+	idx.ids = map[string]int32{}
+	idx.nodes = nil
+	idx.generation++
+}
+
+// Len returns the number of places in the index.
+func (idx *Index) Len() int {
+	idx.mu.RLock()
+	defer idx.mu.RUnlock()
+	return len(idx.nodes)
+}
+
+// intern returns the id of a place, adding it if needed. Requires the lock.
+func (idx *Index) intern(dcid string) int32 {
+	if id, ok := idx.ids[dcid]; ok {
+		return id
+	}
+	id := int32(len(idx.nodes))
+	idx.ids[dcid] = id
+	idx.nodes = append(idx.nodes, node{place: Place{Dcid: dcid}})
+	return id
+}
+
+// frontier returns the places whose parents have not been read, found by
+// walking up from dcids through the places that are loaded. A Load that
+// failed partway leaves such places above loaded ones, so they are read again.
+func (idx *Index) frontier(dcids []string) []string {
+	idx.mu.RLock()
+	defer idx.mu.RUnlock()
+	var result []string
+	seen := map[string]bool{}
+	queue := append([]string{}, dcids...)
+	for len(queue) > 0 {
+		dcid := queue[0]
+		queue = queue[1:]
+		if seen[dcid] {
+			continue
+		}
+		seen[dcid] = true
+		id, ok := idx.ids[dcid]
+		if !ok || !idx.nodes[id].loaded {
+			result = append(result, dcid)
+			continue
+		}
+		for _, pid := range idx.nodes[id].parents {
+			queue = append(queue, idx.nodes[pid].place.Dcid)
+		}
+	}
+	return result
+}
+
+// resetIfFull drops all the places when the index reached its size limit.
+func (idx *Index) resetIfFull() {
+	idx.mu.RLock()
+	full := len(idx.nodes) >= idx.maxPlaces
+	idx.mu.RUnlock()
+	if !full {
+		return
+	}
+	idx.mu.Lock()
+	defer idx.mu.Unlock()
+	if len(idx.nodes) >= idx.maxPlaces {
+		idx.reset()
+	}
+}
+
+// Load reads the ancestors of places that are not in the index yet, with one
+// read per level of the graph.
+//
+// The index is reset before the load when it is full, so it holds up to
+// maxPlaces places plus the ancestors of the places of one call.
+func (idx *Index) Load(ctx context.Context, dcids []string) error {
+	idx.resetIfFull()
+	frontier := idx.frontier(dcids)
+	// Places read without parents and not interned. They are interned as
+	// loaded if they turn out to be the parent of another place.
+	roots := map[string]bool{}
+	for depth := 0; len(frontier) > 0 && depth < maxDepth; depth++ {
+		parents, err := idx.read(ctx, frontier)
+		if err != nil {
+			return err
+		}
+		idx.mu.Lock()
+		var next []string
+		queued := map[string]bool{}
+		for _, dcid := range frontier {
+			ps := parents[dcid]
+			id, ok := idx.ids[dcid]
+			if !ok {
+				if len(ps) == 0 {
+					// Not found, or a root place.
+					roots[dcid] = true
+					continue
+				}
+				id = idx.intern(dcid)
+			}
+			if idx.nodes[id].loaded {
+				// Loaded by a concurrent call.
+				continue
+			}
+			sort.SliceStable(ps, func(i, j int) bool { return ps[i].Dcid > ps[j].Dcid })
+			ids := make([]int32, len(ps))
+			for i, p := range ps {
+				pid := idx.intern(p.Dcid)
+				idx.nodes[pid].place = p
+				ids[i] = pid
+				if roots[p.Dcid] {
+					idx.nodes[pid].loaded = true
+				}
+				if !idx.nodes[pid].loaded && !queued[p.Dcid] {
+					queued[p.Dcid] = true
+					next = append(next, p.Dcid)
+				}
+			}
+			idx.nodes[id].parents = ids
+			idx.nodes[id].loaded = true
+		}
+		frontier = nil
+		for _, dcid := range next {
+			// Skip the parents that were in this level too, and those dropped
+			// by a reset.
+			if id, ok := idx.ids[dcid]; ok && !idx.nodes[id].loaded {
+				frontier = append(frontier, dcid)
+			}
+		}
+		idx.mu.Unlock()
+	}
+	return nil
+}
+
+// Ancestors returns the ancestors of each place, nearest first. Places
+// without parents are omitted.
+//
+// At each level all the parents are included, in descending dcid order, and
+// the chain continues from the last one: a city lists its county, state and
+// country, and the chain goes on from the country.
+func (idx *Index) Ancestors(ctx context.Context, dcids []string, opts Options) (
+	map[string][]Place, error) {
+	for attempt := 1; ; attempt++ {
+		idx.mu.RLock()
+		generation := idx.generation
+		idx.mu.RUnlock()
+		if err := idx.Load(ctx, dcids); err != nil {
+			return nil, err
+		}
+		idx.mu.RLock()
+		if idx.generation == generation || attempt == maxAttempts {
+			result := idx.ancestors(dcids, opts)
+			idx.mu.RUnlock()
+			return result, nil
+		}
+		// Reset while loading, some of the chains may be missing.
+		idx.mu.RUnlock()
+	}
+}
+
+// ancestors returns the chains of the places in the index. Requires the lock.
+func (idx *Index) ancestors(dcids []string, opts Options) map[string][]Place {
+	exclude := toSet(opts.ExcludeTypes)
+	include := toSet(opts.Types)
+	result := map[string][]Place{}
+	for _, dcid := range dcids {
+		id, ok := idx.ids[dcid]
+		if !ok {
+			continue
+		}
+		var chain []Place
+		seen := map[int32]bool{id: true}
+		for depth := 0; depth < maxDepth; depth++ {
+			last := int32(-1)
+			for _, pid := range idx.nodes[id].parents {
+				p := &idx.nodes[pid].place
+				if (len(p.Types) > 0 && exclude[p.Types[0]]) || seen[pid] {
+					continue
+				}
+				seen[pid] = true
+				last = pid
+				if len(include) == 0 || hasAny(p.Types, include) {
+					chain = append(chain, *p)
+				}
+			}
+			if last < 0 || (opts.StopAt != nil && opts.StopAt(idx.nodes[last].place)) {
+				break
+			}
+			id = last
+		}
+		if len(chain) > 0 {
+			result[dcid] = chain
+		}
+	}
+	return result
+}
+
+func toSet(values []string) map[string]bool {
+	set := make(map[string]bool, len(values))
+	for _, v := range values {
+		set[v] = true
+	}
+	return set
+}
+
+func hasAny(types []string, set map[string]bool) bool {
+	for _, t := range types {
+		if set[t] {
+			return true
+		}
+	}
+	return false
+}
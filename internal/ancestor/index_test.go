@@ -0,0 +1,193 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package ancestor
+
+import (
+	"context"
+	"errors"
+	"testing"
+
+	"github.com/google/go-cmp/cmp"
+)
+
+var graph = map[string][]Place{
+	"geoId/0667000": {
+		{Dcid: "geoId/06", Types: []string{"State"}},
+		{Dcid: "geoId/06075", Types: []string{"County"}},
+		{Dcid: "zip/94103", Types: []string{"CensusZipCodeTabulationArea"}},
+		{Dcid: "country/USA", Types: []string{"Country"}},
+	},
+	"geoId/06075":  {{Dcid: "geoId/06", Types: []string{"State"}}},
+	"geoId/06":     {{Dcid: "country/USA", Types: []string{"Country"}}},
+	"country/USA":  {{Dcid: "northamerica", Name: "North America", Types: []string{"Continent"}}},
+	"northamerica": {{Dcid: "Earth", Types: []string{"Place"}}},
+	"zip/94103":    {{Dcid: "geoId/06", Types: []string{"State"}}},
+	// A cycle.
+	"a": {{Dcid: "b"}},
+	"b": {{Dcid: "a"}},
+}
+
+func TestAncestors(t *testing.T) {
+	var reads [][]string
+	idx := New(func(ctx context.Context, dcids []string) (map[string][]Place, error) {
+		reads = append(reads, dcids)
+		result := map[string][]Place{}
+		for _, dcid := range dcids {
+			if ps, ok := graph[dcid]; ok {
+				result[dcid] = append([]Place{}, ps...)
+			}
+		}
+		return result, nil
+	}, 100)
+	ctx := context.Background()
+
+	got, err := idx.Ancestors(ctx, []string{"geoId/0667000", "geoId/06075", "a", "Earth"},
+		Options{ExcludeTypes: []string{"CensusZipCodeTabulationArea"}})
+	if err != nil {
+		t.Fatalf("Ancestors() = %v", err)
+	}
+	dcids := map[string][]string{}
+	for dcid, chain := range got {
+		for _, p := range chain {
+			dcids[dcid] = append(dcids[dcid], p.Dcid)
+		}
+	}
+	want := map[string][]string{
+		"geoId/0667000": {"geoId/06075", "geoId/06", "country/USA", "northamerica", "Earth"},
+		"geoId/06075":   {"geoId/06", "country/USA", "northamerica", "Earth"},
+		"a":             {"b"},
+	}
+	if diff := cmp.Diff(want, dcids); diff != "" {
+		t.Errorf("Ancestors() diff %v", diff)
+	}
+	// One read per level.
+	if len(reads) != 3 {
+		t.Errorf("Ancestors() made %d reads, want 3: %v", len(reads), reads)
+	}
+
+	got, err = idx.Ancestors(ctx, []string{"geoId/0667000"}, Options{Types: []string{"State", "Continent"}})
+	if err != nil {
+		t.Fatalf("Ancestors() = %v", err)
+	}
+	want = map[string][]string{"geoId/0667000": {"geoId/06", "northamerica"}}
+	dcids = map[string][]string{}
+	for dcid, chain := range got {
+		for _, p := range chain {
+			dcids[dcid] = append(dcids[dcid], p.Dcid)
+		}
+	}
+	if diff := cmp.Diff(want, dcids); diff != "" {
+		t.Errorf("Ancestors() diff %v", diff)
+	}
+	if got["geoId/0667000"][1].Name != "North America" {
+		t.Errorf("Ancestors() = %+v, want the name of northamerica", got)
+	}
+	if len(reads) != 3 {
+		t.Errorf("Ancestors() made %d reads after loading, want none", len(reads)-3)
+	}
+}
+
+func TestLoadAfterFailure(t *testing.T) {
+	fail := true
+	idx := New(func(ctx context.Context, dcids []string) (map[string][]Place, error) {
+		result := map[string][]Place{}
+		for _, dcid := range dcids {
+			// The read of the second level fails once.
+			if dcid == "geoId/06" && fail {
+				fail = false
+				return nil, errors.New("unavailable")
+			}
+			if ps, ok := graph[dcid]; ok {
+				result[dcid] = append([]Place{}, ps...)
+			}
+		}
+		return result, nil
+	}, 100)
+	ctx := context.Background()
+	if _, err := idx.Ancestors(ctx, []string{"geoId/06075"}, Options{}); err == nil {
+		t.Fatal("Ancestors() succeeded with a failed read")
+	}
+	got, err := idx.Ancestors(ctx, []string{"geoId/06075"}, Options{})
+	if err != nil {
+		t.Fatalf("Ancestors() = %v", err)
+	}
+	var dcids []string
+	for _, p := range got["geoId/06075"] {
+		dcids = append(dcids, p.Dcid)
+	}
+	want := []string{"geoId/06", "country/USA", "northamerica", "Earth"}
+	if diff := cmp.Diff(want, dcids); diff != "" {
+		t.Errorf("Ancestors() after a failed read diff %v", diff)
+	}
+}
+
+func TestIndexBounds(t *testing.T) {
+	reads := 0
+	read := func(ctx context.Context, dcids []string) (map[string][]Place, error) {
+		reads++
+		result := map[string][]Place{}
+		for _, dcid := range dcids {
+			if ps, ok := graph[dcid]; ok {
+				result[dcid] = append([]Place{}, ps...)
+			}
+		}
+		return result, nil
+	}
+	ctx := context.Background()
+	idx := New(read, 100)
+
+	// Places that are not found are not interned.
+	got, err := idx.Ancestors(ctx, []string{"dc/unknown1", "dc/unknown2"}, Options{})
+	if err != nil {
+		t.Fatalf("Ancestors() = %v", err)
+	}
+	if len(got) != 0 || idx.Len() != 0 {
+		t.Errorf("Ancestors() = %v with %d places in the index, want none", got, idx.Len())
+	}
+
+	// Reset drops the places, which are read again.
+	if _, err := idx.Ancestors(ctx, []string{"geoId/06075"}, Options{}); err != nil {
+		t.Fatalf("Ancestors() = %v", err)
+	}
+	if idx.Len() != 5 {
+		t.Errorf("Len() = %d, want 5", idx.Len())
+	}
+	idx.Reset()
+	if idx.Len() != 0 {
+		t.Errorf("Len() = %d after Reset(), want 0", idx.Len())
+	}
+	reads = 0
+	if _, err := idx.Ancestors(ctx, []string{"geoId/06075"}, Options{}); err != nil {
+		t.Fatalf("Ancestors() = %v", err)
+	}
+	if reads == 0 {
+		t.Error("Ancestors() did not read after Reset()")
+	}
+
+	// A full index is dropped, and the chains are still complete.
+	idx = New(read, 3)
+	for _, dcid := range []string{"geoId/06075", "geoId/0667000", "geoId/06075"} {
+		got, err := idx.Ancestors(ctx, []string{dcid}, Options{})
+		if err != nil {
+			t.Fatalf("Ancestors() = %v", err)
+		}
+		if n := len(got[dcid]); n < 4 {
+			t.Errorf("Ancestors(%s) has %d places, want at least 4", dcid, n)
+		}
+	}
+	if idx.Len() > 3+len(graph) {
+		t.Errorf("Len() = %d, index is not bounded", idx.Len())
+	}
+}
@@ -0,0 +1,158 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Package batch merges the small Bigtable reads of concurrent requests into
+// shared reads.
+package batch
+
+import (
+	"context"
+	"sync"
+	"time"
+)
+
+// ReadFunc reads the raw value of each row key. Rows that do not exist are
+// missing from the result.
+type ReadFunc func(ctx context.Context, rowKeys []string) (map[string][]byte, error)
+
+// Options configures a Batcher.
+type Options struct {
+	// Bounds of the time a batch collects row keys. The wait grows while
+	// batches merge several requests, and shrinks back when they do not, so
+	// reads are only delayed under load.
+	MinWait time.Duration
+	MaxWait time.Duration
+	// A batch is read as soon as it has this number of row keys.
+	MaxRows int
+	// Time limit of a batch read. The read is shared by the requests, so it
+	// does not follow the deadline of any of them. No limit when 0.
+	Timeout time.Duration
+}
+
+// Batcher collects the row keys of concurrent reads of a table for a short
+// wait, and reads them with a single row list.
+type Batcher struct {
+	opts Options
+
+	mu   sync.Mutex
+	wait time.Duration
+	// Batch collecting row keys, keyed by table.
+	pending map[string]*batch
+}
+
+type batch struct {
+	table    string
+	read     ReadFunc
+	rowKeys  []string
+	seen     map[string]struct{}
+	requests int
+	timer    *time.Timer
+
+	done chan struct{}
+	rows map[string][]byte
+	err  error
+}
+
+// New creates a Batcher.
+func New(opts Options) *Batcher {
+	if opts.MaxWait < opts.MinWait {
+		opts.MaxWait = opts.MinWait
+	}
+	return &Batcher{
+		opts:    opts,
+		wait:    opts.MinWait,
+		pending: map[string]*batch{},
+	}
+}
+
+// Read reads rowKeys of a table with the other reads of the table in the
+// same batch. It returns the rows of the whole batch, which must not be
+// modified.
+//
+// The batch is read with the read function of its first request, so all the
+// reads of a table name must read the same table.
+func (b *Batcher) Read(
+	ctx context.Context, table string, rowKeys []string, read ReadFunc) (
+	map[string][]byte, error) {
+	b.mu.Lock()
+	bt, ok := b.pending[table]
+	if !ok {
+		bt = &batch{
+			table: table,
+			read:  read,
+			seen:  map[string]struct{}{},
+			done:  make(chan struct{}),
+		}
+		b.pending[table] = bt
+		bt.timer = time.AfterFunc(b.wait, func() { b.flush(bt) })
+	}
+	bt.requests++
+	for _, rowKey := range rowKeys {
+		if _, ok := bt.seen[rowKey]; !ok {
+			bt.seen[rowKey] = struct{}{}
+			bt.rowKeys = append(bt.rowKeys, rowKey)
+		}
+	}
+	full := b.opts.MaxRows > 0 && len(bt.rowKeys) >= b.opts.MaxRows
+	b.mu.Unlock()
+
+	if full {
+		bt.timer.Stop()
+		b.flush(bt)
+	}
+	select {
+	case <-bt.done:
+		return bt.rows, bt.err
+	case <-ctx.Done():
+		return nil, ctx.Err()
+	}
+}
+
+// Wait returns the current wait of a batch.
+func (b *Batcher) Wait() time.Duration {
+	b.mu.Lock()
+	defer b.mu.Unlock()
+	return b.wait
+}
+
+// flush reads a batch, unless it is already read.
+func (b *Batcher) flush(bt *batch) {
+	b.mu.Lock()
+	if b.pending[bt.table] != bt {
+		b.mu.Unlock()
+		return
+	}
+	delete(b.pending, bt.table)
+	if bt.requests > 1 {
+		b.wait *= 2
+		if b.wait == 0 {
+			b.wait = b.opts.MaxWait / 8
+		}
+		if b.wait > b.opts.MaxWait {
+			b.wait = b.opts.MaxWait
+		}
+	} else if b.wait /= 2; b.wait < b.opts.MinWait {
+		b.wait = b.opts.MinWait
+	}
+	b.mu.Unlock()
+
+	ctx := context.Background()
+	if b.opts.Timeout > 0 {
+		var cancel context.CancelFunc
+		ctx, cancel = context.WithTimeout(ctx, b.opts.Timeout)
+		defer cancel()
+	}
+	bt.rows, bt.err = bt.read(ctx, bt.rowKeys)
+	close(bt.done)
+}
@@ -0,0 +1,93 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package batch
+
+import (
+	"context"
+	"errors"
+	"fmt"
+	"sort"
+	"sync"
+	"testing"
+	"time"
+)
+
+func TestRead(t *testing.T) {
+	b := New(Options{MinWait: 50 * time.Millisecond, MaxWait: 100 * time.Millisecond})
+	var mu sync.Mutex
+	var reads [][]string
+	read := func(ctx context.Context, rowKeys []string) (map[string][]byte, error) {
+		mu.Lock()
+		reads = append(reads, rowKeys)
+		mu.Unlock()
+		rows := map[string][]byte{}
+		for _, rowKey := range rowKeys {
+			if rowKey != "missing" {
+				rows[rowKey] = []byte("v" + rowKey)
+			}
+		}
+		return rows, nil
+	}
+
+	var wg sync.WaitGroup
+	for i := 0; i < 10; i++ {
+		wg.Add(1)
+		go func(i int) {
+			defer wg.Done()
+			rowKey := fmt.Sprintf("k%d", i%5)
+			rows, err := b.Read(context.Background(), "base", []string{rowKey, "missing"}, read)
+			if err != nil {
+				t.Errorf("Read() = %v", err)
+				return
+			}
+			if got := string(rows[rowKey]); got != "v"+rowKey {
+				t.Errorf("Read() row %s = %q, want %q", rowKey, got, "v"+rowKey)
+			}
+			if _, ok := rows["missing"]; ok {
+				t.Error("Read() returned a missing row")
+			}
+		}(i)
+	}
+	wg.Wait()
+	if len(reads) != 1 {
+		t.Fatalf("Read() issued %d reads, want 1", len(reads))
+	}
+	sort.Strings(reads[0])
+	if got := fmt.Sprint(reads[0]); got != "[k0 k1 k2 k3 k4 missing]" {
+		t.Errorf("Read() read rows %s", got)
+	}
+	// The wait grows after a batch of several requests.
+	if got := b.Wait(); got != 100*time.Millisecond {
+		t.Errorf("Wait() = %s, want 100ms", got)
+	}
+}
+
+func TestReadFull(t *testing.T) {
+	b := New(Options{MinWait: time.Hour, MaxWait: time.Hour, MaxRows: 2})
+	readErr := errors.New("unavailable")
+	read := func(ctx context.Context, rowKeys []string) (map[string][]byte, error) {
+		return nil, readErr
+	}
+	// The batch is read without waiting once it is full.
+	if _, err := b.Read(context.Background(), "base", []string{"a", "b"}, read); err != readErr {
+		t.Errorf("Read() = %v, want %v", err, readErr)
+	}
+
+	ctx, cancel := context.WithTimeout(context.Background(), 10*time.Millisecond)
+	defer cancel()
+	if _, err := b.Read(ctx, "base", []string{"a"}, read); err != context.DeadlineExceeded {
+		t.Errorf("Read() = %v, want %v", err, context.DeadlineExceeded)
+	}
+}
@@ -0,0 +1,186 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Package compression provides response compression for gRPC and HTTP.
+//
+// Messages are buffered up to a size threshold. Smaller messages are stored
+// without deflating them, so small responses do not pay for compression, while
+// larger ones are compressed with pooled gzip writers.
+package compression
+
+import (
+	"compress/gzip"
+	"io"
+	"sync"
+
+	"google.golang.org/grpc/encoding"
+)
+
+// Name is the name of the compressor, as used in "grpc-encoding" and
+// "Content-Encoding".
+const Name = "gzip"
+
+// Options configures the compressor.
+type Options struct {
+	// Messages smaller than this number of bytes are not deflated.
+	Threshold int
+	// The gzip compression level of larger messages.
+	Level int
+}
+
+// DefaultOptions favors speed, since most of the size reduction of the map
+// heavy responses is already achieved at the fastest level.
+var DefaultOptions = Options{
+	Threshold: 1024,
+	Level:     gzip.BestSpeed,
+}
+
+// Compressor is a gzip compressor with pooled writers and readers. It
+// implements the gRPC encoding.Compressor interface.
+type Compressor struct {
+	opts       Options
+	writerPool sync.Pool
+	storedPool sync.Pool
+	bufPool    sync.Pool
+	readerPool sync.Pool
+}
+
+// NewCompressor creates a Compressor.
+func NewCompressor(opts Options) *Compressor {
+	if opts.Threshold < 0 {
+		opts.Threshold = 0
+	}
+	c := &Compressor{opts: opts}
+	c.writerPool.New = func() interface{} {
+		gz, err := gzip.NewWriterLevel(io.Discard, opts.Level)
+		if err != nil {
+			gz = gzip.NewWriter(io.Discard)
+		}
+		return gz
+	}
+	c.storedPool.New = func() interface{} {
+		gz, _ := gzip.NewWriterLevel(io.Discard, gzip.NoCompression)
+		return gz
+	}
+	c.bufPool.New = func() interface{} {
+		return &writer{c: c, buf: make([]byte, 0, opts.Threshold)}
+	}
+	return c
+}
+
+// Register registers the compressor with gRPC. A client that sends requests
+// with "grpc-encoding: gzip" gets the responses compressed the same way.
+//
+// This must only be called at initialization time, before the server starts.
+func Register(opts Options) *Compressor {
+	c := NewCompressor(opts)
+	encoding.RegisterCompressor(c)
+	return c
+}
+
+// Name returns the name of the compressor.
+func (c *Compressor) Name() string {
+	return Name
+}
+
+// Compress returns a writer that compresses the data written to it into w.
+func (c *Compressor) Compress(w io.Writer) (io.WriteCloser, error) {
+	z := c.bufPool.Get().(*writer)
+	z.w = w
+	return z, nil
+}
+
+// writer buffers a message until the threshold is reached, then decides on how
+// to encode it.
+type writer struct {
+	c   *Compressor
+	w   io.Writer
+	buf []byte
+	gz  *gzip.Writer
+	// The pool that gz is returned to.
+	gzPool *sync.Pool
+}
+
+func (z *writer) start(pool *sync.Pool) error {
+	z.gzPool = pool
+	z.gz = pool.Get().(*gzip.Writer)
+	z.gz.Reset(z.w)
+	if len(z.buf) == 0 {
+		return nil
+	}
+	_, err := z.gz.Write(z.buf)
+	z.buf = z.buf[:0]
+	return err
+}
+
+func (z *writer) Write(p []byte) (int, error) {
+	if z.gz != nil {
+		return z.gz.Write(p)
+	}
+	if len(z.buf)+len(p) < z.c.opts.Threshold {
+		z.buf = append(z.buf, p...)
+		return len(p), nil
+	}
+	if err := z.start(&z.c.writerPool); err != nil {
+		return 0, err
+	}
+	return z.gz.Write(p)
+}
+
+// Close flushes the message and returns the writer to the pool.
+func (z *writer) Close() error {
+	if z.gz == nil {
+		if err := z.start(&z.c.storedPool); err != nil {
+			return err
+		}
+	}
+	err := z.gz.Close()
+	z.gzPool.Put(z.gz)
+	z.gz = nil
+	z.gzPool = nil
+	z.w = nil
+	z.buf = z.buf[:0]
+	z.c.bufPool.Put(z)
+	return err
+}
+
+type reader struct {
+	*gzip.Reader
+	pool *sync.Pool
+}
+
+// Decompress returns a reader of the decompressed data in r.
+func (c *Compressor) Decompress(r io.Reader) (io.Reader, error) {
+	z, inPool := c.readerPool.Get().(*reader)
+	if !inPool {
+		gz, err := gzip.NewReader(r)
+		if err != nil {
+			return nil, err
+		}
+		return &reader{Reader: gz, pool: &c.readerPool}, nil
+	}
+	if err := z.Reset(r); err != nil {
+		c.readerPool.Put(z)
+		return nil, err
+	}
+	return z, nil
+}
+
+func (z *reader) Read(p []byte) (int, error) {
+	n, err := z.Reader.Read(p)
+	if err == io.EOF {
+		z.pool.Put(z)
+	}
+	return n, err
+}
@@ -0,0 +1,206 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package compression
+
+import (
+	"bytes"
+	"compress/gzip"
+	"io"
+	"io/ioutil"
+	"net/http"
+	"net/http/httptest"
+	"strings"
+	"testing"
+)
+
+func compress(t *testing.T, c *Compressor, data []byte) []byte {
+	t.Helper()
+	var buf bytes.Buffer
+	w, err := c.Compress(&buf)
+	if err != nil {
+		t.Fatalf("Compress() = %v", err)
+	}
+	// Write in pieces to cross the threshold in the middle of a write.
+	for len(data) > 0 {
+		n := 100
+		if n > len(data) {
+			n = len(data)
+		}
+		if _, err := w.Write(data[:n]); err != nil {
+			t.Fatalf("Write() = %v", err)
+		}
+		data = data[n:]
+	}
+	if err := w.Close(); err != nil {
+		t.Fatalf("Close() = %v", err)
+	}
+	return buf.Bytes()
+}
+
+func TestCompressor(t *testing.T) {
+	comp := NewCompressor(Options{Threshold: 1000, Level: gzip.BestSpeed})
+	for _, c := range []struct {
+		data        string
+		wantSmaller bool
+	}{
+		{"", false},
+		{"short", false},
+		{strings.Repeat(`{"geoId/06":{"value":1}}`, 40), false},
+		{strings.Repeat(`{"geoId/06":{"value":1}}`, 1000), true},
+	} {
+		// Run twice to go through the pools.
+		for i := 0; i < 2; i++ {
+			compressed := compress(t, comp, []byte(c.data))
+			if smaller := len(compressed) < len(c.data); smaller != c.wantSmaller {
+				t.Errorf("Compress(%d bytes) = %d bytes, want smaller: %v",
+					len(c.data), len(compressed), c.wantSmaller)
+			}
+			r, err := comp.Decompress(bytes.NewReader(compressed))
+			if err != nil {
+				t.Fatalf("Decompress() = %v", err)
+			}
+			got, err := ioutil.ReadAll(r)
+			if err != nil {
+				t.Fatalf("ReadAll() = %v", err)
+			}
+			if string(got) != c.data {
+				t.Errorf("Decompress(Compress(%d bytes)) = %d bytes", len(c.data), len(got))
+			}
+		}
+	}
+}
+
+func TestHandler(t *testing.T) {
+	comp := NewCompressor(Options{Threshold: 100, Level: gzip.BestSpeed})
+	large := strings.Repeat("a", 1000)
+	h := comp.Handler(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		w.Header().Set("ETag", `"tag"`)
+		if r.URL.Path == "/large" {
+			w.WriteHeader(http.StatusCreated)
+			_, _ = w.Write([]byte(large))
+		} else {
+			_, _ = w.Write([]byte("small"))
+		}
+	}))
+	for _, c := range []struct {
+		path           string
+		acceptEncoding string
+		wantEncoding   string
+		wantCode       int
+		wantBody       string
+		wantETag       string
+	}{
+		{"/large", "gzip, deflate", "gzip", http.StatusCreated, large, `W/"tag"`},
+		{"/large", "br;q=1.0, gzip;q=0", "", http.StatusCreated, large, `"tag"`},
+		{"/large", "", "", http.StatusCreated, large, `"tag"`},
+		{"/small", "gzip", "", http.StatusOK, "small", `"tag"`},
+	} {
+		req := httptest.NewRequest(http.MethodGet, c.path, nil)
+		req.Header.Set("Accept-Encoding", c.acceptEncoding)
+		rec := httptest.NewRecorder()
+		h.ServeHTTP(rec, req)
+		if rec.Code != c.wantCode {
+			t.Errorf("%s %s got code %d, want %d", c.path, c.acceptEncoding, rec.Code, c.wantCode)
+		}
+		gotEncoding := rec.Header().Get("Content-Encoding")
+		if gotEncoding != c.wantEncoding {
+			t.Errorf("%s %s got encoding %q, want %q",
+				c.path, c.acceptEncoding, gotEncoding, c.wantEncoding)
+		}
+		if got := rec.Header().Get("ETag"); got != c.wantETag {
+			t.Errorf("%s %s got ETag %s, want %s", c.path, c.acceptEncoding, got, c.wantETag)
+		}
+		body := rec.Body.Bytes()
+		if gotEncoding == "gzip" {
+			r, err := gzip.NewReader(bytes.NewReader(body))
+			if err != nil {
+				t.Fatalf("gzip.NewReader() = %v", err)
+			}
+			if body, err = ioutil.ReadAll(r); err != nil {
+				t.Fatalf("ReadAll() = %v", err)
+			}
+		}
+		if string(body) != c.wantBody {
+			t.Errorf("%s %s got body of %d bytes, want %d",
+				c.path, c.acceptEncoding, len(body), len(c.wantBody))
+		}
+	}
+}
+
+func TestHandlerFlush(t *testing.T) {
+	comp := NewCompressor(Options{Threshold: 100, Level: gzip.BestSpeed})
+	rec := httptest.NewRecorder()
+	h := comp.Handler(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		_, _ = w.Write([]byte("first"))
+		w.(http.Flusher).Flush()
+		// The flushed part can be decoded before the response is done.
+		if !rec.Flushed {
+			t.Error("Flush() did not flush the underlying writer")
+		}
+		zr, err := gzip.NewReader(bytes.NewReader(rec.Body.Bytes()))
+		if err != nil {
+			t.Fatalf("gzip.NewReader() = %v", err)
+		}
+		got := make([]byte, len("first"))
+		if _, err := io.ReadFull(zr, got); err != nil || string(got) != "first" {
+			t.Errorf("flushed body = %q, %v, want %q", got, err, "first")
+		}
+		_, _ = w.Write([]byte(" second"))
+	}))
+	req := httptest.NewRequest(http.MethodGet, "/", nil)
+	req.Header.Set("Accept-Encoding", "gzip")
+	h.ServeHTTP(rec, req)
+	if got := rec.Header().Get("Content-Encoding"); got != "gzip" {
+		t.Errorf("got encoding %q, want gzip", got)
+	}
+	r, err := gzip.NewReader(bytes.NewReader(rec.Body.Bytes()))
+	if err != nil {
+		t.Fatalf("gzip.NewReader() = %v", err)
+	}
+	body, err := ioutil.ReadAll(r)
+	if err != nil {
+		t.Fatalf("ReadAll() = %v", err)
+	}
+	if string(body) != "first second" {
+		t.Errorf("got body %q, want %q", body, "first second")
+	}
+}
+
+func TestHandlerPanic(t *testing.T) {
+	comp := NewCompressor(Options{Threshold: 10, Level: gzip.BestSpeed})
+	h := comp.Handler(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		_, _ = w.Write([]byte(strings.Repeat("a", 100)))
+		panic(http.ErrAbortHandler)
+	}))
+	req := httptest.NewRequest(http.MethodGet, "/", nil)
+	req.Header.Set("Accept-Encoding", "gzip")
+	rec := httptest.NewRecorder()
+	func() {
+		defer func() {
+			if p := recover(); p != http.ErrAbortHandler {
+				t.Errorf("recover() = %v, want %v", p, http.ErrAbortHandler)
+			}
+		}()
+		h.ServeHTTP(rec, req)
+	}()
+	// The body is a truncated gzip stream.
+	r, err := gzip.NewReader(bytes.NewReader(rec.Body.Bytes()))
+	if err != nil {
+		t.Fatalf("gzip.NewReader() = %v", err)
+	}
+	if _, err := ioutil.ReadAll(r); err != io.ErrUnexpectedEOF {
+		t.Errorf("ReadAll() = %v, want %v", err, io.ErrUnexpectedEOF)
+	}
+}
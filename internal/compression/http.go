@@ -0,0 +1,171 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package compression
+
+import (
+	"compress/gzip"
+	"net/http"
+	"strings"
+)
+
+// Handler wraps an HTTP handler to gzip responses that reach the threshold
+// when the client accepts gzip. Smaller responses are sent as is.
+func (c *Compressor) Handler(h http.Handler) http.Handler {
+	return http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		w.Header().Add("Vary", "Accept-Encoding")
+		if !acceptsGzip(r.Header.Get("Accept-Encoding")) {
+			h.ServeHTTP(w, r)
+			return
+		}
+		gw := &responseWriter{ResponseWriter: w, c: c, status: http.StatusOK}
+		defer func() {
+			if p := recover(); p != nil {
+				// Leave the gzip stream unterminated, so the client does not
+				// take an aborted response, e.g. by http.ErrAbortHandler, as
+				// complete.
+				panic(p)
+			}
+			gw.finish()
+		}()
+		h.ServeHTTP(gw, r)
+	})
+}
+
+func acceptsGzip(acceptEncoding string) bool {
+	for _, part := range strings.Split(acceptEncoding, ",") {
+		params := strings.Split(part, ";")
+		if strings.TrimSpace(params[0]) != Name {
+			continue
+		}
+		for _, param := range params[1:] {
+			if q := strings.TrimSpace(param); q == "q=0" || q == "q=0.0" {
+				return false
+			}
+		}
+		return true
+	}
+	return false
+}
+
+// responseWriter buffers the response body until the threshold is reached.
+type responseWriter struct {
+	http.ResponseWriter
+	c      *Compressor
+	status int
+	// Whether the header is sent to the underlying writer.
+	started bool
+	buf     []byte
+	gz      *gzip.Writer
+}
+
+func (w *responseWriter) WriteHeader(code int) {
+	if !w.started {
+		w.status = code
+	}
+}
+
+func (w *responseWriter) Write(p []byte) (int, error) {
+	if w.gz != nil {
+		return w.gz.Write(p)
+	}
+	if w.started {
+		return w.ResponseWriter.Write(p)
+	}
+	if len(w.buf)+len(p) < w.c.opts.Threshold {
+		w.buf = append(w.buf, p...)
+		return len(p), nil
+	}
+	if err := w.start(); err != nil {
+		return 0, err
+	}
+	if w.gz != nil {
+		return w.gz.Write(p)
+	}
+	return w.ResponseWriter.Write(p)
+}
+
+// Flush implements http.Flusher, so streamed responses reach the client as
+// they are written. A response that is flushed before the threshold is
+// reached is compressed, as more of it is coming.
+func (w *responseWriter) Flush() {
+	if !w.started {
+		if len(w.buf) == 0 {
+			return
+		}
+		if err := w.start(); err != nil {
+			return
+		}
+	}
+	if w.gz != nil {
+		if err := w.gz.Flush(); err != nil {
+			return
+		}
+	}
+	if f, ok := w.ResponseWriter.(http.Flusher); ok {
+		f.Flush()
+	}
+}
+
+// start sends the header to the underlying writer, and the buffered body
+// through the gzip writer unless the handler already encoded it.
+func (w *responseWriter) start() error {
+	w.started = true
+	buf := w.buf
+	w.buf = nil
+	header := w.ResponseWriter.Header()
+	if header.Get("Content-Encoding") != "" {
+		// Already encoded by the handler.
+		w.ResponseWriter.WriteHeader(w.status)
+		_, err := w.ResponseWriter.Write(buf)
+		return err
+	}
+	header.Set("Content-Encoding", Name)
+	header.Del("Content-Length")
+	weakenETag(header)
+	w.ResponseWriter.WriteHeader(w.status)
+	w.gz = w.c.writerPool.Get().(*gzip.Writer)
+	w.gz.Reset(w.ResponseWriter)
+	_, err := w.gz.Write(buf)
+	return err
+}
+
+func (w *responseWriter) finish() {
+	if w.gz != nil {
+		_ = w.gz.Close()
+		w.c.writerPool.Put(w.gz)
+		w.gz = nil
+		return
+	}
+	if !w.started {
+		w.started = true
+		if w.status == http.StatusNotModified {
+			// The cached response of the client may be gzipped.
+			weakenETag(w.ResponseWriter.Header())
+		}
+		w.ResponseWriter.WriteHeader(w.status)
+		if len(w.buf) > 0 {
+			_, _ = w.ResponseWriter.Write(w.buf)
+		}
+	}
+}
+
+// weakenETag makes the entity tag weak, since a gzipped body is not byte for
+// byte the body that the strong tag validates. If-None-Match uses the weak
+// comparison, so the tag still matches the uncompressed response.
+func weakenETag(header http.Header) {
+	if etag := header.Get("ETag"); etag != "" && !strings.HasPrefix(etag, "W/") {
+		header.Set("ETag", "W/"+etag)
+	}
+}
@@ -0,0 +1,375 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Package diskcache is a log-structured cache of raw Bigtable cells on local
+// disk.
+//
+// Entries are appended to segment files and located with an in-memory index.
+// When the cache is full, the oldest segment is deleted, so eviction is first
+// in first out. The index is rebuilt from the segments when the cache is
+// opened again for the same data.
+package diskcache
+
+import (
+	"bufio"
+	"encoding/binary"
+	"errors"
+	"fmt"
+	"hash/crc32"
+	"io"
+	"io/ioutil"
+	"log"
+	"os"
+	"path/filepath"
+	"sort"
+	"strings"
+	"sync"
+)
+
+const (
+	identityFile  = "IDENTITY"
+	segmentSuffix = ".seg"
+	// crc32, key length and value length.
+	headerSize = 12
+	// Value length of a row that does not exist.
+	nilValue = ^uint32(0)
+	// Number of pending writes. Writes are dropped when the queue is full.
+	writeQueueSize = 4096
+)
+
+// Cache is a size bounded disk cache.
+type Cache struct {
+	dir          string
+	maxBytes     int64
+	segmentBytes int64
+
+	mu       sync.RWMutex
+	index    map[string]location
+	segments []*segment
+	bytes    int64
+
+	writes chan interface{}
+	done   chan struct{}
+}
+
+type location struct {
+	seg    *segment
+	offset int64
+	size   int64
+}
+
+type segment struct {
+	id   int
+	file *os.File
+	size int64
+	keys []string
+}
+
+type record struct {
+	key   string
+	value []byte
+}
+
+// Open opens the cache in a directory, holding up to about maxBytes of data.
+//
+// The identity names the data being cached, like the base Bigtable table name.
+// When it differs from the identity of the existing cache, the cache is
+// cleared.
+func Open(dir, identity string, maxBytes int64) (*Cache, error) {
+	if err := os.MkdirAll(dir, 0755); err != nil {
+		return nil, err
+	}
+	c := &Cache{
+		dir:          dir,
+		maxBytes:     maxBytes,
+		segmentBytes: maxBytes / 8,
+		index:        map[string]location{},
+		writes:       make(chan interface{}, writeQueueSize),
+		done:         make(chan struct{}),
+	}
+	if c.segmentBytes < 1<<20 {
+		c.segmentBytes = 1 << 20
+	}
+	current, err := ioutil.ReadFile(filepath.Join(dir, identityFile))
+	if err != nil && !os.IsNotExist(err) {
+		return nil, err
+	}
+	if string(current) != identity {
+		log.Printf("Clearing disk cache %s for %s", dir, identity)
+		if err := c.removeSegments(); err != nil {
+			return nil, err
+		}
+		if err := ioutil.WriteFile(
+			filepath.Join(dir, identityFile), []byte(identity), 0644); err != nil {
+			return nil, err
+		}
+	} else if err := c.load(); err != nil {
+		return nil, err
+	}
+	if len(c.segments) == 0 {
+		if err := c.rotate(); err != nil {
+			return nil, err
+		}
+	}
+	go c.writeLoop()
+	return c, nil
+}
+
+func (c *Cache) segmentPath(id int) string {
+	return filepath.Join(c.dir, fmt.Sprintf("%08d%s", id, segmentSuffix))
+}
+
+func (c *Cache) segmentIDs() ([]int, error) {
+	files, err := ioutil.ReadDir(c.dir)
+	if err != nil {
+		return nil, err
+	}
+	var ids []int
+	for _, f := range files {
+		var id int
+		if !strings.HasSuffix(f.Name(), segmentSuffix) {
+			continue
+		}
+		if _, err := fmt.Sscanf(f.Name(), "%d"+segmentSuffix, &id); err == nil {
+			ids = append(ids, id)
+		}
+	}
+	sort.Ints(ids)
+	return ids, nil
+}
+
+func (c *Cache) removeSegments() error {
+	ids, err := c.segmentIDs()
+	if err != nil {
+		return err
+	}
+	for _, id := range ids {
+		if err := os.Remove(c.segmentPath(id)); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+// load rebuilds the index from the segments. A segment is truncated at the
+// first corrupted record, which is usually a partial write.
+func (c *Cache) load() error {
+	ids, err := c.segmentIDs()
+	if err != nil {
+		return err
+	}
+	for _, id := range ids {
+		file, err := os.OpenFile(c.segmentPath(id), os.O_RDWR, 0644)
+		if err != nil {
+			return err
+		}
+		seg := &segment{id: id, file: file}
+		r := bufio.NewReader(file)
+		for {
+			rec, size, err := readRecord(r)
+			if err != nil {
+				if err != io.EOF {
+					log.Printf("Truncating disk cache segment %d at %d: %v", id, seg.size, err)
+				}
+				break
+			}
+			c.addToIndex(seg, rec.key, seg.size, size)
+			seg.size += size
+		}
+		if err := file.Truncate(seg.size); err != nil {
+			return err
+		}
+		if _, err := file.Seek(seg.size, io.SeekStart); err != nil {
+			return err
+		}
+		c.segments = append(c.segments, seg)
+		c.bytes += seg.size
+	}
+	c.evict()
+	return nil
+}
+
+func (c *Cache) addToIndex(seg *segment, key string, offset, size int64) {
+	c.index[key] = location{seg, offset, size}
+	seg.keys = append(seg.keys, key)
+}
+
+// rotate starts a new segment. Must be called with the lock held, or before
+// the cache is used.
+func (c *Cache) rotate() error {
+	id := 0
+	if len(c.segments) > 0 {
+		id = c.segments[len(c.segments)-1].id + 1
+	}
+	file, err := os.OpenFile(
+		c.segmentPath(id), os.O_CREATE|os.O_RDWR|os.O_TRUNC, 0644)
+	if err != nil {
+		return err
+	}
+	c.segments = append(c.segments, &segment{id: id, file: file})
+	return nil
+}
+
+// evict deletes the oldest segments until the cache fits. Must be called with
+// the lock held, or before the cache is used.
+func (c *Cache) evict() {
+	for c.bytes > c.maxBytes && len(c.segments) > 1 {
+		seg := c.segments[0]
+		c.segments = c.segments[1:]
+		for _, key := range seg.keys {
+			if loc, ok := c.index[key]; ok && loc.seg == seg {
+				delete(c.index, key)
+			}
+		}
+		c.bytes -= seg.size
+		_ = seg.file.Close()
+		_ = os.Remove(c.segmentPath(seg.id))
+	}
+}
+
+func encodeRecord(key string, value []byte) []byte {
+	valueLen := uint32(len(value))
+	if value == nil {
+		valueLen = nilValue
+	}
+	buf := make([]byte, headerSize+len(key)+len(value))
+	binary.LittleEndian.PutUint32(buf[4:], uint32(len(key)))
+	binary.LittleEndian.PutUint32(buf[8:], valueLen)
+	copy(buf[headerSize:], key)
+	copy(buf[headerSize+len(key):], value)
+	binary.LittleEndian.PutUint32(buf, crc32.ChecksumIEEE(buf[4:]))
+	return buf
+}
+
+func readRecord(r io.Reader) (*record, int64, error) {
+	header := make([]byte, headerSize)
+	if _, err := io.ReadFull(r, header); err != nil {
+		return nil, 0, err
+	}
+	keyLen := binary.LittleEndian.Uint32(header[4:])
+	valueLen := binary.LittleEndian.Uint32(header[8:])
+	dataLen := keyLen
+	if valueLen != nilValue {
+		dataLen += valueLen
+	}
+	if dataLen > 1<<30 {
+		return nil, 0, errors.New("invalid record length")
+	}
+	data := make([]byte, dataLen)
+	if _, err := io.ReadFull(r, data); err != nil {
+		return nil, 0, err
+	}
+	crc := crc32.Update(crc32.ChecksumIEEE(header[4:]), crc32.IEEETable, data)
+	if crc != binary.LittleEndian.Uint32(header) {
+		return nil, 0, errors.New("checksum mismatch")
+	}
+	rec := &record{key: string(data[:keyLen])}
+	if valueLen != nilValue {
+		rec.value = data[keyLen:]
+	}
+	return rec, int64(headerSize + dataLen), nil
+}
+
+// Get returns the cached value of a key and whether it is in the cache.
+func (c *Cache) Get(key string) ([]byte, bool) {
+	c.mu.RLock()
+	loc, ok := c.index[key]
+	c.mu.RUnlock()
+	if !ok {
+		return nil, false
+	}
+	rec, _, err := readRecord(
+		io.NewSectionReader(loc.seg.file, loc.offset, loc.size))
+	if err != nil || rec.key != key {
+		// The segment may be evicted while reading.
+		return nil, false
+	}
+	return rec.value, true
+}
+
+// Add queues a value to be written to the cache, unless the key is already in
+// the cache. It is dropped when there are too many pending writes.
+func (c *Cache) Add(key string, value []byte) {
+	c.mu.RLock()
+	_, ok := c.index[key]
+	c.mu.RUnlock()
+	if ok {
+		return
+	}
+	select {
+	case c.writes <- record{key, value}:
+	default:
+	}
+}
+
+// Flush waits for the pending writes to complete.
+func (c *Cache) Flush() {
+	done := make(chan struct{})
+	c.writes <- done
+	<-done
+}
+
+// Close writes the pending writes and closes the cache.
+func (c *Cache) Close() error {
+	close(c.writes)
+	<-c.done
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	for _, seg := range c.segments {
+		if err := seg.file.Close(); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+func (c *Cache) writeLoop() {
+	defer close(c.done)
+	for w := range c.writes {
+		switch v := w.(type) {
+		case record:
+			if err := c.write(v); err != nil {
+				log.Printf("Failed to write disk cache: %v", err)
+			}
+		case chan struct{}:
+			close(v)
+		}
+	}
+}
+
+// write appends a record to the last segment. Only the write loop changes the
+// segments, so the disk write does not need the lock.
+func (c *Cache) write(rec record) error {
+	buf := encodeRecord(rec.key, rec.value)
+	seg := c.segments[len(c.segments)-1]
+	if seg.size > 0 && seg.size+int64(len(buf)) > c.segmentBytes {
+		c.mu.Lock()
+		err := c.rotate()
+		c.mu.Unlock()
+		if err != nil {
+			return err
+		}
+		seg = c.segments[len(c.segments)-1]
+	}
+	if _, err := seg.file.WriteAt(buf, seg.size); err != nil {
+		return err
+	}
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	c.addToIndex(seg, rec.key, seg.size, int64(len(buf)))
+	seg.size += int64(len(buf))
+	c.bytes += int64(len(buf))
+	c.evict()
+	return nil
+}
@@ -0,0 +1,90 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package diskcache
+
+import (
+	"bytes"
+	"fmt"
+	"io/ioutil"
+	"os"
+	"testing"
+)
+
+func TestCache(t *testing.T) {
+	dir, err := ioutil.TempDir("", "diskcache")
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer os.RemoveAll(dir)
+
+	c, err := Open(dir, "table1", 8<<20)
+	if err != nil {
+		t.Fatalf("Open() = %v", err)
+	}
+	c.Add("k1", []byte("v1"))
+	c.Add("k2", nil)
+	c.Add("k3", []byte{})
+	c.Flush()
+	check := func(c *Cache, key string, want []byte, wantOk bool) {
+		t.Helper()
+		got, ok := c.Get(key)
+		if ok != wantOk || !bytes.Equal(got, want) || (ok && (got == nil) != (want == nil)) {
+			t.Errorf("Get(%s) = %q, %v, want %q, %v", key, got, ok, want, wantOk)
+		}
+	}
+	check(c, "k1", []byte("v1"), true)
+	check(c, "k2", nil, true)
+	check(c, "k3", []byte{}, true)
+	check(c, "k4", nil, false)
+	if err := c.Close(); err != nil {
+		t.Fatalf("Close() = %v", err)
+	}
+
+	// The entries are kept for the same identity.
+	c, err = Open(dir, "table1", 8<<20)
+	if err != nil {
+		t.Fatalf("Open() = %v", err)
+	}
+	check(c, "k1", []byte("v1"), true)
+	check(c, "k2", nil, true)
+	if err := c.Close(); err != nil {
+		t.Fatalf("Close() = %v", err)
+	}
+
+	// The cache is cleared for another identity.
+	c, err = Open(dir, "table2", 8<<20)
+	if err != nil {
+		t.Fatalf("Open() = %v", err)
+	}
+	check(c, "k1", nil, false)
+
+	// The oldest entries are evicted when the cache is full.
+	value := make([]byte, 64<<10)
+	for i := 0; i < 256; i++ {
+		c.Add(fmt.Sprintf("x%d", i), value)
+		if i%16 == 0 {
+			c.Flush()
+		}
+	}
+	c.Flush()
+	check(c, "x0", nil, false)
+	check(c, "x255", value, true)
+	if c.bytes > c.maxBytes {
+		t.Errorf("Cache has %d bytes, more than %d", c.bytes, c.maxBytes)
+	}
+	if err := c.Close(); err != nil {
+		t.Fatalf("Close() = %v", err)
+	}
+}
@@ -0,0 +1,203 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package gateway
+
+import (
+	"bufio"
+	"context"
+	"log"
+	"net/http"
+	"strconv"
+	"strings"
+
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"google.golang.org/grpc"
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/status"
+)
+
+// Path of the CSV download of stat var observations. It takes the same
+// parameters as ExportStatRequest.
+const csvPath = "/stat/csv"
+
+var csvHeader = []string{
+	"place", "stat_var", "date", "value", "import_name", "measurement_method",
+	"observation_period", "unit", "scaling_factor", "provenance_url",
+}
+
+// exportStream is an in-process Mixer_ExportStatServer. The server only uses
+// Context and Send.
+type exportStream struct {
+	grpc.ServerStream
+	ctx  context.Context
+	send func(*pb.ExportStatBatch) error
+}
+
+func (s *exportStream) Context() context.Context {
+	return s.ctx
+}
+
+func (s *exportStream) Send(batch *pb.ExportStatBatch) error {
+	return s.send(batch)
+}
+
+// serveCSV streams the observations of ExportStat as CSV rows. Each batch is
+// written out as it is received, through a pooled buffer, so the memory does
+// not grow with the size of the table.
+func (g *Gateway) serveCSV(w http.ResponseWriter, r *http.Request) {
+	if r.Method != http.MethodGet && r.Method != http.MethodPost {
+		writeError(w, status.Errorf(codes.NotFound, "Method does not exist: %s", r.URL.Path))
+		return
+	}
+	req := &pb.ExportStatRequest{}
+	if err := parseRequestInto(r, req.ProtoReflect(), r.Method == http.MethodPost); err != nil {
+		writeError(w, err)
+		return
+	}
+	cw := newCSVWriter(w, req.GetStatVars())
+	defer cw.release()
+	err := g.srv.ExportStat(req, &exportStream{ctx: r.Context(), send: cw.writeBatch})
+	if err == nil {
+		err = cw.finish()
+	}
+	if err != nil {
+		if !cw.started {
+			writeError(w, err)
+			return
+		}
+		// The status is already sent. Abort the response, so the client does not
+		// take a truncated file as complete.
+		log.Printf("Failed to stream CSV: %v", err)
+		panic(http.ErrAbortHandler)
+	}
+}
+
+// csvWriter writes the export batches as CSV rows, and decodes their
+// dictionaries.
+type csvWriter struct {
+	w        http.ResponseWriter
+	bw       *bufio.Writer
+	statVars []string
+	started  bool
+	places   []string
+	dates    []string
+	sources  []*pb.StatMetadata
+	scratch  []byte
+}
+
+func newCSVWriter(w http.ResponseWriter, statVars []string) *csvWriter {
+	bw := writerPool.Get().(*bufio.Writer)
+	bw.Reset(w)
+	return &csvWriter{w: w, bw: bw, statVars: statVars}
+}
+
+func (cw *csvWriter) release() {
+	cw.bw.Reset(nil)
+	writerPool.Put(cw.bw)
+}
+
+// start writes the response headers and the CSV header row.
+func (cw *csvWriter) start() {
+	if cw.started {
+		return
+	}
+	cw.started = true
+	cw.w.Header().Set("Content-Type", "text/csv; charset=utf-8")
+	cw.w.Header().Set("Content-Disposition", `attachment; filename="stat.csv"`)
+	cw.w.WriteHeader(http.StatusOK)
+	for i, field := range csvHeader {
+		if i > 0 {
+			_ = cw.bw.WriteByte(',')
+		}
+		_, _ = cw.bw.WriteString(field)
+	}
+	_, _ = cw.bw.WriteString("\r\n")
+}
+
+func (cw *csvWriter) writeBatch(batch *pb.ExportStatBatch) error {
+	cw.start()
+	cw.places = append(cw.places, batch.GetPlaceDictionary()...)
+	cw.dates = append(cw.dates, batch.GetDateDictionary()...)
+	cw.sources = append(cw.sources, batch.GetSourceDictionary()...)
+	for i, value := range batch.GetValue() {
+		statVar := int(batch.StatVar[i])
+		place := int(batch.Place[i])
+		date := int(batch.Date[i])
+		source := int(batch.Source[i])
+		if statVar >= len(cw.statVars) || place >= len(cw.places) ||
+			date >= len(cw.dates) || source >= len(cw.sources) {
+			return status.Errorf(codes.Internal, "Invalid export batch")
+		}
+		meta := cw.sources[source]
+		writeCSVField(cw.bw, cw.places[place])
+		_ = cw.bw.WriteByte(',')
+		writeCSVField(cw.bw, cw.statVars[statVar])
+		_ = cw.bw.WriteByte(',')
+		writeCSVField(cw.bw, cw.dates[date])
+		_ = cw.bw.WriteByte(',')
+		cw.scratch = strconv.AppendFloat(cw.scratch[:0], value, 'f', -1, 64)
+		_, _ = cw.bw.Write(cw.scratch)
+		for _, field := range []string{
+			meta.GetImportName(),
+			meta.GetMeasurementMethod(),
+			meta.GetObservationPeriod(),
+			meta.GetUnit(),
+			meta.GetScalingFactor(),
+			meta.GetProvenanceUrl(),
+		} {
+			_ = cw.bw.WriteByte(',')
+			writeCSVField(cw.bw, field)
+		}
+		_, _ = cw.bw.WriteString("\r\n")
+	}
+	return cw.flush()
+}
+
+// finish writes the header row of an empty export, and flushes the buffer.
+func (cw *csvWriter) finish() error {
+	cw.start()
+	return cw.flush()
+}
+
+// flush sends the buffered rows to the client.
+func (cw *csvWriter) flush() error {
+	if err := cw.bw.Flush(); err != nil {
+		return err
+	}
+	if f, ok := cw.w.(http.Flusher); ok {
+		f.Flush()
+	}
+	return nil
+}
+
+// writeCSVField writes a CSV field, quoted when needed as in RFC 4180.
+func writeCSVField(w *bufio.Writer, s string) {
+	if !strings.ContainsAny(s, ",\"\r\n") {
+		_, _ = w.WriteString(s)
+		return
+	}
+	_ = w.WriteByte('"')
+	for {
+		i := strings.IndexByte(s, '"')
+		if i < 0 {
+			break
+		}
+		_, _ = w.WriteString(s[:i+1])
+		_ = w.WriteByte('"')
+		s = s[i+1:]
+	}
+	_, _ = w.WriteString(s)
+	_ = w.WriteByte('"')
+}
@@ -0,0 +1,97 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package gateway
+
+import (
+	"net/http"
+	"net/http/httptest"
+	"testing"
+
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/google/go-cmp/cmp"
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/status"
+)
+
+func (s *fakeServer) ExportStat(
+	in *pb.ExportStatRequest, stream pb.Mixer_ExportStatServer) error {
+	if len(in.GetStatVars()) == 0 {
+		return status.Errorf(codes.InvalidArgument, "Missing required argument: stat_vars")
+	}
+	for _, batch := range []*pb.ExportStatBatch{
+		{
+			PlaceDictionary: []string{"geoId/06"},
+			DateDictionary:  []string{"2018", "2019"},
+			SourceDictionary: []*pb.StatMetadata{
+				{ImportName: "CensusPEP", MeasurementMethod: "CensusPEPSurvey"},
+			},
+			StatVar: []int32{0, 0},
+			Place:   []int32{0, 0},
+			Date:    []int32{0, 1},
+			Value:   []float64{200, 300.5},
+			Source:  []int32{0, 0},
+		},
+		{
+			PlaceDictionary: []string{"place, \"quoted\""},
+			StatVar:         []int32{1},
+			Place:           []int32{1},
+			Date:            []int32{1},
+			Value:           []float64{1e9},
+			Source:          []int32{0},
+		},
+	} {
+		if err := stream.Send(batch); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+func TestGatewayCSV(t *testing.T) {
+	g, err := New(&fakeServer{})
+	if err != nil {
+		t.Fatalf("New() = %v", err)
+	}
+	for _, c := range []struct {
+		target   string
+		wantCode int
+		wantBody string
+	}{
+		{
+			"/stat/csv?stat_vars=Count_Person&stat_vars=Median_Age_Person&places=geoId/06",
+			http.StatusOK,
+			"place,stat_var,date,value,import_name,measurement_method," +
+				"observation_period,unit,scaling_factor,provenance_url\r\n" +
+				"geoId/06,Count_Person,2018,200,CensusPEP,CensusPEPSurvey,,,,\r\n" +
+				"geoId/06,Count_Person,2019,300.5,CensusPEP,CensusPEPSurvey,,,,\r\n" +
+				"\"place, \"\"quoted\"\"\",Median_Age_Person,2019,1000000000," +
+				"CensusPEP,CensusPEPSurvey,,,,\r\n",
+		},
+		{
+			"/stat/csv?places=geoId/06",
+			http.StatusBadRequest,
+			`{"code":3,"message":"Missing required argument: stat_vars"}`,
+		},
+	} {
+		rec := httptest.NewRecorder()
+		g.ServeHTTP(rec, httptest.NewRequest(http.MethodGet, c.target, nil))
+		if rec.Code != c.wantCode {
+			t.Errorf("GET %s code = %d, want %d", c.target, rec.Code, c.wantCode)
+		}
+		if diff := cmp.Diff(c.wantBody, rec.Body.String()); diff != "" {
+			t.Errorf("GET %s body diff %v", c.target, diff)
+		}
+	}
+}
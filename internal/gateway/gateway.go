@@ -0,0 +1,492 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Package gateway serves the Mixer API as HTTP/JSON in process.
+//
+// The routes are read from the google.api.http annotations in mixer.proto, so
+// the gateway exposes the same REST surface as the ESP transcoding proxy.
+package gateway
+
+import (
+	"bufio"
+	"context"
+	"encoding/base64"
+	"encoding/json"
+	"fmt"
+	"io/ioutil"
+	"net/http"
+	"reflect"
+	"strconv"
+	"strings"
+	"sync"
+	"unicode/utf8"
+
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/datacommonsorg/mixer/internal/util"
+	"google.golang.org/genproto/googleapis/api/annotations"
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/status"
+	"google.golang.org/protobuf/encoding/protojson"
+	"google.golang.org/protobuf/proto"
+	"google.golang.org/protobuf/reflect/protoreflect"
+	"google.golang.org/protobuf/reflect/protoregistry"
+)
+
+const (
+	// Field name of the responses that hold a serialized JSON string.
+	payloadField = "payload"
+	// Query parameter to embed the payload as JSON instead of a JSON string.
+	payloadFormatParam = "payload_format"
+	payloadFormatRaw   = "raw"
+	// Maximum size of a request body.
+	maxBodySize = 32 << 20
+)
+
+// Validator is implemented by servers that support conditional requests.
+type Validator interface {
+	// ETag returns a strong validator of the response to a request, or "" when
+	// the response can not be cached.
+	ETag(fullMethod string, req proto.Message) string
+}
+
+// route is an HTTP binding of a Mixer RPC.
+type route struct {
+	method protoreflect.MethodDescriptor
+	// Full RPC name, like "/datacommons.Mixer/GetStats".
+	fullMethod string
+	// The server method to call.
+	handler reflect.Value
+	// The request message type.
+	reqType protoreflect.MessageType
+	// Whether the request body maps to the request message.
+	hasBody bool
+	// Set when the response only has a JSON string payload field.
+	payload protoreflect.FieldDescriptor
+}
+
+// Gateway is an http.Handler that transcodes HTTP/JSON requests to Mixer RPCs.
+type Gateway struct {
+	srv       pb.MixerServer
+	routes    map[string]*route
+	validator Validator
+}
+
+var writerPool = sync.Pool{
+	New: func() interface{} {
+		return bufio.NewWriterSize(nil, 32<<10)
+	},
+}
+
+// New creates a Gateway that calls the given Mixer server.
+func New(srv pb.MixerServer) (*Gateway, error) {
+	sd := pb.File_mixer_proto.Services().ByName("Mixer")
+	if sd == nil {
+		return nil, fmt.Errorf("mixer service is not found in mixer.proto")
+	}
+	srvValue := reflect.ValueOf(srv)
+	g := &Gateway{srv: srv, routes: map[string]*route{}}
+	if v, ok := srv.(Validator); ok {
+		g.validator = v
+	}
+	methods := sd.Methods()
+	for i := 0; i < methods.Len(); i++ {
+		md := methods.Get(i)
+		if md.IsStreamingClient() || md.IsStreamingServer() {
+			continue
+		}
+		rule, ok := proto.GetExtension(md.Options(), annotations.E_Http).(*annotations.HttpRule)
+		if !ok || rule == nil {
+			continue
+		}
+		handler := srvValue.MethodByName(string(md.Name()))
+		if !handler.IsValid() {
+			return nil, fmt.Errorf("server does not implement %s", md.Name())
+		}
+		reqType, err := protoregistry.GlobalTypes.FindMessageByName(md.Input().FullName())
+		if err != nil {
+			return nil, err
+		}
+		var payload protoreflect.FieldDescriptor
+		outFields := md.Output().Fields()
+		if outFields.Len() == 1 {
+			fd := outFields.Get(0)
+			if fd.Name() == payloadField && fd.Kind() == protoreflect.StringKind &&
+				fd.Cardinality() != protoreflect.Repeated {
+				payload = fd
+			}
+		}
+		for _, r := range append([]*annotations.HttpRule{rule}, rule.GetAdditionalBindings()...) {
+			var verb, path string
+			switch p := r.GetPattern().(type) {
+			case *annotations.HttpRule_Get:
+				verb, path = http.MethodGet, p.Get
+			case *annotations.HttpRule_Post:
+				verb, path = http.MethodPost, p.Post
+			case *annotations.HttpRule_Put:
+				verb, path = http.MethodPut, p.Put
+			case *annotations.HttpRule_Delete:
+				verb, path = http.MethodDelete, p.Delete
+			case *annotations.HttpRule_Patch:
+				verb, path = http.MethodPatch, p.Patch
+			default:
+				continue
+			}
+			// Mixer routes are literal paths, path templates are not supported.
+			if strings.Contains(path, "{") {
+				return nil, fmt.Errorf("unsupported path template %s", path)
+			}
+			g.routes[verb+" "+path] = &route{
+				method:     md,
+				fullMethod: fmt.Sprintf("/%s/%s", sd.FullName(), md.Name()),
+				handler:    handler,
+				reqType:    reqType,
+				hasBody:    r.GetBody() == "*",
+				payload:    payload,
+			}
+		}
+	}
+	return g, nil
+}
+
+// ServeHTTP implements http.Handler.
+func (g *Gateway) ServeHTTP(w http.ResponseWriter, r *http.Request) {
+	// Same as the "basic" CORS preset of ESP.
+	w.Header().Set("Access-Control-Allow-Origin", "*")
+	if r.Method == http.MethodOptions {
+		w.Header().Set("Access-Control-Allow-Methods", "GET, POST, PUT, PATCH, DELETE, OPTIONS")
+		w.Header().Set("Access-Control-Allow-Headers",
+			"DNT,User-Agent,X-Requested-With,If-Modified-Since,If-None-Match,"+
+				"Cache-Control,Content-Type,Range,Authorization")
+		w.Header().Set("Access-Control-Max-Age", "1728000")
+		w.WriteHeader(http.StatusNoContent)
+		return
+	}
+	// Larger bodies fail to read instead of being truncated, and the connection
+	// is closed, so the rest of the body is not read.
+	r.Body = http.MaxBytesReader(w, r.Body, maxBodySize)
+	if r.URL.Path == csvPath {
+		g.serveCSV(w, r)
+		return
+	}
+	rt, ok := g.routes[r.Method+" "+r.URL.Path]
+	if !ok {
+		writeError(w, status.Errorf(codes.NotFound, "Method does not exist: %s", r.URL.Path))
+		return
+	}
+	req, err := rt.parseRequest(r)
+	if err != nil {
+		writeError(w, err)
+		return
+	}
+	raw := r.URL.Query().Get(payloadFormatParam) == payloadFormatRaw
+	var etag string
+	if g.validator != nil {
+		etag = g.validator.ETag(rt.fullMethod, req)
+		// The raw payload is a different representation of the response.
+		if raw && etag != "" {
+			etag = strings.TrimSuffix(etag, `"`) + "-" + payloadFormatRaw + `"`
+		}
+	}
+	if ifNoneMatch := r.Header.Get("If-None-Match"); etag != "" && ifNoneMatch != "" &&
+		util.ETagMatch(ifNoneMatch, etag) {
+		w.Header().Set("ETag", etag)
+		w.Header().Set("Cache-Control", util.CacheControl)
+		w.WriteHeader(http.StatusNotModified)
+		return
+	}
+	ctx, isStale := util.WithStaleFlag(r.Context())
+	resp, err := rt.call(ctx, req)
+	if err != nil {
+		writeError(w, err)
+		return
+	}
+	// The validator headers are only sent with successful responses.
+	if isStale() {
+		w.Header().Set("Cache-Control", util.StaleCacheControl)
+		w.Header().Set(util.StaleHeader, "true")
+	} else if etag != "" {
+		w.Header().Set("ETag", etag)
+		w.Header().Set("Cache-Control", util.CacheControl)
+	}
+	if err := rt.writeResponse(w, resp, raw); err != nil {
+		writeError(w, err)
+	}
+}
+
+func (rt *route) call(ctx context.Context, req proto.Message) (proto.Message, error) {
+	out := rt.handler.Call([]reflect.Value{reflect.ValueOf(ctx), reflect.ValueOf(req)})
+	if err, _ := out[1].Interface().(error); err != nil {
+		return nil, err
+	}
+	resp, _ := out[0].Interface().(proto.Message)
+	if resp == nil {
+		return nil, status.Errorf(codes.Internal, "%s returned nil response", rt.method.Name())
+	}
+	return resp, nil
+}
+
+// parseRequest populates the request message from the body and query
+// parameters.
+func (rt *route) parseRequest(r *http.Request) (proto.Message, error) {
+	req := rt.reqType.New()
+	if err := parseRequestInto(r, req, rt.hasBody); err != nil {
+		return nil, err
+	}
+	return req.Interface(), nil
+}
+
+// parseRequestInto populates req from the body, when hasBody is set, and the
+// query parameters.
+func parseRequestInto(r *http.Request, req protoreflect.Message, hasBody bool) error {
+	if hasBody {
+		body, err := ioutil.ReadAll(r.Body)
+		if err != nil && len(body) >= maxBodySize {
+			return status.Errorf(codes.InvalidArgument,
+				"Request body is larger than %d bytes", maxBodySize)
+		}
+		if err != nil {
+			return status.Errorf(codes.InvalidArgument, "Failed to read body: %v", err)
+		}
+		if len(body) > 0 {
+			err = protojson.UnmarshalOptions{DiscardUnknown: true}.Unmarshal(
+				body, req.Interface())
+			if err != nil {
+				return status.Errorf(codes.InvalidArgument, "Invalid JSON body: %v", err)
+			}
+		}
+	}
+	for key, values := range r.URL.Query() {
+		if key == payloadFormatParam {
+			continue
+		}
+		if err := setQueryParam(req, key, values); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+// setQueryParam sets a (possibly nested) request field from a query parameter.
+// The parameter can use either the proto field name or the JSON name, with
+// "." to reach into message fields. Unknown parameters are ignored.
+func setQueryParam(m protoreflect.Message, key string, values []string) error {
+	parts := strings.Split(key, ".")
+	for i, part := range parts {
+		fields := m.Descriptor().Fields()
+		fd := fields.ByName(protoreflect.Name(part))
+		if fd == nil {
+			fd = fields.ByJSONName(part)
+		}
+		if fd == nil {
+			return nil
+		}
+		if i < len(parts)-1 {
+			if fd.Kind() != protoreflect.MessageKind || fd.IsList() || fd.IsMap() {
+				return status.Errorf(codes.InvalidArgument, "Invalid query parameter %s", key)
+			}
+			m = m.Mutable(fd).Message()
+			continue
+		}
+		if fd.IsMap() || fd.Kind() == protoreflect.MessageKind ||
+			fd.Kind() == protoreflect.GroupKind {
+			return status.Errorf(codes.InvalidArgument, "Invalid query parameter %s", key)
+		}
+		if fd.IsList() {
+			list := m.Mutable(fd).List()
+			for _, value := range values {
+				v, err := parseScalar(fd, value)
+				if err != nil {
+					return status.Errorf(codes.InvalidArgument, "Invalid value for %s: %v", key, err)
+				}
+				list.Append(v)
+			}
+			return nil
+		}
+		v, err := parseScalar(fd, values[len(values)-1])
+		if err != nil {
+			return status.Errorf(codes.InvalidArgument, "Invalid value for %s: %v", key, err)
+		}
+		m.Set(fd, v)
+	}
+	return nil
+}
+
+func parseScalar(fd protoreflect.FieldDescriptor, s string) (protoreflect.Value, error) {
+	switch fd.Kind() {
+	case protoreflect.StringKind:
+		return protoreflect.ValueOfString(s), nil
+	case protoreflect.BoolKind:
+		v, err := strconv.ParseBool(s)
+		return protoreflect.ValueOfBool(v), err
+	case protoreflect.Int32Kind, protoreflect.Sint32Kind, protoreflect.Sfixed32Kind:
+		v, err := strconv.ParseInt(s, 10, 32)
+		return protoreflect.ValueOfInt32(int32(v)), err
+	case protoreflect.Int64Kind, protoreflect.Sint64Kind, protoreflect.Sfixed64Kind:
+		v, err := strconv.ParseInt(s, 10, 64)
+		return protoreflect.ValueOfInt64(v), err
+	case protoreflect.Uint32Kind, protoreflect.Fixed32Kind:
+		v, err := strconv.ParseUint(s, 10, 32)
+		return protoreflect.ValueOfUint32(uint32(v)), err
+	case protoreflect.Uint64Kind, protoreflect.Fixed64Kind:
+		v, err := strconv.ParseUint(s, 10, 64)
+		return protoreflect.ValueOfUint64(v), err
+	case protoreflect.FloatKind:
+		v, err := strconv.ParseFloat(s, 32)
+		return protoreflect.ValueOfFloat32(float32(v)), err
+	case protoreflect.DoubleKind:
+		v, err := strconv.ParseFloat(s, 64)
+		return protoreflect.ValueOfFloat64(v), err
+	case protoreflect.BytesKind:
+		v, err := base64.StdEncoding.DecodeString(s)
+		return protoreflect.ValueOfBytes(v), err
+	case protoreflect.EnumKind:
+		if ev := fd.Enum().Values().ByName(protoreflect.Name(s)); ev != nil {
+			return protoreflect.ValueOfEnum(ev.Number()), nil
+		}
+		v, err := strconv.ParseInt(s, 10, 32)
+		return protoreflect.ValueOfEnum(protoreflect.EnumNumber(v)), err
+	}
+	return protoreflect.Value{}, fmt.Errorf("unsupported field kind %s", fd.Kind())
+}
+
+// writeResponse writes the JSON response.
+//
+// Responses with a single JSON string payload skip protojson: the payload is
+// escaped straight into the output, or embedded as is when raw is set.
+func (rt *route) writeResponse(w http.ResponseWriter, resp proto.Message, raw bool) error {
+	w.Header().Set("Content-Type", "application/json")
+	if rt.payload == nil {
+		jsonRaw, err := protojson.Marshal(resp)
+		if err != nil {
+			return err
+		}
+		_, err = w.Write(jsonRaw)
+		return err
+	}
+	payload := resp.ProtoReflect().Get(rt.payload).String()
+	bw := writerPool.Get().(*bufio.Writer)
+	bw.Reset(w)
+	defer func() {
+		bw.Reset(nil)
+		writerPool.Put(bw)
+	}()
+	_, _ = bw.WriteString(`{"payload":`)
+	if raw && json.Valid([]byte(payload)) {
+		_, _ = bw.WriteString(payload)
+	} else {
+		writeJSONString(bw, payload)
+	}
+	_ = bw.WriteByte('}')
+	return bw.Flush()
+}
+
+const hexDigits = "0123456789abcdef"
+
+// writeJSONString writes s as a quoted JSON string.
+func writeJSONString(w *bufio.Writer, s string) {
+	_ = w.WriteByte('"')
+	start := 0
+	for i := 0; i < len(s); {
+		b := s[i]
+		if b < utf8.RuneSelf {
+			if b >= 0x20 && b != '"' && b != '\\' {
+				i++
+				continue
+			}
+			_, _ = w.WriteString(s[start:i])
+			switch b {
+			case '"', '\\':
+				_ = w.WriteByte('\\')
+				_ = w.WriteByte(b)
+			case '\n':
+				_, _ = w.WriteString(`\n`)
+			case '\r':
+				_, _ = w.WriteString(`\r`)
+			case '\t':
+				_, _ = w.WriteString(`\t`)
+			default:
+				_, _ = w.WriteString(`\u00`)
+				_ = w.WriteByte(hexDigits[b>>4])
+				_ = w.WriteByte(hexDigits[b&0xF])
+			}
+			i++
+			start = i
+			continue
+		}
+		c, size := utf8.DecodeRuneInString(s[i:])
+		if c == utf8.RuneError && size == 1 {
+			_, _ = w.WriteString(s[start:i])
+			_, _ = w.WriteString(`\ufffd`)
+			i += size
+			start = i
+			continue
+		}
+		// U+2028 and U+2029 are valid JSON but break JavaScript parsers.
+		if c == '\u2028' || c == '\u2029' {
+			_, _ = w.WriteString(s[start:i])
+			_, _ = w.WriteString(`\u202`)
+			_ = w.WriteByte(hexDigits[c&0xF])
+			i += size
+			start = i
+			continue
+		}
+		i += size
+	}
+	_, _ = w.WriteString(s[start:])
+	_ = w.WriteByte('"')
+}
+
+// writeError writes a gRPC status as a JSON error, in the same format as ESP.
+func writeError(w http.ResponseWriter, err error) {
+	st := status.Convert(err)
+	body, _ := json.Marshal(struct {
+		Code    int32  `json:"code"`
+		Message string `json:"message"`
+	}{int32(st.Code()), st.Message()})
+	// Errors are not cacheable.
+	w.Header().Del("ETag")
+	w.Header().Del("Cache-Control")
+	w.Header().Set("Content-Type", "application/json")
+	w.WriteHeader(HTTPStatusFromCode(st.Code()))
+	_, _ = w.Write(body)
+}
+
+// HTTPStatusFromCode converts a gRPC status code to the HTTP status code.
+func HTTPStatusFromCode(code codes.Code) int {
+	switch code {
+	case codes.OK:
+		return http.StatusOK
+	case codes.Canceled:
+		return 499
+	case codes.InvalidArgument, codes.FailedPrecondition, codes.OutOfRange:
+		return http.StatusBadRequest
+	case codes.DeadlineExceeded:
+		return http.StatusGatewayTimeout
+	case codes.NotFound:
+		return http.StatusNotFound
+	case codes.AlreadyExists, codes.Aborted:
+		return http.StatusConflict
+	case codes.PermissionDenied:
+		return http.StatusForbidden
+	case codes.Unauthenticated:
+		return http.StatusUnauthorized
+	case codes.ResourceExhausted:
+		return http.StatusTooManyRequests
+	case codes.Unimplemented:
+		return http.StatusNotImplemented
+	case codes.Unavailable:
+		return http.StatusServiceUnavailable
+	}
+	return http.StatusInternalServerError
+}
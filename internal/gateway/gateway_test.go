@@ -0,0 +1,272 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package gateway
+
+import (
+	"bufio"
+	"bytes"
+	"context"
+	"encoding/json"
+	"io/ioutil"
+	"net/http"
+	"net/http/httptest"
+	"strings"
+	"testing"
+
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/google/go-cmp/cmp"
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/status"
+	"google.golang.org/protobuf/proto"
+	"google.golang.org/protobuf/testing/protocmp"
+)
+
+// fakeServer only implements the methods used in the tests.
+type fakeServer struct {
+	pb.MixerServer
+	lastReq *pb.GetPropertyValuesRequest
+}
+
+func (s *fakeServer) GetPropertyValues(
+	ctx context.Context, in *pb.GetPropertyValuesRequest) (
+	*pb.GetPropertyValuesResponse, error) {
+	s.lastReq = in
+	if len(in.GetDcids()) == 0 {
+		return nil, status.Errorf(codes.InvalidArgument, "Missing required arguments")
+	}
+	return &pb.GetPropertyValuesResponse{Payload: `{"geoId/06":{"out":[]}}`}, nil
+}
+
+func (s *fakeServer) ETag(fullMethod string, req proto.Message) string {
+	if fullMethod == "/datacommons.Mixer/GetStatValue" {
+		return `"statvalue"`
+	}
+	return ""
+}
+
+func (s *fakeServer) GetStatValue(
+	ctx context.Context, in *pb.GetStatValueRequest) (
+	*pb.GetStatValueResponse, error) {
+	if in.GetPlace() == "" {
+		return nil, status.Errorf(codes.InvalidArgument, "Missing required argument: place")
+	}
+	return &pb.GetStatValueResponse{Value: 123}, nil
+}
+
+func TestGateway(t *testing.T) {
+	srv := &fakeServer{}
+	g, err := New(srv)
+	if err != nil {
+		t.Fatalf("New() = %v", err)
+	}
+	for _, c := range []struct {
+		method   string
+		target   string
+		body     string
+		wantCode int
+		wantBody string
+		wantReq  *pb.GetPropertyValuesRequest
+	}{
+		{
+			http.MethodGet,
+			"/node/property-values?dcids=geoId/06&dcids=geoId/07&property=name&limit=5",
+			"",
+			http.StatusOK,
+			`{"payload":"{\"geoId/06\":{\"out\":[]}}"}`,
+			&pb.GetPropertyValuesRequest{
+				Dcids:    []string{"geoId/06", "geoId/07"},
+				Property: "name",
+				Limit:    5,
+			},
+		},
+		{
+			http.MethodPost,
+			"/node/property-values?payload_format=raw",
+			`{"dcids": ["geoId/06"], "valueType": "Place"}`,
+			http.StatusOK,
+			`{"payload":{"geoId/06":{"out":[]}}}`,
+			&pb.GetPropertyValuesRequest{
+				Dcids:     []string{"geoId/06"},
+				ValueType: "Place",
+			},
+		},
+		{
+			http.MethodGet,
+			"/node/property-values?property=name",
+			"",
+			http.StatusBadRequest,
+			`{"code":3,"message":"Missing required arguments"}`,
+			&pb.GetPropertyValuesRequest{Property: "name"},
+		},
+		{
+			http.MethodGet,
+			"/node/property-values?limit=abc",
+			"",
+			http.StatusBadRequest,
+			"",
+			nil,
+		},
+		{
+			http.MethodGet,
+			"/stat/value?place=geoId/06&stat_var=Count_Person",
+			"",
+			http.StatusOK,
+			`{"value":123}`,
+			nil,
+		},
+		{
+			http.MethodGet,
+			"/no/such/method",
+			"",
+			http.StatusNotFound,
+			"",
+			nil,
+		},
+	} {
+		srv.lastReq = nil
+		req := httptest.NewRequest(c.method, c.target, strings.NewReader(c.body))
+		rec := httptest.NewRecorder()
+		g.ServeHTTP(rec, req)
+		if rec.Code != c.wantCode {
+			t.Errorf("%s %s got code %d, want %d", c.method, c.target, rec.Code, c.wantCode)
+			continue
+		}
+		if c.wantBody != "" {
+			got, _ := ioutil.ReadAll(rec.Body)
+			if !jsonEqual(t, got, []byte(c.wantBody)) {
+				t.Errorf("%s %s got body %s, want %s", c.method, c.target, got, c.wantBody)
+			}
+		}
+		if c.wantReq != nil {
+			if diff := cmp.Diff(srv.lastReq, c.wantReq, protocmp.Transform()); diff != "" {
+				t.Errorf("%s %s got request diff %v", c.method, c.target, diff)
+			}
+		}
+	}
+}
+
+func TestGatewayConditionalRequest(t *testing.T) {
+	g, err := New(&fakeServer{})
+	if err != nil {
+		t.Fatalf("New() = %v", err)
+	}
+	for _, c := range []struct {
+		target      string
+		ifNoneMatch string
+		wantCode    int
+		wantETag    string
+	}{
+		{"/stat/value?place=geoId/06", "", http.StatusOK, `"statvalue"`},
+		{"/stat/value?place=geoId/06", `"other"`, http.StatusOK, `"statvalue"`},
+		{"/stat/value?place=geoId/06", `"statvalue"`, http.StatusNotModified, `"statvalue"`},
+		{"/stat/value?place=geoId/06&payload_format=raw", `"statvalue"`, http.StatusOK,
+			`"statvalue-raw"`},
+		{"/stat/value?place=geoId/06&payload_format=raw", `W/"statvalue-raw"`,
+			http.StatusNotModified, `"statvalue-raw"`},
+	} {
+		req := httptest.NewRequest(http.MethodGet, c.target, nil)
+		if c.ifNoneMatch != "" {
+			req.Header.Set("If-None-Match", c.ifNoneMatch)
+		}
+		rec := httptest.NewRecorder()
+		g.ServeHTTP(rec, req)
+		if rec.Code != c.wantCode {
+			t.Errorf("%s If-None-Match %s got code %d, want %d",
+				c.target, c.ifNoneMatch, rec.Code, c.wantCode)
+		}
+		if got := rec.Header().Get("ETag"); got != c.wantETag {
+			t.Errorf("%s If-None-Match %s got ETag %s, want %s",
+				c.target, c.ifNoneMatch, got, c.wantETag)
+		}
+		if got := rec.Header().Get("Cache-Control"); got == "" {
+			t.Errorf("If-None-Match %s got no Cache-Control", c.ifNoneMatch)
+		}
+	}
+}
+
+func TestGatewayErrorNotCacheable(t *testing.T) {
+	g, err := New(&fakeServer{})
+	if err != nil {
+		t.Fatalf("New() = %v", err)
+	}
+	rec := httptest.NewRecorder()
+	g.ServeHTTP(rec, httptest.NewRequest(http.MethodGet, "/stat/value", nil))
+	if rec.Code != http.StatusBadRequest {
+		t.Errorf("GET /stat/value got code %d, want %d", rec.Code, http.StatusBadRequest)
+	}
+	for _, header := range []string{"ETag", "Cache-Control"} {
+		if got := rec.Header().Get(header); got != "" {
+			t.Errorf("GET /stat/value got %s %s on error", header, got)
+		}
+	}
+}
+
+func TestGatewayBodyTooLarge(t *testing.T) {
+	g, err := New(&fakeServer{})
+	if err != nil {
+		t.Fatalf("New() = %v", err)
+	}
+	body := `{"dcids": ["` + strings.Repeat("a", maxBodySize) + `"]}`
+	rec := httptest.NewRecorder()
+	g.ServeHTTP(rec, httptest.NewRequest(
+		http.MethodPost, "/node/property-values", strings.NewReader(body)))
+	if rec.Code != http.StatusBadRequest {
+		t.Errorf("POST of %d bytes got code %d, want %d",
+			len(body), rec.Code, http.StatusBadRequest)
+	}
+	if got := rec.Body.String(); !strings.Contains(got, "larger than") {
+		t.Errorf("POST of %d bytes got body %s", len(body), got)
+	}
+}
+
+func jsonEqual(t *testing.T, a, b []byte) bool {
+	var va, vb interface{}
+	if err := json.Unmarshal(a, &va); err != nil {
+		t.Errorf("Invalid JSON %s: %v", a, err)
+		return false
+	}
+	if err := json.Unmarshal(b, &vb); err != nil {
+		t.Errorf("Invalid JSON %s: %v", b, err)
+		return false
+	}
+	return cmp.Equal(va, vb)
+}
+
+func TestWriteJSONString(t *testing.T) {
+	for _, s := range []string{
+		"",
+		"abc",
+		`{"a":"b\c"}`,
+		"line\nbreak\ttab\r\x01",
+		"unicode 中文 \u2028 \u2029 é",
+		"invalid \xff utf8",
+	} {
+		var buf bytes.Buffer
+		w := bufio.NewWriter(&buf)
+		writeJSONString(w, s)
+		if err := w.Flush(); err != nil {
+			t.Fatal(err)
+		}
+		var got string
+		if err := json.Unmarshal(buf.Bytes(), &got); err != nil {
+			t.Errorf("writeJSONString(%q) = %s, invalid JSON: %v", s, buf.String(), err)
+			continue
+		}
+		want := strings.ToValidUTF8(s, "\ufffd")
+		if got != want {
+			t.Errorf("writeJSONString(%q) decodes to %q, want %q", s, got, want)
+		}
+	}
+}
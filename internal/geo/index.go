@@ -0,0 +1,259 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Package geo is an in-memory spatial index of place centroids.
+package geo
+
+import (
+	"container/heap"
+	"math"
+	"sort"
+)
+
+// EarthRadiusKm is the mean radius of the Earth.
+const EarthRadiusKm = 6371.0088
+
+// Place is a place with its centroid.
+type Place struct {
+	Dcid       string
+	Types      []string
+	Latitude   float64
+	Longitude  float64
+	Population int64
+}
+
+// hasType returns whether the place has the type, or the type is empty.
+func (p *Place) hasType(typ string) bool {
+	if typ == "" {
+		return true
+	}
+	for _, t := range p.Types {
+		if t == typ {
+			return true
+		}
+	}
+	return false
+}
+
+// Index is a static k-d tree over the centroids as points on the unit sphere.
+// The straight line distance between two points grows with their great-circle
+// distance, so the nearest points in 3D are the nearest places.
+type Index struct {
+	places []Place
+	// The tree is implicit: the root of places[lo:hi] is at (lo+hi)/2, and the
+	// split axis cycles with the depth.
+	points [][3]float64
+	byDcid map[string]int
+}
+
+// NewIndex builds an Index over places with a location.
+func NewIndex(places []Place) *Index {
+	idx := &Index{
+		places: places,
+		points: make([][3]float64, len(places)),
+		byDcid: make(map[string]int, len(places)),
+	}
+	order := make([]int, len(places))
+	for i := range order {
+		order[i] = i
+	}
+	points := make([][3]float64, len(places))
+	for i, p := range places {
+		points[i] = toPoint(p.Latitude, p.Longitude)
+	}
+	build(order, points, 0)
+	sorted := make([]Place, len(places))
+	for i, j := range order {
+		sorted[i] = places[j]
+		idx.points[i] = points[j]
+		idx.byDcid[places[j].Dcid] = i
+	}
+	idx.places = sorted
+	return idx
+}
+
+// build arranges order so each range has its median on the axis at its middle.
+func build(order []int, points [][3]float64, depth int) {
+	if len(order) <= 1 {
+		return
+	}
+	axis := depth % 3
+	sort.Slice(order, func(i, j int) bool {
+		return points[order[i]][axis] < points[order[j]][axis]
+	})
+	mid := len(order) / 2
+	build(order[:mid], points, depth+1)
+	build(order[mid+1:], points, depth+1)
+}
+
+func toPoint(lat, lng float64) [3]float64 {
+	phi := lat * math.Pi / 180
+	lambda := lng * math.Pi / 180
+	return [3]float64{
+		math.Cos(phi) * math.Cos(lambda),
+		math.Cos(phi) * math.Sin(lambda),
+		math.Sin(phi),
+	}
+}
+
+// chordToKm converts the squared straight line distance on the unit sphere to
+// the great-circle distance.
+func chordToKm(chord2 float64) float64 {
+	half := math.Min(1, math.Sqrt(chord2)/2)
+	return 2 * EarthRadiusKm * math.Asin(half)
+}
+
+// kmToChord converts the great-circle distance to the squared straight line
+// distance on the unit sphere.
+func kmToChord(km float64) float64 {
+	if km >= math.Pi*EarthRadiusKm {
+		return 4
+	}
+	chord := 2 * math.Sin(km/(2*EarthRadiusKm))
+	return chord * chord
+}
+
+// Len returns the number of places.
+func (idx *Index) Len() int {
+	return len(idx.places)
+}
+
+// Lookup returns a place by dcid.
+func (idx *Index) Lookup(dcid string) (*Place, bool) {
+	i, ok := idx.byDcid[dcid]
+	if !ok {
+		return nil, false
+	}
+	return &idx.places[i], true
+}
+
+// Query is a nearby places query.
+type Query struct {
+	Latitude  float64
+	Longitude float64
+	// Maximum distance, unlimited when 0.
+	RadiusKm float64
+	// Maximum number of places, the nearest first. Unlimited when 0.
+	K int
+	// Only places of this type when set.
+	Type string
+	// Only places with a larger population.
+	MinPopulation int64
+	// Place to skip, usually the place at the center.
+	Exclude string
+}
+
+// Result is a place found by a query.
+type Result struct {
+	Place      *Place
+	DistanceKm float64
+}
+
+// resultHeap is a max-heap on the distance, to keep the K nearest places.
+type resultHeap []heapItem
+
+type heapItem struct {
+	index  int
+	chord2 float64
+}
+
+func (h resultHeap) Len() int            { return len(h) }
+func (h resultHeap) Less(i, j int) bool  { return h[i].chord2 > h[j].chord2 }
+func (h resultHeap) Swap(i, j int)       { h[i], h[j] = h[j], h[i] }
+func (h *resultHeap) Push(x interface{}) { *h = append(*h, x.(heapItem)) }
+func (h *resultHeap) Pop() interface{} {
+	old := *h
+	x := old[len(old)-1]
+	*h = old[:len(old)-1]
+	return x
+}
+
+// Nearby returns the places that match the query, the nearest first.
+func (idx *Index) Nearby(q Query) []Result {
+	s := &search{
+		idx:    idx,
+		q:      q,
+		target: toPoint(q.Latitude, q.Longitude),
+		bound:  4,
+	}
+	if q.RadiusKm > 0 {
+		s.bound = kmToChord(q.RadiusKm)
+	}
+	s.visit(0, len(idx.places), 0)
+	sort.Slice(s.found, func(i, j int) bool {
+		return s.found[i].chord2 < s.found[j].chord2
+	})
+	result := make([]Result, len(s.found))
+	for i, item := range s.found {
+		result[i] = Result{
+			Place:      &idx.places[item.index],
+			DistanceKm: chordToKm(item.chord2),
+		}
+	}
+	return result
+}
+
+type search struct {
+	idx    *Index
+	q      Query
+	target [3]float64
+	// Squared distance of the farthest place that can still be a result.
+	bound float64
+	found resultHeap
+}
+
+func (s *search) visit(lo, hi, depth int) {
+	if lo >= hi {
+		return
+	}
+	mid := (lo + hi) / 2
+	point := s.idx.points[mid]
+	chord2 := 0.0
+	for i := 0; i < 3; i++ {
+		d := point[i] - s.target[i]
+		chord2 += d * d
+	}
+	if chord2 <= s.bound {
+		s.add(mid, chord2)
+	}
+	axis := depth % 3
+	diff := s.target[axis] - point[axis]
+	near, far := [2]int{lo, mid}, [2]int{mid + 1, hi}
+	if diff > 0 {
+		near, far = far, near
+	}
+	s.visit(near[0], near[1], depth+1)
+	// The other side is only visited if the splitting plane is within reach.
+	if diff*diff <= s.bound {
+		s.visit(far[0], far[1], depth+1)
+	}
+}
+
+func (s *search) add(i int, chord2 float64) {
+	p := &s.idx.places[i]
+	if p.Dcid == s.q.Exclude || p.Population < s.q.MinPopulation || !p.hasType(s.q.Type) {
+		return
+	}
+	if s.q.K <= 0 {
+		s.found = append(s.found, heapItem{i, chord2})
+		return
+	}
+	heap.Push(&s.found, heapItem{i, chord2})
+	if len(s.found) > s.q.K {
+		heap.Pop(&s.found)
+	}
+	if len(s.found) == s.q.K {
+		s.bound = math.Min(s.bound, s.found[0].chord2)
+	}
+}
@@ -0,0 +1,143 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package geo
+
+import (
+	"fmt"
+	"math"
+	"math/rand"
+	"sort"
+	"testing"
+
+	"github.com/google/go-cmp/cmp"
+)
+
+func TestNearby(t *testing.T) {
+	idx := NewIndex([]Place{
+		{Dcid: "geoId/0667000", Types: []string{"City"}, Latitude: 37.7749, Longitude: -122.4194, Population: 870000},
+		{Dcid: "geoId/0653000", Types: []string{"City"}, Latitude: 37.8044, Longitude: -122.2712, Population: 420000},
+		{Dcid: "geoId/0668000", Types: []string{"City"}, Latitude: 37.3382, Longitude: -121.8863, Population: 1000000},
+		{Dcid: "geoId/06075", Types: []string{"County"}, Latitude: 37.7599, Longitude: -122.4367, Population: 870000},
+		{Dcid: "geoId/3651000", Types: []string{"City"}, Latitude: 40.7128, Longitude: -74.0060, Population: 8000000},
+	})
+	sf, _ := idx.Lookup("geoId/0667000")
+	for _, c := range []struct {
+		q    Query
+		want []string
+	}{
+		{
+			Query{RadiusKm: 100, Type: "City", Exclude: "geoId/0667000"},
+			[]string{"geoId/0653000", "geoId/0668000"},
+		},
+		{
+			Query{K: 2},
+			[]string{"geoId/0667000", "geoId/06075"},
+		},
+		{
+			Query{K: 2, MinPopulation: 900000},
+			[]string{"geoId/0668000", "geoId/3651000"},
+		},
+		{
+			Query{RadiusKm: 20, K: 5},
+			[]string{"geoId/0667000", "geoId/06075", "geoId/0653000"},
+		},
+	} {
+		c.q.Latitude, c.q.Longitude = sf.Latitude, sf.Longitude
+		got := []string{}
+		for _, r := range idx.Nearby(c.q) {
+			got = append(got, r.Place.Dcid)
+		}
+		if diff := cmp.Diff(c.want, got); diff != "" {
+			t.Errorf("Nearby(%+v) diff %v", c.q, diff)
+		}
+	}
+
+	// San Francisco to New York is about 4130 km.
+	r := idx.Nearby(Query{Latitude: sf.Latitude, Longitude: sf.Longitude, Type: "City", MinPopulation: 5000000})
+	if len(r) != 1 || math.Abs(r[0].DistanceKm-4130) > 10 {
+		t.Errorf("Nearby() = %+v, want New York at 4130 km", r)
+	}
+}
+
+func TestNearbyMatchesBruteForce(t *testing.T) {
+	rnd := rand.New(rand.NewSource(1))
+	places := make([]Place, 2000)
+	for i := range places {
+		places[i] = Place{
+			Dcid:       fmt.Sprintf("p%d", i),
+			Latitude:   rnd.Float64()*180 - 90,
+			Longitude:  rnd.Float64()*360 - 180,
+			Population: rnd.Int63n(1000),
+		}
+	}
+	idx := NewIndex(append([]Place{}, places...))
+	for i := 0; i < 50; i++ {
+		q := Query{
+			Latitude:      rnd.Float64()*180 - 90,
+			Longitude:     rnd.Float64()*360 - 180,
+			RadiusKm:      rnd.Float64() * 3000,
+			K:             rnd.Intn(20),
+			MinPopulation: rnd.Int63n(500),
+		}
+		target := toPoint(q.Latitude, q.Longitude)
+		type item struct {
+			dcid   string
+			chord2 float64
+		}
+		var all []item
+		for _, p := range places {
+			point := toPoint(p.Latitude, p.Longitude)
+			chord2 := 0.0
+			for k := 0; k < 3; k++ {
+				chord2 += (point[k] - target[k]) * (point[k] - target[k])
+			}
+			if chord2 <= kmToChord(q.RadiusKm) && p.Population >= q.MinPopulation {
+				all = append(all, item{p.Dcid, chord2})
+			}
+		}
+		sort.Slice(all, func(i, j int) bool { return all[i].chord2 < all[j].chord2 })
+		if q.K > 0 && len(all) > q.K {
+			all = all[:q.K]
+		}
+		want := []string{}
+		for _, it := range all {
+			want = append(want, it.dcid)
+		}
+		got := []string{}
+		for _, r := range idx.Nearby(q) {
+			got = append(got, r.Place.Dcid)
+		}
+		if diff := cmp.Diff(want, got); diff != "" {
+			t.Errorf("Nearby(%+v) diff %v", q, diff)
+		}
+	}
+}
+
+func BenchmarkNearby(b *testing.B) {
+	rnd := rand.New(rand.NewSource(1))
+	places := make([]Place, 200000)
+	for i := range places {
+		places[i] = Place{
+			Dcid:      fmt.Sprintf("p%d", i),
+			Latitude:  rnd.Float64()*180 - 90,
+			Longitude: rnd.Float64()*360 - 180,
+		}
+	}
+	idx := NewIndex(places)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		idx.Nearby(Query{Latitude: 37.77, Longitude: -122.42, RadiusKm: 200, K: 10})
+	}
+}
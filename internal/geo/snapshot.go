@@ -0,0 +1,99 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package geo
+
+import (
+	"encoding/csv"
+	"fmt"
+	"io"
+	"math"
+	"os"
+	"strconv"
+	"strings"
+)
+
+// Columns of a snapshot.
+var snapshotHeader = []string{"dcid", "types", "latitude", "longitude", "population"}
+
+// ReadSnapshot reads places from a CSV file with the columns dcid, types,
+// latitude, longitude and population. Types are separated by ";".
+//
+// Only the dcid is required. Missing coordinates are NaN and a missing
+// population is -1, so they can be filled from the graph.
+func ReadSnapshot(path string) ([]Place, error) {
+	file, err := os.Open(path)
+	if err != nil {
+		return nil, err
+	}
+	defer file.Close()
+	return readSnapshot(file)
+}
+
+func readSnapshot(r io.Reader) ([]Place, error) {
+	reader := csv.NewReader(r)
+	reader.FieldsPerRecord = len(snapshotHeader)
+	header, err := reader.Read()
+	if err != nil {
+		return nil, err
+	}
+	for i, column := range snapshotHeader {
+		if header[i] != column {
+			return nil, fmt.Errorf("invalid snapshot header %v, want %v", header, snapshotHeader)
+		}
+	}
+	var places []Place
+	for {
+		record, err := reader.Read()
+		if err == io.EOF {
+			break
+		}
+		if err != nil {
+			return nil, err
+		}
+		p := Place{
+			Dcid:       record[0],
+			Latitude:   math.NaN(),
+			Longitude:  math.NaN(),
+			Population: -1,
+		}
+		if p.Dcid == "" {
+			continue
+		}
+		if record[1] != "" {
+			p.Types = strings.Split(record[1], ";")
+		}
+		if record[2] != "" && record[3] != "" {
+			if p.Latitude, err = strconv.ParseFloat(record[2], 64); err != nil {
+				return nil, fmt.Errorf("invalid latitude of %s: %v", p.Dcid, err)
+			}
+			if p.Longitude, err = strconv.ParseFloat(record[3], 64); err != nil {
+				return nil, fmt.Errorf("invalid longitude of %s: %v", p.Dcid, err)
+			}
+		}
+		if record[4] != "" {
+			if p.Population, err = strconv.ParseInt(record[4], 10, 64); err != nil {
+				return nil, fmt.Errorf("invalid population of %s: %v", p.Dcid, err)
+			}
+		}
+		places = append(places, p)
+	}
+	return places, nil
+}
+
+// HasLocation returns whether the place has valid coordinates.
+func (p *Place) HasLocation() bool {
+	return !math.IsNaN(p.Latitude) && !math.IsNaN(p.Longitude) &&
+		math.Abs(p.Latitude) <= 90 && math.Abs(p.Longitude) <= 180
+}
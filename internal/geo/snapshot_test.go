@@ -0,0 +1,47 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package geo
+
+import (
+	"strings"
+	"testing"
+
+	"github.com/google/go-cmp/cmp"
+)
+
+func TestReadSnapshot(t *testing.T) {
+	got, err := readSnapshot(strings.NewReader(
+		"dcid,types,latitude,longitude,population\n" +
+			"geoId/06,State;AdministrativeArea1,37.1,-119.7,39000000\n" +
+			"geoId/0667000,City,,,\n"))
+	if err != nil {
+		t.Fatalf("readSnapshot() = %v", err)
+	}
+	if len(got) != 2 {
+		t.Fatalf("readSnapshot() = %d places, want 2", len(got))
+	}
+	want := Place{"geoId/06", []string{"State", "AdministrativeArea1"}, 37.1, -119.7, 39000000}
+	if diff := cmp.Diff(want, got[0]); diff != "" {
+		t.Errorf("readSnapshot() diff %v", diff)
+	}
+	// Missing values are filled from the graph.
+	if got[1].HasLocation() || got[1].Population != -1 {
+		t.Errorf("readSnapshot() = %+v, want no location and population", got[1])
+	}
+
+	if _, err := readSnapshot(strings.NewReader("dcid,lat,lng\n")); err == nil {
+		t.Error("readSnapshot() accepted an invalid header")
+	}
+}
@@ -16,24 +16,205 @@ package healthcheck
 
 import (
 	"context"
+	"encoding/json"
+	"log"
+	"net/http"
+	"strings"
+	"sync"
+	"time"
 
+	"google.golang.org/grpc"
+	"google.golang.org/grpc/codes"
 	"google.golang.org/grpc/health/grpc_health_v1"
+	"google.golang.org/grpc/status"
 )
 
-type HealthChecker struct{}
+// Step is a warm-up step that needs to complete before the server is ready.
+type Step struct {
+	Name string
+	Run  func(ctx context.Context) error
+}
+
+// StepStatus is the status of a warm-up step.
+type StepStatus struct {
+	Name       string `json:"name"`
+	Done       bool   `json:"done"`
+	DurationMs int64  `json:"durationMs"`
+	Error      string `json:"error,omitempty"`
+}
+
+// HealthChecker reports the serving status of the mixer.
+//
+// The status is NOT_SERVING until all the warm-up steps are done. Without any
+// warm-up step, the status is SERVING.
+type HealthChecker struct {
+	mu    sync.RWMutex
+	steps []*Step
+	stats []*StepStatus
+	ready bool
+	// Closed and replaced whenever the status changes.
+	changed chan struct{}
+}
+
+// NewHealthChecker creates a HealthChecker.
+func NewHealthChecker() *HealthChecker {
+	return &HealthChecker{
+		ready:   true,
+		changed: make(chan struct{}),
+	}
+}
+
+// AddStep adds a warm-up step. Steps run in the order they are added.
+func (s *HealthChecker) AddStep(name string, run func(ctx context.Context) error) {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+	s.steps = append(s.steps, &Step{Name: name, Run: run})
+	s.stats = append(s.stats, &StepStatus{Name: name})
+	s.setReadyLocked(false)
+}
+
+// Run runs the warm-up steps and reports SERVING when they all succeed.
+func (s *HealthChecker) Run(ctx context.Context) error {
+	s.mu.RLock()
+	steps := s.steps
+	stats := s.stats
+	s.mu.RUnlock()
+	for i, step := range steps {
+		start := time.Now()
+		err := step.Run(ctx)
+		elapsed := time.Since(start)
+		s.mu.Lock()
+		stats[i].DurationMs = elapsed.Milliseconds()
+		if err != nil {
+			stats[i].Error = err.Error()
+		} else {
+			stats[i].Done = true
+		}
+		s.mu.Unlock()
+		if err != nil {
+			log.Printf("Warm-up step %s failed after %s: %v", step.Name, elapsed, err)
+			return err
+		}
+		log.Printf("Warm-up step %s completed in %s", step.Name, elapsed)
+	}
+	s.mu.Lock()
+	s.setReadyLocked(true)
+	s.mu.Unlock()
+	return nil
+}
+
+func (s *HealthChecker) setReadyLocked(ready bool) {
+	if s.ready == ready {
+		return
+	}
+	s.ready = ready
+	close(s.changed)
+	s.changed = make(chan struct{})
+}
+
+// Ready returns whether all the warm-up steps are done.
+func (s *HealthChecker) Ready() bool {
+	s.mu.RLock()
+	defer s.mu.RUnlock()
+	return s.ready
+}
+
+// Steps returns the status of the warm-up steps.
+func (s *HealthChecker) Steps() []StepStatus {
+	s.mu.RLock()
+	defer s.mu.RUnlock()
+	result := make([]StepStatus, len(s.stats))
+	for i, stat := range s.stats {
+		result[i] = *stat
+	}
+	return result
+}
+
+func (s *HealthChecker) servingStatus() grpc_health_v1.HealthCheckResponse_ServingStatus {
+	if s.Ready() {
+		return grpc_health_v1.HealthCheckResponse_SERVING
+	}
+	return grpc_health_v1.HealthCheckResponse_NOT_SERVING
+}
 
 func (s *HealthChecker) Check(ctx context.Context, req *grpc_health_v1.HealthCheckRequest) (*grpc_health_v1.HealthCheckResponse, error) {
 	return &grpc_health_v1.HealthCheckResponse{
-		Status: grpc_health_v1.HealthCheckResponse_SERVING,
+		Status: s.servingStatus(),
 	}, nil
 }
 
 func (s *HealthChecker) Watch(req *grpc_health_v1.HealthCheckRequest, server grpc_health_v1.Health_WatchServer) error {
-	return server.Send(&grpc_health_v1.HealthCheckResponse{
-		Status: grpc_health_v1.HealthCheckResponse_SERVING,
+	for {
+		s.mu.RLock()
+		changed := s.changed
+		s.mu.RUnlock()
+		err := server.Send(&grpc_health_v1.HealthCheckResponse{
+			Status: s.servingStatus(),
+		})
+		if err != nil {
+			return err
+		}
+		select {
+		case <-changed:
+		case <-server.Context().Done():
+			return server.Context().Err()
+		}
+	}
+}
+
+// UnaryInterceptor rejects RPCs with UNAVAILABLE until the server is ready.
+// The health service is always served.
+func (s *HealthChecker) UnaryInterceptor(
+	ctx context.Context,
+	req interface{},
+	info *grpc.UnaryServerInfo,
+	handler grpc.UnaryHandler,
+) (interface{}, error) {
+	if !s.Ready() && !strings.HasPrefix(info.FullMethod, "/grpc.health.v1.Health/") {
+		return nil, status.Errorf(codes.Unavailable, "Server is warming up")
+	}
+	return handler(ctx, req)
+}
+
+// StreamInterceptor rejects streaming RPCs with UNAVAILABLE until the server is
+// ready. The health service is always served.
+func (s *HealthChecker) StreamInterceptor(
+	srv interface{},
+	ss grpc.ServerStream,
+	info *grpc.StreamServerInfo,
+	handler grpc.StreamHandler,
+) error {
+	if !s.Ready() && !strings.HasPrefix(info.FullMethod, "/grpc.health.v1.Health/") {
+		return status.Errorf(codes.Unavailable, "Server is warming up")
+	}
+	return handler(srv, ss)
+}
+
+// Gate wraps an HTTP handler to respond with 503 until the server is ready.
+func (s *HealthChecker) Gate(h http.Handler) http.Handler {
+	return http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		if !s.Ready() {
+			http.Error(w, "Server is warming up", http.StatusServiceUnavailable)
+			return
+		}
+		h.ServeHTTP(w, r)
 	})
 }
 
-func NewHealthChecker() *HealthChecker {
-	return &HealthChecker{}
+// ServeHTTP reports readiness and the warm-up steps as JSON. It responds with
+// 503 until the server is ready.
+func (s *HealthChecker) ServeHTTP(w http.ResponseWriter, r *http.Request) {
+	body, err := json.Marshal(struct {
+		Status string       `json:"status"`
+		Steps  []StepStatus `json:"steps,omitempty"`
+	}{s.servingStatus().String(), s.Steps()})
+	if err != nil {
+		http.Error(w, err.Error(), http.StatusInternalServerError)
+		return
+	}
+	w.Header().Set("Content-Type", "application/json")
+	if !s.Ready() {
+		w.WriteHeader(http.StatusServiceUnavailable)
+	}
+	_, _ = w.Write(body)
 }
@@ -0,0 +1,110 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package healthcheck
+
+import (
+	"context"
+	"errors"
+	"net/http"
+	"net/http/httptest"
+	"testing"
+
+	"google.golang.org/grpc"
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/health/grpc_health_v1"
+	"google.golang.org/grpc/status"
+)
+
+func checkStatus(
+	t *testing.T,
+	hc *HealthChecker,
+	want grpc_health_v1.HealthCheckResponse_ServingStatus,
+	wantHTTP int,
+	wantCode codes.Code,
+) {
+	t.Helper()
+	resp, err := hc.Check(context.Background(), &grpc_health_v1.HealthCheckRequest{})
+	if err != nil {
+		t.Fatalf("Check() = %v", err)
+	}
+	if resp.GetStatus() != want {
+		t.Errorf("Check() got status %v, want %v", resp.GetStatus(), want)
+	}
+	rec := httptest.NewRecorder()
+	hc.ServeHTTP(rec, httptest.NewRequest(http.MethodGet, "/healthz", nil))
+	if rec.Code != wantHTTP {
+		t.Errorf("ServeHTTP() got code %d, want %d", rec.Code, wantHTTP)
+	}
+	_, err = hc.UnaryInterceptor(
+		context.Background(),
+		nil,
+		&grpc.UnaryServerInfo{FullMethod: "/datacommons.Mixer/GetStats"},
+		func(ctx context.Context, req interface{}) (interface{}, error) {
+			return nil, nil
+		})
+	if status.Code(err) != wantCode {
+		t.Errorf("UnaryInterceptor() got code %v, want %v", status.Code(err), wantCode)
+	}
+}
+
+func TestHealthChecker(t *testing.T) {
+	hc := NewHealthChecker()
+	checkStatus(t, hc, grpc_health_v1.HealthCheckResponse_SERVING, http.StatusOK, codes.OK)
+
+	var order []string
+	hc.AddStep("a", func(ctx context.Context) error {
+		order = append(order, "a")
+		return nil
+	})
+	hc.AddStep("b", func(ctx context.Context) error {
+		order = append(order, "b")
+		return nil
+	})
+	checkStatus(t, hc, grpc_health_v1.HealthCheckResponse_NOT_SERVING,
+		http.StatusServiceUnavailable, codes.Unavailable)
+
+	if err := hc.Run(context.Background()); err != nil {
+		t.Fatalf("Run() = %v", err)
+	}
+	checkStatus(t, hc, grpc_health_v1.HealthCheckResponse_SERVING, http.StatusOK, codes.OK)
+	if len(order) != 2 || order[0] != "a" || order[1] != "b" {
+		t.Errorf("Run() got step order %v", order)
+	}
+	for _, step := range hc.Steps() {
+		if !step.Done || step.Error != "" {
+			t.Errorf("Steps() got %+v", step)
+		}
+	}
+}
+
+func TestHealthCheckerFailedStep(t *testing.T) {
+	hc := NewHealthChecker()
+	hc.AddStep("fail", func(ctx context.Context) error {
+		return errors.New("no table")
+	})
+	hc.AddStep("never", func(ctx context.Context) error {
+		t.Error("Step after failure should not run")
+		return nil
+	})
+	if err := hc.Run(context.Background()); err == nil {
+		t.Fatal("Run() got no error")
+	}
+	checkStatus(t, hc, grpc_health_v1.HealthCheckResponse_NOT_SERVING,
+		http.StatusServiceUnavailable, codes.Unavailable)
+	steps := hc.Steps()
+	if steps[0].Done || steps[0].Error != "no table" || steps[1].Done {
+		t.Errorf("Steps() got %+v", steps)
+	}
+}
@@ -0,0 +1,187 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package limiter
+
+import (
+	"log"
+	"sync"
+	"time"
+)
+
+// State is the state of a Breaker.
+type State int
+
+const (
+	// Closed lets all the calls through.
+	Closed State = iota
+	// Open rejects all the calls.
+	Open
+	// HalfOpen lets a probe call through to decide whether to close.
+	HalfOpen
+)
+
+func (s State) String() string {
+	switch s {
+	case Closed:
+		return "closed"
+	case Open:
+		return "open"
+	default:
+		return "half-open"
+	}
+}
+
+// BreakerOptions configures a Breaker.
+type BreakerOptions struct {
+	// Calls slower than this count as failures.
+	LatencyBudget time.Duration
+	// The breaker opens when the ratio of failures in the window reaches this.
+	FailureRatio float64
+	// Number of recent calls that are considered. Less than 1 means 1.
+	Window int
+	// How long the breaker stays open before a probe.
+	Cooldown time.Duration
+}
+
+// Breaker is a circuit breaker over the recent calls to a backend.
+//
+// When too many of the recent calls fail or exceed the latency budget, the
+// breaker opens and the backend is skipped. After a cooldown, a single call is
+// let through as a probe. The breaker closes if the probe succeeds, and opens
+// again otherwise.
+type Breaker struct {
+	name string
+	opts BreakerOptions
+
+	mu       sync.Mutex
+	state    State
+	openedAt time.Time
+	probing  bool
+	// Ring buffer of the recent outcomes, true for failures.
+	outcomes []bool
+	next     int
+	count    int
+	failures int
+}
+
+// NewBreaker creates a Breaker. The name is used in logs.
+func NewBreaker(name string, opts BreakerOptions) *Breaker {
+	if opts.Window < 1 {
+		opts.Window = 1
+	}
+	return &Breaker{
+		name:     name,
+		opts:     opts,
+		outcomes: make([]bool, opts.Window),
+	}
+}
+
+// LatencyBudget returns the latency over which calls count as failures.
+func (b *Breaker) LatencyBudget() time.Duration {
+	return b.opts.LatencyBudget
+}
+
+// State returns the current state.
+func (b *Breaker) State() State {
+	b.mu.Lock()
+	defer b.mu.Unlock()
+	return b.state
+}
+
+// Allow returns whether a call can go to the backend. When it returns true,
+// the outcome must be reported with Record.
+func (b *Breaker) Allow(now time.Time) bool {
+	b.mu.Lock()
+	defer b.mu.Unlock()
+	switch b.state {
+	case Closed:
+		return true
+	case Open:
+		if now.Sub(b.openedAt) < b.opts.Cooldown {
+			return false
+		}
+		b.state = HalfOpen
+		b.probing = true
+		return true
+	default:
+		if b.probing {
+			return false
+		}
+		b.probing = true
+		return true
+	}
+}
+
+// Record reports the outcome of an allowed call.
+func (b *Breaker) Record(now time.Time, latency time.Duration, err error) {
+	failed := err != nil || latency > b.opts.LatencyBudget
+	b.mu.Lock()
+	defer b.mu.Unlock()
+	if b.state == HalfOpen {
+		b.probing = false
+		if failed {
+			b.openLocked(now)
+		} else {
+			log.Printf("Circuit breaker for %s is closed", b.name)
+			b.state = Closed
+			b.resetLocked()
+		}
+		return
+	}
+	if b.state == Open {
+		return
+	}
+	if b.count == len(b.outcomes) {
+		if b.outcomes[b.next] {
+			b.failures--
+		}
+	} else {
+		b.count++
+	}
+	b.outcomes[b.next] = failed
+	b.next = (b.next + 1) % len(b.outcomes)
+	if failed {
+		b.failures++
+	}
+	if b.count == len(b.outcomes) &&
+		float64(b.failures) >= b.opts.FailureRatio*float64(b.count) {
+		b.openLocked(now)
+	}
+}
+
+// Cancel reports that an allowed call was cancelled for reasons unrelated to
+// the backend, so it has no outcome.
+func (b *Breaker) Cancel() {
+	b.mu.Lock()
+	defer b.mu.Unlock()
+	if b.state == HalfOpen {
+		b.probing = false
+	}
+}
+
+func (b *Breaker) openLocked(now time.Time) {
+	if b.state != Open {
+		log.Printf("Circuit breaker for %s is open", b.name)
+	}
+	b.state = Open
+	b.openedAt = now
+	b.resetLocked()
+}
+
+func (b *Breaker) resetLocked() {
+	b.next = 0
+	b.count = 0
+	b.failures = 0
+}
@@ -0,0 +1,185 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Package limiter protects the Bigtable backends with adaptive concurrency
+// limits and circuit breakers.
+package limiter
+
+import (
+	"container/list"
+	"context"
+	"math"
+	"math/bits"
+	"sync"
+	"time"
+)
+
+const (
+	// Weight of a new limit in the smoothed limit.
+	smoothing = 0.2
+	// Factor of the limit after a failure.
+	backoff = 0.9
+	// The minimum latency is reset after this number of samples, so it follows
+	// the changes of the backend.
+	minLatencyWindow = 1000
+	// Number of size classes of the calls. The sizes of a class are within a
+	// factor of 4, and the last class has all the larger calls.
+	sizeClasses = 8
+)
+
+// Limiter is an adaptive concurrency limiter using the gradient of latency.
+//
+// The limit grows while the latency stays close to the minimum latency, and
+// shrinks as requests queue up in the backend and the latency grows. Failures
+// decrease the limit multiplicatively.
+//
+// The latency of a call grows with the number of rows it reads, so the latency
+// is compared with the minimum latency of the calls of the same size class.
+type Limiter struct {
+	minLimit float64
+	maxLimit float64
+
+	mu         sync.Mutex
+	limit      float64
+	inflight   int
+	minLatency [sizeClasses]time.Duration
+	samples    [sizeClasses]int
+	// Channels of the callers waiting for a slot.
+	waiters *list.List
+}
+
+// Token is a slot acquired from the Limiter.
+type Token struct {
+	l     *Limiter
+	start time.Time
+}
+
+// NewLimiter creates a Limiter with an initial limit between minLimit and
+// maxLimit.
+func NewLimiter(initialLimit, minLimit, maxLimit int) *Limiter {
+	return &Limiter{
+		minLimit: float64(minLimit),
+		maxLimit: float64(maxLimit),
+		limit:    float64(initialLimit),
+		waiters:  list.New(),
+	}
+}
+
+// Limit returns the current concurrency limit.
+func (l *Limiter) Limit() int {
+	l.mu.Lock()
+	defer l.mu.Unlock()
+	return int(l.limit)
+}
+
+// TryAcquire acquires a slot if one is available.
+func (l *Limiter) TryAcquire() (*Token, bool) {
+	l.mu.Lock()
+	defer l.mu.Unlock()
+	if l.inflight >= int(l.limit) {
+		return nil, false
+	}
+	l.inflight++
+	return &Token{l, time.Now()}, true
+}
+
+// Acquire waits for a slot until ctx is done.
+func (l *Limiter) Acquire(ctx context.Context) (*Token, error) {
+	l.mu.Lock()
+	if l.inflight < int(l.limit) {
+		l.inflight++
+		l.mu.Unlock()
+		return &Token{l, time.Now()}, nil
+	}
+	ready := make(chan struct{})
+	elem := l.waiters.PushBack(ready)
+	l.mu.Unlock()
+
+	select {
+	case <-ready:
+		return &Token{l, time.Now()}, nil
+	case <-ctx.Done():
+		l.mu.Lock()
+		defer l.mu.Unlock()
+		select {
+		case <-ready:
+			// The slot was handed over while ctx was done. Give it back.
+			l.inflight--
+			l.wakeLocked()
+		default:
+			l.waiters.Remove(elem)
+		}
+		return nil, ctx.Err()
+	}
+}
+
+// wakeLocked hands over the free slots to the waiters. Must be called with the
+// lock held.
+func (l *Limiter) wakeLocked() {
+	for l.inflight < int(l.limit) && l.waiters.Len() > 0 {
+		ready := l.waiters.Remove(l.waiters.Front()).(chan struct{})
+		l.inflight++
+		close(ready)
+	}
+}
+
+// Done releases the slot and updates the limit with the latency of the call,
+// which read the given number of rows. Failures that are caused by the
+// backend, like timeouts, should be reported with failed set to true.
+func (t *Token) Done(rows int, failed bool) {
+	latency := time.Since(t.start)
+	l := t.l
+	l.mu.Lock()
+	defer l.mu.Unlock()
+	l.inflight--
+	if failed {
+		l.limit = math.Max(l.minLimit, l.limit*backoff)
+	} else {
+		l.update(sizeClass(rows), latency)
+	}
+	l.wakeLocked()
+}
+
+// sizeClass returns the size class of a call that read the given number of
+// rows.
+func sizeClass(rows int) int {
+	if rows < 1 {
+		rows = 1
+	}
+	class := (bits.Len(uint(rows)) - 1) / 2
+	if class >= sizeClasses {
+		class = sizeClasses - 1
+	}
+	return class
+}
+
+// update applies the gradient of latency to the limit. Must be called with the
+// lock held.
+func (l *Limiter) update(class int, latency time.Duration) {
+	l.samples[class]++
+	if l.minLatency[class] == 0 || latency < l.minLatency[class] ||
+		l.samples[class] > minLatencyWindow {
+		l.minLatency[class] = latency
+		l.samples[class] = 0
+	}
+	if latency <= 0 {
+		return
+	}
+	gradient := math.Max(0.5, math.Min(1,
+		float64(l.minLatency[class])/float64(latency)))
+	// Allow some queueing, so the limit can grow when the latency is stable.
+	newLimit := l.limit*gradient + math.Sqrt(l.limit)
+	l.limit = l.limit*(1-smoothing) + newLimit*smoothing
+	l.limit = math.Max(l.minLimit, math.Min(l.maxLimit, l.limit))
+}
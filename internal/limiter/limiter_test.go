@@ -0,0 +1,170 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package limiter
+
+import (
+	"context"
+	"errors"
+	"testing"
+	"time"
+)
+
+func TestLimiter(t *testing.T) {
+	l := NewLimiter(2, 1, 100)
+	t1, ok := l.TryAcquire()
+	if !ok {
+		t.Fatal("TryAcquire() failed under the limit")
+	}
+	t2, _ := l.TryAcquire()
+	if _, ok := l.TryAcquire(); ok {
+		t.Fatal("TryAcquire() succeeded over the limit")
+	}
+
+	// Acquire waits for a slot.
+	ctx, cancel := context.WithTimeout(context.Background(), 10*time.Millisecond)
+	defer cancel()
+	if _, err := l.Acquire(ctx); err == nil {
+		t.Fatal("Acquire() got a slot over the limit")
+	}
+	acquired := make(chan *Token)
+	go func() {
+		token, err := l.Acquire(context.Background())
+		if err != nil {
+			t.Errorf("Acquire() = %v", err)
+		}
+		acquired <- token
+	}()
+	t1.Done(1, false)
+	t3 := <-acquired
+	t2.Done(1, false)
+	t3.Done(1, false)
+
+	// Failures shrink the limit down to the minimum.
+	for i := 0; i < 50; i++ {
+		token, _ := l.Acquire(context.Background())
+		token.Done(1, true)
+	}
+	if got := l.Limit(); got != 1 {
+		t.Errorf("Limit() = %d after failures, want 1", got)
+	}
+
+	// The limit grows while the latency is stable.
+	for i := 0; i < 50; i++ {
+		token, _ := l.Acquire(context.Background())
+		token.Done(1, false)
+	}
+	if got := l.Limit(); got <= 1 {
+		t.Errorf("Limit() = %d after successes, want > 1", got)
+	}
+}
+
+func TestLimiterSizeClasses(t *testing.T) {
+	l := NewLimiter(10, 1, 100)
+	token, _ := l.TryAcquire()
+	token.Done(1, false)
+	// A read of many rows is slower than the minimum latency of single rows,
+	// but it is the first of its size class, so the limit does not shrink.
+	limit := l.Limit()
+	token, _ = l.TryAcquire()
+	time.Sleep(10 * time.Millisecond)
+	token.Done(1000, false)
+	if got := l.Limit(); got < limit {
+		t.Errorf("Limit() = %d after a large read, want >= %d", got, limit)
+	}
+	for _, c := range []struct {
+		rows int
+		want int
+	}{
+		{0, 0}, {1, 0}, {3, 0}, {4, 1}, {15, 1}, {16, 2}, {1000, 4}, {1 << 30, 7},
+	} {
+		if got := sizeClass(c.rows); got != c.want {
+			t.Errorf("sizeClass(%d) = %d, want %d", c.rows, got, c.want)
+		}
+	}
+}
+
+func TestBreaker(t *testing.T) {
+	b := NewBreaker("branch", BreakerOptions{
+		LatencyBudget: time.Second,
+		FailureRatio:  0.5,
+		Window:        4,
+		Cooldown:      time.Minute,
+	})
+	now := time.Now()
+	errBackend := errors.New("unavailable")
+	for _, c := range []struct {
+		latency time.Duration
+		err     error
+		want    State
+	}{
+		{time.Millisecond, nil, Closed},
+		{time.Millisecond, errBackend, Closed},
+		{time.Millisecond, nil, Closed},
+		// Too slow, 2 of the 4 calls fail.
+		{2 * time.Second, nil, Open},
+	} {
+		if !b.Allow(now) {
+			t.Fatalf("Allow() = false in state %v", b.State())
+		}
+		b.Record(now, c.latency, c.err)
+		if got := b.State(); got != c.want {
+			t.Errorf("State() = %v, want %v", got, c.want)
+		}
+	}
+	if b.Allow(now.Add(time.Second)) {
+		t.Error("Allow() = true before the cooldown")
+	}
+
+	// A failed probe opens the breaker again.
+	now = now.Add(2 * time.Minute)
+	if !b.Allow(now) {
+		t.Fatal("Allow() = false for the probe")
+	}
+	if b.Allow(now) {
+		t.Error("Allow() = true for a second probe")
+	}
+	b.Record(now, time.Millisecond, errBackend)
+	if got := b.State(); got != Open {
+		t.Errorf("State() = %v after a failed probe, want open", got)
+	}
+
+	// A successful probe closes it.
+	now = now.Add(2 * time.Minute)
+	if !b.Allow(now) {
+		t.Fatal("Allow() = false for the probe")
+	}
+	b.Record(now, time.Millisecond, nil)
+	if got := b.State(); got != Closed {
+		t.Errorf("State() = %v after a successful probe, want closed", got)
+	}
+}
+
+func TestBreakerEmptyWindow(t *testing.T) {
+	b := NewBreaker("branch", BreakerOptions{
+		LatencyBudget: time.Second,
+		FailureRatio:  0.5,
+		Cooldown:      time.Minute,
+	})
+	now := time.Now()
+	b.Record(now, time.Millisecond, nil)
+	if got := b.State(); got != Closed {
+		t.Errorf("State() = %v, want closed", got)
+	}
+	// The window holds only the last call.
+	b.Record(now, 2*time.Second, nil)
+	if got := b.State(); got != Open {
+		t.Errorf("State() = %v, want open", got)
+	}
+}
@@ -0,0 +1,73 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package peer
+
+import (
+	"fmt"
+	"testing"
+)
+
+func TestRing(t *testing.T) {
+	nodes := []string{"a:1", "b:1", "c:1", "d:1"}
+	ring := NewRing(nodes, ringReplicas)
+	smaller := NewRing(nodes[:3], ringReplicas)
+
+	if got := NewRing(nil, ringReplicas).Owner("geoId/06"); got != "" {
+		t.Errorf("Owner() of empty ring = %s", got)
+	}
+
+	count := map[string]int{}
+	moved := 0
+	numKeys := 10000
+	for i := 0; i < numKeys; i++ {
+		key := fmt.Sprintf("geoId/%05d", i)
+		owner := ring.Owner(key)
+		if owner != ring.Owner(key) {
+			t.Fatalf("Owner(%s) is not stable", key)
+		}
+		count[owner]++
+		if newOwner := smaller.Owner(key); newOwner != owner {
+			moved++
+			if owner != "d:1" {
+				t.Errorf("Owner(%s) moved from %s to %s", key, owner, newOwner)
+			}
+		}
+	}
+	for _, node := range nodes {
+		// Each node should get about a quarter of the keys.
+		if count[node] < numKeys/8 || count[node] > numKeys*3/8 {
+			t.Errorf("Node %s owns %d of %d keys", node, count[node], numKeys)
+		}
+	}
+	if moved != count["d:1"] {
+		t.Errorf("%d keys moved, want %d", moved, count["d:1"])
+	}
+}
+
+func TestPartitionKey(t *testing.T) {
+	for _, c := range []struct {
+		rowKey string
+		want   string
+	}{
+		{"d/f/geoId/06^Count_Person", "geoId/06"},
+		{"d/7/geoId/06^City", "geoId/06"},
+		{"d/2/Count_Person", "Count_Person"},
+		{"malformed", "malformed"},
+	} {
+		if got := partitionKey(c.rowKey); got != c.want {
+			t.Errorf("partitionKey(%s) = %s, want %s", c.rowKey, got, c.want)
+		}
+	}
+}
@@ -0,0 +1,217 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Package peer routes Bigtable reads to the mixer replica that owns the rows.
+//
+// Replicas own partitions of the row key space by consistent hashing on the
+// place dcid of the row key, so each replica only caches the rows of its own
+// partition.
+package peer
+
+import (
+	"context"
+	"fmt"
+	"log"
+	"net"
+	"sort"
+	"strings"
+	"sync"
+	"time"
+
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/datacommonsorg/mixer/internal/util"
+	"google.golang.org/grpc"
+)
+
+const (
+	// Number of virtual points of each replica on the hash ring.
+	ringReplicas = 128
+	dnsScheme    = "dns:///"
+)
+
+// Router maps row keys to the replicas that own them and reads rows from the
+// other replicas.
+type Router struct {
+	self    string
+	timeout time.Duration
+
+	mu      sync.RWMutex
+	peers   []string
+	ring    *Ring
+	conns   map[string]*grpc.ClientConn
+	clients map[string]pb.MixerPeerClient
+}
+
+// NewRouter creates a Router. self is the address of this replica as it
+// appears in the peer list. Reads from peers are cancelled after timeout.
+func NewRouter(self string, timeout time.Duration) *Router {
+	return &Router{
+		self:    self,
+		timeout: timeout,
+		ring:    NewRing(nil, ringReplicas),
+		conns:   map[string]*grpc.ClientConn{},
+		clients: map[string]pb.MixerPeerClient{},
+	}
+}
+
+// SetPeers updates the replicas, including this one. Connections are created
+// for the new replicas and closed for the removed ones.
+func (r *Router) SetPeers(peers []string) error {
+	peers = append([]string{}, peers...)
+	sort.Strings(peers)
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	if strings.Join(peers, ",") == strings.Join(r.peers, ",") {
+		return nil
+	}
+	current := map[string]struct{}{}
+	for _, peer := range peers {
+		current[peer] = struct{}{}
+		if peer == r.self {
+			continue
+		}
+		if _, ok := r.conns[peer]; ok {
+			continue
+		}
+		conn, err := grpc.Dial(peer, grpc.WithInsecure())
+		if err != nil {
+			return err
+		}
+		r.conns[peer] = conn
+		r.clients[peer] = pb.NewMixerPeerClient(conn)
+	}
+	for peer, conn := range r.conns {
+		if _, ok := current[peer]; !ok {
+			_ = conn.Close()
+			delete(r.conns, peer)
+			delete(r.clients, peer)
+		}
+	}
+	r.peers = peers
+	r.ring = NewRing(peers, ringReplicas)
+	log.Printf("Mixer peers: %v", peers)
+	return nil
+}
+
+// partitionKey returns the part of a row key that is hashed, which is the
+// place dcid for keys like "d/f/geoId/06^Count_Person".
+func partitionKey(rowKey string) string {
+	if dcid, err := util.KeyToDcid(rowKey); err == nil {
+		return dcid
+	}
+	return rowKey
+}
+
+// Owner returns the replica that owns a row key, or "" if it is this replica.
+func (r *Router) Owner(rowKey string) string {
+	r.mu.RLock()
+	defer r.mu.RUnlock()
+	owner := r.ring.Owner(partitionKey(rowKey))
+	if owner == r.self {
+		return ""
+	}
+	return owner
+}
+
+// Split splits row keys into the keys owned by this replica and the keys owned
+// by each of the other replicas.
+func (r *Router) Split(rowKeys []string) ([]string, map[string][]string) {
+	r.mu.RLock()
+	defer r.mu.RUnlock()
+	var local []string
+	remote := map[string][]string{}
+	for _, rowKey := range rowKeys {
+		owner := r.ring.Owner(partitionKey(rowKey))
+		if owner == "" || owner == r.self {
+			local = append(local, rowKey)
+		} else {
+			remote[owner] = append(remote[owner], rowKey)
+		}
+	}
+	return local, remote
+}
+
+// ReadRows reads rows of a table from a replica. The returned map is keyed by
+// row key and does not have the rows that do not exist.
+func (r *Router) ReadRows(
+	ctx context.Context, peer, table string, rowKeys []string) (
+	map[string][]byte, error) {
+	r.mu.RLock()
+	client, ok := r.clients[peer]
+	r.mu.RUnlock()
+	if !ok {
+		return nil, fmt.Errorf("unknown peer %s", peer)
+	}
+	ctx, cancel := context.WithTimeout(ctx, r.timeout)
+	defer cancel()
+	resp, err := client.ReadRows(ctx, &pb.PeerReadRowsRequest{
+		Table:   table,
+		RowKeys: rowKeys,
+	})
+	if err != nil {
+		return nil, err
+	}
+	return resp.GetRows(), nil
+}
+
+// Discover sets the replicas from a spec and keeps them up to date.
+//
+// The spec is either a comma separated list of addresses like
+// "10.0.0.1:12345,10.0.0.2:12345", or "dns:///<host>:<port>" to use all the
+// addresses of a DNS name, like the headless service of the deployment. DNS is
+// resolved again every interval until ctx is done.
+func (r *Router) Discover(ctx context.Context, spec string, interval time.Duration) error {
+	if !strings.HasPrefix(spec, dnsScheme) {
+		var peers []string
+		for _, peer := range strings.Split(spec, ",") {
+			if peer = strings.TrimSpace(peer); peer != "" {
+				peers = append(peers, peer)
+			}
+		}
+		return r.SetPeers(peers)
+	}
+	host, port, err := net.SplitHostPort(strings.TrimPrefix(spec, dnsScheme))
+	if err != nil {
+		return err
+	}
+	resolve := func() error {
+		addrs, err := net.DefaultResolver.LookupHost(ctx, host)
+		if err != nil {
+			return err
+		}
+		peers := make([]string, len(addrs))
+		for i, addr := range addrs {
+			peers[i] = net.JoinHostPort(addr, port)
+		}
+		return r.SetPeers(peers)
+	}
+	if err := resolve(); err != nil {
+		return err
+	}
+	go func() {
+		ticker := time.NewTicker(interval)
+		defer ticker.Stop()
+		for {
+			select {
+			case <-ctx.Done():
+				return
+			case <-ticker.C:
+				if err := resolve(); err != nil {
+					log.Printf("Failed to resolve mixer peers: %v", err)
+				}
+			}
+		}
+	}()
+	return nil
+}
@@ -0,0 +1,325 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Package prefetch warms the row cache with rows that are likely to be read
+// next, under a budget of rows per second.
+package prefetch
+
+import (
+	"context"
+	"log"
+	"sort"
+	"sync"
+	"sync/atomic"
+	"time"
+)
+
+const (
+	// Number of scheduled batches waiting to be fetched. Batches are dropped
+	// when the queue is full, so prefetch only uses spare capacity.
+	queueSize = 64
+	// Maximum number of prefetched rows tracked for hit attribution.
+	maxPending = 100000
+	// Number of shards of the tracked rows, so the cache hits of concurrent
+	// requests do not contend on one lock.
+	pendingShards = 32
+	// Prefetched rows that are not read within this time count as wasted.
+	pendingTTL = 10 * time.Minute
+	// Interval to report the stats and decay the stat var popularity.
+	reportInterval = time.Minute
+)
+
+// ReadFunc reads rows into the row cache and returns the keys of the rows that
+// were read and exist.
+type ReadFunc func(ctx context.Context, rowKeys []string) ([]string, error)
+
+// Stats are the counters of a Prefetcher.
+type Stats struct {
+	// Rows scheduled to prefetch.
+	Scheduled int64
+	// Rows not prefetched because of the budget or a full queue.
+	Dropped int64
+	// Rows read into the cache.
+	Fetched int64
+	// Prefetched rows that were later read by a request.
+	Hits int64
+	// Prefetched rows that were not read before they expired.
+	Wasted int64
+}
+
+// Prefetcher fetches scheduled rows in the background.
+type Prefetcher struct {
+	read   ReadFunc
+	budget int
+	queue  chan []string
+
+	// Token bucket of the rows that can be fetched.
+	tokenMu    sync.Mutex
+	tokens     float64
+	lastRefill time.Time
+
+	// Prefetched rows that are not read yet, with the time they were fetched.
+	pending [pendingShards]pendingShard
+	// Number of rows in pending, to skip the lookup when there are none.
+	numPending int64
+
+	statVars *Counter
+	stats    Stats
+}
+
+type pendingShard struct {
+	mu   sync.Mutex
+	rows map[string]time.Time
+}
+
+// New creates a Prefetcher that fetches up to rowsPerSecond rows per second.
+func New(read ReadFunc, rowsPerSecond int) *Prefetcher {
+	p := &Prefetcher{
+		read:       read,
+		budget:     rowsPerSecond,
+		queue:      make(chan []string, queueSize),
+		tokens:     float64(rowsPerSecond),
+		lastRefill: time.Now(),
+		statVars:   NewCounter(1000),
+	}
+	for i := range p.pending {
+		p.pending[i].rows = map[string]time.Time{}
+	}
+	return p
+}
+
+// shard returns the pending shard of a row, by the FNV-1a hash of its key.
+func (p *Prefetcher) shard(rowKey string) *pendingShard {
+	h := uint32(2166136261)
+	for i := 0; i < len(rowKey); i++ {
+		h ^= uint32(rowKey[i])
+		h *= 16777619
+	}
+	return &p.pending[h%pendingShards]
+}
+
+// Start fetches the scheduled rows until ctx is done.
+func (p *Prefetcher) Start(ctx context.Context) {
+	go func() {
+		for {
+			select {
+			case <-ctx.Done():
+				return
+			case rowKeys := <-p.queue:
+				p.fetch(ctx, rowKeys)
+			}
+		}
+	}()
+	go func() {
+		ticker := time.NewTicker(reportInterval)
+		defer ticker.Stop()
+		for {
+			select {
+			case <-ctx.Done():
+				return
+			case <-ticker.C:
+				p.expire(time.Now())
+				p.statVars.Decay()
+				stats := p.Stats()
+				log.Printf("Prefetch: scheduled %d, dropped %d, fetched %d, hits %d, wasted %d",
+					stats.Scheduled, stats.Dropped, stats.Fetched, stats.Hits, stats.Wasted)
+			}
+		}
+	}()
+}
+
+// Schedule schedules rows to prefetch, in the order of priority. It never
+// blocks. Nil Prefetcher is a no-op.
+func (p *Prefetcher) Schedule(rowKeys []string) {
+	if p == nil || len(rowKeys) == 0 {
+		return
+	}
+	atomic.AddInt64(&p.stats.Scheduled, int64(len(rowKeys)))
+	select {
+	case p.queue <- rowKeys:
+	default:
+		atomic.AddInt64(&p.stats.Dropped, int64(len(rowKeys)))
+	}
+}
+
+// take takes up to n tokens from the budget and returns the number taken.
+func (p *Prefetcher) take(n int, now time.Time) int {
+	p.tokenMu.Lock()
+	defer p.tokenMu.Unlock()
+	p.tokens += now.Sub(p.lastRefill).Seconds() * float64(p.budget)
+	if p.tokens > float64(p.budget) {
+		p.tokens = float64(p.budget)
+	}
+	p.lastRefill = now
+	if float64(n) > p.tokens {
+		n = int(p.tokens)
+	}
+	p.tokens -= float64(n)
+	return n
+}
+
+func (p *Prefetcher) fetch(ctx context.Context, rowKeys []string) {
+	n := p.take(len(rowKeys), time.Now())
+	if n < len(rowKeys) {
+		atomic.AddInt64(&p.stats.Dropped, int64(len(rowKeys)-n))
+		rowKeys = rowKeys[:n]
+	}
+	if len(rowKeys) == 0 {
+		return
+	}
+	fetched, err := p.read(ctx, rowKeys)
+	if err != nil {
+		log.Printf("Failed to prefetch %d rows: %v", len(rowKeys), err)
+	}
+	atomic.AddInt64(&p.stats.Fetched, int64(len(fetched)))
+	now := time.Now()
+	for _, rowKey := range fetched {
+		shard := p.shard(rowKey)
+		shard.mu.Lock()
+		if _, ok := shard.rows[rowKey]; !ok && len(shard.rows) < maxPending/pendingShards {
+			shard.rows[rowKey] = now
+			atomic.AddInt64(&p.numPending, 1)
+		}
+		shard.mu.Unlock()
+	}
+}
+
+// Used records that a request read a row from the cache. Nil Prefetcher is a
+// no-op.
+func (p *Prefetcher) Used(rowKey string) {
+	if p == nil || atomic.LoadInt64(&p.numPending) == 0 {
+		return
+	}
+	shard := p.shard(rowKey)
+	shard.mu.Lock()
+	_, ok := shard.rows[rowKey]
+	if ok {
+		delete(shard.rows, rowKey)
+	}
+	shard.mu.Unlock()
+	if ok {
+		atomic.AddInt64(&p.numPending, -1)
+		atomic.AddInt64(&p.stats.Hits, 1)
+	}
+}
+
+func (p *Prefetcher) expire(now time.Time) {
+	for i := range p.pending {
+		shard := &p.pending[i]
+		shard.mu.Lock()
+		for rowKey, t := range shard.rows {
+			if now.Sub(t) > pendingTTL {
+				delete(shard.rows, rowKey)
+				atomic.AddInt64(&p.numPending, -1)
+				atomic.AddInt64(&p.stats.Wasted, 1)
+			}
+		}
+		shard.mu.Unlock()
+	}
+}
+
+// ObserveStatVars records the stat vars of a request. Nil Prefetcher is a
+// no-op.
+func (p *Prefetcher) ObserveStatVars(statVars []string) {
+	if p == nil {
+		return
+	}
+	p.statVars.Observe(statVars)
+}
+
+// HotStatVars returns the n most requested stat vars.
+func (p *Prefetcher) HotStatVars(n int) []string {
+	return p.statVars.Top(n)
+}
+
+// Stats returns the counters.
+func (p *Prefetcher) Stats() Stats {
+	return Stats{
+		Scheduled: atomic.LoadInt64(&p.stats.Scheduled),
+		Dropped:   atomic.LoadInt64(&p.stats.Dropped),
+		Fetched:   atomic.LoadInt64(&p.stats.Fetched),
+		Hits:      atomic.LoadInt64(&p.stats.Hits),
+		Wasted:    atomic.LoadInt64(&p.stats.Wasted),
+	}
+}
+
+// Counter counts items with exponential decay, keeping about the most frequent
+// items.
+type Counter struct {
+	mu       sync.Mutex
+	capacity int
+	counts   map[string]float64
+}
+
+// NewCounter creates a Counter that keeps up to about capacity items.
+func NewCounter(capacity int) *Counter {
+	return &Counter{capacity: capacity, counts: map[string]float64{}}
+}
+
+// Observe counts the items once each.
+func (c *Counter) Observe(items []string) {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	for _, item := range items {
+		if _, ok := c.counts[item]; !ok && len(c.counts) >= 2*c.capacity {
+			c.prune()
+		}
+		c.counts[item]++
+	}
+}
+
+// Decay halves the counts, so recent requests count more.
+func (c *Counter) Decay() {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	for item, count := range c.counts {
+		if count < 1 {
+			delete(c.counts, item)
+		} else {
+			c.counts[item] = count / 2
+		}
+	}
+}
+
+// prune keeps the most frequent items. Must be called with the lock held.
+func (c *Counter) prune() {
+	for _, item := range c.sorted()[c.capacity:] {
+		delete(c.counts, item)
+	}
+}
+
+func (c *Counter) sorted() []string {
+	items := make([]string, 0, len(c.counts))
+	for item := range c.counts {
+		items = append(items, item)
+	}
+	sort.Slice(items, func(i, j int) bool {
+		if c.counts[items[i]] == c.counts[items[j]] {
+			return items[i] < items[j]
+		}
+		return c.counts[items[i]] > c.counts[items[j]]
+	})
+	return items
+}
+
+// Top returns the n most frequent items.
+func (c *Counter) Top(n int) []string {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	items := c.sorted()
+	if len(items) > n {
+		items = items[:n]
+	}
+	return items
+}
@@ -0,0 +1,79 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package prefetch
+
+import (
+	"context"
+	"testing"
+	"time"
+
+	"github.com/google/go-cmp/cmp"
+)
+
+func TestPrefetcher(t *testing.T) {
+	var read []string
+	p := New(func(ctx context.Context, rowKeys []string) ([]string, error) {
+		read = append(read, rowKeys...)
+		// "a" does not exist.
+		var fetched []string
+		for _, rowKey := range rowKeys {
+			if rowKey != "a" {
+				fetched = append(fetched, rowKey)
+			}
+		}
+		return fetched, nil
+	}, 3)
+
+	// Only 3 rows fit in the budget.
+	p.fetch(context.Background(), []string{"a", "b", "c", "d", "e"})
+	if diff := cmp.Diff([]string{"a", "b", "c"}, read); diff != "" {
+		t.Errorf("fetch() read diff %v", diff)
+	}
+	p.Used("a")
+	p.Used("b")
+	p.Used("b")
+	p.expire(time.Now().Add(2 * pendingTTL))
+
+	want := Stats{Dropped: 2, Fetched: 2, Hits: 1, Wasted: 1}
+	if diff := cmp.Diff(want, p.Stats()); diff != "" {
+		t.Errorf("Stats() diff %v", diff)
+	}
+
+	// A nil Prefetcher is a no-op.
+	var nilPrefetcher *Prefetcher
+	nilPrefetcher.Schedule([]string{"a"})
+	nilPrefetcher.Used("a")
+	nilPrefetcher.ObserveStatVars([]string{"Count_Person"})
+}
+
+func TestCounter(t *testing.T) {
+	c := NewCounter(2)
+	c.Observe([]string{"a", "b", "c"})
+	c.Observe([]string{"b", "c"})
+	c.Observe([]string{"c"})
+	if diff := cmp.Diff([]string{"c", "b"}, c.Top(2)); diff != "" {
+		t.Errorf("Top() diff %v", diff)
+	}
+	// Items are pruned to the capacity when new items do not fit.
+	c.Observe([]string{"d", "e"})
+	if got := len(c.counts); got > 4 {
+		t.Errorf("Counter has %d items", got)
+	}
+	c.Decay()
+	c.Decay()
+	if diff := cmp.Diff([]string{"c"}, c.Top(1)); diff != "" {
+		t.Errorf("Top() after Decay() diff %v", diff)
+	}
+}
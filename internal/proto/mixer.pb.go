@@ -15,7 +15,7 @@
 // Code generated by protoc-gen-go. DO NOT EDIT.
 // versions:
 // 	protoc-gen-go v1.26.0
-// 	protoc        v3.17.0
+// 	protoc        v3.21.12
 // source: mixer.proto
 
 package proto
@@ -1014,6 +1014,335 @@ func (x *GetRelatedLocationsRequest) GetIsPerCapita() bool {
 	return false
 }
 
+// Request to get the places near a place or a location.
+type GetPlacesNearbyRequest struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// The place at the center. If not set, latitude and longitude are used.
+	Place     string  `protobuf:"bytes,1,opt,name=place,proto3" json:"place,omitempty"`
+	Latitude  float64 `protobuf:"fixed64,2,opt,name=latitude,proto3" json:"latitude,omitempty"`
+	Longitude float64 `protobuf:"fixed64,3,opt,name=longitude,proto3" json:"longitude,omitempty"`
+	// (Optional) Maximum distance in kilometers.
+	RadiusKm float64 `protobuf:"fixed64,4,opt,name=radius_km,json=radiusKm,proto3" json:"radius_km,omitempty"`
+	// (Optional) Maximum number of places, the nearest first. Defaults to 10
+	// without a radius.
+	Limit int32 `protobuf:"varint,5,opt,name=limit,proto3" json:"limit,omitempty"`
+	// (Optional) Only return places of this type.
+	PlaceType string `protobuf:"bytes,6,opt,name=place_type,json=placeType,proto3" json:"place_type,omitempty"`
+	// (Optional) Only return places with at least this population.
+	MinPopulation int64 `protobuf:"varint,7,opt,name=min_population,json=minPopulation,proto3" json:"min_population,omitempty"`
+}
+
+func (x *GetPlacesNearbyRequest) Reset() {
+	*x = GetPlacesNearbyRequest{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_mixer_proto_msgTypes[17]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *GetPlacesNearbyRequest) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*GetPlacesNearbyRequest) ProtoMessage() {}
+
+func (x *GetPlacesNearbyRequest) ProtoReflect() protoreflect.Message {
+	mi := &file_mixer_proto_msgTypes[17]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use GetPlacesNearbyRequest.ProtoReflect.Descriptor instead.
+func (*GetPlacesNearbyRequest) Descriptor() ([]byte, []int) {
+	return file_mixer_proto_rawDescGZIP(), []int{17}
+}
+
+func (x *GetPlacesNearbyRequest) GetPlace() string {
+	if x != nil {
+		return x.Place
+	}
+	return ""
+}
+
+func (x *GetPlacesNearbyRequest) GetLatitude() float64 {
+	if x != nil {
+		return x.Latitude
+	}
+	return 0
+}
+
+func (x *GetPlacesNearbyRequest) GetLongitude() float64 {
+	if x != nil {
+		return x.Longitude
+	}
+	return 0
+}
+
+func (x *GetPlacesNearbyRequest) GetRadiusKm() float64 {
+	if x != nil {
+		return x.RadiusKm
+	}
+	return 0
+}
+
+func (x *GetPlacesNearbyRequest) GetLimit() int32 {
+	if x != nil {
+		return x.Limit
+	}
+	return 0
+}
+
+func (x *GetPlacesNearbyRequest) GetPlaceType() string {
+	if x != nil {
+		return x.PlaceType
+	}
+	return ""
+}
+
+func (x *GetPlacesNearbyRequest) GetMinPopulation() int64 {
+	if x != nil {
+		return x.MinPopulation
+	}
+	return 0
+}
+
+type NearbyPlace struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	Dcid       string  `protobuf:"bytes,1,opt,name=dcid,proto3" json:"dcid,omitempty"`
+	DistanceKm float64 `protobuf:"fixed64,2,opt,name=distance_km,json=distanceKm,proto3" json:"distance_km,omitempty"`
+	Population int64   `protobuf:"varint,3,opt,name=population,proto3" json:"population,omitempty"`
+}
+
+func (x *NearbyPlace) Reset() {
+	*x = NearbyPlace{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_mixer_proto_msgTypes[18]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *NearbyPlace) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*NearbyPlace) ProtoMessage() {}
+
+func (x *NearbyPlace) ProtoReflect() protoreflect.Message {
+	mi := &file_mixer_proto_msgTypes[18]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use NearbyPlace.ProtoReflect.Descriptor instead.
+func (*NearbyPlace) Descriptor() ([]byte, []int) {
+	return file_mixer_proto_rawDescGZIP(), []int{18}
+}
+
+func (x *NearbyPlace) GetDcid() string {
+	if x != nil {
+		return x.Dcid
+	}
+	return ""
+}
+
+func (x *NearbyPlace) GetDistanceKm() float64 {
+	if x != nil {
+		return x.DistanceKm
+	}
+	return 0
+}
+
+func (x *NearbyPlace) GetPopulation() int64 {
+	if x != nil {
+		return x.Population
+	}
+	return 0
+}
+
+type GetPlacesNearbyResponse struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// The nearest places first. The place at the center is not included.
+	Places []*NearbyPlace `protobuf:"bytes,1,rep,name=places,proto3" json:"places,omitempty"`
+}
+
+func (x *GetPlacesNearbyResponse) Reset() {
+	*x = GetPlacesNearbyResponse{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_mixer_proto_msgTypes[19]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *GetPlacesNearbyResponse) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*GetPlacesNearbyResponse) ProtoMessage() {}
+
+func (x *GetPlacesNearbyResponse) ProtoReflect() protoreflect.Message {
+	mi := &file_mixer_proto_msgTypes[19]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use GetPlacesNearbyResponse.ProtoReflect.Descriptor instead.
+func (*GetPlacesNearbyResponse) Descriptor() ([]byte, []int) {
+	return file_mixer_proto_rawDescGZIP(), []int{19}
+}
+
+func (x *GetPlacesNearbyResponse) GetPlaces() []*NearbyPlace {
+	if x != nil {
+		return x.Places
+	}
+	return nil
+}
+
+// Request to get the ancestors of places.
+type GetPlaceAncestorsRequest struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	Places []string `protobuf:"bytes,1,rep,name=places,proto3" json:"places,omitempty"`
+	// (Optional) Only return ancestors of these types. The chain still goes
+	// through the ancestors of other types.
+	PlaceTypes []string `protobuf:"bytes,2,rep,name=place_types,json=placeTypes,proto3" json:"place_types,omitempty"`
+	// (Optional) Whether to include CensusZipCodeTabulationArea ancestors,
+	// which are skipped by default.
+	IncludeZipCodes bool `protobuf:"varint,3,opt,name=include_zip_codes,json=includeZipCodes,proto3" json:"include_zip_codes,omitempty"`
+}
+
+func (x *GetPlaceAncestorsRequest) Reset() {
+	*x = GetPlaceAncestorsRequest{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_mixer_proto_msgTypes[20]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *GetPlaceAncestorsRequest) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*GetPlaceAncestorsRequest) ProtoMessage() {}
+
+func (x *GetPlaceAncestorsRequest) ProtoReflect() protoreflect.Message {
+	mi := &file_mixer_proto_msgTypes[20]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use GetPlaceAncestorsRequest.ProtoReflect.Descriptor instead.
+func (*GetPlaceAncestorsRequest) Descriptor() ([]byte, []int) {
+	return file_mixer_proto_rawDescGZIP(), []int{20}
+}
+
+func (x *GetPlaceAncestorsRequest) GetPlaces() []string {
+	if x != nil {
+		return x.Places
+	}
+	return nil
+}
+
+func (x *GetPlaceAncestorsRequest) GetPlaceTypes() []string {
+	if x != nil {
+		return x.PlaceTypes
+	}
+	return nil
+}
+
+func (x *GetPlaceAncestorsRequest) GetIncludeZipCodes() bool {
+	if x != nil {
+		return x.IncludeZipCodes
+	}
+	return false
+}
+
+type GetPlaceAncestorsResponse struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Keyed by place dcid, the nearest ancestor first.
+	Ancestors map[string]*Places `protobuf:"bytes,1,rep,name=ancestors,proto3" json:"ancestors,omitempty" protobuf_key:"bytes,1,opt,name=key,proto3" protobuf_val:"bytes,2,opt,name=value,proto3"`
+}
+
+func (x *GetPlaceAncestorsResponse) Reset() {
+	*x = GetPlaceAncestorsResponse{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_mixer_proto_msgTypes[21]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *GetPlaceAncestorsResponse) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*GetPlaceAncestorsResponse) ProtoMessage() {}
+
+func (x *GetPlaceAncestorsResponse) ProtoReflect() protoreflect.Message {
+	mi := &file_mixer_proto_msgTypes[21]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use GetPlaceAncestorsResponse.ProtoReflect.Descriptor instead.
+func (*GetPlaceAncestorsResponse) Descriptor() ([]byte, []int) {
+	return file_mixer_proto_rawDescGZIP(), []int{21}
+}
+
+func (x *GetPlaceAncestorsResponse) GetAncestors() map[string]*Places {
+	if x != nil {
+		return x.Ancestors
+	}
+	return nil
+}
+
 // Request to get rankings of locations for given stat var DCIDs.
 type GetLocationsRankingsRequest struct {
 	state         protoimpl.MessageState
@@ -1032,7 +1361,7 @@ type GetLocationsRankingsRequest struct {
 func (x *GetLocationsRankingsRequest) Reset() {
 	*x = GetLocationsRankingsRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[17]
+		mi := &file_mixer_proto_msgTypes[22]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1045,7 +1374,7 @@ func (x *GetLocationsRankingsRequest) String() string {
 func (*GetLocationsRankingsRequest) ProtoMessage() {}
 
 func (x *GetLocationsRankingsRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[17]
+	mi := &file_mixer_proto_msgTypes[22]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1058,7 +1387,7 @@ func (x *GetLocationsRankingsRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetLocationsRankingsRequest.ProtoReflect.Descriptor instead.
 func (*GetLocationsRankingsRequest) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{17}
+	return file_mixer_proto_rawDescGZIP(), []int{22}
 }
 
 func (x *GetLocationsRankingsRequest) GetStatVarDcids() []string {
@@ -1100,7 +1429,7 @@ type GetLocationsRankingsResponse struct {
 func (x *GetLocationsRankingsResponse) Reset() {
 	*x = GetLocationsRankingsResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[18]
+		mi := &file_mixer_proto_msgTypes[23]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1113,7 +1442,7 @@ func (x *GetLocationsRankingsResponse) String() string {
 func (*GetLocationsRankingsResponse) ProtoMessage() {}
 
 func (x *GetLocationsRankingsResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[18]
+	mi := &file_mixer_proto_msgTypes[23]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1126,7 +1455,7 @@ func (x *GetLocationsRankingsResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetLocationsRankingsResponse.ProtoReflect.Descriptor instead.
 func (*GetLocationsRankingsResponse) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{18}
+	return file_mixer_proto_rawDescGZIP(), []int{23}
 }
 
 func (x *GetLocationsRankingsResponse) GetPayload() map[string]*RelatedPlacesInfo {
@@ -1149,7 +1478,7 @@ type GetRelatedLocationsResponse struct {
 func (x *GetRelatedLocationsResponse) Reset() {
 	*x = GetRelatedLocationsResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[19]
+		mi := &file_mixer_proto_msgTypes[24]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1162,7 +1491,7 @@ func (x *GetRelatedLocationsResponse) String() string {
 func (*GetRelatedLocationsResponse) ProtoMessage() {}
 
 func (x *GetRelatedLocationsResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[19]
+	mi := &file_mixer_proto_msgTypes[24]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1175,7 +1504,7 @@ func (x *GetRelatedLocationsResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetRelatedLocationsResponse.ProtoReflect.Descriptor instead.
 func (*GetRelatedLocationsResponse) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{19}
+	return file_mixer_proto_rawDescGZIP(), []int{24}
 }
 
 func (x *GetRelatedLocationsResponse) GetPayload() string {
@@ -1198,7 +1527,7 @@ type Place struct {
 func (x *Place) Reset() {
 	*x = Place{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[20]
+		mi := &file_mixer_proto_msgTypes[25]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1211,7 +1540,7 @@ func (x *Place) String() string {
 func (*Place) ProtoMessage() {}
 
 func (x *Place) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[20]
+	mi := &file_mixer_proto_msgTypes[25]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1224,7 +1553,7 @@ func (x *Place) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Place.ProtoReflect.Descriptor instead.
 func (*Place) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{20}
+	return file_mixer_proto_rawDescGZIP(), []int{25}
 }
 
 func (x *Place) GetDcid() string {
@@ -1259,7 +1588,7 @@ type Places struct {
 func (x *Places) Reset() {
 	*x = Places{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[21]
+		mi := &file_mixer_proto_msgTypes[26]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1272,7 +1601,7 @@ func (x *Places) String() string {
 func (*Places) ProtoMessage() {}
 
 func (x *Places) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[21]
+	mi := &file_mixer_proto_msgTypes[26]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1285,7 +1614,7 @@ func (x *Places) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Places.ProtoReflect.Descriptor instead.
 func (*Places) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{21}
+	return file_mixer_proto_rawDescGZIP(), []int{26}
 }
 
 func (x *Places) GetPlaces() []*Place {
@@ -1315,7 +1644,7 @@ type GetLandingPageDataRequest struct {
 func (x *GetLandingPageDataRequest) Reset() {
 	*x = GetLandingPageDataRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[22]
+		mi := &file_mixer_proto_msgTypes[27]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1328,7 +1657,7 @@ func (x *GetLandingPageDataRequest) String() string {
 func (*GetLandingPageDataRequest) ProtoMessage() {}
 
 func (x *GetLandingPageDataRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[22]
+	mi := &file_mixer_proto_msgTypes[27]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1341,7 +1670,7 @@ func (x *GetLandingPageDataRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetLandingPageDataRequest.ProtoReflect.Descriptor instead.
 func (*GetLandingPageDataRequest) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{22}
+	return file_mixer_proto_rawDescGZIP(), []int{27}
 }
 
 func (x *GetLandingPageDataRequest) GetPlace() string {
@@ -1384,7 +1713,7 @@ type GetLandingPageDataResponse struct {
 func (x *GetLandingPageDataResponse) Reset() {
 	*x = GetLandingPageDataResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[23]
+		mi := &file_mixer_proto_msgTypes[28]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1397,7 +1726,7 @@ func (x *GetLandingPageDataResponse) String() string {
 func (*GetLandingPageDataResponse) ProtoMessage() {}
 
 func (x *GetLandingPageDataResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[23]
+	mi := &file_mixer_proto_msgTypes[28]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1410,7 +1739,7 @@ func (x *GetLandingPageDataResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetLandingPageDataResponse.ProtoReflect.Descriptor instead.
 func (*GetLandingPageDataResponse) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{23}
+	return file_mixer_proto_rawDescGZIP(), []int{28}
 }
 
 func (x *GetLandingPageDataResponse) GetStatVarSeries() map[string]*StatVarSeries {
@@ -1480,7 +1809,7 @@ type SearchRequest struct {
 func (x *SearchRequest) Reset() {
 	*x = SearchRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[24]
+		mi := &file_mixer_proto_msgTypes[29]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1493,7 +1822,7 @@ func (x *SearchRequest) String() string {
 func (*SearchRequest) ProtoMessage() {}
 
 func (x *SearchRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[24]
+	mi := &file_mixer_proto_msgTypes[29]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1506,7 +1835,7 @@ func (x *SearchRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use SearchRequest.ProtoReflect.Descriptor instead.
 func (*SearchRequest) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{24}
+	return file_mixer_proto_rawDescGZIP(), []int{29}
 }
 
 func (x *SearchRequest) GetQuery() string {
@@ -1536,7 +1865,7 @@ type SearchResponse struct {
 func (x *SearchResponse) Reset() {
 	*x = SearchResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[25]
+		mi := &file_mixer_proto_msgTypes[30]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1549,7 +1878,7 @@ func (x *SearchResponse) String() string {
 func (*SearchResponse) ProtoMessage() {}
 
 func (x *SearchResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[25]
+	mi := &file_mixer_proto_msgTypes[30]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1562,7 +1891,7 @@ func (x *SearchResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use SearchResponse.ProtoReflect.Descriptor instead.
 func (*SearchResponse) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{25}
+	return file_mixer_proto_rawDescGZIP(), []int{30}
 }
 
 func (x *SearchResponse) GetSection() []*SearchResultSection {
@@ -1582,7 +1911,7 @@ type GetVersionRequest struct {
 func (x *GetVersionRequest) Reset() {
 	*x = GetVersionRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[26]
+		mi := &file_mixer_proto_msgTypes[31]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1595,7 +1924,7 @@ func (x *GetVersionRequest) String() string {
 func (*GetVersionRequest) ProtoMessage() {}
 
 func (x *GetVersionRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[26]
+	mi := &file_mixer_proto_msgTypes[31]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1608,7 +1937,7 @@ func (x *GetVersionRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetVersionRequest.ProtoReflect.Descriptor instead.
 func (*GetVersionRequest) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{26}
+	return file_mixer_proto_rawDescGZIP(), []int{31}
 }
 
 // Get version response.
@@ -1630,7 +1959,7 @@ type GetVersionResponse struct {
 func (x *GetVersionResponse) Reset() {
 	*x = GetVersionResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[27]
+		mi := &file_mixer_proto_msgTypes[32]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1643,7 +1972,7 @@ func (x *GetVersionResponse) String() string {
 func (*GetVersionResponse) ProtoMessage() {}
 
 func (x *GetVersionResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[27]
+	mi := &file_mixer_proto_msgTypes[32]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1656,7 +1985,7 @@ func (x *GetVersionResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetVersionResponse.ProtoReflect.Descriptor instead.
 func (*GetVersionResponse) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{27}
+	return file_mixer_proto_rawDescGZIP(), []int{32}
 }
 
 func (x *GetVersionResponse) GetStore() string {
@@ -1702,7 +2031,7 @@ type SearchResultSection struct {
 func (x *SearchResultSection) Reset() {
 	*x = SearchResultSection{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[28]
+		mi := &file_mixer_proto_msgTypes[33]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1715,7 +2044,7 @@ func (x *SearchResultSection) String() string {
 func (*SearchResultSection) ProtoMessage() {}
 
 func (x *SearchResultSection) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[28]
+	mi := &file_mixer_proto_msgTypes[33]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1728,7 +2057,7 @@ func (x *SearchResultSection) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use SearchResultSection.ProtoReflect.Descriptor instead.
 func (*SearchResultSection) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{28}
+	return file_mixer_proto_rawDescGZIP(), []int{33}
 }
 
 func (x *SearchResultSection) GetTypeName() string {
@@ -1760,7 +2089,7 @@ type SearchEntityResult struct {
 func (x *SearchEntityResult) Reset() {
 	*x = SearchEntityResult{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[29]
+		mi := &file_mixer_proto_msgTypes[34]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1773,7 +2102,7 @@ func (x *SearchEntityResult) String() string {
 func (*SearchEntityResult) ProtoMessage() {}
 
 func (x *SearchEntityResult) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[29]
+	mi := &file_mixer_proto_msgTypes[34]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1786,7 +2115,7 @@ func (x *SearchEntityResult) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use SearchEntityResult.ProtoReflect.Descriptor instead.
 func (*SearchEntityResult) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{29}
+	return file_mixer_proto_rawDescGZIP(), []int{34}
 }
 
 func (x *SearchEntityResult) GetDcid() string {
@@ -1815,7 +2144,7 @@ type StatsVars struct {
 func (x *StatsVars) Reset() {
 	*x = StatsVars{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[30]
+		mi := &file_mixer_proto_msgTypes[35]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1828,7 +2157,7 @@ func (x *StatsVars) String() string {
 func (*StatsVars) ProtoMessage() {}
 
 func (x *StatsVars) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[30]
+	mi := &file_mixer_proto_msgTypes[35]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1841,7 +2170,7 @@ func (x *StatsVars) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use StatsVars.ProtoReflect.Descriptor instead.
 func (*StatsVars) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{30}
+	return file_mixer_proto_rawDescGZIP(), []int{35}
 }
 
 func (x *StatsVars) GetStatsVars() []string {
@@ -1864,7 +2193,7 @@ type GetPlaceStatsVarRequest struct {
 func (x *GetPlaceStatsVarRequest) Reset() {
 	*x = GetPlaceStatsVarRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[31]
+		mi := &file_mixer_proto_msgTypes[36]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1877,7 +2206,7 @@ func (x *GetPlaceStatsVarRequest) String() string {
 func (*GetPlaceStatsVarRequest) ProtoMessage() {}
 
 func (x *GetPlaceStatsVarRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[31]
+	mi := &file_mixer_proto_msgTypes[36]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1890,7 +2219,7 @@ func (x *GetPlaceStatsVarRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetPlaceStatsVarRequest.ProtoReflect.Descriptor instead.
 func (*GetPlaceStatsVarRequest) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{31}
+	return file_mixer_proto_rawDescGZIP(), []int{36}
 }
 
 func (x *GetPlaceStatsVarRequest) GetDcids() []string {
@@ -1913,7 +2242,7 @@ type GetPlaceStatsVarResponse struct {
 func (x *GetPlaceStatsVarResponse) Reset() {
 	*x = GetPlaceStatsVarResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[32]
+		mi := &file_mixer_proto_msgTypes[37]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1926,7 +2255,7 @@ func (x *GetPlaceStatsVarResponse) String() string {
 func (*GetPlaceStatsVarResponse) ProtoMessage() {}
 
 func (x *GetPlaceStatsVarResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[32]
+	mi := &file_mixer_proto_msgTypes[37]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1939,7 +2268,7 @@ func (x *GetPlaceStatsVarResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetPlaceStatsVarResponse.ProtoReflect.Descriptor instead.
 func (*GetPlaceStatsVarResponse) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{32}
+	return file_mixer_proto_rawDescGZIP(), []int{37}
 }
 
 func (x *GetPlaceStatsVarResponse) GetPlaces() map[string]*StatsVars {
@@ -1961,7 +2290,7 @@ type StatVars struct {
 func (x *StatVars) Reset() {
 	*x = StatVars{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[33]
+		mi := &file_mixer_proto_msgTypes[38]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1974,7 +2303,7 @@ func (x *StatVars) String() string {
 func (*StatVars) ProtoMessage() {}
 
 func (x *StatVars) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[33]
+	mi := &file_mixer_proto_msgTypes[38]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1987,7 +2316,7 @@ func (x *StatVars) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use StatVars.ProtoReflect.Descriptor instead.
 func (*StatVars) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{33}
+	return file_mixer_proto_rawDescGZIP(), []int{38}
 }
 
 func (x *StatVars) GetStatVars() []string {
@@ -2010,7 +2339,7 @@ type GetPlaceStatVarsRequest struct {
 func (x *GetPlaceStatVarsRequest) Reset() {
 	*x = GetPlaceStatVarsRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[34]
+		mi := &file_mixer_proto_msgTypes[39]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -2023,7 +2352,7 @@ func (x *GetPlaceStatVarsRequest) String() string {
 func (*GetPlaceStatVarsRequest) ProtoMessage() {}
 
 func (x *GetPlaceStatVarsRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[34]
+	mi := &file_mixer_proto_msgTypes[39]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -2036,7 +2365,7 @@ func (x *GetPlaceStatVarsRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetPlaceStatVarsRequest.ProtoReflect.Descriptor instead.
 func (*GetPlaceStatVarsRequest) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{34}
+	return file_mixer_proto_rawDescGZIP(), []int{39}
 }
 
 func (x *GetPlaceStatVarsRequest) GetDcids() []string {
@@ -2059,7 +2388,7 @@ type GetPlaceStatVarsResponse struct {
 func (x *GetPlaceStatVarsResponse) Reset() {
 	*x = GetPlaceStatVarsResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[35]
+		mi := &file_mixer_proto_msgTypes[40]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -2072,7 +2401,7 @@ func (x *GetPlaceStatVarsResponse) String() string {
 func (*GetPlaceStatVarsResponse) ProtoMessage() {}
 
 func (x *GetPlaceStatVarsResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[35]
+	mi := &file_mixer_proto_msgTypes[40]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -2085,7 +2414,7 @@ func (x *GetPlaceStatVarsResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetPlaceStatVarsResponse.ProtoReflect.Descriptor instead.
 func (*GetPlaceStatVarsResponse) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{35}
+	return file_mixer_proto_rawDescGZIP(), []int{40}
 }
 
 func (x *GetPlaceStatVarsResponse) GetPlaces() map[string]*StatVars {
@@ -2110,7 +2439,7 @@ type GetPlaceStatVarsUnionRequest struct {
 func (x *GetPlaceStatVarsUnionRequest) Reset() {
 	*x = GetPlaceStatVarsUnionRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[36]
+		mi := &file_mixer_proto_msgTypes[41]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -2123,7 +2452,7 @@ func (x *GetPlaceStatVarsUnionRequest) String() string {
 func (*GetPlaceStatVarsUnionRequest) ProtoMessage() {}
 
 func (x *GetPlaceStatVarsUnionRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[36]
+	mi := &file_mixer_proto_msgTypes[41]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -2136,7 +2465,7 @@ func (x *GetPlaceStatVarsUnionRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetPlaceStatVarsUnionRequest.ProtoReflect.Descriptor instead.
 func (*GetPlaceStatVarsUnionRequest) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{36}
+	return file_mixer_proto_rawDescGZIP(), []int{41}
 }
 
 func (x *GetPlaceStatVarsUnionRequest) GetDcids() []string {
@@ -2166,7 +2495,7 @@ type GetPlaceStatVarsUnionResponse struct {
 func (x *GetPlaceStatVarsUnionResponse) Reset() {
 	*x = GetPlaceStatVarsUnionResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[37]
+		mi := &file_mixer_proto_msgTypes[42]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -2179,7 +2508,7 @@ func (x *GetPlaceStatVarsUnionResponse) String() string {
 func (*GetPlaceStatVarsUnionResponse) ProtoMessage() {}
 
 func (x *GetPlaceStatVarsUnionResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[37]
+	mi := &file_mixer_proto_msgTypes[42]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -2192,7 +2521,7 @@ func (x *GetPlaceStatVarsUnionResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetPlaceStatVarsUnionResponse.ProtoReflect.Descriptor instead.
 func (*GetPlaceStatVarsUnionResponse) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{37}
+	return file_mixer_proto_rawDescGZIP(), []int{42}
 }
 
 func (x *GetPlaceStatVarsUnionResponse) GetStatVars() *StatVars {
@@ -2214,7 +2543,7 @@ type GetPlaceStatVarsUnionResponseV1 struct {
 func (x *GetPlaceStatVarsUnionResponseV1) Reset() {
 	*x = GetPlaceStatVarsUnionResponseV1{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[38]
+		mi := &file_mixer_proto_msgTypes[43]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -2227,7 +2556,7 @@ func (x *GetPlaceStatVarsUnionResponseV1) String() string {
 func (*GetPlaceStatVarsUnionResponseV1) ProtoMessage() {}
 
 func (x *GetPlaceStatVarsUnionResponseV1) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[38]
+	mi := &file_mixer_proto_msgTypes[43]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -2240,7 +2569,7 @@ func (x *GetPlaceStatVarsUnionResponseV1) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetPlaceStatVarsUnionResponseV1.ProtoReflect.Descriptor instead.
 func (*GetPlaceStatVarsUnionResponseV1) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{38}
+	return file_mixer_proto_rawDescGZIP(), []int{43}
 }
 
 func (x *GetPlaceStatVarsUnionResponseV1) GetStatVars() []string {
@@ -2262,7 +2591,7 @@ type StatVarGroups struct {
 func (x *StatVarGroups) Reset() {
 	*x = StatVarGroups{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[39]
+		mi := &file_mixer_proto_msgTypes[44]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -2275,7 +2604,7 @@ func (x *StatVarGroups) String() string {
 func (*StatVarGroups) ProtoMessage() {}
 
 func (x *StatVarGroups) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[39]
+	mi := &file_mixer_proto_msgTypes[44]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -2288,7 +2617,7 @@ func (x *StatVarGroups) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use StatVarGroups.ProtoReflect.Descriptor instead.
 func (*StatVarGroups) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{39}
+	return file_mixer_proto_rawDescGZIP(), []int{44}
 }
 
 func (x *StatVarGroups) GetStatVarGroups() map[string]*StatVarGroupNode {
@@ -2319,7 +2648,7 @@ type StatVarGroupNode struct {
 func (x *StatVarGroupNode) Reset() {
 	*x = StatVarGroupNode{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[40]
+		mi := &file_mixer_proto_msgTypes[45]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -2332,7 +2661,7 @@ func (x *StatVarGroupNode) String() string {
 func (*StatVarGroupNode) ProtoMessage() {}
 
 func (x *StatVarGroupNode) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[40]
+	mi := &file_mixer_proto_msgTypes[45]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -2345,7 +2674,7 @@ func (x *StatVarGroupNode) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use StatVarGroupNode.ProtoReflect.Descriptor instead.
 func (*StatVarGroupNode) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{40}
+	return file_mixer_proto_rawDescGZIP(), []int{45}
 }
 
 func (x *StatVarGroupNode) GetAbsoluteName() string {
@@ -2394,7 +2723,7 @@ type GetStatVarGroupRequest struct {
 func (x *GetStatVarGroupRequest) Reset() {
 	*x = GetStatVarGroupRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[41]
+		mi := &file_mixer_proto_msgTypes[46]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -2407,7 +2736,7 @@ func (x *GetStatVarGroupRequest) String() string {
 func (*GetStatVarGroupRequest) ProtoMessage() {}
 
 func (x *GetStatVarGroupRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[41]
+	mi := &file_mixer_proto_msgTypes[46]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -2420,7 +2749,7 @@ func (x *GetStatVarGroupRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetStatVarGroupRequest.ProtoReflect.Descriptor instead.
 func (*GetStatVarGroupRequest) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{41}
+	return file_mixer_proto_rawDescGZIP(), []int{46}
 }
 
 func (x *GetStatVarGroupRequest) GetPlaces() []string {
@@ -2448,7 +2777,7 @@ type GetStatVarGroupNodeRequest struct {
 func (x *GetStatVarGroupNodeRequest) Reset() {
 	*x = GetStatVarGroupNodeRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[42]
+		mi := &file_mixer_proto_msgTypes[47]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -2461,7 +2790,7 @@ func (x *GetStatVarGroupNodeRequest) String() string {
 func (*GetStatVarGroupNodeRequest) ProtoMessage() {}
 
 func (x *GetStatVarGroupNodeRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[42]
+	mi := &file_mixer_proto_msgTypes[47]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -2474,7 +2803,7 @@ func (x *GetStatVarGroupNodeRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetStatVarGroupNodeRequest.ProtoReflect.Descriptor instead.
 func (*GetStatVarGroupNodeRequest) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{42}
+	return file_mixer_proto_rawDescGZIP(), []int{47}
 }
 
 func (x *GetStatVarGroupNodeRequest) GetStatVarGroup() string {
@@ -2519,7 +2848,7 @@ type SVOPlace struct {
 func (x *SVOPlace) Reset() {
 	*x = SVOPlace{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[43]
+		mi := &file_mixer_proto_msgTypes[48]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -2532,7 +2861,7 @@ func (x *SVOPlace) String() string {
 func (*SVOPlace) ProtoMessage() {}
 
 func (x *SVOPlace) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[43]
+	mi := &file_mixer_proto_msgTypes[48]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -2545,7 +2874,7 @@ func (x *SVOPlace) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use SVOPlace.ProtoReflect.Descriptor instead.
 func (*SVOPlace) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{43}
+	return file_mixer_proto_rawDescGZIP(), []int{48}
 }
 
 func (x *SVOPlace) GetName() string {
@@ -2615,7 +2944,7 @@ type SVOObservation struct {
 func (x *SVOObservation) Reset() {
 	*x = SVOObservation{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[44]
+		mi := &file_mixer_proto_msgTypes[49]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -2628,7 +2957,7 @@ func (x *SVOObservation) String() string {
 func (*SVOObservation) ProtoMessage() {}
 
 func (x *SVOObservation) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[44]
+	mi := &file_mixer_proto_msgTypes[49]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -2641,7 +2970,7 @@ func (x *SVOObservation) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use SVOObservation.ProtoReflect.Descriptor instead.
 func (*SVOObservation) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{44}
+	return file_mixer_proto_rawDescGZIP(), []int{49}
 }
 
 func (x *SVOObservation) GetDcid() string {
@@ -2751,7 +3080,7 @@ type SVOCollection struct {
 func (x *SVOCollection) Reset() {
 	*x = SVOCollection{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[45]
+		mi := &file_mixer_proto_msgTypes[50]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -2764,7 +3093,7 @@ func (x *SVOCollection) String() string {
 func (*SVOCollection) ProtoMessage() {}
 
 func (x *SVOCollection) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[45]
+	mi := &file_mixer_proto_msgTypes[50]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -2777,7 +3106,7 @@ func (x *SVOCollection) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use SVOCollection.ProtoReflect.Descriptor instead.
 func (*SVOCollection) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{45}
+	return file_mixer_proto_rawDescGZIP(), []int{50}
 }
 
 func (x *SVOCollection) GetPlaces() []*SVOPlace {
@@ -2803,7 +3132,7 @@ type EntityInfo struct {
 func (x *EntityInfo) Reset() {
 	*x = EntityInfo{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[46]
+		mi := &file_mixer_proto_msgTypes[51]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -2816,7 +3145,7 @@ func (x *EntityInfo) String() string {
 func (*EntityInfo) ProtoMessage() {}
 
 func (x *EntityInfo) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[46]
+	mi := &file_mixer_proto_msgTypes[51]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -2829,7 +3158,7 @@ func (x *EntityInfo) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use EntityInfo.ProtoReflect.Descriptor instead.
 func (*EntityInfo) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{46}
+	return file_mixer_proto_rawDescGZIP(), []int{51}
 }
 
 func (x *EntityInfo) GetName() string {
@@ -2880,7 +3209,7 @@ type EntityInfoCollection struct {
 func (x *EntityInfoCollection) Reset() {
 	*x = EntityInfoCollection{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[47]
+		mi := &file_mixer_proto_msgTypes[52]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -2893,7 +3222,7 @@ func (x *EntityInfoCollection) String() string {
 func (*EntityInfoCollection) ProtoMessage() {}
 
 func (x *EntityInfoCollection) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[47]
+	mi := &file_mixer_proto_msgTypes[52]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -2906,7 +3235,7 @@ func (x *EntityInfoCollection) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use EntityInfoCollection.ProtoReflect.Descriptor instead.
 func (*EntityInfoCollection) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{47}
+	return file_mixer_proto_rawDescGZIP(), []int{52}
 }
 
 func (x *EntityInfoCollection) GetEntities() []*EntityInfo {
@@ -2938,7 +3267,7 @@ type ContainedInPlaceRelation struct {
 func (x *ContainedInPlaceRelation) Reset() {
 	*x = ContainedInPlaceRelation{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[48]
+		mi := &file_mixer_proto_msgTypes[53]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -2951,7 +3280,7 @@ func (x *ContainedInPlaceRelation) String() string {
 func (*ContainedInPlaceRelation) ProtoMessage() {}
 
 func (x *ContainedInPlaceRelation) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[48]
+	mi := &file_mixer_proto_msgTypes[53]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -2964,7 +3293,7 @@ func (x *ContainedInPlaceRelation) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use ContainedInPlaceRelation.ProtoReflect.Descriptor instead.
 func (*ContainedInPlaceRelation) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{48}
+	return file_mixer_proto_rawDescGZIP(), []int{53}
 }
 
 func (x *ContainedInPlaceRelation) GetParentId() string {
@@ -3015,7 +3344,7 @@ type Triple struct {
 func (x *Triple) Reset() {
 	*x = Triple{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[49]
+		mi := &file_mixer_proto_msgTypes[54]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -3028,7 +3357,7 @@ func (x *Triple) String() string {
 func (*Triple) ProtoMessage() {}
 
 func (x *Triple) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[49]
+	mi := &file_mixer_proto_msgTypes[54]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -3041,7 +3370,7 @@ func (x *Triple) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Triple.ProtoReflect.Descriptor instead.
 func (*Triple) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{49}
+	return file_mixer_proto_rawDescGZIP(), []int{54}
 }
 
 func (x *Triple) GetSubjectId() string {
@@ -3120,7 +3449,7 @@ type Triples struct {
 func (x *Triples) Reset() {
 	*x = Triples{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[50]
+		mi := &file_mixer_proto_msgTypes[55]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -3133,7 +3462,7 @@ func (x *Triples) String() string {
 func (*Triples) ProtoMessage() {}
 
 func (x *Triples) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[50]
+	mi := &file_mixer_proto_msgTypes[55]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -3146,7 +3475,7 @@ func (x *Triples) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Triples.ProtoReflect.Descriptor instead.
 func (*Triples) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{50}
+	return file_mixer_proto_rawDescGZIP(), []int{55}
 }
 
 func (x *Triples) GetTriples() []*Triple {
@@ -3178,7 +3507,7 @@ type ProvenanceInfo struct {
 func (x *ProvenanceInfo) Reset() {
 	*x = ProvenanceInfo{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[51]
+		mi := &file_mixer_proto_msgTypes[56]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -3191,7 +3520,7 @@ func (x *ProvenanceInfo) String() string {
 func (*ProvenanceInfo) ProtoMessage() {}
 
 func (x *ProvenanceInfo) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[51]
+	mi := &file_mixer_proto_msgTypes[56]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -3204,7 +3533,7 @@ func (x *ProvenanceInfo) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use ProvenanceInfo.ProtoReflect.Descriptor instead.
 func (*ProvenanceInfo) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{51}
+	return file_mixer_proto_rawDescGZIP(), []int{56}
 }
 
 func (x *ProvenanceInfo) GetProvenanceId() string {
@@ -3240,7 +3569,7 @@ type Provenances struct {
 func (x *Provenances) Reset() {
 	*x = Provenances{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[52]
+		mi := &file_mixer_proto_msgTypes[57]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -3253,7 +3582,7 @@ func (x *Provenances) String() string {
 func (*Provenances) ProtoMessage() {}
 
 func (x *Provenances) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[52]
+	mi := &file_mixer_proto_msgTypes[57]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -3266,7 +3595,7 @@ func (x *Provenances) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Provenances.ProtoReflect.Descriptor instead.
 func (*Provenances) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{52}
+	return file_mixer_proto_rawDescGZIP(), []int{57}
 }
 
 func (x *Provenances) GetProvenances() []*ProvenanceInfo {
@@ -3289,7 +3618,7 @@ type PropertyLabels struct {
 func (x *PropertyLabels) Reset() {
 	*x = PropertyLabels{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[53]
+		mi := &file_mixer_proto_msgTypes[58]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -3302,7 +3631,7 @@ func (x *PropertyLabels) String() string {
 func (*PropertyLabels) ProtoMessage() {}
 
 func (x *PropertyLabels) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[53]
+	mi := &file_mixer_proto_msgTypes[58]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -3315,7 +3644,7 @@ func (x *PropertyLabels) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use PropertyLabels.ProtoReflect.Descriptor instead.
 func (*PropertyLabels) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{53}
+	return file_mixer_proto_rawDescGZIP(), []int{58}
 }
 
 func (x *PropertyLabels) GetInLabels() []string {
@@ -3351,7 +3680,7 @@ type RelatedPlacesInfo struct {
 func (x *RelatedPlacesInfo) Reset() {
 	*x = RelatedPlacesInfo{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[54]
+		mi := &file_mixer_proto_msgTypes[59]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -3364,7 +3693,7 @@ func (x *RelatedPlacesInfo) String() string {
 func (*RelatedPlacesInfo) ProtoMessage() {}
 
 func (x *RelatedPlacesInfo) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[54]
+	mi := &file_mixer_proto_msgTypes[59]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -3377,7 +3706,7 @@ func (x *RelatedPlacesInfo) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use RelatedPlacesInfo.ProtoReflect.Descriptor instead.
 func (*RelatedPlacesInfo) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{54}
+	return file_mixer_proto_rawDescGZIP(), []int{59}
 }
 
 func (x *RelatedPlacesInfo) GetRelatedPlaces() []string {
@@ -3434,7 +3763,7 @@ type PlaceStatVarExistence struct {
 func (x *PlaceStatVarExistence) Reset() {
 	*x = PlaceStatVarExistence{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[55]
+		mi := &file_mixer_proto_msgTypes[60]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -3447,7 +3776,7 @@ func (x *PlaceStatVarExistence) String() string {
 func (*PlaceStatVarExistence) ProtoMessage() {}
 
 func (x *PlaceStatVarExistence) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[55]
+	mi := &file_mixer_proto_msgTypes[60]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -3460,7 +3789,7 @@ func (x *PlaceStatVarExistence) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use PlaceStatVarExistence.ProtoReflect.Descriptor instead.
 func (*PlaceStatVarExistence) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{55}
+	return file_mixer_proto_rawDescGZIP(), []int{60}
 }
 
 func (x *PlaceStatVarExistence) GetNumDescendentStatVars() int32 {
@@ -3482,7 +3811,7 @@ type GetStatVarPathRequest struct {
 func (x *GetStatVarPathRequest) Reset() {
 	*x = GetStatVarPathRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[56]
+		mi := &file_mixer_proto_msgTypes[61]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -3495,7 +3824,7 @@ func (x *GetStatVarPathRequest) String() string {
 func (*GetStatVarPathRequest) ProtoMessage() {}
 
 func (x *GetStatVarPathRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[56]
+	mi := &file_mixer_proto_msgTypes[61]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -3508,7 +3837,7 @@ func (x *GetStatVarPathRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetStatVarPathRequest.ProtoReflect.Descriptor instead.
 func (*GetStatVarPathRequest) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{56}
+	return file_mixer_proto_rawDescGZIP(), []int{61}
 }
 
 func (x *GetStatVarPathRequest) GetId() string {
@@ -3534,7 +3863,7 @@ type GetStatVarPathResponse struct {
 func (x *GetStatVarPathResponse) Reset() {
 	*x = GetStatVarPathResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[57]
+		mi := &file_mixer_proto_msgTypes[62]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -3547,7 +3876,7 @@ func (x *GetStatVarPathResponse) String() string {
 func (*GetStatVarPathResponse) ProtoMessage() {}
 
 func (x *GetStatVarPathResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[57]
+	mi := &file_mixer_proto_msgTypes[62]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -3560,7 +3889,7 @@ func (x *GetStatVarPathResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetStatVarPathResponse.ProtoReflect.Descriptor instead.
 func (*GetStatVarPathResponse) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{57}
+	return file_mixer_proto_rawDescGZIP(), []int{62}
 }
 
 func (x *GetStatVarPathResponse) GetPath() []string {
@@ -3586,7 +3915,7 @@ type SearchStatVarRequest struct {
 func (x *SearchStatVarRequest) Reset() {
 	*x = SearchStatVarRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[58]
+		mi := &file_mixer_proto_msgTypes[63]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -3599,7 +3928,7 @@ func (x *SearchStatVarRequest) String() string {
 func (*SearchStatVarRequest) ProtoMessage() {}
 
 func (x *SearchStatVarRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[58]
+	mi := &file_mixer_proto_msgTypes[63]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -3612,7 +3941,7 @@ func (x *SearchStatVarRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use SearchStatVarRequest.ProtoReflect.Descriptor instead.
 func (*SearchStatVarRequest) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{58}
+	return file_mixer_proto_rawDescGZIP(), []int{63}
 }
 
 func (x *SearchStatVarRequest) GetQuery() string {
@@ -3650,7 +3979,7 @@ type SearchStatVarResponse struct {
 func (x *SearchStatVarResponse) Reset() {
 	*x = SearchStatVarResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[59]
+		mi := &file_mixer_proto_msgTypes[64]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -3663,7 +3992,7 @@ func (x *SearchStatVarResponse) String() string {
 func (*SearchStatVarResponse) ProtoMessage() {}
 
 func (x *SearchStatVarResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[59]
+	mi := &file_mixer_proto_msgTypes[64]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -3676,7 +4005,7 @@ func (x *SearchStatVarResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use SearchStatVarResponse.ProtoReflect.Descriptor instead.
 func (*SearchStatVarResponse) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{59}
+	return file_mixer_proto_rawDescGZIP(), []int{64}
 }
 
 func (x *SearchStatVarResponse) GetStatVars() []*EntityInfo {
@@ -3705,7 +4034,7 @@ type StatVarSummary struct {
 func (x *StatVarSummary) Reset() {
 	*x = StatVarSummary{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[60]
+		mi := &file_mixer_proto_msgTypes[65]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -3718,7 +4047,7 @@ func (x *StatVarSummary) String() string {
 func (*StatVarSummary) ProtoMessage() {}
 
 func (x *StatVarSummary) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[60]
+	mi := &file_mixer_proto_msgTypes[65]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -3731,7 +4060,7 @@ func (x *StatVarSummary) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use StatVarSummary.ProtoReflect.Descriptor instead.
 func (*StatVarSummary) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{60}
+	return file_mixer_proto_rawDescGZIP(), []int{65}
 }
 
 func (x *StatVarSummary) GetPlaceTypeSummary() map[string]*StatVarSummary_PlaceTypeSummary {
@@ -3753,7 +4082,7 @@ type GetStatVarSummaryRequest struct {
 func (x *GetStatVarSummaryRequest) Reset() {
 	*x = GetStatVarSummaryRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[61]
+		mi := &file_mixer_proto_msgTypes[66]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -3766,7 +4095,7 @@ func (x *GetStatVarSummaryRequest) String() string {
 func (*GetStatVarSummaryRequest) ProtoMessage() {}
 
 func (x *GetStatVarSummaryRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[61]
+	mi := &file_mixer_proto_msgTypes[66]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -3779,7 +4108,7 @@ func (x *GetStatVarSummaryRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetStatVarSummaryRequest.ProtoReflect.Descriptor instead.
 func (*GetStatVarSummaryRequest) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{61}
+	return file_mixer_proto_rawDescGZIP(), []int{66}
 }
 
 func (x *GetStatVarSummaryRequest) GetStatVars() []string {
@@ -3800,7 +4129,7 @@ type GetStatVarSummaryResponse struct {
 func (x *GetStatVarSummaryResponse) Reset() {
 	*x = GetStatVarSummaryResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[62]
+		mi := &file_mixer_proto_msgTypes[67]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -3813,7 +4142,7 @@ func (x *GetStatVarSummaryResponse) String() string {
 func (*GetStatVarSummaryResponse) ProtoMessage() {}
 
 func (x *GetStatVarSummaryResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[62]
+	mi := &file_mixer_proto_msgTypes[67]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -3826,7 +4155,7 @@ func (x *GetStatVarSummaryResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetStatVarSummaryResponse.ProtoReflect.Descriptor instead.
 func (*GetStatVarSummaryResponse) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{62}
+	return file_mixer_proto_rawDescGZIP(), []int{67}
 }
 
 func (x *GetStatVarSummaryResponse) GetStatVarSummary() map[string]*StatVarSummary {
@@ -3855,7 +4184,7 @@ type StatVarGroupNode_ChildSVG struct {
 func (x *StatVarGroupNode_ChildSVG) Reset() {
 	*x = StatVarGroupNode_ChildSVG{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[69]
+		mi := &file_mixer_proto_msgTypes[75]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -3868,7 +4197,7 @@ func (x *StatVarGroupNode_ChildSVG) String() string {
 func (*StatVarGroupNode_ChildSVG) ProtoMessage() {}
 
 func (x *StatVarGroupNode_ChildSVG) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[69]
+	mi := &file_mixer_proto_msgTypes[75]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -3881,7 +4210,7 @@ func (x *StatVarGroupNode_ChildSVG) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use StatVarGroupNode_ChildSVG.ProtoReflect.Descriptor instead.
 func (*StatVarGroupNode_ChildSVG) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{40, 0}
+	return file_mixer_proto_rawDescGZIP(), []int{45, 0}
 }
 
 func (x *StatVarGroupNode_ChildSVG) GetId() string {
@@ -3930,7 +4259,7 @@ type StatVarGroupNode_ChildSV struct {
 func (x *StatVarGroupNode_ChildSV) Reset() {
 	*x = StatVarGroupNode_ChildSV{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[70]
+		mi := &file_mixer_proto_msgTypes[76]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -3943,7 +4272,7 @@ func (x *StatVarGroupNode_ChildSV) String() string {
 func (*StatVarGroupNode_ChildSV) ProtoMessage() {}
 
 func (x *StatVarGroupNode_ChildSV) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[70]
+	mi := &file_mixer_proto_msgTypes[76]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -3956,7 +4285,7 @@ func (x *StatVarGroupNode_ChildSV) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use StatVarGroupNode_ChildSV.ProtoReflect.Descriptor instead.
 func (*StatVarGroupNode_ChildSV) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{40, 1}
+	return file_mixer_proto_rawDescGZIP(), []int{45, 1}
 }
 
 func (x *StatVarGroupNode_ChildSV) GetId() string {
@@ -4000,7 +4329,7 @@ type SVOPlace_Temp struct {
 func (x *SVOPlace_Temp) Reset() {
 	*x = SVOPlace_Temp{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[71]
+		mi := &file_mixer_proto_msgTypes[77]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -4013,7 +4342,7 @@ func (x *SVOPlace_Temp) String() string {
 func (*SVOPlace_Temp) ProtoMessage() {}
 
 func (x *SVOPlace_Temp) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[71]
+	mi := &file_mixer_proto_msgTypes[77]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -4026,7 +4355,7 @@ func (x *SVOPlace_Temp) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use SVOPlace_Temp.ProtoReflect.Descriptor instead.
 func (*SVOPlace_Temp) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{43, 0}
+	return file_mixer_proto_rawDescGZIP(), []int{48, 0}
 }
 
 func (x *SVOPlace_Temp) GetChildPlaces() []string {
@@ -4057,7 +4386,7 @@ type SVOObservation_Temp struct {
 func (x *SVOObservation_Temp) Reset() {
 	*x = SVOObservation_Temp{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[72]
+		mi := &file_mixer_proto_msgTypes[78]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -4070,7 +4399,7 @@ func (x *SVOObservation_Temp) String() string {
 func (*SVOObservation_Temp) ProtoMessage() {}
 
 func (x *SVOObservation_Temp) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[72]
+	mi := &file_mixer_proto_msgTypes[78]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -4083,7 +4412,7 @@ func (x *SVOObservation_Temp) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use SVOObservation_Temp.ProtoReflect.Descriptor instead.
 func (*SVOObservation_Temp) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{44, 0}
+	return file_mixer_proto_rawDescGZIP(), []int{49, 0}
 }
 
 func (x *SVOObservation_Temp) GetObservationAbout() string {
@@ -4118,7 +4447,7 @@ type RelatedPlacesInfo_Ranking struct {
 func (x *RelatedPlacesInfo_Ranking) Reset() {
 	*x = RelatedPlacesInfo_Ranking{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[73]
+		mi := &file_mixer_proto_msgTypes[79]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -4131,7 +4460,7 @@ func (x *RelatedPlacesInfo_Ranking) String() string {
 func (*RelatedPlacesInfo_Ranking) ProtoMessage() {}
 
 func (x *RelatedPlacesInfo_Ranking) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[73]
+	mi := &file_mixer_proto_msgTypes[79]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -4144,7 +4473,7 @@ func (x *RelatedPlacesInfo_Ranking) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use RelatedPlacesInfo_Ranking.ProtoReflect.Descriptor instead.
 func (*RelatedPlacesInfo_Ranking) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{54, 0}
+	return file_mixer_proto_rawDescGZIP(), []int{59, 0}
 }
 
 func (x *RelatedPlacesInfo_Ranking) GetInfo() []*RelatedPlacesInfo_Ranking_RankInfo {
@@ -4167,7 +4496,7 @@ type RelatedPlacesInfo_Ranking_RankInfo struct {
 func (x *RelatedPlacesInfo_Ranking_RankInfo) Reset() {
 	*x = RelatedPlacesInfo_Ranking_RankInfo{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[74]
+		mi := &file_mixer_proto_msgTypes[80]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -4180,7 +4509,7 @@ func (x *RelatedPlacesInfo_Ranking_RankInfo) String() string {
 func (*RelatedPlacesInfo_Ranking_RankInfo) ProtoMessage() {}
 
 func (x *RelatedPlacesInfo_Ranking_RankInfo) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[74]
+	mi := &file_mixer_proto_msgTypes[80]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -4193,7 +4522,7 @@ func (x *RelatedPlacesInfo_Ranking_RankInfo) ProtoReflect() protoreflect.Message
 
 // Deprecated: Use RelatedPlacesInfo_Ranking_RankInfo.ProtoReflect.Descriptor instead.
 func (*RelatedPlacesInfo_Ranking_RankInfo) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{54, 0, 0}
+	return file_mixer_proto_rawDescGZIP(), []int{59, 0, 0}
 }
 
 func (x *RelatedPlacesInfo_Ranking_RankInfo) GetRank() int32 {
@@ -4230,7 +4559,7 @@ type StatVarSummary_Place struct {
 func (x *StatVarSummary_Place) Reset() {
 	*x = StatVarSummary_Place{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[75]
+		mi := &file_mixer_proto_msgTypes[81]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -4243,7 +4572,7 @@ func (x *StatVarSummary_Place) String() string {
 func (*StatVarSummary_Place) ProtoMessage() {}
 
 func (x *StatVarSummary_Place) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[75]
+	mi := &file_mixer_proto_msgTypes[81]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -4256,7 +4585,7 @@ func (x *StatVarSummary_Place) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use StatVarSummary_Place.ProtoReflect.Descriptor instead.
 func (*StatVarSummary_Place) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{60, 0}
+	return file_mixer_proto_rawDescGZIP(), []int{65, 0}
 }
 
 func (x *StatVarSummary_Place) GetDcid() string {
@@ -4294,7 +4623,7 @@ type StatVarSummary_PlaceTypeSummary struct {
 func (x *StatVarSummary_PlaceTypeSummary) Reset() {
 	*x = StatVarSummary_PlaceTypeSummary{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_mixer_proto_msgTypes[76]
+		mi := &file_mixer_proto_msgTypes[82]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -4307,7 +4636,7 @@ func (x *StatVarSummary_PlaceTypeSummary) String() string {
 func (*StatVarSummary_PlaceTypeSummary) ProtoMessage() {}
 
 func (x *StatVarSummary_PlaceTypeSummary) ProtoReflect() protoreflect.Message {
-	mi := &file_mixer_proto_msgTypes[76]
+	mi := &file_mixer_proto_msgTypes[82]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -4320,7 +4649,7 @@ func (x *StatVarSummary_PlaceTypeSummary) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use StatVarSummary_PlaceTypeSummary.ProtoReflect.Descriptor instead.
 func (*StatVarSummary_PlaceTypeSummary) Descriptor() ([]byte, []int) {
-	return file_mixer_proto_rawDescGZIP(), []int{60, 1}
+	return file_mixer_proto_rawDescGZIP(), []int{65, 1}
 }
 
 func (x *StatVarSummary_PlaceTypeSummary) GetNumPlaces() int64 {
@@ -4427,563 +4756,629 @@ var file_mixer_proto_rawDesc = []byte{
 	0x01, 0x28, 0x09, 0x52, 0x0b, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x50, 0x6c, 0x61, 0x63, 0x65,
 	0x12, 0x22, 0x0a, 0x0d, 0x69, 0x73, 0x5f, 0x70, 0x65, 0x72, 0x5f, 0x63, 0x61, 0x70, 0x69, 0x74,
 	0x61, 0x18, 0x05, 0x20, 0x01, 0x28, 0x08, 0x52, 0x0b, 0x69, 0x73, 0x50, 0x65, 0x72, 0x43, 0x61,
-	0x70, 0x69, 0x74, 0x61, 0x22, 0xa9, 0x01, 0x0a, 0x1b, 0x47, 0x65, 0x74, 0x4c, 0x6f, 0x63, 0x61,
-	0x74, 0x69, 0x6f, 0x6e, 0x73, 0x52, 0x61, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 0x73, 0x52, 0x65, 0x71,
-	0x75, 0x65, 0x73, 0x74, 0x12, 0x24, 0x0a, 0x0e, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72,
-	0x5f, 0x64, 0x63, 0x69, 0x64, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0c, 0x73, 0x74,
-	0x61, 0x74, 0x56, 0x61, 0x72, 0x44, 0x63, 0x69, 0x64, 0x73, 0x12, 0x1d, 0x0a, 0x0a, 0x70, 0x6c,
-	0x61, 0x63, 0x65, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x09,
-	0x70, 0x6c, 0x61, 0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x12, 0x21, 0x0a, 0x0c, 0x77, 0x69, 0x74,
-	0x68, 0x69, 0x6e, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52,
-	0x0b, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x12, 0x22, 0x0a, 0x0d,
-	0x69, 0x73, 0x5f, 0x70, 0x65, 0x72, 0x5f, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x18, 0x04, 0x20,
-	0x01, 0x28, 0x08, 0x52, 0x0b, 0x69, 0x73, 0x50, 0x65, 0x72, 0x43, 0x61, 0x70, 0x69, 0x74, 0x61,
-	0x22, 0xcc, 0x01, 0x0a, 0x1c, 0x47, 0x65, 0x74, 0x4c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-	0x73, 0x52, 0x61, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73,
-	0x65, 0x12, 0x50, 0x0a, 0x07, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x18, 0x01, 0x20, 0x03,
-	0x28, 0x0b, 0x32, 0x36, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73,
-	0x2e, 0x47, 0x65, 0x74, 0x4c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x52, 0x61, 0x6e,
-	0x6b, 0x69, 0x6e, 0x67, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x50, 0x61,
-	0x79, 0x6c, 0x6f, 0x61, 0x64, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x07, 0x70, 0x61, 0x79, 0x6c,
-	0x6f, 0x61, 0x64, 0x1a, 0x5a, 0x0a, 0x0c, 0x50, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x45, 0x6e,
-	0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09,
-	0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x34, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02,
-	0x20, 0x01, 0x28, 0x0b, 0x32, 0x1e, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
-	0x6e, 0x73, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73,
-	0x49, 0x6e, 0x66, 0x6f, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22,
-	0x37, 0x0a, 0x1b, 0x47, 0x65, 0x74, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x4c, 0x6f, 0x63,
-	0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x18,
-	0x0a, 0x07, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52,
-	0x07, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x22, 0x41, 0x0a, 0x05, 0x50, 0x6c, 0x61, 0x63,
-	0x65, 0x12, 0x12, 0x0a, 0x04, 0x64, 0x63, 0x69, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52,
-	0x04, 0x64, 0x63, 0x69, 0x64, 0x12, 0x12, 0x0a, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x02, 0x20,
-	0x01, 0x28, 0x09, 0x52, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x12, 0x10, 0x0a, 0x03, 0x70, 0x6f, 0x70,
-	0x18, 0x03, 0x20, 0x01, 0x28, 0x05, 0x52, 0x03, 0x70, 0x6f, 0x70, 0x22, 0x34, 0x0a, 0x06, 0x50,
-	0x6c, 0x61, 0x63, 0x65, 0x73, 0x12, 0x2a, 0x0a, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18,
-	0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x12, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d,
-	0x6f, 0x6e, 0x73, 0x2e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65,
-	0x73, 0x22, 0x6f, 0x0a, 0x19, 0x47, 0x65, 0x74, 0x4c, 0x61, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x50,
-	0x61, 0x67, 0x65, 0x44, 0x61, 0x74, 0x61, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x14,
-	0x0a, 0x05, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x05, 0x70,
-	0x6c, 0x61, 0x63, 0x65, 0x12, 0x22, 0x0a, 0x0d, 0x6e, 0x65, 0x77, 0x5f, 0x73, 0x74, 0x61, 0x74,
-	0x5f, 0x76, 0x61, 0x72, 0x73, 0x18, 0x04, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0b, 0x6e, 0x65, 0x77,
-	0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x12, 0x12, 0x0a, 0x04, 0x73, 0x65, 0x65, 0x64,
-	0x18, 0x03, 0x20, 0x01, 0x28, 0x03, 0x52, 0x04, 0x73, 0x65, 0x65, 0x64, 0x4a, 0x04, 0x08, 0x02,
-	0x10, 0x03, 0x22, 0xdd, 0x04, 0x0a, 0x1a, 0x47, 0x65, 0x74, 0x4c, 0x61, 0x6e, 0x64, 0x69, 0x6e,
-	0x67, 0x50, 0x61, 0x67, 0x65, 0x44, 0x61, 0x74, 0x61, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73,
-	0x65, 0x12, 0x62, 0x0a, 0x0f, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x73, 0x65,
-	0x72, 0x69, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x3a, 0x2e, 0x64, 0x61, 0x74,
-	0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x4c, 0x61, 0x6e, 0x64,
-	0x69, 0x6e, 0x67, 0x50, 0x61, 0x67, 0x65, 0x44, 0x61, 0x74, 0x61, 0x52, 0x65, 0x73, 0x70, 0x6f,
-	0x6e, 0x73, 0x65, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x65, 0x72, 0x69, 0x65,
-	0x73, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x0d, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53,
-	0x65, 0x72, 0x69, 0x65, 0x73, 0x12, 0x65, 0x0a, 0x10, 0x61, 0x6c, 0x6c, 0x5f, 0x63, 0x68, 0x69,
-	0x6c, 0x64, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x0b, 0x32,
-	0x3b, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65,
-	0x74, 0x4c, 0x61, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x50, 0x61, 0x67, 0x65, 0x44, 0x61, 0x74, 0x61,
-	0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x41, 0x6c, 0x6c, 0x43, 0x68, 0x69, 0x6c,
-	0x64, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x0e, 0x61, 0x6c,
-	0x6c, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x12, 0x2a, 0x0a, 0x11,
-	0x63, 0x68, 0x69, 0x6c, 0x64, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x5f, 0x74, 0x79, 0x70,
-	0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0f, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x50, 0x6c,
-	0x61, 0x63, 0x65, 0x73, 0x54, 0x79, 0x70, 0x65, 0x12, 0x21, 0x0a, 0x0c, 0x63, 0x68, 0x69, 0x6c,
-	0x64, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x04, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0b,
-	0x63, 0x68, 0x69, 0x6c, 0x64, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x12, 0x23, 0x0a, 0x0d, 0x70,
-	0x61, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x05, 0x20, 0x03,
-	0x28, 0x09, 0x52, 0x0c, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73,
-	0x12, 0x25, 0x0a, 0x0e, 0x73, 0x69, 0x6d, 0x69, 0x6c, 0x61, 0x72, 0x5f, 0x70, 0x6c, 0x61, 0x63,
-	0x65, 0x73, 0x18, 0x06, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0d, 0x73, 0x69, 0x6d, 0x69, 0x6c, 0x61,
-	0x72, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x12, 0x23, 0x0a, 0x0d, 0x6e, 0x65, 0x61, 0x72, 0x62,
-	0x79, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x07, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0c,
-	0x6e, 0x65, 0x61, 0x72, 0x62, 0x79, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x1a, 0x5c, 0x0a, 0x12,
+	0x70, 0x69, 0x74, 0x61, 0x22, 0xe1, 0x01, 0x0a, 0x16, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63,
+	0x65, 0x73, 0x4e, 0x65, 0x61, 0x72, 0x62, 0x79, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12,
+	0x14, 0x0a, 0x05, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x05,
+	0x70, 0x6c, 0x61, 0x63, 0x65, 0x12, 0x1a, 0x0a, 0x08, 0x6c, 0x61, 0x74, 0x69, 0x74, 0x75, 0x64,
+	0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x01, 0x52, 0x08, 0x6c, 0x61, 0x74, 0x69, 0x74, 0x75, 0x64,
+	0x65, 0x12, 0x1c, 0x0a, 0x09, 0x6c, 0x6f, 0x6e, 0x67, 0x69, 0x74, 0x75, 0x64, 0x65, 0x18, 0x03,
+	0x20, 0x01, 0x28, 0x01, 0x52, 0x09, 0x6c, 0x6f, 0x6e, 0x67, 0x69, 0x74, 0x75, 0x64, 0x65, 0x12,
+	0x1b, 0x0a, 0x09, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x5f, 0x6b, 0x6d, 0x18, 0x04, 0x20, 0x01,
+	0x28, 0x01, 0x52, 0x08, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x4b, 0x6d, 0x12, 0x14, 0x0a, 0x05,
+	0x6c, 0x69, 0x6d, 0x69, 0x74, 0x18, 0x05, 0x20, 0x01, 0x28, 0x05, 0x52, 0x05, 0x6c, 0x69, 0x6d,
+	0x69, 0x74, 0x12, 0x1d, 0x0a, 0x0a, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x5f, 0x74, 0x79, 0x70, 0x65,
+	0x18, 0x06, 0x20, 0x01, 0x28, 0x09, 0x52, 0x09, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x54, 0x79, 0x70,
+	0x65, 0x12, 0x25, 0x0a, 0x0e, 0x6d, 0x69, 0x6e, 0x5f, 0x70, 0x6f, 0x70, 0x75, 0x6c, 0x61, 0x74,
+	0x69, 0x6f, 0x6e, 0x18, 0x07, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0d, 0x6d, 0x69, 0x6e, 0x50, 0x6f,
+	0x70, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x62, 0x0a, 0x0b, 0x4e, 0x65, 0x61, 0x72,
+	0x62, 0x79, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x12, 0x12, 0x0a, 0x04, 0x64, 0x63, 0x69, 0x64, 0x18,
+	0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x64, 0x63, 0x69, 0x64, 0x12, 0x1f, 0x0a, 0x0b, 0x64,
+	0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x5f, 0x6b, 0x6d, 0x18, 0x02, 0x20, 0x01, 0x28, 0x01,
+	0x52, 0x0a, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x4b, 0x6d, 0x12, 0x1e, 0x0a, 0x0a,
+	0x70, 0x6f, 0x70, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x18, 0x03, 0x20, 0x01, 0x28, 0x03,
+	0x52, 0x0a, 0x70, 0x6f, 0x70, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x4b, 0x0a, 0x17,
+	0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x4e, 0x65, 0x61, 0x72, 0x62, 0x79, 0x52,
+	0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x30, 0x0a, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65,
+	0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x18, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f,
+	0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x4e, 0x65, 0x61, 0x72, 0x62, 0x79, 0x50, 0x6c, 0x61, 0x63,
+	0x65, 0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x22, 0x7f, 0x0a, 0x18, 0x47, 0x65, 0x74,
+	0x50, 0x6c, 0x61, 0x63, 0x65, 0x41, 0x6e, 0x63, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x73, 0x52, 0x65,
+	0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x16, 0x0a, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18,
+	0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x12, 0x1f, 0x0a,
+	0x0b, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x73, 0x18, 0x02, 0x20, 0x03,
+	0x28, 0x09, 0x52, 0x0a, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x73, 0x12, 0x2a,
+	0x0a, 0x11, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x5f, 0x7a, 0x69, 0x70, 0x5f, 0x63, 0x6f,
+	0x64, 0x65, 0x73, 0x18, 0x03, 0x20, 0x01, 0x28, 0x08, 0x52, 0x0f, 0x69, 0x6e, 0x63, 0x6c, 0x75,
+	0x64, 0x65, 0x5a, 0x69, 0x70, 0x43, 0x6f, 0x64, 0x65, 0x73, 0x22, 0xc3, 0x01, 0x0a, 0x19, 0x47,
+	0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x41, 0x6e, 0x63, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x73,
+	0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x53, 0x0a, 0x09, 0x61, 0x6e, 0x63, 0x65,
+	0x73, 0x74, 0x6f, 0x72, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x35, 0x2e, 0x64, 0x61,
+	0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61,
+	0x63, 0x65, 0x41, 0x6e, 0x63, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f,
+	0x6e, 0x73, 0x65, 0x2e, 0x41, 0x6e, 0x63, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x73, 0x45, 0x6e, 0x74,
+	0x72, 0x79, 0x52, 0x09, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x73, 0x1a, 0x51, 0x0a,
+	0x0e, 0x41, 0x6e, 0x63, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x73, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12,
+	0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65,
+	0x79, 0x12, 0x29, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b,
+	0x32, 0x13, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x50,
+	0x6c, 0x61, 0x63, 0x65, 0x73, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01,
+	0x22, 0xa9, 0x01, 0x0a, 0x1b, 0x47, 0x65, 0x74, 0x4c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+	0x73, 0x52, 0x61, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 0x73, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
+	0x12, 0x24, 0x0a, 0x0e, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x64, 0x63, 0x69,
+	0x64, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0c, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61,
+	0x72, 0x44, 0x63, 0x69, 0x64, 0x73, 0x12, 0x1d, 0x0a, 0x0a, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x5f,
+	0x74, 0x79, 0x70, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x09, 0x70, 0x6c, 0x61, 0x63,
+	0x65, 0x54, 0x79, 0x70, 0x65, 0x12, 0x21, 0x0a, 0x0c, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x5f,
+	0x70, 0x6c, 0x61, 0x63, 0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0b, 0x77, 0x69, 0x74,
+	0x68, 0x69, 0x6e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x12, 0x22, 0x0a, 0x0d, 0x69, 0x73, 0x5f, 0x70,
+	0x65, 0x72, 0x5f, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x18, 0x04, 0x20, 0x01, 0x28, 0x08, 0x52,
+	0x0b, 0x69, 0x73, 0x50, 0x65, 0x72, 0x43, 0x61, 0x70, 0x69, 0x74, 0x61, 0x22, 0xcc, 0x01, 0x0a,
+	0x1c, 0x47, 0x65, 0x74, 0x4c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x52, 0x61, 0x6e,
+	0x6b, 0x69, 0x6e, 0x67, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x50, 0x0a,
+	0x07, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x36,
+	0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74,
+	0x4c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x52, 0x61, 0x6e, 0x6b, 0x69, 0x6e, 0x67,
+	0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x50, 0x61, 0x79, 0x6c, 0x6f, 0x61,
+	0x64, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x07, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x1a,
+	0x5a, 0x0a, 0x0c, 0x50, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12,
+	0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65,
+	0x79, 0x12, 0x34, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b,
+	0x32, 0x1e, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x52,
+	0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x49, 0x6e, 0x66, 0x6f,
+	0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0x37, 0x0a, 0x1b, 0x47,
+	0x65, 0x74, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x4c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f,
+	0x6e, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x18, 0x0a, 0x07, 0x70, 0x61,
+	0x79, 0x6c, 0x6f, 0x61, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x07, 0x70, 0x61, 0x79,
+	0x6c, 0x6f, 0x61, 0x64, 0x22, 0x41, 0x0a, 0x05, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x12, 0x12, 0x0a,
+	0x04, 0x64, 0x63, 0x69, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x64, 0x63, 0x69,
+	0x64, 0x12, 0x12, 0x0a, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52,
+	0x04, 0x6e, 0x61, 0x6d, 0x65, 0x12, 0x10, 0x0a, 0x03, 0x70, 0x6f, 0x70, 0x18, 0x03, 0x20, 0x01,
+	0x28, 0x05, 0x52, 0x03, 0x70, 0x6f, 0x70, 0x22, 0x34, 0x0a, 0x06, 0x50, 0x6c, 0x61, 0x63, 0x65,
+	0x73, 0x12, 0x2a, 0x0a, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28,
+	0x0b, 0x32, 0x12, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e,
+	0x50, 0x6c, 0x61, 0x63, 0x65, 0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x22, 0x6f, 0x0a,
+	0x19, 0x47, 0x65, 0x74, 0x4c, 0x61, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x50, 0x61, 0x67, 0x65, 0x44,
+	0x61, 0x74, 0x61, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x14, 0x0a, 0x05, 0x70, 0x6c,
+	0x61, 0x63, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x05, 0x70, 0x6c, 0x61, 0x63, 0x65,
+	0x12, 0x22, 0x0a, 0x0d, 0x6e, 0x65, 0x77, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72,
+	0x73, 0x18, 0x04, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0b, 0x6e, 0x65, 0x77, 0x53, 0x74, 0x61, 0x74,
+	0x56, 0x61, 0x72, 0x73, 0x12, 0x12, 0x0a, 0x04, 0x73, 0x65, 0x65, 0x64, 0x18, 0x03, 0x20, 0x01,
+	0x28, 0x03, 0x52, 0x04, 0x73, 0x65, 0x65, 0x64, 0x4a, 0x04, 0x08, 0x02, 0x10, 0x03, 0x22, 0xdd,
+	0x04, 0x0a, 0x1a, 0x47, 0x65, 0x74, 0x4c, 0x61, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x50, 0x61, 0x67,
+	0x65, 0x44, 0x61, 0x74, 0x61, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x62, 0x0a,
+	0x0f, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73,
+	0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x3a, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d,
+	0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x4c, 0x61, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x50,
+	0x61, 0x67, 0x65, 0x44, 0x61, 0x74, 0x61, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e,
 	0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x45, 0x6e, 0x74,
-	0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52,
-	0x03, 0x6b, 0x65, 0x79, 0x12, 0x30, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20,
-	0x01, 0x28, 0x0b, 0x32, 0x1a, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e,
-	0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52,
-	0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x1a, 0x56, 0x0a, 0x13, 0x41, 0x6c,
-	0x6c, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x45, 0x6e, 0x74, 0x72,
-	0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03,
-	0x6b, 0x65, 0x79, 0x12, 0x29, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01,
-	0x28, 0x0b, 0x32, 0x13, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73,
-	0x2e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02,
-	0x38, 0x01, 0x22, 0x46, 0x0a, 0x0d, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x52, 0x65, 0x71, 0x75,
-	0x65, 0x73, 0x74, 0x12, 0x14, 0x0a, 0x05, 0x71, 0x75, 0x65, 0x72, 0x79, 0x18, 0x01, 0x20, 0x01,
-	0x28, 0x09, 0x52, 0x05, 0x71, 0x75, 0x65, 0x72, 0x79, 0x12, 0x1f, 0x0a, 0x0b, 0x6d, 0x61, 0x78,
-	0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x18, 0x02, 0x20, 0x01, 0x28, 0x05, 0x52, 0x0a,
-	0x6d, 0x61, 0x78, 0x52, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x22, 0x4c, 0x0a, 0x0e, 0x53, 0x65,
-	0x61, 0x72, 0x63, 0x68, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x3a, 0x0a, 0x07,
-	0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x20, 0x2e,
-	0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x65, 0x61, 0x72,
-	0x63, 0x68, 0x52, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x52,
-	0x07, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x13, 0x0a, 0x11, 0x47, 0x65, 0x74, 0x56,
-	0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x22, 0x7f, 0x0a,
-	0x12, 0x47, 0x65, 0x74, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x52, 0x65, 0x73, 0x70, 0x6f,
-	0x6e, 0x73, 0x65, 0x12, 0x14, 0x0a, 0x05, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x18, 0x01, 0x20, 0x01,
-	0x28, 0x09, 0x52, 0x05, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x12, 0x1b, 0x0a, 0x09, 0x62, 0x69, 0x67,
-	0x5f, 0x71, 0x75, 0x65, 0x72, 0x79, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x62, 0x69,
-	0x67, 0x51, 0x75, 0x65, 0x72, 0x79, 0x12, 0x1b, 0x0a, 0x09, 0x62, 0x69, 0x67, 0x5f, 0x74, 0x61,
-	0x62, 0x6c, 0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x62, 0x69, 0x67, 0x54, 0x61,
-	0x62, 0x6c, 0x65, 0x12, 0x19, 0x0a, 0x08, 0x67, 0x69, 0x74, 0x5f, 0x68, 0x61, 0x73, 0x68, 0x18,
-	0x04, 0x20, 0x01, 0x28, 0x09, 0x52, 0x07, 0x67, 0x69, 0x74, 0x48, 0x61, 0x73, 0x68, 0x22, 0x6b,
-	0x0a, 0x13, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x52, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x53, 0x65,
-	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x12, 0x1b, 0x0a, 0x09, 0x74, 0x79, 0x70, 0x65, 0x5f, 0x6e, 0x61,
-	0x6d, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x74, 0x79, 0x70, 0x65, 0x4e, 0x61,
-	0x6d, 0x65, 0x12, 0x37, 0x0a, 0x06, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x18, 0x02, 0x20, 0x03,
-	0x28, 0x0b, 0x32, 0x1f, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73,
-	0x2e, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x52, 0x65, 0x73,
-	0x75, 0x6c, 0x74, 0x52, 0x06, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x22, 0x3c, 0x0a, 0x12, 0x53,
-	0x65, 0x61, 0x72, 0x63, 0x68, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x52, 0x65, 0x73, 0x75, 0x6c,
-	0x74, 0x12, 0x12, 0x0a, 0x04, 0x64, 0x63, 0x69, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52,
-	0x04, 0x64, 0x63, 0x69, 0x64, 0x12, 0x12, 0x0a, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x02, 0x20,
-	0x01, 0x28, 0x09, 0x52, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x29, 0x0a, 0x09, 0x53, 0x74, 0x61,
-	0x74, 0x73, 0x56, 0x61, 0x72, 0x73, 0x12, 0x1c, 0x0a, 0x09, 0x73, 0x74, 0x61, 0x74, 0x73, 0x56,
-	0x61, 0x72, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x09, 0x73, 0x74, 0x61, 0x74, 0x73,
-	0x56, 0x61, 0x72, 0x73, 0x22, 0x2f, 0x0a, 0x17, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65,
-	0x53, 0x74, 0x61, 0x74, 0x73, 0x56, 0x61, 0x72, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12,
-	0x14, 0x0a, 0x05, 0x64, 0x63, 0x69, 0x64, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x05,
-	0x64, 0x63, 0x69, 0x64, 0x73, 0x22, 0xb8, 0x01, 0x0a, 0x18, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61,
-	0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x73, 0x56, 0x61, 0x72, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e,
-	0x73, 0x65, 0x12, 0x49, 0x0a, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03,
-	0x28, 0x0b, 0x32, 0x31, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73,
-	0x2e, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x73, 0x56, 0x61,
-	0x72, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73,
-	0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x1a, 0x51, 0x0a,
-	0x0b, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03,
-	0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x2c,
-	0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x16, 0x2e,
-	0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x74,
-	0x73, 0x56, 0x61, 0x72, 0x73, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01,
-	0x22, 0x27, 0x0a, 0x08, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x12, 0x1b, 0x0a, 0x09,
-	0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52,
-	0x08, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x22, 0x2f, 0x0a, 0x17, 0x47, 0x65, 0x74,
-	0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x52, 0x65, 0x71,
-	0x75, 0x65, 0x73, 0x74, 0x12, 0x14, 0x0a, 0x05, 0x64, 0x63, 0x69, 0x64, 0x73, 0x18, 0x01, 0x20,
-	0x03, 0x28, 0x09, 0x52, 0x05, 0x64, 0x63, 0x69, 0x64, 0x73, 0x22, 0xb7, 0x01, 0x0a, 0x18, 0x47,
-	0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x52,
-	0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x49, 0x0a, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65,
-	0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x31, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f,
-	0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74,
-	0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x50,
-	0x6c, 0x61, 0x63, 0x65, 0x73, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x06, 0x70, 0x6c, 0x61, 0x63,
-	0x65, 0x73, 0x1a, 0x50, 0x0a, 0x0b, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x45, 0x6e, 0x74, 0x72,
-	0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03,
-	0x6b, 0x65, 0x79, 0x12, 0x2b, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01,
-	0x28, 0x0b, 0x32, 0x15, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73,
-	0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65,
-	0x3a, 0x02, 0x38, 0x01, 0x22, 0x51, 0x0a, 0x1c, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65,
-	0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x55, 0x6e, 0x69, 0x6f, 0x6e, 0x52, 0x65, 0x71,
-	0x75, 0x65, 0x73, 0x74, 0x12, 0x14, 0x0a, 0x05, 0x64, 0x63, 0x69, 0x64, 0x73, 0x18, 0x01, 0x20,
-	0x03, 0x28, 0x09, 0x52, 0x05, 0x64, 0x63, 0x69, 0x64, 0x73, 0x12, 0x1b, 0x0a, 0x09, 0x73, 0x74,
-	0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x09, 0x52, 0x08, 0x73,
-	0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x22, 0x53, 0x0a, 0x1d, 0x47, 0x65, 0x74, 0x50, 0x6c,
-	0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x55, 0x6e, 0x69, 0x6f, 0x6e,
-	0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x32, 0x0a, 0x09, 0x73, 0x74, 0x61, 0x74,
-	0x5f, 0x76, 0x61, 0x72, 0x73, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x15, 0x2e, 0x64, 0x61,
-	0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61,
-	0x72, 0x73, 0x52, 0x08, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x22, 0x3e, 0x0a, 0x1f,
-	0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73,
-	0x55, 0x6e, 0x69, 0x6f, 0x6e, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x56, 0x31, 0x12,
-	0x1b, 0x0a, 0x09, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x73, 0x18, 0x01, 0x20, 0x03,
-	0x28, 0x09, 0x52, 0x08, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x22, 0xc7, 0x01, 0x0a,
-	0x0d, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x12, 0x55,
-	0x0a, 0x0f, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70,
-	0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x2d, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f,
-	0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x47, 0x72, 0x6f,
-	0x75, 0x70, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x47, 0x72, 0x6f, 0x75, 0x70,
-	0x73, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x0d, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x47,
-	0x72, 0x6f, 0x75, 0x70, 0x73, 0x1a, 0x5f, 0x0a, 0x12, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72,
-	0x47, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b,
-	0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x33, 0x0a,
-	0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1d, 0x2e, 0x64,
-	0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56,
-	0x61, 0x72, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x4e, 0x6f, 0x64, 0x65, 0x52, 0x05, 0x76, 0x61, 0x6c,
-	0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0xf1, 0x04, 0x0a, 0x10, 0x53, 0x74, 0x61, 0x74, 0x56,
-	0x61, 0x72, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x4e, 0x6f, 0x64, 0x65, 0x12, 0x23, 0x0a, 0x0d, 0x61,
-	0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x01, 0x20, 0x01,
-	0x28, 0x09, 0x52, 0x0c, 0x61, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x4e, 0x61, 0x6d, 0x65,
-	0x12, 0x4d, 0x0a, 0x0f, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76,
-	0x61, 0x72, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x25, 0x2e, 0x64, 0x61, 0x74, 0x61,
-	0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x47,
-	0x72, 0x6f, 0x75, 0x70, 0x4e, 0x6f, 0x64, 0x65, 0x2e, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x53, 0x56,
-	0x52, 0x0d, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x12,
-	0x59, 0x0a, 0x15, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61,
-	0x72, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x18, 0x03, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x26,
+	0x72, 0x79, 0x52, 0x0d, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x65, 0x72, 0x69, 0x65,
+	0x73, 0x12, 0x65, 0x0a, 0x10, 0x61, 0x6c, 0x6c, 0x5f, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x5f, 0x70,
+	0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x3b, 0x2e, 0x64, 0x61,
+	0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x4c, 0x61, 0x6e,
+	0x64, 0x69, 0x6e, 0x67, 0x50, 0x61, 0x67, 0x65, 0x44, 0x61, 0x74, 0x61, 0x52, 0x65, 0x73, 0x70,
+	0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x41, 0x6c, 0x6c, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x50, 0x6c, 0x61,
+	0x63, 0x65, 0x73, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x0e, 0x61, 0x6c, 0x6c, 0x43, 0x68, 0x69,
+	0x6c, 0x64, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x12, 0x2a, 0x0a, 0x11, 0x63, 0x68, 0x69, 0x6c,
+	0x64, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x18, 0x03, 0x20,
+	0x01, 0x28, 0x09, 0x52, 0x0f, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73,
+	0x54, 0x79, 0x70, 0x65, 0x12, 0x21, 0x0a, 0x0c, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x5f, 0x70, 0x6c,
+	0x61, 0x63, 0x65, 0x73, 0x18, 0x04, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0b, 0x63, 0x68, 0x69, 0x6c,
+	0x64, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x12, 0x23, 0x0a, 0x0d, 0x70, 0x61, 0x72, 0x65, 0x6e,
+	0x74, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x05, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0c,
+	0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x12, 0x25, 0x0a, 0x0e,
+	0x73, 0x69, 0x6d, 0x69, 0x6c, 0x61, 0x72, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x06,
+	0x20, 0x03, 0x28, 0x09, 0x52, 0x0d, 0x73, 0x69, 0x6d, 0x69, 0x6c, 0x61, 0x72, 0x50, 0x6c, 0x61,
+	0x63, 0x65, 0x73, 0x12, 0x23, 0x0a, 0x0d, 0x6e, 0x65, 0x61, 0x72, 0x62, 0x79, 0x5f, 0x70, 0x6c,
+	0x61, 0x63, 0x65, 0x73, 0x18, 0x07, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0c, 0x6e, 0x65, 0x61, 0x72,
+	0x62, 0x79, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x1a, 0x5c, 0x0a, 0x12, 0x53, 0x74, 0x61, 0x74,
+	0x56, 0x61, 0x72, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10,
+	0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79,
+	0x12, 0x30, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32,
+	0x1a, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74,
+	0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x05, 0x76, 0x61, 0x6c,
+	0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x1a, 0x56, 0x0a, 0x13, 0x41, 0x6c, 0x6c, 0x43, 0x68, 0x69,
+	0x6c, 0x64, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a,
+	0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12,
+	0x29, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x13,
+	0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x50, 0x6c, 0x61,
+	0x63, 0x65, 0x73, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0x46,
+	0x0a, 0x0d, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12,
+	0x14, 0x0a, 0x05, 0x71, 0x75, 0x65, 0x72, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x05,
+	0x71, 0x75, 0x65, 0x72, 0x79, 0x12, 0x1f, 0x0a, 0x0b, 0x6d, 0x61, 0x78, 0x5f, 0x72, 0x65, 0x73,
+	0x75, 0x6c, 0x74, 0x73, 0x18, 0x02, 0x20, 0x01, 0x28, 0x05, 0x52, 0x0a, 0x6d, 0x61, 0x78, 0x52,
+	0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x22, 0x4c, 0x0a, 0x0e, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68,
+	0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x3a, 0x0a, 0x07, 0x73, 0x65, 0x63, 0x74,
+	0x69, 0x6f, 0x6e, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x20, 0x2e, 0x64, 0x61, 0x74, 0x61,
+	0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x52, 0x65,
+	0x73, 0x75, 0x6c, 0x74, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x52, 0x07, 0x73, 0x65, 0x63,
+	0x74, 0x69, 0x6f, 0x6e, 0x22, 0x13, 0x0a, 0x11, 0x47, 0x65, 0x74, 0x56, 0x65, 0x72, 0x73, 0x69,
+	0x6f, 0x6e, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x22, 0x7f, 0x0a, 0x12, 0x47, 0x65, 0x74,
+	0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12,
+	0x14, 0x0a, 0x05, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x05,
+	0x73, 0x74, 0x6f, 0x72, 0x65, 0x12, 0x1b, 0x0a, 0x09, 0x62, 0x69, 0x67, 0x5f, 0x71, 0x75, 0x65,
+	0x72, 0x79, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x62, 0x69, 0x67, 0x51, 0x75, 0x65,
+	0x72, 0x79, 0x12, 0x1b, 0x0a, 0x09, 0x62, 0x69, 0x67, 0x5f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x18,
+	0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x62, 0x69, 0x67, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x12,
+	0x19, 0x0a, 0x08, 0x67, 0x69, 0x74, 0x5f, 0x68, 0x61, 0x73, 0x68, 0x18, 0x04, 0x20, 0x01, 0x28,
+	0x09, 0x52, 0x07, 0x67, 0x69, 0x74, 0x48, 0x61, 0x73, 0x68, 0x22, 0x6b, 0x0a, 0x13, 0x53, 0x65,
+	0x61, 0x72, 0x63, 0x68, 0x52, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6f,
+	0x6e, 0x12, 0x1b, 0x0a, 0x09, 0x74, 0x79, 0x70, 0x65, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x01,
+	0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x74, 0x79, 0x70, 0x65, 0x4e, 0x61, 0x6d, 0x65, 0x12, 0x37,
+	0x0a, 0x06, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x18, 0x02, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x1f,
+	0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x65, 0x61,
+	0x72, 0x63, 0x68, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x52, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x52,
+	0x06, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x22, 0x3c, 0x0a, 0x12, 0x53, 0x65, 0x61, 0x72, 0x63,
+	0x68, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x52, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x12, 0x12, 0x0a,
+	0x04, 0x64, 0x63, 0x69, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x64, 0x63, 0x69,
+	0x64, 0x12, 0x12, 0x0a, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52,
+	0x04, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x29, 0x0a, 0x09, 0x53, 0x74, 0x61, 0x74, 0x73, 0x56, 0x61,
+	0x72, 0x73, 0x12, 0x1c, 0x0a, 0x09, 0x73, 0x74, 0x61, 0x74, 0x73, 0x56, 0x61, 0x72, 0x73, 0x18,
+	0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x09, 0x73, 0x74, 0x61, 0x74, 0x73, 0x56, 0x61, 0x72, 0x73,
+	0x22, 0x2f, 0x0a, 0x17, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74,
+	0x73, 0x56, 0x61, 0x72, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x14, 0x0a, 0x05, 0x64,
+	0x63, 0x69, 0x64, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x05, 0x64, 0x63, 0x69, 0x64,
+	0x73, 0x22, 0xb8, 0x01, 0x0a, 0x18, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74,
+	0x61, 0x74, 0x73, 0x56, 0x61, 0x72, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x49,
+	0x0a, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x31,
+	0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74,
+	0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x73, 0x56, 0x61, 0x72, 0x52, 0x65, 0x73,
+	0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x45, 0x6e, 0x74, 0x72,
+	0x79, 0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x1a, 0x51, 0x0a, 0x0b, 0x50, 0x6c, 0x61,
+	0x63, 0x65, 0x73, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18,
+	0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x2c, 0x0a, 0x05, 0x76, 0x61,
+	0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x16, 0x2e, 0x64, 0x61, 0x74, 0x61,
+	0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x73, 0x56, 0x61, 0x72,
+	0x73, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0x27, 0x0a, 0x08,
+	0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x12, 0x1b, 0x0a, 0x09, 0x73, 0x74, 0x61, 0x74,
+	0x5f, 0x76, 0x61, 0x72, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x08, 0x73, 0x74, 0x61,
+	0x74, 0x56, 0x61, 0x72, 0x73, 0x22, 0x2f, 0x0a, 0x17, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63,
+	0x65, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
+	0x12, 0x14, 0x0a, 0x05, 0x64, 0x63, 0x69, 0x64, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52,
+	0x05, 0x64, 0x63, 0x69, 0x64, 0x73, 0x22, 0xb7, 0x01, 0x0a, 0x18, 0x47, 0x65, 0x74, 0x50, 0x6c,
+	0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f,
+	0x6e, 0x73, 0x65, 0x12, 0x49, 0x0a, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x01, 0x20,
+	0x03, 0x28, 0x0b, 0x32, 0x31, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e,
+	0x73, 0x2e, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61,
+	0x72, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x50, 0x6c, 0x61, 0x63, 0x65,
+	0x73, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x1a, 0x50,
+	0x0a, 0x0b, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a,
+	0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12,
+	0x2b, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x15,
 	0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74, 0x61,
-	0x74, 0x56, 0x61, 0x72, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x4e, 0x6f, 0x64, 0x65, 0x2e, 0x43, 0x68,
-	0x69, 0x6c, 0x64, 0x53, 0x56, 0x47, 0x52, 0x12, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x53, 0x74, 0x61,
-	0x74, 0x56, 0x61, 0x72, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x12, 0x33, 0x0a, 0x16, 0x70, 0x61,
-	0x72, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x67, 0x72,
-	0x6f, 0x75, 0x70, 0x73, 0x18, 0x04, 0x20, 0x03, 0x28, 0x09, 0x52, 0x13, 0x70, 0x61, 0x72, 0x65,
-	0x6e, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x12,
-	0x37, 0x0a, 0x18, 0x6e, 0x75, 0x6d, 0x5f, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x6e,
-	0x74, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x73, 0x18, 0x05, 0x20, 0x01, 0x28,
-	0x05, 0x52, 0x15, 0x6e, 0x75, 0x6d, 0x44, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x74,
-	0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x1a, 0xa5, 0x01, 0x0a, 0x08, 0x43, 0x68, 0x69,
-	0x6c, 0x64, 0x53, 0x56, 0x47, 0x12, 0x0e, 0x0a, 0x02, 0x69, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28,
-	0x09, 0x52, 0x02, 0x69, 0x64, 0x12, 0x2d, 0x0a, 0x12, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c,
-	0x69, 0x7a, 0x65, 0x64, 0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x18, 0x02, 0x20, 0x01, 0x28,
-	0x09, 0x52, 0x11, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x64, 0x45, 0x6e,
-	0x74, 0x69, 0x74, 0x79, 0x12, 0x21, 0x0a, 0x0c, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x5f,
-	0x6e, 0x61, 0x6d, 0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0b, 0x64, 0x69, 0x73, 0x70,
-	0x6c, 0x61, 0x79, 0x4e, 0x61, 0x6d, 0x65, 0x12, 0x37, 0x0a, 0x18, 0x6e, 0x75, 0x6d, 0x5f, 0x64,
-	0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76,
-	0x61, 0x72, 0x73, 0x18, 0x04, 0x20, 0x01, 0x28, 0x05, 0x52, 0x15, 0x6e, 0x75, 0x6d, 0x44, 0x65,
-	0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73,
-	0x1a, 0x78, 0x0a, 0x07, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x53, 0x56, 0x12, 0x0e, 0x0a, 0x02, 0x69,
-	0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x02, 0x69, 0x64, 0x12, 0x1f, 0x0a, 0x0b, 0x73,
-	0x65, 0x61, 0x72, 0x63, 0x68, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09,
-	0x52, 0x0a, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4e, 0x61, 0x6d, 0x65, 0x12, 0x21, 0x0a, 0x0c,
-	0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x03, 0x20, 0x01,
-	0x28, 0x09, 0x52, 0x0b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x4e, 0x61, 0x6d, 0x65, 0x12,
-	0x19, 0x0a, 0x08, 0x68, 0x61, 0x73, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x18, 0x04, 0x20, 0x01, 0x28,
-	0x08, 0x52, 0x07, 0x68, 0x61, 0x73, 0x44, 0x61, 0x74, 0x61, 0x22, 0x36, 0x0a, 0x16, 0x47, 0x65,
-	0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x52, 0x65, 0x71,
-	0x75, 0x65, 0x73, 0x74, 0x12, 0x16, 0x0a, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x02,
-	0x20, 0x03, 0x28, 0x09, 0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x4a, 0x04, 0x08, 0x01,
-	0x10, 0x02, 0x22, 0x86, 0x01, 0x0a, 0x1a, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61,
-	0x72, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x4e, 0x6f, 0x64, 0x65, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73,
-	0x74, 0x12, 0x24, 0x0a, 0x0e, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x67, 0x72,
-	0x6f, 0x75, 0x70, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0c, 0x73, 0x74, 0x61, 0x74, 0x56,
-	0x61, 0x72, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x12, 0x16, 0x0a, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65,
-	0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x09, 0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x12,
-	0x2a, 0x0a, 0x11, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x74, 0x72, 0x69,
-	0x70, 0x6c, 0x65, 0x73, 0x18, 0x03, 0x20, 0x01, 0x28, 0x08, 0x52, 0x0f, 0x72, 0x65, 0x61, 0x64,
-	0x46, 0x72, 0x6f, 0x6d, 0x54, 0x72, 0x69, 0x70, 0x6c, 0x65, 0x73, 0x22, 0xa1, 0x02, 0x0a, 0x08,
-	0x53, 0x56, 0x4f, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x12, 0x12, 0x0a, 0x04, 0x6e, 0x61, 0x6d, 0x65,
-	0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x12, 0x12, 0x0a, 0x04,
-	0x74, 0x79, 0x70, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x74, 0x79, 0x70, 0x65,
-	0x12, 0x12, 0x0a, 0x04, 0x64, 0x63, 0x69, 0x64, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04,
-	0x64, 0x63, 0x69, 0x64, 0x12, 0x3f, 0x0a, 0x0c, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74,
-	0x69, 0x6f, 0x6e, 0x73, 0x18, 0x04, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x1b, 0x2e, 0x64, 0x61, 0x74,
-	0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x56, 0x4f, 0x4f, 0x62, 0x73, 0x65,
-	0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x52, 0x0c, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61,
-	0x74, 0x69, 0x6f, 0x6e, 0x73, 0x12, 0x23, 0x0a, 0x0d, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61,
-	0x6e, 0x63, 0x65, 0x5f, 0x69, 0x64, 0x18, 0x05, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0c, 0x70, 0x72,
-	0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x64, 0x12, 0x2e, 0x0a, 0x04, 0x74, 0x65,
-	0x6d, 0x70, 0x18, 0x06, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1a, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63,
-	0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x56, 0x4f, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x2e,
-	0x54, 0x65, 0x6d, 0x70, 0x52, 0x04, 0x74, 0x65, 0x6d, 0x70, 0x1a, 0x43, 0x0a, 0x04, 0x54, 0x65,
-	0x6d, 0x70, 0x12, 0x21, 0x0a, 0x0c, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x5f, 0x70, 0x6c, 0x61, 0x63,
-	0x65, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0b, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x50,
-	0x6c, 0x61, 0x63, 0x65, 0x73, 0x12, 0x12, 0x0a, 0x04, 0x6d, 0x69, 0x64, 0x73, 0x18, 0x03, 0x20,
-	0x03, 0x28, 0x09, 0x52, 0x04, 0x6d, 0x69, 0x64, 0x73, 0x4a, 0x04, 0x08, 0x01, 0x10, 0x02, 0x22,
-	0x8c, 0x04, 0x0a, 0x0e, 0x53, 0x56, 0x4f, 0x4f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69,
-	0x6f, 0x6e, 0x12, 0x12, 0x0a, 0x04, 0x64, 0x63, 0x69, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09,
-	0x52, 0x04, 0x64, 0x63, 0x69, 0x64, 0x12, 0x29, 0x0a, 0x10, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76,
-	0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x64, 0x61, 0x74, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09,
-	0x52, 0x0f, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x44, 0x61, 0x74,
-	0x65, 0x12, 0x2d, 0x0a, 0x12, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-	0x5f, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x11, 0x6f,
-	0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x50, 0x65, 0x72, 0x69, 0x6f, 0x64,
-	0x12, 0x2d, 0x0a, 0x12, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x5f,
-	0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x18, 0x04, 0x20, 0x01, 0x28, 0x09, 0x52, 0x11, 0x6d, 0x65,
-	0x61, 0x73, 0x75, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x4d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x12,
-	0x12, 0x0a, 0x04, 0x75, 0x6e, 0x69, 0x74, 0x18, 0x05, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x75,
-	0x6e, 0x69, 0x74, 0x12, 0x25, 0x0a, 0x0e, 0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e, 0x67, 0x5f, 0x66,
-	0x61, 0x63, 0x74, 0x6f, 0x72, 0x18, 0x06, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0d, 0x73, 0x63, 0x61,
-	0x6c, 0x69, 0x6e, 0x67, 0x46, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x12, 0x23, 0x0a, 0x0d, 0x70, 0x72,
-	0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x5f, 0x69, 0x64, 0x18, 0x07, 0x20, 0x01, 0x28,
-	0x09, 0x52, 0x0c, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x64, 0x12,
-	0x1d, 0x0a, 0x09, 0x73, 0x74, 0x72, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x08, 0x20, 0x01,
-	0x28, 0x09, 0x48, 0x00, 0x52, 0x08, 0x73, 0x74, 0x72, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x12, 0x1d,
-	0x0a, 0x09, 0x64, 0x62, 0x6c, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x09, 0x20, 0x01, 0x28,
-	0x01, 0x48, 0x00, 0x52, 0x08, 0x64, 0x62, 0x6c, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x12, 0x34, 0x0a,
-	0x04, 0x74, 0x65, 0x6d, 0x70, 0x18, 0x0a, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x20, 0x2e, 0x64, 0x61,
-	0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x56, 0x4f, 0x4f, 0x62, 0x73,
-	0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x54, 0x65, 0x6d, 0x70, 0x52, 0x04, 0x74,
-	0x65, 0x6d, 0x70, 0x1a, 0x81, 0x01, 0x0a, 0x04, 0x54, 0x65, 0x6d, 0x70, 0x12, 0x2b, 0x0a, 0x11,
-	0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x61, 0x62, 0x6f, 0x75,
-	0x74, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x10, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61,
-	0x74, 0x69, 0x6f, 0x6e, 0x41, 0x62, 0x6f, 0x75, 0x74, 0x12, 0x2b, 0x0a, 0x11, 0x76, 0x61, 0x72,
-	0x69, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x64, 0x18, 0x02,
-	0x20, 0x01, 0x28, 0x09, 0x52, 0x10, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4d, 0x65,
-	0x61, 0x73, 0x75, 0x72, 0x65, 0x64, 0x12, 0x1f, 0x0a, 0x0b, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74,
-	0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0a, 0x69, 0x6d, 0x70,
-	0x6f, 0x72, 0x74, 0x4e, 0x61, 0x6d, 0x65, 0x42, 0x05, 0x0a, 0x03, 0x76, 0x61, 0x6c, 0x22, 0x3e,
-	0x0a, 0x0d, 0x53, 0x56, 0x4f, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x12,
-	0x2d, 0x0a, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32,
-	0x15, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x56,
-	0x4f, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x22, 0x85,
-	0x01, 0x0a, 0x0a, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x49, 0x6e, 0x66, 0x6f, 0x12, 0x12, 0x0a,
-	0x04, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x6e, 0x61, 0x6d,
-	0x65, 0x12, 0x14, 0x0a, 0x05, 0x74, 0x79, 0x70, 0x65, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x09,
-	0x52, 0x05, 0x74, 0x79, 0x70, 0x65, 0x73, 0x12, 0x12, 0x0a, 0x04, 0x64, 0x63, 0x69, 0x64, 0x18,
-	0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x64, 0x63, 0x69, 0x64, 0x12, 0x23, 0x0a, 0x0d, 0x70,
-	0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x5f, 0x69, 0x64, 0x18, 0x04, 0x20, 0x01,
+	0x74, 0x56, 0x61, 0x72, 0x73, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01,
+	0x22, 0x51, 0x0a, 0x1c, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74,
+	0x56, 0x61, 0x72, 0x73, 0x55, 0x6e, 0x69, 0x6f, 0x6e, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
+	0x12, 0x14, 0x0a, 0x05, 0x64, 0x63, 0x69, 0x64, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52,
+	0x05, 0x64, 0x63, 0x69, 0x64, 0x73, 0x12, 0x1b, 0x0a, 0x09, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76,
+	0x61, 0x72, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x09, 0x52, 0x08, 0x73, 0x74, 0x61, 0x74, 0x56,
+	0x61, 0x72, 0x73, 0x22, 0x53, 0x0a, 0x1d, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x53,
+	0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x55, 0x6e, 0x69, 0x6f, 0x6e, 0x52, 0x65, 0x73, 0x70,
+	0x6f, 0x6e, 0x73, 0x65, 0x12, 0x32, 0x0a, 0x09, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72,
+	0x73, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x15, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f,
+	0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x52, 0x08,
+	0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x22, 0x3e, 0x0a, 0x1f, 0x47, 0x65, 0x74, 0x50,
+	0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x55, 0x6e, 0x69, 0x6f,
+	0x6e, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x56, 0x31, 0x12, 0x1b, 0x0a, 0x09, 0x73,
+	0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x08,
+	0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x22, 0xc7, 0x01, 0x0a, 0x0d, 0x53, 0x74, 0x61,
+	0x74, 0x56, 0x61, 0x72, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x12, 0x55, 0x0a, 0x0f, 0x73, 0x74,
+	0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x18, 0x01, 0x20,
+	0x03, 0x28, 0x0b, 0x32, 0x2d, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e,
+	0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x2e,
+	0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x45, 0x6e, 0x74,
+	0x72, 0x79, 0x52, 0x0d, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x47, 0x72, 0x6f, 0x75, 0x70,
+	0x73, 0x1a, 0x5f, 0x0a, 0x12, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x47, 0x72, 0x6f, 0x75,
+	0x70, 0x73, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01,
+	0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x33, 0x0a, 0x05, 0x76, 0x61, 0x6c,
+	0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1d, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63,
+	0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x47, 0x72,
+	0x6f, 0x75, 0x70, 0x4e, 0x6f, 0x64, 0x65, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02,
+	0x38, 0x01, 0x22, 0xf1, 0x04, 0x0a, 0x10, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x47, 0x72,
+	0x6f, 0x75, 0x70, 0x4e, 0x6f, 0x64, 0x65, 0x12, 0x23, 0x0a, 0x0d, 0x61, 0x62, 0x73, 0x6f, 0x6c,
+	0x75, 0x74, 0x65, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0c,
+	0x61, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x4e, 0x61, 0x6d, 0x65, 0x12, 0x4d, 0x0a, 0x0f,
+	0x63, 0x68, 0x69, 0x6c, 0x64, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x73, 0x18,
+	0x02, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x25, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d,
+	0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x47, 0x72, 0x6f, 0x75, 0x70,
+	0x4e, 0x6f, 0x64, 0x65, 0x2e, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x53, 0x56, 0x52, 0x0d, 0x63, 0x68,
+	0x69, 0x6c, 0x64, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x12, 0x59, 0x0a, 0x15, 0x63,
+	0x68, 0x69, 0x6c, 0x64, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x67, 0x72,
+	0x6f, 0x75, 0x70, 0x73, 0x18, 0x03, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x26, 0x2e, 0x64, 0x61, 0x74,
+	0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72,
+	0x47, 0x72, 0x6f, 0x75, 0x70, 0x4e, 0x6f, 0x64, 0x65, 0x2e, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x53,
+	0x56, 0x47, 0x52, 0x12, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72,
+	0x47, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x12, 0x33, 0x0a, 0x16, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74,
+	0x5f, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x73,
+	0x18, 0x04, 0x20, 0x03, 0x28, 0x09, 0x52, 0x13, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x53, 0x74,
+	0x61, 0x74, 0x56, 0x61, 0x72, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x12, 0x37, 0x0a, 0x18, 0x6e,
+	0x75, 0x6d, 0x5f, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74,
+	0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x73, 0x18, 0x05, 0x20, 0x01, 0x28, 0x05, 0x52, 0x15, 0x6e,
+	0x75, 0x6d, 0x44, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x74, 0x53, 0x74, 0x61, 0x74,
+	0x56, 0x61, 0x72, 0x73, 0x1a, 0xa5, 0x01, 0x0a, 0x08, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x53, 0x56,
+	0x47, 0x12, 0x0e, 0x0a, 0x02, 0x69, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x02, 0x69,
+	0x64, 0x12, 0x2d, 0x0a, 0x12, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x64,
+	0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x11, 0x73,
+	0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x64, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79,
+	0x12, 0x21, 0x0a, 0x0c, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x5f, 0x6e, 0x61, 0x6d, 0x65,
+	0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x4e,
+	0x61, 0x6d, 0x65, 0x12, 0x37, 0x0a, 0x18, 0x6e, 0x75, 0x6d, 0x5f, 0x64, 0x65, 0x73, 0x63, 0x65,
+	0x6e, 0x64, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x73, 0x18,
+	0x04, 0x20, 0x01, 0x28, 0x05, 0x52, 0x15, 0x6e, 0x75, 0x6d, 0x44, 0x65, 0x73, 0x63, 0x65, 0x6e,
+	0x64, 0x65, 0x6e, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x1a, 0x78, 0x0a, 0x07,
+	0x43, 0x68, 0x69, 0x6c, 0x64, 0x53, 0x56, 0x12, 0x0e, 0x0a, 0x02, 0x69, 0x64, 0x18, 0x01, 0x20,
+	0x01, 0x28, 0x09, 0x52, 0x02, 0x69, 0x64, 0x12, 0x1f, 0x0a, 0x0b, 0x73, 0x65, 0x61, 0x72, 0x63,
+	0x68, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0a, 0x73, 0x65,
+	0x61, 0x72, 0x63, 0x68, 0x4e, 0x61, 0x6d, 0x65, 0x12, 0x21, 0x0a, 0x0c, 0x64, 0x69, 0x73, 0x70,
+	0x6c, 0x61, 0x79, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0b,
+	0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x4e, 0x61, 0x6d, 0x65, 0x12, 0x19, 0x0a, 0x08, 0x68,
+	0x61, 0x73, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x18, 0x04, 0x20, 0x01, 0x28, 0x08, 0x52, 0x07, 0x68,
+	0x61, 0x73, 0x44, 0x61, 0x74, 0x61, 0x22, 0x36, 0x0a, 0x16, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61,
+	0x74, 0x56, 0x61, 0x72, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
+	0x12, 0x16, 0x0a, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x09,
+	0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x4a, 0x04, 0x08, 0x01, 0x10, 0x02, 0x22, 0x86,
+	0x01, 0x0a, 0x1a, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x47, 0x72, 0x6f,
+	0x75, 0x70, 0x4e, 0x6f, 0x64, 0x65, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x24, 0x0a,
+	0x0e, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x18,
+	0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0c, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x47, 0x72,
+	0x6f, 0x75, 0x70, 0x12, 0x16, 0x0a, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x02, 0x20,
+	0x03, 0x28, 0x09, 0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x12, 0x2a, 0x0a, 0x11, 0x72,
+	0x65, 0x61, 0x64, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x74, 0x72, 0x69, 0x70, 0x6c, 0x65, 0x73,
+	0x18, 0x03, 0x20, 0x01, 0x28, 0x08, 0x52, 0x0f, 0x72, 0x65, 0x61, 0x64, 0x46, 0x72, 0x6f, 0x6d,
+	0x54, 0x72, 0x69, 0x70, 0x6c, 0x65, 0x73, 0x22, 0xa1, 0x02, 0x0a, 0x08, 0x53, 0x56, 0x4f, 0x50,
+	0x6c, 0x61, 0x63, 0x65, 0x12, 0x12, 0x0a, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x01, 0x20, 0x01,
+	0x28, 0x09, 0x52, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x12, 0x12, 0x0a, 0x04, 0x74, 0x79, 0x70, 0x65,
+	0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x74, 0x79, 0x70, 0x65, 0x12, 0x12, 0x0a, 0x04,
+	0x64, 0x63, 0x69, 0x64, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x64, 0x63, 0x69, 0x64,
+	0x12, 0x3f, 0x0a, 0x0c, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+	0x18, 0x04, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x1b, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d,
+	0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x56, 0x4f, 0x4f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74,
+	0x69, 0x6f, 0x6e, 0x52, 0x0c, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+	0x73, 0x12, 0x23, 0x0a, 0x0d, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x5f,
+	0x69, 0x64, 0x18, 0x05, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0c, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e,
+	0x61, 0x6e, 0x63, 0x65, 0x49, 0x64, 0x12, 0x2e, 0x0a, 0x04, 0x74, 0x65, 0x6d, 0x70, 0x18, 0x06,
+	0x20, 0x01, 0x28, 0x0b, 0x32, 0x1a, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
+	0x6e, 0x73, 0x2e, 0x53, 0x56, 0x4f, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x2e, 0x54, 0x65, 0x6d, 0x70,
+	0x52, 0x04, 0x74, 0x65, 0x6d, 0x70, 0x1a, 0x43, 0x0a, 0x04, 0x54, 0x65, 0x6d, 0x70, 0x12, 0x21,
+	0x0a, 0x0c, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x02,
+	0x20, 0x03, 0x28, 0x09, 0x52, 0x0b, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x50, 0x6c, 0x61, 0x63, 0x65,
+	0x73, 0x12, 0x12, 0x0a, 0x04, 0x6d, 0x69, 0x64, 0x73, 0x18, 0x03, 0x20, 0x03, 0x28, 0x09, 0x52,
+	0x04, 0x6d, 0x69, 0x64, 0x73, 0x4a, 0x04, 0x08, 0x01, 0x10, 0x02, 0x22, 0x8c, 0x04, 0x0a, 0x0e,
+	0x53, 0x56, 0x4f, 0x4f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x12, 0x12,
+	0x0a, 0x04, 0x64, 0x63, 0x69, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x64, 0x63,
+	0x69, 0x64, 0x12, 0x29, 0x0a, 0x10, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f,
+	0x6e, 0x5f, 0x64, 0x61, 0x74, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0f, 0x6f, 0x62,
+	0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x44, 0x61, 0x74, 0x65, 0x12, 0x2d, 0x0a,
+	0x12, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x70, 0x65, 0x72,
+	0x69, 0x6f, 0x64, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x11, 0x6f, 0x62, 0x73, 0x65, 0x72,
+	0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x50, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x12, 0x2d, 0x0a, 0x12,
+	0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x65, 0x74, 0x68,
+	0x6f, 0x64, 0x18, 0x04, 0x20, 0x01, 0x28, 0x09, 0x52, 0x11, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72,
+	0x65, 0x6d, 0x65, 0x6e, 0x74, 0x4d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x12, 0x12, 0x0a, 0x04, 0x75,
+	0x6e, 0x69, 0x74, 0x18, 0x05, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x75, 0x6e, 0x69, 0x74, 0x12,
+	0x25, 0x0a, 0x0e, 0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x61, 0x63, 0x74, 0x6f,
+	0x72, 0x18, 0x06, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0d, 0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e, 0x67,
+	0x46, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x12, 0x23, 0x0a, 0x0d, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e,
+	0x61, 0x6e, 0x63, 0x65, 0x5f, 0x69, 0x64, 0x18, 0x07, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0c, 0x70,
+	0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x64, 0x12, 0x1d, 0x0a, 0x09, 0x73,
+	0x74, 0x72, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x08, 0x20, 0x01, 0x28, 0x09, 0x48, 0x00,
+	0x52, 0x08, 0x73, 0x74, 0x72, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x12, 0x1d, 0x0a, 0x09, 0x64, 0x62,
+	0x6c, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x09, 0x20, 0x01, 0x28, 0x01, 0x48, 0x00, 0x52,
+	0x08, 0x64, 0x62, 0x6c, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x12, 0x34, 0x0a, 0x04, 0x74, 0x65, 0x6d,
+	0x70, 0x18, 0x0a, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x20, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f,
+	0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x56, 0x4f, 0x4f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61,
+	0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x54, 0x65, 0x6d, 0x70, 0x52, 0x04, 0x74, 0x65, 0x6d, 0x70, 0x1a,
+	0x81, 0x01, 0x0a, 0x04, 0x54, 0x65, 0x6d, 0x70, 0x12, 0x2b, 0x0a, 0x11, 0x6f, 0x62, 0x73, 0x65,
+	0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x18, 0x01, 0x20,
+	0x01, 0x28, 0x09, 0x52, 0x10, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+	0x41, 0x62, 0x6f, 0x75, 0x74, 0x12, 0x2b, 0x0a, 0x11, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
+	0x65, 0x5f, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x64, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09,
+	0x52, 0x10, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4d, 0x65, 0x61, 0x73, 0x75, 0x72,
+	0x65, 0x64, 0x12, 0x1f, 0x0a, 0x0b, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x6e, 0x61, 0x6d,
+	0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0a, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x4e,
+	0x61, 0x6d, 0x65, 0x42, 0x05, 0x0a, 0x03, 0x76, 0x61, 0x6c, 0x22, 0x3e, 0x0a, 0x0d, 0x53, 0x56,
+	0x4f, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x12, 0x2d, 0x0a, 0x06, 0x70,
+	0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x15, 0x2e, 0x64, 0x61,
+	0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x56, 0x4f, 0x50, 0x6c, 0x61,
+	0x63, 0x65, 0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x22, 0x85, 0x01, 0x0a, 0x0a, 0x45,
+	0x6e, 0x74, 0x69, 0x74, 0x79, 0x49, 0x6e, 0x66, 0x6f, 0x12, 0x12, 0x0a, 0x04, 0x6e, 0x61, 0x6d,
+	0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x12, 0x14, 0x0a,
+	0x05, 0x74, 0x79, 0x70, 0x65, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x09, 0x52, 0x05, 0x74, 0x79,
+	0x70, 0x65, 0x73, 0x12, 0x12, 0x0a, 0x04, 0x64, 0x63, 0x69, 0x64, 0x18, 0x03, 0x20, 0x01, 0x28,
+	0x09, 0x52, 0x04, 0x64, 0x63, 0x69, 0x64, 0x12, 0x23, 0x0a, 0x0d, 0x70, 0x72, 0x6f, 0x76, 0x65,
+	0x6e, 0x61, 0x6e, 0x63, 0x65, 0x5f, 0x69, 0x64, 0x18, 0x04, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0c,
+	0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x64, 0x12, 0x14, 0x0a, 0x05,
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x05, 0x20, 0x01, 0x28, 0x09, 0x52, 0x05, 0x76, 0x61, 0x6c,
+	0x75, 0x65, 0x22, 0x6c, 0x0a, 0x14, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x49, 0x6e, 0x66, 0x6f,
+	0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x12, 0x33, 0x0a, 0x08, 0x65, 0x6e,
+	0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x17, 0x2e, 0x64,
+	0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x45, 0x6e, 0x74, 0x69, 0x74,
+	0x79, 0x49, 0x6e, 0x66, 0x6f, 0x52, 0x08, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x12,
+	0x1f, 0x0a, 0x0b, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x18, 0x02,
+	0x20, 0x01, 0x28, 0x03, 0x52, 0x0a, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x43, 0x6f, 0x75, 0x6e, 0x74,
+	0x22, 0x92, 0x01, 0x0a, 0x18, 0x43, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x64, 0x49, 0x6e,
+	0x50, 0x6c, 0x61, 0x63, 0x65, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x12, 0x1b, 0x0a,
+	0x09, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x69, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09,
+	0x52, 0x08, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x49, 0x64, 0x12, 0x1f, 0x0a, 0x0b, 0x70, 0x61,
+	0x72, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52,
+	0x0a, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x54, 0x79, 0x70, 0x65, 0x12, 0x19, 0x0a, 0x08, 0x63,
+	0x68, 0x69, 0x6c, 0x64, 0x5f, 0x69, 0x64, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x07, 0x63,
+	0x68, 0x69, 0x6c, 0x64, 0x49, 0x64, 0x12, 0x1d, 0x0a, 0x0a, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x5f,
+	0x74, 0x79, 0x70, 0x65, 0x18, 0x04, 0x20, 0x01, 0x28, 0x09, 0x52, 0x09, 0x63, 0x68, 0x69, 0x6c,
+	0x64, 0x54, 0x79, 0x70, 0x65, 0x22, 0xb6, 0x02, 0x0a, 0x06, 0x54, 0x72, 0x69, 0x70, 0x6c, 0x65,
+	0x12, 0x1d, 0x0a, 0x0a, 0x73, 0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x69, 0x64, 0x18, 0x01,
+	0x20, 0x01, 0x28, 0x09, 0x52, 0x09, 0x73, 0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x49, 0x64, 0x12,
+	0x1c, 0x0a, 0x09, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x18, 0x02, 0x20, 0x01,
+	0x28, 0x09, 0x52, 0x09, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x12, 0x1b, 0x0a,
+	0x09, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x69, 0x64, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09,
+	0x52, 0x08, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x49, 0x64, 0x12, 0x1f, 0x0a, 0x0b, 0x6f, 0x62,
+	0x6a, 0x65, 0x63, 0x74, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x04, 0x20, 0x01, 0x28, 0x09, 0x52,
+	0x0a, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x4e, 0x61, 0x6d, 0x65, 0x12, 0x21, 0x0a, 0x0c, 0x6f,
+	0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x05, 0x20, 0x01, 0x28,
+	0x09, 0x52, 0x0b, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x12, 0x23,
+	0x0a, 0x0d, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x5f, 0x69, 0x64, 0x18,
+	0x06, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0c, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63,
+	0x65, 0x49, 0x64, 0x12, 0x21, 0x0a, 0x0c, 0x73, 0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x6e,
+	0x61, 0x6d, 0x65, 0x18, 0x07, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0b, 0x73, 0x75, 0x62, 0x6a, 0x65,
+	0x63, 0x74, 0x4e, 0x61, 0x6d, 0x65, 0x12, 0x23, 0x0a, 0x0d, 0x73, 0x75, 0x62, 0x6a, 0x65, 0x63,
+	0x74, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x73, 0x18, 0x08, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0c, 0x73,
+	0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x54, 0x79, 0x70, 0x65, 0x73, 0x12, 0x21, 0x0a, 0x0c, 0x6f,
+	0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x73, 0x18, 0x0a, 0x20, 0x03, 0x28,
+	0x09, 0x52, 0x0b, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x54, 0x79, 0x70, 0x65, 0x73, 0x22, 0x59,
+	0x0a, 0x07, 0x54, 0x72, 0x69, 0x70, 0x6c, 0x65, 0x73, 0x12, 0x2d, 0x0a, 0x07, 0x74, 0x72, 0x69,
+	0x70, 0x6c, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x13, 0x2e, 0x64, 0x61, 0x74,
+	0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x54, 0x72, 0x69, 0x70, 0x6c, 0x65, 0x52,
+	0x07, 0x74, 0x72, 0x69, 0x70, 0x6c, 0x65, 0x73, 0x12, 0x1f, 0x0a, 0x0b, 0x74, 0x6f, 0x74, 0x61,
+	0x6c, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x18, 0x02, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0a, 0x74,
+	0x6f, 0x74, 0x61, 0x6c, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x22, 0x6e, 0x0a, 0x0e, 0x50, 0x72, 0x6f,
+	0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x6e, 0x66, 0x6f, 0x12, 0x23, 0x0a, 0x0d, 0x70,
+	0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x5f, 0x69, 0x64, 0x18, 0x01, 0x20, 0x01,
 	0x28, 0x09, 0x52, 0x0c, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x64,
-	0x12, 0x14, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x05, 0x20, 0x01, 0x28, 0x09, 0x52,
-	0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x6c, 0x0a, 0x14, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79,
-	0x49, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x12, 0x33,
-	0x0a, 0x08, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b,
+	0x12, 0x16, 0x0a, 0x06, 0x64, 0x6f, 0x6d, 0x61, 0x69, 0x6e, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09,
+	0x52, 0x06, 0x64, 0x6f, 0x6d, 0x61, 0x69, 0x6e, 0x12, 0x1f, 0x0a, 0x0b, 0x69, 0x6d, 0x70, 0x6f,
+	0x72, 0x74, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0a, 0x69,
+	0x6d, 0x70, 0x6f, 0x72, 0x74, 0x4e, 0x61, 0x6d, 0x65, 0x22, 0x4c, 0x0a, 0x0b, 0x50, 0x72, 0x6f,
+	0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x12, 0x3d, 0x0a, 0x0b, 0x70, 0x72, 0x6f, 0x76,
+	0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x1b, 0x2e,
+	0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x50, 0x72, 0x6f, 0x76,
+	0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x6e, 0x66, 0x6f, 0x52, 0x0b, 0x70, 0x72, 0x6f, 0x76,
+	0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x22, 0x4c, 0x0a, 0x0e, 0x50, 0x72, 0x6f, 0x70, 0x65,
+	0x72, 0x74, 0x79, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x12, 0x1b, 0x0a, 0x09, 0x69, 0x6e, 0x5f,
+	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x08, 0x69, 0x6e,
+	0x4c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x12, 0x1d, 0x0a, 0x0a, 0x6f, 0x75, 0x74, 0x5f, 0x6c, 0x61,
+	0x62, 0x65, 0x6c, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x09, 0x52, 0x09, 0x6f, 0x75, 0x74, 0x4c,
+	0x61, 0x62, 0x65, 0x6c, 0x73, 0x22, 0xa1, 0x04, 0x0a, 0x11, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x65,
+	0x64, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x49, 0x6e, 0x66, 0x6f, 0x12, 0x25, 0x0a, 0x0e, 0x72,
+	0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x01, 0x20,
+	0x03, 0x28, 0x09, 0x52, 0x0d, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x50, 0x6c, 0x61, 0x63,
+	0x65, 0x73, 0x12, 0x22, 0x0a, 0x0d, 0x72, 0x61, 0x6e, 0x6b, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f,
+	0x74, 0x6f, 0x70, 0x18, 0x02, 0x20, 0x01, 0x28, 0x05, 0x52, 0x0b, 0x72, 0x61, 0x6e, 0x6b, 0x46,
+	0x72, 0x6f, 0x6d, 0x54, 0x6f, 0x70, 0x12, 0x28, 0x0a, 0x10, 0x72, 0x61, 0x6e, 0x6b, 0x5f, 0x66,
+	0x72, 0x6f, 0x6d, 0x5f, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x18, 0x03, 0x20, 0x01, 0x28, 0x05,
+	0x52, 0x0e, 0x72, 0x61, 0x6e, 0x6b, 0x46, 0x72, 0x6f, 0x6d, 0x42, 0x6f, 0x74, 0x74, 0x6f, 0x6d,
+	0x12, 0x41, 0x0a, 0x08, 0x72, 0x61, 0x6e, 0x6b, 0x5f, 0x61, 0x6c, 0x6c, 0x18, 0x07, 0x20, 0x01,
+	0x28, 0x0b, 0x32, 0x26, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73,
+	0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x49, 0x6e,
+	0x66, 0x6f, 0x2e, 0x52, 0x61, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 0x52, 0x07, 0x72, 0x61, 0x6e, 0x6b,
+	0x41, 0x6c, 0x6c, 0x12, 0x4a, 0x0a, 0x0d, 0x72, 0x61, 0x6e, 0x6b, 0x5f, 0x74, 0x6f, 0x70, 0x5f,
+	0x31, 0x30, 0x30, 0x30, 0x18, 0x08, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x26, 0x2e, 0x64, 0x61, 0x74,
+	0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
+	0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x49, 0x6e, 0x66, 0x6f, 0x2e, 0x52, 0x61, 0x6e, 0x6b, 0x69,
+	0x6e, 0x67, 0x52, 0x0b, 0x72, 0x61, 0x6e, 0x6b, 0x54, 0x6f, 0x70, 0x31, 0x30, 0x30, 0x30, 0x12,
+	0x50, 0x0a, 0x10, 0x72, 0x61, 0x6e, 0x6b, 0x5f, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x5f, 0x31,
+	0x30, 0x30, 0x30, 0x18, 0x09, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x26, 0x2e, 0x64, 0x61, 0x74, 0x61,
+	0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x50,
+	0x6c, 0x61, 0x63, 0x65, 0x73, 0x49, 0x6e, 0x66, 0x6f, 0x2e, 0x52, 0x61, 0x6e, 0x6b, 0x69, 0x6e,
+	0x67, 0x52, 0x0e, 0x72, 0x61, 0x6e, 0x6b, 0x42, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x31, 0x30, 0x30,
+	0x30, 0x1a, 0xa3, 0x01, 0x0a, 0x07, 0x52, 0x61, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 0x12, 0x43, 0x0a,
+	0x04, 0x69, 0x6e, 0x66, 0x6f, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x2f, 0x2e, 0x64, 0x61,
+	0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x65,
+	0x64, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x49, 0x6e, 0x66, 0x6f, 0x2e, 0x52, 0x61, 0x6e, 0x6b,
+	0x69, 0x6e, 0x67, 0x2e, 0x52, 0x61, 0x6e, 0x6b, 0x49, 0x6e, 0x66, 0x6f, 0x52, 0x04, 0x69, 0x6e,
+	0x66, 0x6f, 0x1a, 0x53, 0x0a, 0x08, 0x52, 0x61, 0x6e, 0x6b, 0x49, 0x6e, 0x66, 0x6f, 0x12, 0x12,
+	0x0a, 0x04, 0x72, 0x61, 0x6e, 0x6b, 0x18, 0x01, 0x20, 0x01, 0x28, 0x05, 0x52, 0x04, 0x72, 0x61,
+	0x6e, 0x6b, 0x12, 0x14, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28,
+	0x01, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x12, 0x1d, 0x0a, 0x0a, 0x70, 0x6c, 0x61, 0x63,
+	0x65, 0x5f, 0x64, 0x63, 0x69, 0x64, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x09, 0x70, 0x6c,
+	0x61, 0x63, 0x65, 0x44, 0x63, 0x69, 0x64, 0x4a, 0x04, 0x08, 0x04, 0x10, 0x05, 0x4a, 0x04, 0x08,
+	0x05, 0x10, 0x06, 0x4a, 0x04, 0x08, 0x06, 0x10, 0x07, 0x22, 0x50, 0x0a, 0x15, 0x50, 0x6c, 0x61,
+	0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x45, 0x78, 0x69, 0x73, 0x74, 0x65, 0x6e,
+	0x63, 0x65, 0x12, 0x37, 0x0a, 0x18, 0x6e, 0x75, 0x6d, 0x5f, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e,
+	0x64, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x73, 0x18, 0x01,
+	0x20, 0x01, 0x28, 0x05, 0x52, 0x15, 0x6e, 0x75, 0x6d, 0x44, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64,
+	0x65, 0x6e, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x22, 0x27, 0x0a, 0x15, 0x47,
+	0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x50, 0x61, 0x74, 0x68, 0x52, 0x65, 0x71,
+	0x75, 0x65, 0x73, 0x74, 0x12, 0x0e, 0x0a, 0x02, 0x69, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09,
+	0x52, 0x02, 0x69, 0x64, 0x22, 0x2c, 0x0a, 0x16, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56,
+	0x61, 0x72, 0x50, 0x61, 0x74, 0x68, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x12,
+	0x0a, 0x04, 0x70, 0x61, 0x74, 0x68, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x04, 0x70, 0x61,
+	0x74, 0x68, 0x22, 0x6f, 0x0a, 0x14, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x53, 0x74, 0x61, 0x74,
+	0x56, 0x61, 0x72, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x14, 0x0a, 0x05, 0x71, 0x75,
+	0x65, 0x72, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x05, 0x71, 0x75, 0x65, 0x72, 0x79,
+	0x12, 0x16, 0x0a, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x09,
+	0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x12, 0x29, 0x0a, 0x10, 0x65, 0x6e, 0x61, 0x62,
+	0x6c, 0x65, 0x5f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x6c, 0x69, 0x73, 0x74, 0x18, 0x03, 0x20, 0x01,
+	0x28, 0x08, 0x52, 0x0f, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x6c,
+	0x69, 0x73, 0x74, 0x22, 0x8e, 0x01, 0x0a, 0x15, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x53, 0x74,
+	0x61, 0x74, 0x56, 0x61, 0x72, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x34, 0x0a,
+	0x09, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b,
 	0x32, 0x17, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x45,
-	0x6e, 0x74, 0x69, 0x74, 0x79, 0x49, 0x6e, 0x66, 0x6f, 0x52, 0x08, 0x65, 0x6e, 0x74, 0x69, 0x74,
-	0x69, 0x65, 0x73, 0x12, 0x1f, 0x0a, 0x0b, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x63, 0x6f, 0x75,
-	0x6e, 0x74, 0x18, 0x02, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0a, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x43,
-	0x6f, 0x75, 0x6e, 0x74, 0x22, 0x92, 0x01, 0x0a, 0x18, 0x43, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e,
-	0x65, 0x64, 0x49, 0x6e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f,
-	0x6e, 0x12, 0x1b, 0x0a, 0x09, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x69, 0x64, 0x18, 0x01,
-	0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x49, 0x64, 0x12, 0x1f,
-	0x0a, 0x0b, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x18, 0x02, 0x20,
-	0x01, 0x28, 0x09, 0x52, 0x0a, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x54, 0x79, 0x70, 0x65, 0x12,
-	0x19, 0x0a, 0x08, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x5f, 0x69, 0x64, 0x18, 0x03, 0x20, 0x01, 0x28,
-	0x09, 0x52, 0x07, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x49, 0x64, 0x12, 0x1d, 0x0a, 0x0a, 0x63, 0x68,
-	0x69, 0x6c, 0x64, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x18, 0x04, 0x20, 0x01, 0x28, 0x09, 0x52, 0x09,
-	0x63, 0x68, 0x69, 0x6c, 0x64, 0x54, 0x79, 0x70, 0x65, 0x22, 0xb6, 0x02, 0x0a, 0x06, 0x54, 0x72,
-	0x69, 0x70, 0x6c, 0x65, 0x12, 0x1d, 0x0a, 0x0a, 0x73, 0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f,
-	0x69, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x09, 0x73, 0x75, 0x62, 0x6a, 0x65, 0x63,
-	0x74, 0x49, 0x64, 0x12, 0x1c, 0x0a, 0x09, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65,
-	0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x09, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74,
-	0x65, 0x12, 0x1b, 0x0a, 0x09, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x69, 0x64, 0x18, 0x03,
-	0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x49, 0x64, 0x12, 0x1f,
-	0x0a, 0x0b, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x04, 0x20,
-	0x01, 0x28, 0x09, 0x52, 0x0a, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x4e, 0x61, 0x6d, 0x65, 0x12,
-	0x21, 0x0a, 0x0c, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18,
-	0x05, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0b, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x56, 0x61, 0x6c,
-	0x75, 0x65, 0x12, 0x23, 0x0a, 0x0d, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65,
-	0x5f, 0x69, 0x64, 0x18, 0x06, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0c, 0x70, 0x72, 0x6f, 0x76, 0x65,
-	0x6e, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x64, 0x12, 0x21, 0x0a, 0x0c, 0x73, 0x75, 0x62, 0x6a, 0x65,
-	0x63, 0x74, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x07, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0b, 0x73,
-	0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x4e, 0x61, 0x6d, 0x65, 0x12, 0x23, 0x0a, 0x0d, 0x73, 0x75,
-	0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x73, 0x18, 0x08, 0x20, 0x03, 0x28,
-	0x09, 0x52, 0x0c, 0x73, 0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x54, 0x79, 0x70, 0x65, 0x73, 0x12,
-	0x21, 0x0a, 0x0c, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x73, 0x18,
-	0x0a, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0b, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x54, 0x79, 0x70,
-	0x65, 0x73, 0x22, 0x59, 0x0a, 0x07, 0x54, 0x72, 0x69, 0x70, 0x6c, 0x65, 0x73, 0x12, 0x2d, 0x0a,
-	0x07, 0x74, 0x72, 0x69, 0x70, 0x6c, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x13,
-	0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x54, 0x72, 0x69,
-	0x70, 0x6c, 0x65, 0x52, 0x07, 0x74, 0x72, 0x69, 0x70, 0x6c, 0x65, 0x73, 0x12, 0x1f, 0x0a, 0x0b,
-	0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x18, 0x02, 0x20, 0x01, 0x28,
-	0x03, 0x52, 0x0a, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x22, 0x6e, 0x0a,
-	0x0e, 0x50, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x6e, 0x66, 0x6f, 0x12,
-	0x23, 0x0a, 0x0d, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x5f, 0x69, 0x64,
-	0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0c, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e,
-	0x63, 0x65, 0x49, 0x64, 0x12, 0x16, 0x0a, 0x06, 0x64, 0x6f, 0x6d, 0x61, 0x69, 0x6e, 0x18, 0x02,
-	0x20, 0x01, 0x28, 0x09, 0x52, 0x06, 0x64, 0x6f, 0x6d, 0x61, 0x69, 0x6e, 0x12, 0x1f, 0x0a, 0x0b,
-	0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x03, 0x20, 0x01, 0x28,
-	0x09, 0x52, 0x0a, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x4e, 0x61, 0x6d, 0x65, 0x22, 0x4c, 0x0a,
-	0x0b, 0x50, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x12, 0x3d, 0x0a, 0x0b,
-	0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28,
-	0x0b, 0x32, 0x1b, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e,
-	0x50, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x6e, 0x66, 0x6f, 0x52, 0x0b,
-	0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x22, 0x4c, 0x0a, 0x0e, 0x50,
-	0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x12, 0x1b, 0x0a,
-	0x09, 0x69, 0x6e, 0x5f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09,
-	0x52, 0x08, 0x69, 0x6e, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x12, 0x1d, 0x0a, 0x0a, 0x6f, 0x75,
-	0x74, 0x5f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x09, 0x52, 0x09,
-	0x6f, 0x75, 0x74, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x22, 0xa1, 0x04, 0x0a, 0x11, 0x52, 0x65,
-	0x6c, 0x61, 0x74, 0x65, 0x64, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x49, 0x6e, 0x66, 0x6f, 0x12,
-	0x25, 0x0a, 0x0e, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65,
-	0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0d, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-	0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x12, 0x22, 0x0a, 0x0d, 0x72, 0x61, 0x6e, 0x6b, 0x5f, 0x66,
-	0x72, 0x6f, 0x6d, 0x5f, 0x74, 0x6f, 0x70, 0x18, 0x02, 0x20, 0x01, 0x28, 0x05, 0x52, 0x0b, 0x72,
-	0x61, 0x6e, 0x6b, 0x46, 0x72, 0x6f, 0x6d, 0x54, 0x6f, 0x70, 0x12, 0x28, 0x0a, 0x10, 0x72, 0x61,
-	0x6e, 0x6b, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x18, 0x03,
-	0x20, 0x01, 0x28, 0x05, 0x52, 0x0e, 0x72, 0x61, 0x6e, 0x6b, 0x46, 0x72, 0x6f, 0x6d, 0x42, 0x6f,
-	0x74, 0x74, 0x6f, 0x6d, 0x12, 0x41, 0x0a, 0x08, 0x72, 0x61, 0x6e, 0x6b, 0x5f, 0x61, 0x6c, 0x6c,
-	0x18, 0x07, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x26, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d,
-	0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x50, 0x6c, 0x61, 0x63,
-	0x65, 0x73, 0x49, 0x6e, 0x66, 0x6f, 0x2e, 0x52, 0x61, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 0x52, 0x07,
-	0x72, 0x61, 0x6e, 0x6b, 0x41, 0x6c, 0x6c, 0x12, 0x4a, 0x0a, 0x0d, 0x72, 0x61, 0x6e, 0x6b, 0x5f,
-	0x74, 0x6f, 0x70, 0x5f, 0x31, 0x30, 0x30, 0x30, 0x18, 0x08, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x26,
-	0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x52, 0x65, 0x6c,
-	0x61, 0x74, 0x65, 0x64, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x49, 0x6e, 0x66, 0x6f, 0x2e, 0x52,
-	0x61, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 0x52, 0x0b, 0x72, 0x61, 0x6e, 0x6b, 0x54, 0x6f, 0x70, 0x31,
-	0x30, 0x30, 0x30, 0x12, 0x50, 0x0a, 0x10, 0x72, 0x61, 0x6e, 0x6b, 0x5f, 0x62, 0x6f, 0x74, 0x74,
-	0x6f, 0x6d, 0x5f, 0x31, 0x30, 0x30, 0x30, 0x18, 0x09, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x26, 0x2e,
-	0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x52, 0x65, 0x6c, 0x61,
-	0x74, 0x65, 0x64, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x49, 0x6e, 0x66, 0x6f, 0x2e, 0x52, 0x61,
-	0x6e, 0x6b, 0x69, 0x6e, 0x67, 0x52, 0x0e, 0x72, 0x61, 0x6e, 0x6b, 0x42, 0x6f, 0x74, 0x74, 0x6f,
-	0x6d, 0x31, 0x30, 0x30, 0x30, 0x1a, 0xa3, 0x01, 0x0a, 0x07, 0x52, 0x61, 0x6e, 0x6b, 0x69, 0x6e,
-	0x67, 0x12, 0x43, 0x0a, 0x04, 0x69, 0x6e, 0x66, 0x6f, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32,
-	0x2f, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x52, 0x65,
-	0x6c, 0x61, 0x74, 0x65, 0x64, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x49, 0x6e, 0x66, 0x6f, 0x2e,
-	0x52, 0x61, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 0x2e, 0x52, 0x61, 0x6e, 0x6b, 0x49, 0x6e, 0x66, 0x6f,
-	0x52, 0x04, 0x69, 0x6e, 0x66, 0x6f, 0x1a, 0x53, 0x0a, 0x08, 0x52, 0x61, 0x6e, 0x6b, 0x49, 0x6e,
-	0x66, 0x6f, 0x12, 0x12, 0x0a, 0x04, 0x72, 0x61, 0x6e, 0x6b, 0x18, 0x01, 0x20, 0x01, 0x28, 0x05,
-	0x52, 0x04, 0x72, 0x61, 0x6e, 0x6b, 0x12, 0x14, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18,
-	0x02, 0x20, 0x01, 0x28, 0x01, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x12, 0x1d, 0x0a, 0x0a,
-	0x70, 0x6c, 0x61, 0x63, 0x65, 0x5f, 0x64, 0x63, 0x69, 0x64, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09,
-	0x52, 0x09, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x44, 0x63, 0x69, 0x64, 0x4a, 0x04, 0x08, 0x04, 0x10,
-	0x05, 0x4a, 0x04, 0x08, 0x05, 0x10, 0x06, 0x4a, 0x04, 0x08, 0x06, 0x10, 0x07, 0x22, 0x50, 0x0a,
-	0x15, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x45, 0x78, 0x69,
-	0x73, 0x74, 0x65, 0x6e, 0x63, 0x65, 0x12, 0x37, 0x0a, 0x18, 0x6e, 0x75, 0x6d, 0x5f, 0x64, 0x65,
-	0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61,
-	0x72, 0x73, 0x18, 0x01, 0x20, 0x01, 0x28, 0x05, 0x52, 0x15, 0x6e, 0x75, 0x6d, 0x44, 0x65, 0x73,
-	0x63, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x22,
-	0x27, 0x0a, 0x15, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x50, 0x61, 0x74,
-	0x68, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x0e, 0x0a, 0x02, 0x69, 0x64, 0x18, 0x01,
-	0x20, 0x01, 0x28, 0x09, 0x52, 0x02, 0x69, 0x64, 0x22, 0x2c, 0x0a, 0x16, 0x47, 0x65, 0x74, 0x53,
-	0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x50, 0x61, 0x74, 0x68, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e,
-	0x73, 0x65, 0x12, 0x12, 0x0a, 0x04, 0x70, 0x61, 0x74, 0x68, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09,
-	0x52, 0x04, 0x70, 0x61, 0x74, 0x68, 0x22, 0x6f, 0x0a, 0x14, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68,
-	0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x14,
-	0x0a, 0x05, 0x71, 0x75, 0x65, 0x72, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x05, 0x71,
-	0x75, 0x65, 0x72, 0x79, 0x12, 0x16, 0x0a, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x02,
-	0x20, 0x03, 0x28, 0x09, 0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x12, 0x29, 0x0a, 0x10,
-	0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x6c, 0x69, 0x73, 0x74,
-	0x18, 0x03, 0x20, 0x01, 0x28, 0x08, 0x52, 0x0f, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x42, 0x6c,
-	0x6f, 0x63, 0x6b, 0x6c, 0x69, 0x73, 0x74, 0x22, 0x8e, 0x01, 0x0a, 0x15, 0x53, 0x65, 0x61, 0x72,
-	0x63, 0x68, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73,
-	0x65, 0x12, 0x34, 0x0a, 0x09, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x73, 0x18, 0x01,
-	0x20, 0x03, 0x28, 0x0b, 0x32, 0x17, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
-	0x6e, 0x73, 0x2e, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x49, 0x6e, 0x66, 0x6f, 0x52, 0x08, 0x73,
-	0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x12, 0x3f, 0x0a, 0x0f, 0x73, 0x74, 0x61, 0x74, 0x5f,
-	0x76, 0x61, 0x72, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x0b,
-	0x32, 0x17, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x45,
-	0x6e, 0x74, 0x69, 0x74, 0x79, 0x49, 0x6e, 0x66, 0x6f, 0x52, 0x0d, 0x73, 0x74, 0x61, 0x74, 0x56,
-	0x61, 0x72, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x22, 0xad, 0x03, 0x0a, 0x0e, 0x53, 0x74, 0x61,
-	0x74, 0x56, 0x61, 0x72, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x12, 0x5f, 0x0a, 0x12, 0x70,
-	0x6c, 0x61, 0x63, 0x65, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x5f, 0x73, 0x75, 0x6d, 0x6d, 0x61, 0x72,
-	0x79, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x31, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f,
-	0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x75, 0x6d,
-	0x6d, 0x61, 0x72, 0x79, 0x2e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x53, 0x75,
-	0x6d, 0x6d, 0x61, 0x72, 0x79, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x10, 0x70, 0x6c, 0x61, 0x63,
-	0x65, 0x54, 0x79, 0x70, 0x65, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x1a, 0x52, 0x0a, 0x05,
-	0x50, 0x6c, 0x61, 0x63, 0x65, 0x12, 0x12, 0x0a, 0x04, 0x64, 0x63, 0x69, 0x64, 0x18, 0x01, 0x20,
-	0x01, 0x28, 0x09, 0x52, 0x04, 0x64, 0x63, 0x69, 0x64, 0x12, 0x12, 0x0a, 0x04, 0x6e, 0x61, 0x6d,
-	0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x12, 0x21, 0x0a,
-	0x0c, 0x70, 0x65, 0x72, 0x73, 0x6f, 0x6e, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x18, 0x03, 0x20,
-	0x01, 0x28, 0x03, 0x52, 0x0b, 0x70, 0x65, 0x72, 0x73, 0x6f, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74,
-	0x1a, 0x73, 0x0a, 0x10, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x53, 0x75, 0x6d,
-	0x6d, 0x61, 0x72, 0x79, 0x12, 0x1d, 0x0a, 0x0a, 0x6e, 0x75, 0x6d, 0x5f, 0x70, 0x6c, 0x61, 0x63,
-	0x65, 0x73, 0x18, 0x01, 0x20, 0x01, 0x28, 0x03, 0x52, 0x09, 0x6e, 0x75, 0x6d, 0x50, 0x6c, 0x61,
-	0x63, 0x65, 0x73, 0x12, 0x40, 0x0a, 0x0a, 0x74, 0x6f, 0x70, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65,
-	0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x21, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f,
-	0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x75, 0x6d,
-	0x6d, 0x61, 0x72, 0x79, 0x2e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x52, 0x09, 0x74, 0x6f, 0x70, 0x50,
-	0x6c, 0x61, 0x63, 0x65, 0x73, 0x1a, 0x71, 0x0a, 0x15, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x54, 0x79,
-	0x70, 0x65, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10,
-	0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79,
-	0x12, 0x42, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32,
-	0x2c, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74,
-	0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x2e, 0x50, 0x6c, 0x61,
-	0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x52, 0x05, 0x76,
-	0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0x37, 0x0a, 0x18, 0x47, 0x65, 0x74, 0x53,
-	0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x52, 0x65, 0x71,
-	0x75, 0x65, 0x73, 0x74, 0x12, 0x1b, 0x0a, 0x09, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72,
-	0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x08, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72,
-	0x73, 0x22, 0xe1, 0x01, 0x0a, 0x19, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72,
-	0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12,
-	0x64, 0x0a, 0x10, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x73, 0x75, 0x6d, 0x6d,
-	0x61, 0x72, 0x79, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x3a, 0x2e, 0x64, 0x61, 0x74, 0x61,
-	0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56,
-	0x61, 0x72, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73,
-	0x65, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79,
-	0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x0e, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x75,
-	0x6d, 0x6d, 0x61, 0x72, 0x79, 0x1a, 0x5e, 0x0a, 0x13, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72,
-	0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03,
-	0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x31,
-	0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1b, 0x2e,
-	0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x74,
-	0x56, 0x61, 0x72, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75,
-	0x65, 0x3a, 0x02, 0x38, 0x01, 0x32, 0x8c, 0x20, 0x0a, 0x05, 0x4d, 0x69, 0x78, 0x65, 0x72, 0x12,
-	0x5b, 0x0a, 0x05, 0x51, 0x75, 0x65, 0x72, 0x79, 0x12, 0x19, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63,
-	0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x51, 0x75, 0x65, 0x72, 0x79, 0x52, 0x65, 0x71, 0x75,
-	0x65, 0x73, 0x74, 0x1a, 0x1a, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e,
-	0x73, 0x2e, 0x51, 0x75, 0x65, 0x72, 0x79, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x22,
-	0x1b, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x15, 0x12, 0x06, 0x2f, 0x71, 0x75, 0x65, 0x72, 0x79, 0x5a,
-	0x0b, 0x22, 0x06, 0x2f, 0x71, 0x75, 0x65, 0x72, 0x79, 0x3a, 0x01, 0x2a, 0x12, 0x9d, 0x01, 0x0a,
-	0x11, 0x47, 0x65, 0x74, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x4c, 0x61, 0x62, 0x65,
-	0x6c, 0x73, 0x12, 0x25, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73,
-	0x2e, 0x47, 0x65, 0x74, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x4c, 0x61, 0x62, 0x65,
-	0x6c, 0x73, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x26, 0x2e, 0x64, 0x61, 0x74, 0x61,
-	0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x50, 0x72, 0x6f, 0x70, 0x65,
-	0x72, 0x74, 0x79, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73,
-	0x65, 0x22, 0x39, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x33, 0x12, 0x15, 0x2f, 0x6e, 0x6f, 0x64, 0x65,
-	0x2f, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73,
-	0x5a, 0x1a, 0x22, 0x15, 0x2f, 0x6e, 0x6f, 0x64, 0x65, 0x2f, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72,
-	0x74, 0x79, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x3a, 0x01, 0x2a, 0x12, 0x9d, 0x01, 0x0a,
-	0x11, 0x47, 0x65, 0x74, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x56, 0x61, 0x6c, 0x75,
-	0x65, 0x73, 0x12, 0x25, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73,
-	0x2e, 0x47, 0x65, 0x74, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x56, 0x61, 0x6c, 0x75,
-	0x65, 0x73, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x26, 0x2e, 0x64, 0x61, 0x74, 0x61,
-	0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x50, 0x72, 0x6f, 0x70, 0x65,
-	0x72, 0x74, 0x79, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73,
-	0x65, 0x22, 0x39, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x33, 0x12, 0x15, 0x2f, 0x6e, 0x6f, 0x64, 0x65,
-	0x2f, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73,
-	0x5a, 0x1a, 0x22, 0x15, 0x2f, 0x6e, 0x6f, 0x64, 0x65, 0x2f, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72,
-	0x74, 0x79, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x3a, 0x01, 0x2a, 0x12, 0x78, 0x0a, 0x0a,
-	0x47, 0x65, 0x74, 0x54, 0x72, 0x69, 0x70, 0x6c, 0x65, 0x73, 0x12, 0x1e, 0x2e, 0x64, 0x61, 0x74,
-	0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x54, 0x72, 0x69, 0x70,
-	0x6c, 0x65, 0x73, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x1f, 0x2e, 0x64, 0x61, 0x74,
-	0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x54, 0x72, 0x69, 0x70,
-	0x6c, 0x65, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x22, 0x29, 0x82, 0xd3, 0xe4,
-	0x93, 0x02, 0x23, 0x12, 0x0d, 0x2f, 0x6e, 0x6f, 0x64, 0x65, 0x2f, 0x74, 0x72, 0x69, 0x70, 0x6c,
-	0x65, 0x73, 0x5a, 0x12, 0x22, 0x0d, 0x2f, 0x6e, 0x6f, 0x64, 0x65, 0x2f, 0x74, 0x72, 0x69, 0x70,
-	0x6c, 0x65, 0x73, 0x3a, 0x01, 0x2a, 0x12, 0x7f, 0x0a, 0x0b, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61,
-	0x63, 0x65, 0x73, 0x49, 0x6e, 0x12, 0x1f, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d,
-	0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x49, 0x6e, 0x52,
-	0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x20, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d,
-	0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x49, 0x6e,
-	0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x22, 0x2d, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x27,
-	0x12, 0x0f, 0x2f, 0x6e, 0x6f, 0x64, 0x65, 0x2f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x2d, 0x69,
-	0x6e, 0x5a, 0x14, 0x22, 0x0f, 0x2f, 0x6e, 0x6f, 0x64, 0x65, 0x2f, 0x70, 0x6c, 0x61, 0x63, 0x65,
-	0x73, 0x2d, 0x69, 0x6e, 0x3a, 0x01, 0x2a, 0x12, 0x79, 0x0a, 0x0b, 0x47, 0x65, 0x74, 0x50, 0x6c,
-	0x61, 0x63, 0x65, 0x4f, 0x62, 0x73, 0x12, 0x1f, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d,
-	0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x4f, 0x62, 0x73,
-	0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x1a, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f,
-	0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x56, 0x4f, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74,
-	0x69, 0x6f, 0x6e, 0x22, 0x2d, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x27, 0x12, 0x0f, 0x2f, 0x62, 0x75,
-	0x6c, 0x6b, 0x2f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x2d, 0x6f, 0x62, 0x73, 0x5a, 0x14, 0x22, 0x0f,
-	0x2f, 0x62, 0x75, 0x6c, 0x6b, 0x2f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x2d, 0x6f, 0x62, 0x73, 0x3a,
-	0x01, 0x2a, 0x12, 0x6e, 0x0a, 0x08, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x73, 0x12, 0x1c,
+	0x6e, 0x74, 0x69, 0x74, 0x79, 0x49, 0x6e, 0x66, 0x6f, 0x52, 0x08, 0x73, 0x74, 0x61, 0x74, 0x56,
+	0x61, 0x72, 0x73, 0x12, 0x3f, 0x0a, 0x0f, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x5f,
+	0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x17, 0x2e, 0x64,
+	0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x45, 0x6e, 0x74, 0x69, 0x74,
+	0x79, 0x49, 0x6e, 0x66, 0x6f, 0x52, 0x0d, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x47, 0x72,
+	0x6f, 0x75, 0x70, 0x73, 0x22, 0xad, 0x03, 0x0a, 0x0e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72,
+	0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x12, 0x5f, 0x0a, 0x12, 0x70, 0x6c, 0x61, 0x63, 0x65,
+	0x5f, 0x74, 0x79, 0x70, 0x65, 0x5f, 0x73, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x18, 0x01, 0x20,
+	0x03, 0x28, 0x0b, 0x32, 0x31, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e,
+	0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79,
+	0x2e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72,
+	0x79, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x10, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x54, 0x79, 0x70,
+	0x65, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x1a, 0x52, 0x0a, 0x05, 0x50, 0x6c, 0x61, 0x63,
+	0x65, 0x12, 0x12, 0x0a, 0x04, 0x64, 0x63, 0x69, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52,
+	0x04, 0x64, 0x63, 0x69, 0x64, 0x12, 0x12, 0x0a, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x02, 0x20,
+	0x01, 0x28, 0x09, 0x52, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x12, 0x21, 0x0a, 0x0c, 0x70, 0x65, 0x72,
+	0x73, 0x6f, 0x6e, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x18, 0x03, 0x20, 0x01, 0x28, 0x03, 0x52,
+	0x0b, 0x70, 0x65, 0x72, 0x73, 0x6f, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x1a, 0x73, 0x0a, 0x10,
+	0x50, 0x6c, 0x61, 0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79,
+	0x12, 0x1d, 0x0a, 0x0a, 0x6e, 0x75, 0x6d, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x01,
+	0x20, 0x01, 0x28, 0x03, 0x52, 0x09, 0x6e, 0x75, 0x6d, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x12,
+	0x40, 0x0a, 0x0a, 0x74, 0x6f, 0x70, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x02, 0x20,
+	0x03, 0x28, 0x0b, 0x32, 0x21, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e,
+	0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79,
+	0x2e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x52, 0x09, 0x74, 0x6f, 0x70, 0x50, 0x6c, 0x61, 0x63, 0x65,
+	0x73, 0x1a, 0x71, 0x0a, 0x15, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x53, 0x75,
+	0x6d, 0x6d, 0x61, 0x72, 0x79, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65,
+	0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x42, 0x0a, 0x05,
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x2c, 0x2e, 0x64, 0x61,
+	0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61,
+	0x72, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x2e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x54, 0x79,
+	0x70, 0x65, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65,
+	0x3a, 0x02, 0x38, 0x01, 0x22, 0x37, 0x0a, 0x18, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56,
+	0x61, 0x72, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
+	0x12, 0x1b, 0x0a, 0x09, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x73, 0x18, 0x01, 0x20,
+	0x03, 0x28, 0x09, 0x52, 0x08, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x22, 0xe1, 0x01,
+	0x0a, 0x19, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x75, 0x6d, 0x6d,
+	0x61, 0x72, 0x79, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x64, 0x0a, 0x10, 0x73,
+	0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x73, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x18,
+	0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x3a, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d,
+	0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x75,
+	0x6d, 0x6d, 0x61, 0x72, 0x79, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x53, 0x74,
+	0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x45, 0x6e, 0x74, 0x72,
+	0x79, 0x52, 0x0e, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72,
+	0x79, 0x1a, 0x5e, 0x0a, 0x13, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x75, 0x6d, 0x6d,
+	0x61, 0x72, 0x79, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18,
+	0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x31, 0x0a, 0x05, 0x76, 0x61,
+	0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1b, 0x2e, 0x64, 0x61, 0x74, 0x61,
+	0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53,
+	0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38,
+	0x01, 0x32, 0x90, 0x26, 0x0a, 0x05, 0x4d, 0x69, 0x78, 0x65, 0x72, 0x12, 0x5b, 0x0a, 0x05, 0x51,
+	0x75, 0x65, 0x72, 0x79, 0x12, 0x19, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
+	0x6e, 0x73, 0x2e, 0x51, 0x75, 0x65, 0x72, 0x79, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a,
+	0x1a, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x51, 0x75,
+	0x65, 0x72, 0x79, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x22, 0x1b, 0x82, 0xd3, 0xe4,
+	0x93, 0x02, 0x15, 0x12, 0x06, 0x2f, 0x71, 0x75, 0x65, 0x72, 0x79, 0x5a, 0x0b, 0x22, 0x06, 0x2f,
+	0x71, 0x75, 0x65, 0x72, 0x79, 0x3a, 0x01, 0x2a, 0x12, 0x9d, 0x01, 0x0a, 0x11, 0x47, 0x65, 0x74,
+	0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x12, 0x25,
 	0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74,
-	0x53, 0x74, 0x61, 0x74, 0x73, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x1d, 0x2e, 0x64,
-	0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74,
-	0x61, 0x74, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x22, 0x25, 0x82, 0xd3, 0xe4,
-	0x93, 0x02, 0x1f, 0x12, 0x0b, 0x2f, 0x62, 0x75, 0x6c, 0x6b, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x73,
-	0x5a, 0x10, 0x22, 0x0b, 0x2f, 0x62, 0x75, 0x6c, 0x6b, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x3a,
-	0x01, 0x2a, 0x12, 0x96, 0x01, 0x0a, 0x10, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65,
-	0x74, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x12, 0x24, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f,
-	0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x74,
-	0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x25, 0x2e,
-	0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53,
-	0x74, 0x61, 0x74, 0x53, 0x65, 0x74, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x65, 0x73, 0x70,
-	0x6f, 0x6e, 0x73, 0x65, 0x22, 0x35, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x2f, 0x12, 0x13, 0x2f, 0x76,
-	0x31, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f, 0x73, 0x65, 0x74, 0x2f, 0x73, 0x65, 0x72, 0x69, 0x65,
-	0x73, 0x5a, 0x18, 0x22, 0x13, 0x2f, 0x76, 0x31, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f, 0x73, 0x65,
-	0x74, 0x2f, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x3a, 0x01, 0x2a, 0x12, 0x7a, 0x0a, 0x0c, 0x47,
-	0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x12, 0x20, 0x2e, 0x64, 0x61,
-	0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61,
-	0x74, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x21, 0x2e,
-	0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53,
-	0x74, 0x61, 0x74, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65,
-	0x22, 0x25, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x1f, 0x12, 0x0b, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f,
-	0x76, 0x61, 0x6c, 0x75, 0x65, 0x5a, 0x10, 0x22, 0x0b, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f, 0x76,
-	0x61, 0x6c, 0x75, 0x65, 0x3a, 0x01, 0x2a, 0x12, 0x7f, 0x0a, 0x0d, 0x47, 0x65, 0x74, 0x53, 0x74,
-	0x61, 0x74, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x12, 0x21, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63,
-	0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65,
-	0x72, 0x69, 0x65, 0x73, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x22, 0x2e, 0x64, 0x61,
-	0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61,
-	0x74, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x22,
-	0x27, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x21, 0x12, 0x0c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f, 0x73,
-	0x65, 0x72, 0x69, 0x65, 0x73, 0x5a, 0x11, 0x22, 0x0c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f, 0x73,
-	0x65, 0x72, 0x69, 0x65, 0x73, 0x3a, 0x01, 0x2a, 0x12, 0x70, 0x0a, 0x0a, 0x47, 0x65, 0x74, 0x53,
-	0x74, 0x61, 0x74, 0x41, 0x6c, 0x6c, 0x12, 0x1e, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d,
-	0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x41, 0x6c, 0x6c, 0x52,
+	0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x52, 0x65,
+	0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x26, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d,
+	0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x4c,
+	0x61, 0x62, 0x65, 0x6c, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x22, 0x39, 0x82,
+	0xd3, 0xe4, 0x93, 0x02, 0x33, 0x12, 0x15, 0x2f, 0x6e, 0x6f, 0x64, 0x65, 0x2f, 0x70, 0x72, 0x6f,
+	0x70, 0x65, 0x72, 0x74, 0x79, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x5a, 0x1a, 0x22, 0x15,
+	0x2f, 0x6e, 0x6f, 0x64, 0x65, 0x2f, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x2d, 0x6c,
+	0x61, 0x62, 0x65, 0x6c, 0x73, 0x3a, 0x01, 0x2a, 0x12, 0x9d, 0x01, 0x0a, 0x11, 0x47, 0x65, 0x74,
+	0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x12, 0x25,
+	0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74,
+	0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x52, 0x65,
+	0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x26, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d,
+	0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x56,
+	0x61, 0x6c, 0x75, 0x65, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x22, 0x39, 0x82,
+	0xd3, 0xe4, 0x93, 0x02, 0x33, 0x12, 0x15, 0x2f, 0x6e, 0x6f, 0x64, 0x65, 0x2f, 0x70, 0x72, 0x6f,
+	0x70, 0x65, 0x72, 0x74, 0x79, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5a, 0x1a, 0x22, 0x15,
+	0x2f, 0x6e, 0x6f, 0x64, 0x65, 0x2f, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x2d, 0x76,
+	0x61, 0x6c, 0x75, 0x65, 0x73, 0x3a, 0x01, 0x2a, 0x12, 0x78, 0x0a, 0x0a, 0x47, 0x65, 0x74, 0x54,
+	0x72, 0x69, 0x70, 0x6c, 0x65, 0x73, 0x12, 0x1e, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d,
+	0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x54, 0x72, 0x69, 0x70, 0x6c, 0x65, 0x73, 0x52,
 	0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x1f, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d,
-	0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x41, 0x6c, 0x6c, 0x52,
-	0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x22, 0x21, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x1b, 0x12,
-	0x09, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f, 0x61, 0x6c, 0x6c, 0x5a, 0x0e, 0x22, 0x09, 0x2f, 0x73,
-	0x74, 0x61, 0x74, 0x2f, 0x61, 0x6c, 0x6c, 0x3a, 0x01, 0x2a, 0x12, 0xa0, 0x01, 0x0a, 0x15, 0x47,
+	0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x54, 0x72, 0x69, 0x70, 0x6c, 0x65, 0x73, 0x52,
+	0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x22, 0x29, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x23, 0x12,
+	0x0d, 0x2f, 0x6e, 0x6f, 0x64, 0x65, 0x2f, 0x74, 0x72, 0x69, 0x70, 0x6c, 0x65, 0x73, 0x5a, 0x12,
+	0x22, 0x0d, 0x2f, 0x6e, 0x6f, 0x64, 0x65, 0x2f, 0x74, 0x72, 0x69, 0x70, 0x6c, 0x65, 0x73, 0x3a,
+	0x01, 0x2a, 0x12, 0x7f, 0x0a, 0x0b, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x49,
+	0x6e, 0x12, 0x1f, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e,
+	0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x49, 0x6e, 0x52, 0x65, 0x71, 0x75, 0x65,
+	0x73, 0x74, 0x1a, 0x20, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73,
+	0x2e, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x49, 0x6e, 0x52, 0x65, 0x73, 0x70,
+	0x6f, 0x6e, 0x73, 0x65, 0x22, 0x2d, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x27, 0x12, 0x0f, 0x2f, 0x6e,
+	0x6f, 0x64, 0x65, 0x2f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x2d, 0x69, 0x6e, 0x5a, 0x14, 0x22,
+	0x0f, 0x2f, 0x6e, 0x6f, 0x64, 0x65, 0x2f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x2d, 0x69, 0x6e,
+	0x3a, 0x01, 0x2a, 0x12, 0x79, 0x0a, 0x0b, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x4f,
+	0x62, 0x73, 0x12, 0x1f, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73,
+	0x2e, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x4f, 0x62, 0x73, 0x52, 0x65, 0x71, 0x75,
+	0x65, 0x73, 0x74, 0x1a, 0x1a, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e,
+	0x73, 0x2e, 0x53, 0x56, 0x4f, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x22,
+	0x2d, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x27, 0x12, 0x0f, 0x2f, 0x62, 0x75, 0x6c, 0x6b, 0x2f, 0x70,
+	0x6c, 0x61, 0x63, 0x65, 0x2d, 0x6f, 0x62, 0x73, 0x5a, 0x14, 0x22, 0x0f, 0x2f, 0x62, 0x75, 0x6c,
+	0x6b, 0x2f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x2d, 0x6f, 0x62, 0x73, 0x3a, 0x01, 0x2a, 0x12, 0x6e,
+	0x0a, 0x08, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x73, 0x12, 0x1c, 0x2e, 0x64, 0x61, 0x74,
+	0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74,
+	0x73, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x1d, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63,
+	0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x73, 0x52,
+	0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x22, 0x25, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x1f, 0x12,
+	0x0b, 0x2f, 0x62, 0x75, 0x6c, 0x6b, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x5a, 0x10, 0x22, 0x0b,
+	0x2f, 0x62, 0x75, 0x6c, 0x6b, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x3a, 0x01, 0x2a, 0x12, 0x96,
+	0x01, 0x0a, 0x10, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x74, 0x53, 0x65, 0x72,
+	0x69, 0x65, 0x73, 0x12, 0x24, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e,
+	0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x74, 0x53, 0x65, 0x72, 0x69,
+	0x65, 0x73, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x25, 0x2e, 0x64, 0x61, 0x74, 0x61,
+	0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53,
+	0x65, 0x74, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65,
+	0x22, 0x35, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x2f, 0x12, 0x13, 0x2f, 0x76, 0x31, 0x2f, 0x73, 0x74,
+	0x61, 0x74, 0x2f, 0x73, 0x65, 0x74, 0x2f, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x5a, 0x18, 0x22,
+	0x13, 0x2f, 0x76, 0x31, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f, 0x73, 0x65, 0x74, 0x2f, 0x73, 0x65,
+	0x72, 0x69, 0x65, 0x73, 0x3a, 0x01, 0x2a, 0x12, 0x7a, 0x0a, 0x0c, 0x47, 0x65, 0x74, 0x53, 0x74,
+	0x61, 0x74, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x12, 0x20, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f,
+	0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x6c,
+	0x75, 0x65, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x21, 0x2e, 0x64, 0x61, 0x74, 0x61,
+	0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56,
+	0x61, 0x6c, 0x75, 0x65, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x22, 0x25, 0x82, 0xd3,
+	0xe4, 0x93, 0x02, 0x1f, 0x12, 0x0b, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f, 0x76, 0x61, 0x6c, 0x75,
+	0x65, 0x5a, 0x10, 0x22, 0x0b, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f, 0x76, 0x61, 0x6c, 0x75, 0x65,
+	0x3a, 0x01, 0x2a, 0x12, 0x7f, 0x0a, 0x0d, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65,
+	0x72, 0x69, 0x65, 0x73, 0x12, 0x21, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
+	0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73,
+	0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x22, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f,
+	0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x72,
+	0x69, 0x65, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x22, 0x27, 0x82, 0xd3, 0xe4,
+	0x93, 0x02, 0x21, 0x12, 0x0c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f, 0x73, 0x65, 0x72, 0x69, 0x65,
+	0x73, 0x5a, 0x11, 0x22, 0x0c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f, 0x73, 0x65, 0x72, 0x69, 0x65,
+	0x73, 0x3a, 0x01, 0x2a, 0x12, 0x70, 0x0a, 0x0a, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x41,
+	0x6c, 0x6c, 0x12, 0x1e, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73,
+	0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x41, 0x6c, 0x6c, 0x52, 0x65, 0x71, 0x75, 0x65,
+	0x73, 0x74, 0x1a, 0x1f, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73,
+	0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x41, 0x6c, 0x6c, 0x52, 0x65, 0x73, 0x70, 0x6f,
+	0x6e, 0x73, 0x65, 0x22, 0x21, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x1b, 0x12, 0x09, 0x2f, 0x73, 0x74,
+	0x61, 0x74, 0x2f, 0x61, 0x6c, 0x6c, 0x5a, 0x0e, 0x22, 0x09, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f,
+	0x61, 0x6c, 0x6c, 0x3a, 0x01, 0x2a, 0x12, 0xa0, 0x01, 0x0a, 0x15, 0x47, 0x65, 0x74, 0x53, 0x74,
+	0x61, 0x74, 0x53, 0x65, 0x74, 0x57, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x50, 0x6c, 0x61, 0x63, 0x65,
+	0x12, 0x29, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47,
 	0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x74, 0x57, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x50,
-	0x6c, 0x61, 0x63, 0x65, 0x12, 0x29, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
-	0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x74, 0x57, 0x69, 0x74,
-	0x68, 0x69, 0x6e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a,
-	0x1f, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65,
-	0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x74, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65,
-	0x22, 0x3b, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x35, 0x12, 0x16, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f,
-	0x73, 0x65, 0x74, 0x2f, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x2d, 0x70, 0x6c, 0x61, 0x63, 0x65,
-	0x5a, 0x1b, 0x22, 0x16, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f, 0x73, 0x65, 0x74, 0x2f, 0x77, 0x69,
-	0x74, 0x68, 0x69, 0x6e, 0x2d, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x3a, 0x01, 0x2a, 0x12, 0x70, 0x0a,
-	0x0a, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x74, 0x12, 0x1e, 0x2e, 0x64, 0x61,
+	0x6c, 0x61, 0x63, 0x65, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x1f, 0x2e, 0x64, 0x61,
 	0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61,
-	0x74, 0x53, 0x65, 0x74, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x1f, 0x2e, 0x64, 0x61,
+	0x74, 0x53, 0x65, 0x74, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x22, 0x3b, 0x82, 0xd3,
+	0xe4, 0x93, 0x02, 0x35, 0x12, 0x16, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f, 0x73, 0x65, 0x74, 0x2f,
+	0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x2d, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x5a, 0x1b, 0x22, 0x16,
+	0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f, 0x73, 0x65, 0x74, 0x2f, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e,
+	0x2d, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x3a, 0x01, 0x2a, 0x12, 0xba, 0x01, 0x0a, 0x18, 0x47, 0x65,
+	0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x57, 0x69, 0x74, 0x68, 0x69,
+	0x6e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x12, 0x2c, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d,
+	0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x72, 0x69,
+	0x65, 0x73, 0x57, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x52, 0x65, 0x71,
+	0x75, 0x65, 0x73, 0x74, 0x1a, 0x2d, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
+	0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73,
+	0x57, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x52, 0x65, 0x73, 0x70, 0x6f,
+	0x6e, 0x73, 0x65, 0x22, 0x41, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x3b, 0x12, 0x19, 0x2f, 0x73, 0x74,
+	0x61, 0x74, 0x2f, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x2f, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e,
+	0x2d, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x5a, 0x1e, 0x22, 0x19, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f,
+	0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x2f, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x2d, 0x70, 0x6c,
+	0x61, 0x63, 0x65, 0x3a, 0x01, 0x2a, 0x12, 0x70, 0x0a, 0x0a, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61,
+	0x74, 0x53, 0x65, 0x74, 0x12, 0x1e, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
+	0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x74, 0x52, 0x65, 0x71,
+	0x75, 0x65, 0x73, 0x74, 0x1a, 0x1f, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
+	0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x74, 0x52, 0x65, 0x73,
+	0x70, 0x6f, 0x6e, 0x73, 0x65, 0x22, 0x21, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x1b, 0x12, 0x09, 0x2f,
+	0x73, 0x74, 0x61, 0x74, 0x2f, 0x73, 0x65, 0x74, 0x5a, 0x0e, 0x22, 0x09, 0x2f, 0x73, 0x74, 0x61,
+	0x74, 0x2f, 0x73, 0x65, 0x74, 0x3a, 0x01, 0x2a, 0x12, 0x84, 0x01, 0x0a, 0x0e, 0x47, 0x65, 0x74,
+	0x53, 0x74, 0x61, 0x74, 0x46, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x12, 0x22, 0x2e, 0x64, 0x61,
 	0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61,
-	0x74, 0x53, 0x65, 0x74, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x22, 0x21, 0x82, 0xd3,
-	0xe4, 0x93, 0x02, 0x1b, 0x12, 0x09, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f, 0x73, 0x65, 0x74, 0x5a,
-	0x0e, 0x22, 0x09, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2f, 0x73, 0x65, 0x74, 0x3a, 0x01, 0x2a, 0x12,
+	0x74, 0x46, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a,
+	0x23, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65,
+	0x74, 0x53, 0x74, 0x61, 0x74, 0x46, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x52, 0x65, 0x73, 0x70,
+	0x6f, 0x6e, 0x73, 0x65, 0x22, 0x29, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x23, 0x12, 0x0d, 0x2f, 0x73,
+	0x74, 0x61, 0x74, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x5a, 0x12, 0x22, 0x0d, 0x2f,
+	0x73, 0x74, 0x61, 0x74, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3a, 0x01, 0x2a, 0x12,
 	0xaa, 0x01, 0x0a, 0x14, 0x47, 0x65, 0x74, 0x4c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73,
 	0x52, 0x61, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 0x73, 0x12, 0x28, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63,
 	0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x4c, 0x6f, 0x63, 0x61, 0x74, 0x69,
@@ -5005,7 +5400,25 @@ var file_mixer_proto_rawDesc = []byte{
 	0x17, 0x2f, 0x6e, 0x6f, 0x64, 0x65, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x2d, 0x6c,
 	0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x5a, 0x1c, 0x22, 0x17, 0x2f, 0x6e, 0x6f, 0x64,
 	0x65, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x2d, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69,
-	0x6f, 0x6e, 0x73, 0x3a, 0x01, 0x2a, 0x12, 0x90, 0x01, 0x0a, 0x12, 0x47, 0x65, 0x74, 0x4c, 0x61,
+	0x6f, 0x6e, 0x73, 0x3a, 0x01, 0x2a, 0x12, 0x87, 0x01, 0x0a, 0x0f, 0x47, 0x65, 0x74, 0x50, 0x6c,
+	0x61, 0x63, 0x65, 0x73, 0x4e, 0x65, 0x61, 0x72, 0x62, 0x79, 0x12, 0x23, 0x2e, 0x64, 0x61, 0x74,
+	0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63,
+	0x65, 0x73, 0x4e, 0x65, 0x61, 0x72, 0x62, 0x79, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a,
+	0x24, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65,
+	0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x4e, 0x65, 0x61, 0x72, 0x62, 0x79, 0x52, 0x65, 0x73,
+	0x70, 0x6f, 0x6e, 0x73, 0x65, 0x22, 0x29, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x23, 0x12, 0x0d, 0x2f,
+	0x70, 0x6c, 0x61, 0x63, 0x65, 0x2f, 0x6e, 0x65, 0x61, 0x72, 0x62, 0x79, 0x5a, 0x12, 0x22, 0x0d,
+	0x2f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x2f, 0x6e, 0x65, 0x61, 0x72, 0x62, 0x79, 0x3a, 0x01, 0x2a,
+	0x12, 0x93, 0x01, 0x0a, 0x11, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x41, 0x6e, 0x63,
+	0x65, 0x73, 0x74, 0x6f, 0x72, 0x73, 0x12, 0x25, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d,
+	0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x41, 0x6e, 0x63,
+	0x65, 0x73, 0x74, 0x6f, 0x72, 0x73, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x26, 0x2e,
+	0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x50,
+	0x6c, 0x61, 0x63, 0x65, 0x41, 0x6e, 0x63, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x73, 0x52, 0x65, 0x73,
+	0x70, 0x6f, 0x6e, 0x73, 0x65, 0x22, 0x2f, 0x82, 0xd3, 0xe4, 0x93, 0x02, 0x29, 0x12, 0x10, 0x2f,
+	0x70, 0x6c, 0x61, 0x63, 0x65, 0x2f, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x73, 0x5a,
+	0x15, 0x22, 0x10, 0x2f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x2f, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x74,
+	0x6f, 0x72, 0x73, 0x3a, 0x01, 0x2a, 0x12, 0x90, 0x01, 0x0a, 0x12, 0x47, 0x65, 0x74, 0x4c, 0x61,
 	0x6e, 0x64, 0x69, 0x6e, 0x67, 0x50, 0x61, 0x67, 0x65, 0x44, 0x61, 0x74, 0x61, 0x12, 0x26, 0x2e,
 	0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x4c,
 	0x61, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x50, 0x61, 0x67, 0x65, 0x44, 0x61, 0x74, 0x61, 0x52, 0x65,
@@ -5124,7 +5537,17 @@ var file_mixer_proto_rawDesc = []byte{
 	0x56, 0x61, 0x72, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x22, 0x2f, 0x82, 0xd3, 0xe4,
 	0x93, 0x02, 0x29, 0x12, 0x10, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2d, 0x76, 0x61, 0x72, 0x2f, 0x73,
 	0x65, 0x61, 0x72, 0x63, 0x68, 0x5a, 0x15, 0x22, 0x10, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x2d, 0x76,
-	0x61, 0x72, 0x2f, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x3a, 0x01, 0x2a, 0x12, 0x95, 0x01, 0x0a,
+	0x61, 0x72, 0x2f, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x3a, 0x01, 0x2a, 0x12, 0x4e, 0x0a, 0x0a,
+	0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x53, 0x74, 0x61, 0x74, 0x12, 0x1e, 0x2e, 0x64, 0x61, 0x74,
+	0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x53,
+	0x74, 0x61, 0x74, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x1c, 0x2e, 0x64, 0x61, 0x74,
+	0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x53,
+	0x74, 0x61, 0x74, 0x42, 0x61, 0x74, 0x63, 0x68, 0x22, 0x00, 0x30, 0x01, 0x12, 0x4e, 0x0a, 0x0d,
+	0x53, 0x63, 0x61, 0x6e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x12, 0x21, 0x2e,
+	0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x63, 0x61, 0x6e,
+	0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
+	0x1a, 0x16, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x50,
+	0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x22, 0x00, 0x30, 0x01, 0x12, 0x95, 0x01, 0x0a,
 	0x11, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x75, 0x6d, 0x6d, 0x61,
 	0x72, 0x79, 0x12, 0x25, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73,
 	0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x75, 0x6d, 0x6d, 0x61,
@@ -5150,7 +5573,7 @@ func file_mixer_proto_rawDescGZIP() []byte {
 	return file_mixer_proto_rawDescData
 }
 
-var file_mixer_proto_msgTypes = make([]protoimpl.MessageInfo, 79)
+var file_mixer_proto_msgTypes = make([]protoimpl.MessageInfo, 85)
 var file_mixer_proto_goTypes = []interface{}{
 	(*QueryRequest)(nil),                        // 0: datacommons.QueryRequest
 	(*QueryResponseCell)(nil),                   // 1: datacommons.QueryResponseCell
@@ -5169,187 +5592,216 @@ var file_mixer_proto_goTypes = []interface{}{
 	(*GetPlacesInRequest)(nil),                  // 14: datacommons.GetPlacesInRequest
 	(*GetPlacesInResponse)(nil),                 // 15: datacommons.GetPlacesInResponse
 	(*GetRelatedLocationsRequest)(nil),          // 16: datacommons.GetRelatedLocationsRequest
-	(*GetLocationsRankingsRequest)(nil),         // 17: datacommons.GetLocationsRankingsRequest
-	(*GetLocationsRankingsResponse)(nil),        // 18: datacommons.GetLocationsRankingsResponse
-	(*GetRelatedLocationsResponse)(nil),         // 19: datacommons.GetRelatedLocationsResponse
-	(*Place)(nil),                               // 20: datacommons.Place
-	(*Places)(nil),                              // 21: datacommons.Places
-	(*GetLandingPageDataRequest)(nil),           // 22: datacommons.GetLandingPageDataRequest
-	(*GetLandingPageDataResponse)(nil),          // 23: datacommons.GetLandingPageDataResponse
-	(*SearchRequest)(nil),                       // 24: datacommons.SearchRequest
-	(*SearchResponse)(nil),                      // 25: datacommons.SearchResponse
-	(*GetVersionRequest)(nil),                   // 26: datacommons.GetVersionRequest
-	(*GetVersionResponse)(nil),                  // 27: datacommons.GetVersionResponse
-	(*SearchResultSection)(nil),                 // 28: datacommons.SearchResultSection
-	(*SearchEntityResult)(nil),                  // 29: datacommons.SearchEntityResult
-	(*StatsVars)(nil),                           // 30: datacommons.StatsVars
-	(*GetPlaceStatsVarRequest)(nil),             // 31: datacommons.GetPlaceStatsVarRequest
-	(*GetPlaceStatsVarResponse)(nil),            // 32: datacommons.GetPlaceStatsVarResponse
-	(*StatVars)(nil),                            // 33: datacommons.StatVars
-	(*GetPlaceStatVarsRequest)(nil),             // 34: datacommons.GetPlaceStatVarsRequest
-	(*GetPlaceStatVarsResponse)(nil),            // 35: datacommons.GetPlaceStatVarsResponse
-	(*GetPlaceStatVarsUnionRequest)(nil),        // 36: datacommons.GetPlaceStatVarsUnionRequest
-	(*GetPlaceStatVarsUnionResponse)(nil),       // 37: datacommons.GetPlaceStatVarsUnionResponse
-	(*GetPlaceStatVarsUnionResponseV1)(nil),     // 38: datacommons.GetPlaceStatVarsUnionResponseV1
-	(*StatVarGroups)(nil),                       // 39: datacommons.StatVarGroups
-	(*StatVarGroupNode)(nil),                    // 40: datacommons.StatVarGroupNode
-	(*GetStatVarGroupRequest)(nil),              // 41: datacommons.GetStatVarGroupRequest
-	(*GetStatVarGroupNodeRequest)(nil),          // 42: datacommons.GetStatVarGroupNodeRequest
-	(*SVOPlace)(nil),                            // 43: datacommons.SVOPlace
-	(*SVOObservation)(nil),                      // 44: datacommons.SVOObservation
-	(*SVOCollection)(nil),                       // 45: datacommons.SVOCollection
-	(*EntityInfo)(nil),                          // 46: datacommons.EntityInfo
-	(*EntityInfoCollection)(nil),                // 47: datacommons.EntityInfoCollection
-	(*ContainedInPlaceRelation)(nil),            // 48: datacommons.ContainedInPlaceRelation
-	(*Triple)(nil),                              // 49: datacommons.Triple
-	(*Triples)(nil),                             // 50: datacommons.Triples
-	(*ProvenanceInfo)(nil),                      // 51: datacommons.ProvenanceInfo
-	(*Provenances)(nil),                         // 52: datacommons.Provenances
-	(*PropertyLabels)(nil),                      // 53: datacommons.PropertyLabels
-	(*RelatedPlacesInfo)(nil),                   // 54: datacommons.RelatedPlacesInfo
-	(*PlaceStatVarExistence)(nil),               // 55: datacommons.PlaceStatVarExistence
-	(*GetStatVarPathRequest)(nil),               // 56: datacommons.GetStatVarPathRequest
-	(*GetStatVarPathResponse)(nil),              // 57: datacommons.GetStatVarPathResponse
-	(*SearchStatVarRequest)(nil),                // 58: datacommons.SearchStatVarRequest
-	(*SearchStatVarResponse)(nil),               // 59: datacommons.SearchStatVarResponse
-	(*StatVarSummary)(nil),                      // 60: datacommons.StatVarSummary
-	(*GetStatVarSummaryRequest)(nil),            // 61: datacommons.GetStatVarSummaryRequest
-	(*GetStatVarSummaryResponse)(nil),           // 62: datacommons.GetStatVarSummaryResponse
-	nil,                                         // 63: datacommons.GetLocationsRankingsResponse.PayloadEntry
-	nil,                                         // 64: datacommons.GetLandingPageDataResponse.StatVarSeriesEntry
-	nil,                                         // 65: datacommons.GetLandingPageDataResponse.AllChildPlacesEntry
-	nil,                                         // 66: datacommons.GetPlaceStatsVarResponse.PlacesEntry
-	nil,                                         // 67: datacommons.GetPlaceStatVarsResponse.PlacesEntry
-	nil,                                         // 68: datacommons.StatVarGroups.StatVarGroupsEntry
-	(*StatVarGroupNode_ChildSVG)(nil),           // 69: datacommons.StatVarGroupNode.ChildSVG
-	(*StatVarGroupNode_ChildSV)(nil),            // 70: datacommons.StatVarGroupNode.ChildSV
-	(*SVOPlace_Temp)(nil),                       // 71: datacommons.SVOPlace.Temp
-	(*SVOObservation_Temp)(nil),                 // 72: datacommons.SVOObservation.Temp
-	(*RelatedPlacesInfo_Ranking)(nil),           // 73: datacommons.RelatedPlacesInfo.Ranking
-	(*RelatedPlacesInfo_Ranking_RankInfo)(nil),  // 74: datacommons.RelatedPlacesInfo.Ranking.RankInfo
-	(*StatVarSummary_Place)(nil),                // 75: datacommons.StatVarSummary.Place
-	(*StatVarSummary_PlaceTypeSummary)(nil),     // 76: datacommons.StatVarSummary.PlaceTypeSummary
-	nil,                                         // 77: datacommons.StatVarSummary.PlaceTypeSummaryEntry
-	nil,                                         // 78: datacommons.GetStatVarSummaryResponse.StatVarSummaryEntry
-	(*StatVarSeries)(nil),                       // 79: datacommons.StatVarSeries
-	(*GetStatsRequest)(nil),                     // 80: datacommons.GetStatsRequest
-	(*GetStatSetSeriesRequest)(nil),             // 81: datacommons.GetStatSetSeriesRequest
-	(*GetStatValueRequest)(nil),                 // 82: datacommons.GetStatValueRequest
-	(*GetStatSeriesRequest)(nil),                // 83: datacommons.GetStatSeriesRequest
-	(*GetStatAllRequest)(nil),                   // 84: datacommons.GetStatAllRequest
-	(*GetStatSetWithinPlaceRequest)(nil),        // 85: datacommons.GetStatSetWithinPlaceRequest
-	(*GetStatSetRequest)(nil),                   // 86: datacommons.GetStatSetRequest
-	(*GetPlaceStatDateWithinPlaceRequest)(nil),  // 87: datacommons.GetPlaceStatDateWithinPlaceRequest
-	(*GetStatsResponse)(nil),                    // 88: datacommons.GetStatsResponse
-	(*GetStatSetSeriesResponse)(nil),            // 89: datacommons.GetStatSetSeriesResponse
-	(*GetStatValueResponse)(nil),                // 90: datacommons.GetStatValueResponse
-	(*GetStatSeriesResponse)(nil),               // 91: datacommons.GetStatSeriesResponse
-	(*GetStatAllResponse)(nil),                  // 92: datacommons.GetStatAllResponse
-	(*GetStatSetResponse)(nil),                  // 93: datacommons.GetStatSetResponse
-	(*GetPlaceStatDateWithinPlaceResponse)(nil), // 94: datacommons.GetPlaceStatDateWithinPlaceResponse
+	(*GetPlacesNearbyRequest)(nil),              // 17: datacommons.GetPlacesNearbyRequest
+	(*NearbyPlace)(nil),                         // 18: datacommons.NearbyPlace
+	(*GetPlacesNearbyResponse)(nil),             // 19: datacommons.GetPlacesNearbyResponse
+	(*GetPlaceAncestorsRequest)(nil),            // 20: datacommons.GetPlaceAncestorsRequest
+	(*GetPlaceAncestorsResponse)(nil),           // 21: datacommons.GetPlaceAncestorsResponse
+	(*GetLocationsRankingsRequest)(nil),         // 22: datacommons.GetLocationsRankingsRequest
+	(*GetLocationsRankingsResponse)(nil),        // 23: datacommons.GetLocationsRankingsResponse
+	(*GetRelatedLocationsResponse)(nil),         // 24: datacommons.GetRelatedLocationsResponse
+	(*Place)(nil),                               // 25: datacommons.Place
+	(*Places)(nil),                              // 26: datacommons.Places
+	(*GetLandingPageDataRequest)(nil),           // 27: datacommons.GetLandingPageDataRequest
+	(*GetLandingPageDataResponse)(nil),          // 28: datacommons.GetLandingPageDataResponse
+	(*SearchRequest)(nil),                       // 29: datacommons.SearchRequest
+	(*SearchResponse)(nil),                      // 30: datacommons.SearchResponse
+	(*GetVersionRequest)(nil),                   // 31: datacommons.GetVersionRequest
+	(*GetVersionResponse)(nil),                  // 32: datacommons.GetVersionResponse
+	(*SearchResultSection)(nil),                 // 33: datacommons.SearchResultSection
+	(*SearchEntityResult)(nil),                  // 34: datacommons.SearchEntityResult
+	(*StatsVars)(nil),                           // 35: datacommons.StatsVars
+	(*GetPlaceStatsVarRequest)(nil),             // 36: datacommons.GetPlaceStatsVarRequest
+	(*GetPlaceStatsVarResponse)(nil),            // 37: datacommons.GetPlaceStatsVarResponse
+	(*StatVars)(nil),                            // 38: datacommons.StatVars
+	(*GetPlaceStatVarsRequest)(nil),             // 39: datacommons.GetPlaceStatVarsRequest
+	(*GetPlaceStatVarsResponse)(nil),            // 40: datacommons.GetPlaceStatVarsResponse
+	(*GetPlaceStatVarsUnionRequest)(nil),        // 41: datacommons.GetPlaceStatVarsUnionRequest
+	(*GetPlaceStatVarsUnionResponse)(nil),       // 42: datacommons.GetPlaceStatVarsUnionResponse
+	(*GetPlaceStatVarsUnionResponseV1)(nil),     // 43: datacommons.GetPlaceStatVarsUnionResponseV1
+	(*StatVarGroups)(nil),                       // 44: datacommons.StatVarGroups
+	(*StatVarGroupNode)(nil),                    // 45: datacommons.StatVarGroupNode
+	(*GetStatVarGroupRequest)(nil),              // 46: datacommons.GetStatVarGroupRequest
+	(*GetStatVarGroupNodeRequest)(nil),          // 47: datacommons.GetStatVarGroupNodeRequest
+	(*SVOPlace)(nil),                            // 48: datacommons.SVOPlace
+	(*SVOObservation)(nil),                      // 49: datacommons.SVOObservation
+	(*SVOCollection)(nil),                       // 50: datacommons.SVOCollection
+	(*EntityInfo)(nil),                          // 51: datacommons.EntityInfo
+	(*EntityInfoCollection)(nil),                // 52: datacommons.EntityInfoCollection
+	(*ContainedInPlaceRelation)(nil),            // 53: datacommons.ContainedInPlaceRelation
+	(*Triple)(nil),                              // 54: datacommons.Triple
+	(*Triples)(nil),                             // 55: datacommons.Triples
+	(*ProvenanceInfo)(nil),                      // 56: datacommons.ProvenanceInfo
+	(*Provenances)(nil),                         // 57: datacommons.Provenances
+	(*PropertyLabels)(nil),                      // 58: datacommons.PropertyLabels
+	(*RelatedPlacesInfo)(nil),                   // 59: datacommons.RelatedPlacesInfo
+	(*PlaceStatVarExistence)(nil),               // 60: datacommons.PlaceStatVarExistence
+	(*GetStatVarPathRequest)(nil),               // 61: datacommons.GetStatVarPathRequest
+	(*GetStatVarPathResponse)(nil),              // 62: datacommons.GetStatVarPathResponse
+	(*SearchStatVarRequest)(nil),                // 63: datacommons.SearchStatVarRequest
+	(*SearchStatVarResponse)(nil),               // 64: datacommons.SearchStatVarResponse
+	(*StatVarSummary)(nil),                      // 65: datacommons.StatVarSummary
+	(*GetStatVarSummaryRequest)(nil),            // 66: datacommons.GetStatVarSummaryRequest
+	(*GetStatVarSummaryResponse)(nil),           // 67: datacommons.GetStatVarSummaryResponse
+	nil,                                         // 68: datacommons.GetPlaceAncestorsResponse.AncestorsEntry
+	nil,                                         // 69: datacommons.GetLocationsRankingsResponse.PayloadEntry
+	nil,                                         // 70: datacommons.GetLandingPageDataResponse.StatVarSeriesEntry
+	nil,                                         // 71: datacommons.GetLandingPageDataResponse.AllChildPlacesEntry
+	nil,                                         // 72: datacommons.GetPlaceStatsVarResponse.PlacesEntry
+	nil,                                         // 73: datacommons.GetPlaceStatVarsResponse.PlacesEntry
+	nil,                                         // 74: datacommons.StatVarGroups.StatVarGroupsEntry
+	(*StatVarGroupNode_ChildSVG)(nil),           // 75: datacommons.StatVarGroupNode.ChildSVG
+	(*StatVarGroupNode_ChildSV)(nil),            // 76: datacommons.StatVarGroupNode.ChildSV
+	(*SVOPlace_Temp)(nil),                       // 77: datacommons.SVOPlace.Temp
+	(*SVOObservation_Temp)(nil),                 // 78: datacommons.SVOObservation.Temp
+	(*RelatedPlacesInfo_Ranking)(nil),           // 79: datacommons.RelatedPlacesInfo.Ranking
+	(*RelatedPlacesInfo_Ranking_RankInfo)(nil),  // 80: datacommons.RelatedPlacesInfo.Ranking.RankInfo
+	(*StatVarSummary_Place)(nil),                // 81: datacommons.StatVarSummary.Place
+	(*StatVarSummary_PlaceTypeSummary)(nil),     // 82: datacommons.StatVarSummary.PlaceTypeSummary
+	nil,                                         // 83: datacommons.StatVarSummary.PlaceTypeSummaryEntry
+	nil,                                         // 84: datacommons.GetStatVarSummaryResponse.StatVarSummaryEntry
+	(*StatVarSeries)(nil),                       // 85: datacommons.StatVarSeries
+	(*GetStatsRequest)(nil),                     // 86: datacommons.GetStatsRequest
+	(*GetStatSetSeriesRequest)(nil),             // 87: datacommons.GetStatSetSeriesRequest
+	(*GetStatValueRequest)(nil),                 // 88: datacommons.GetStatValueRequest
+	(*GetStatSeriesRequest)(nil),                // 89: datacommons.GetStatSeriesRequest
+	(*GetStatAllRequest)(nil),                   // 90: datacommons.GetStatAllRequest
+	(*GetStatSetWithinPlaceRequest)(nil),        // 91: datacommons.GetStatSetWithinPlaceRequest
+	(*GetStatSeriesWithinPlaceRequest)(nil),     // 92: datacommons.GetStatSeriesWithinPlaceRequest
+	(*GetStatSetRequest)(nil),                   // 93: datacommons.GetStatSetRequest
+	(*GetStatFormulaRequest)(nil),               // 94: datacommons.GetStatFormulaRequest
+	(*GetPlaceStatDateWithinPlaceRequest)(nil),  // 95: datacommons.GetPlaceStatDateWithinPlaceRequest
+	(*ExportStatRequest)(nil),                   // 96: datacommons.ExportStatRequest
+	(*ScanPlaceStatRequest)(nil),                // 97: datacommons.ScanPlaceStatRequest
+	(*GetStatsResponse)(nil),                    // 98: datacommons.GetStatsResponse
+	(*GetStatSetSeriesResponse)(nil),            // 99: datacommons.GetStatSetSeriesResponse
+	(*GetStatValueResponse)(nil),                // 100: datacommons.GetStatValueResponse
+	(*GetStatSeriesResponse)(nil),               // 101: datacommons.GetStatSeriesResponse
+	(*GetStatAllResponse)(nil),                  // 102: datacommons.GetStatAllResponse
+	(*GetStatSetResponse)(nil),                  // 103: datacommons.GetStatSetResponse
+	(*GetStatSeriesWithinPlaceResponse)(nil),    // 104: datacommons.GetStatSeriesWithinPlaceResponse
+	(*GetStatFormulaResponse)(nil),              // 105: datacommons.GetStatFormulaResponse
+	(*GetPlaceStatDateWithinPlaceResponse)(nil), // 106: datacommons.GetPlaceStatDateWithinPlaceResponse
+	(*ExportStatBatch)(nil),                     // 107: datacommons.ExportStatBatch
+	(*PlaceStat)(nil),                           // 108: datacommons.PlaceStat
 }
 var file_mixer_proto_depIdxs = []int32{
-	1,  // 0: datacommons.QueryResponseRow.cells:type_name -> datacommons.QueryResponseCell
-	2,  // 1: datacommons.QueryResponse.rows:type_name -> datacommons.QueryResponseRow
-	63, // 2: datacommons.GetLocationsRankingsResponse.payload:type_name -> datacommons.GetLocationsRankingsResponse.PayloadEntry
-	20, // 3: datacommons.Places.places:type_name -> datacommons.Place
-	64, // 4: datacommons.GetLandingPageDataResponse.stat_var_series:type_name -> datacommons.GetLandingPageDataResponse.StatVarSeriesEntry
-	65, // 5: datacommons.GetLandingPageDataResponse.all_child_places:type_name -> datacommons.GetLandingPageDataResponse.AllChildPlacesEntry
-	28, // 6: datacommons.SearchResponse.section:type_name -> datacommons.SearchResultSection
-	29, // 7: datacommons.SearchResultSection.entity:type_name -> datacommons.SearchEntityResult
-	66, // 8: datacommons.GetPlaceStatsVarResponse.places:type_name -> datacommons.GetPlaceStatsVarResponse.PlacesEntry
-	67, // 9: datacommons.GetPlaceStatVarsResponse.places:type_name -> datacommons.GetPlaceStatVarsResponse.PlacesEntry
-	33, // 10: datacommons.GetPlaceStatVarsUnionResponse.stat_vars:type_name -> datacommons.StatVars
-	68, // 11: datacommons.StatVarGroups.stat_var_groups:type_name -> datacommons.StatVarGroups.StatVarGroupsEntry
-	70, // 12: datacommons.StatVarGroupNode.child_stat_vars:type_name -> datacommons.StatVarGroupNode.ChildSV
-	69, // 13: datacommons.StatVarGroupNode.child_stat_var_groups:type_name -> datacommons.StatVarGroupNode.ChildSVG
-	44, // 14: datacommons.SVOPlace.observations:type_name -> datacommons.SVOObservation
-	71, // 15: datacommons.SVOPlace.temp:type_name -> datacommons.SVOPlace.Temp
-	72, // 16: datacommons.SVOObservation.temp:type_name -> datacommons.SVOObservation.Temp
-	43, // 17: datacommons.SVOCollection.places:type_name -> datacommons.SVOPlace
-	46, // 18: datacommons.EntityInfoCollection.entities:type_name -> datacommons.EntityInfo
-	49, // 19: datacommons.Triples.triples:type_name -> datacommons.Triple
-	51, // 20: datacommons.Provenances.provenances:type_name -> datacommons.ProvenanceInfo
-	73, // 21: datacommons.RelatedPlacesInfo.rank_all:type_name -> datacommons.RelatedPlacesInfo.Ranking
-	73, // 22: datacommons.RelatedPlacesInfo.rank_top_1000:type_name -> datacommons.RelatedPlacesInfo.Ranking
-	73, // 23: datacommons.RelatedPlacesInfo.rank_bottom_1000:type_name -> datacommons.RelatedPlacesInfo.Ranking
-	46, // 24: datacommons.SearchStatVarResponse.stat_vars:type_name -> datacommons.EntityInfo
-	46, // 25: datacommons.SearchStatVarResponse.stat_var_groups:type_name -> datacommons.EntityInfo
-	77, // 26: datacommons.StatVarSummary.place_type_summary:type_name -> datacommons.StatVarSummary.PlaceTypeSummaryEntry
-	78, // 27: datacommons.GetStatVarSummaryResponse.stat_var_summary:type_name -> datacommons.GetStatVarSummaryResponse.StatVarSummaryEntry
-	54, // 28: datacommons.GetLocationsRankingsResponse.PayloadEntry.value:type_name -> datacommons.RelatedPlacesInfo
-	79, // 29: datacommons.GetLandingPageDataResponse.StatVarSeriesEntry.value:type_name -> datacommons.StatVarSeries
-	21, // 30: datacommons.GetLandingPageDataResponse.AllChildPlacesEntry.value:type_name -> datacommons.Places
-	30, // 31: datacommons.GetPlaceStatsVarResponse.PlacesEntry.value:type_name -> datacommons.StatsVars
-	33, // 32: datacommons.GetPlaceStatVarsResponse.PlacesEntry.value:type_name -> datacommons.StatVars
-	40, // 33: datacommons.StatVarGroups.StatVarGroupsEntry.value:type_name -> datacommons.StatVarGroupNode
-	74, // 34: datacommons.RelatedPlacesInfo.Ranking.info:type_name -> datacommons.RelatedPlacesInfo.Ranking.RankInfo
-	75, // 35: datacommons.StatVarSummary.PlaceTypeSummary.top_places:type_name -> datacommons.StatVarSummary.Place
-	76, // 36: datacommons.StatVarSummary.PlaceTypeSummaryEntry.value:type_name -> datacommons.StatVarSummary.PlaceTypeSummary
-	60, // 37: datacommons.GetStatVarSummaryResponse.StatVarSummaryEntry.value:type_name -> datacommons.StatVarSummary
-	0,  // 38: datacommons.Mixer.Query:input_type -> datacommons.QueryRequest
-	6,  // 39: datacommons.Mixer.GetPropertyLabels:input_type -> datacommons.GetPropertyLabelsRequest
-	8,  // 40: datacommons.Mixer.GetPropertyValues:input_type -> datacommons.GetPropertyValuesRequest
-	10, // 41: datacommons.Mixer.GetTriples:input_type -> datacommons.GetTriplesRequest
-	14, // 42: datacommons.Mixer.GetPlacesIn:input_type -> datacommons.GetPlacesInRequest
-	13, // 43: datacommons.Mixer.GetPlaceObs:input_type -> datacommons.GetPlaceObsRequest
-	80, // 44: datacommons.Mixer.GetStats:input_type -> datacommons.GetStatsRequest
-	81, // 45: datacommons.Mixer.GetStatSetSeries:input_type -> datacommons.GetStatSetSeriesRequest
-	82, // 46: datacommons.Mixer.GetStatValue:input_type -> datacommons.GetStatValueRequest
-	83, // 47: datacommons.Mixer.GetStatSeries:input_type -> datacommons.GetStatSeriesRequest
-	84, // 48: datacommons.Mixer.GetStatAll:input_type -> datacommons.GetStatAllRequest
-	85, // 49: datacommons.Mixer.GetStatSetWithinPlace:input_type -> datacommons.GetStatSetWithinPlaceRequest
-	86, // 50: datacommons.Mixer.GetStatSet:input_type -> datacommons.GetStatSetRequest
-	17, // 51: datacommons.Mixer.GetLocationsRankings:input_type -> datacommons.GetLocationsRankingsRequest
-	16, // 52: datacommons.Mixer.GetRelatedLocations:input_type -> datacommons.GetRelatedLocationsRequest
-	22, // 53: datacommons.Mixer.GetLandingPageData:input_type -> datacommons.GetLandingPageDataRequest
-	4,  // 54: datacommons.Mixer.Translate:input_type -> datacommons.TranslateRequest
-	24, // 55: datacommons.Mixer.Search:input_type -> datacommons.SearchRequest
-	26, // 56: datacommons.Mixer.GetVersion:input_type -> datacommons.GetVersionRequest
-	31, // 57: datacommons.Mixer.GetPlaceStatsVar:input_type -> datacommons.GetPlaceStatsVarRequest
-	34, // 58: datacommons.Mixer.GetPlaceStatVars:input_type -> datacommons.GetPlaceStatVarsRequest
-	36, // 59: datacommons.Mixer.GetPlaceStatVarsUnionV1:input_type -> datacommons.GetPlaceStatVarsUnionRequest
-	36, // 60: datacommons.Mixer.GetPlaceStatVarsUnion:input_type -> datacommons.GetPlaceStatVarsUnionRequest
-	87, // 61: datacommons.Mixer.GetPlaceStatDateWithinPlace:input_type -> datacommons.GetPlaceStatDateWithinPlaceRequest
-	41, // 62: datacommons.Mixer.GetStatVarGroup:input_type -> datacommons.GetStatVarGroupRequest
-	42, // 63: datacommons.Mixer.GetStatVarGroupNode:input_type -> datacommons.GetStatVarGroupNodeRequest
-	56, // 64: datacommons.Mixer.GetStatVarPath:input_type -> datacommons.GetStatVarPathRequest
-	58, // 65: datacommons.Mixer.SearchStatVar:input_type -> datacommons.SearchStatVarRequest
-	61, // 66: datacommons.Mixer.GetStatVarSummary:input_type -> datacommons.GetStatVarSummaryRequest
-	3,  // 67: datacommons.Mixer.Query:output_type -> datacommons.QueryResponse
-	7,  // 68: datacommons.Mixer.GetPropertyLabels:output_type -> datacommons.GetPropertyLabelsResponse
-	9,  // 69: datacommons.Mixer.GetPropertyValues:output_type -> datacommons.GetPropertyValuesResponse
-	11, // 70: datacommons.Mixer.GetTriples:output_type -> datacommons.GetTriplesResponse
-	15, // 71: datacommons.Mixer.GetPlacesIn:output_type -> datacommons.GetPlacesInResponse
-	45, // 72: datacommons.Mixer.GetPlaceObs:output_type -> datacommons.SVOCollection
-	88, // 73: datacommons.Mixer.GetStats:output_type -> datacommons.GetStatsResponse
-	89, // 74: datacommons.Mixer.GetStatSetSeries:output_type -> datacommons.GetStatSetSeriesResponse
-	90, // 75: datacommons.Mixer.GetStatValue:output_type -> datacommons.GetStatValueResponse
-	91, // 76: datacommons.Mixer.GetStatSeries:output_type -> datacommons.GetStatSeriesResponse
-	92, // 77: datacommons.Mixer.GetStatAll:output_type -> datacommons.GetStatAllResponse
-	93, // 78: datacommons.Mixer.GetStatSetWithinPlace:output_type -> datacommons.GetStatSetResponse
-	93, // 79: datacommons.Mixer.GetStatSet:output_type -> datacommons.GetStatSetResponse
-	18, // 80: datacommons.Mixer.GetLocationsRankings:output_type -> datacommons.GetLocationsRankingsResponse
-	19, // 81: datacommons.Mixer.GetRelatedLocations:output_type -> datacommons.GetRelatedLocationsResponse
-	23, // 82: datacommons.Mixer.GetLandingPageData:output_type -> datacommons.GetLandingPageDataResponse
-	5,  // 83: datacommons.Mixer.Translate:output_type -> datacommons.TranslateResponse
-	25, // 84: datacommons.Mixer.Search:output_type -> datacommons.SearchResponse
-	27, // 85: datacommons.Mixer.GetVersion:output_type -> datacommons.GetVersionResponse
-	32, // 86: datacommons.Mixer.GetPlaceStatsVar:output_type -> datacommons.GetPlaceStatsVarResponse
-	35, // 87: datacommons.Mixer.GetPlaceStatVars:output_type -> datacommons.GetPlaceStatVarsResponse
-	38, // 88: datacommons.Mixer.GetPlaceStatVarsUnionV1:output_type -> datacommons.GetPlaceStatVarsUnionResponseV1
-	37, // 89: datacommons.Mixer.GetPlaceStatVarsUnion:output_type -> datacommons.GetPlaceStatVarsUnionResponse
-	94, // 90: datacommons.Mixer.GetPlaceStatDateWithinPlace:output_type -> datacommons.GetPlaceStatDateWithinPlaceResponse
-	39, // 91: datacommons.Mixer.GetStatVarGroup:output_type -> datacommons.StatVarGroups
-	40, // 92: datacommons.Mixer.GetStatVarGroupNode:output_type -> datacommons.StatVarGroupNode
-	57, // 93: datacommons.Mixer.GetStatVarPath:output_type -> datacommons.GetStatVarPathResponse
-	59, // 94: datacommons.Mixer.SearchStatVar:output_type -> datacommons.SearchStatVarResponse
-	62, // 95: datacommons.Mixer.GetStatVarSummary:output_type -> datacommons.GetStatVarSummaryResponse
-	67, // [67:96] is the sub-list for method output_type
-	38, // [38:67] is the sub-list for method input_type
-	38, // [38:38] is the sub-list for extension type_name
-	38, // [38:38] is the sub-list for extension extendee
-	0,  // [0:38] is the sub-list for field type_name
+	1,   // 0: datacommons.QueryResponseRow.cells:type_name -> datacommons.QueryResponseCell
+	2,   // 1: datacommons.QueryResponse.rows:type_name -> datacommons.QueryResponseRow
+	18,  // 2: datacommons.GetPlacesNearbyResponse.places:type_name -> datacommons.NearbyPlace
+	68,  // 3: datacommons.GetPlaceAncestorsResponse.ancestors:type_name -> datacommons.GetPlaceAncestorsResponse.AncestorsEntry
+	69,  // 4: datacommons.GetLocationsRankingsResponse.payload:type_name -> datacommons.GetLocationsRankingsResponse.PayloadEntry
+	25,  // 5: datacommons.Places.places:type_name -> datacommons.Place
+	70,  // 6: datacommons.GetLandingPageDataResponse.stat_var_series:type_name -> datacommons.GetLandingPageDataResponse.StatVarSeriesEntry
+	71,  // 7: datacommons.GetLandingPageDataResponse.all_child_places:type_name -> datacommons.GetLandingPageDataResponse.AllChildPlacesEntry
+	33,  // 8: datacommons.SearchResponse.section:type_name -> datacommons.SearchResultSection
+	34,  // 9: datacommons.SearchResultSection.entity:type_name -> datacommons.SearchEntityResult
+	72,  // 10: datacommons.GetPlaceStatsVarResponse.places:type_name -> datacommons.GetPlaceStatsVarResponse.PlacesEntry
+	73,  // 11: datacommons.GetPlaceStatVarsResponse.places:type_name -> datacommons.GetPlaceStatVarsResponse.PlacesEntry
+	38,  // 12: datacommons.GetPlaceStatVarsUnionResponse.stat_vars:type_name -> datacommons.StatVars
+	74,  // 13: datacommons.StatVarGroups.stat_var_groups:type_name -> datacommons.StatVarGroups.StatVarGroupsEntry
+	76,  // 14: datacommons.StatVarGroupNode.child_stat_vars:type_name -> datacommons.StatVarGroupNode.ChildSV
+	75,  // 15: datacommons.StatVarGroupNode.child_stat_var_groups:type_name -> datacommons.StatVarGroupNode.ChildSVG
+	49,  // 16: datacommons.SVOPlace.observations:type_name -> datacommons.SVOObservation
+	77,  // 17: datacommons.SVOPlace.temp:type_name -> datacommons.SVOPlace.Temp
+	78,  // 18: datacommons.SVOObservation.temp:type_name -> datacommons.SVOObservation.Temp
+	48,  // 19: datacommons.SVOCollection.places:type_name -> datacommons.SVOPlace
+	51,  // 20: datacommons.EntityInfoCollection.entities:type_name -> datacommons.EntityInfo
+	54,  // 21: datacommons.Triples.triples:type_name -> datacommons.Triple
+	56,  // 22: datacommons.Provenances.provenances:type_name -> datacommons.ProvenanceInfo
+	79,  // 23: datacommons.RelatedPlacesInfo.rank_all:type_name -> datacommons.RelatedPlacesInfo.Ranking
+	79,  // 24: datacommons.RelatedPlacesInfo.rank_top_1000:type_name -> datacommons.RelatedPlacesInfo.Ranking
+	79,  // 25: datacommons.RelatedPlacesInfo.rank_bottom_1000:type_name -> datacommons.RelatedPlacesInfo.Ranking
+	51,  // 26: datacommons.SearchStatVarResponse.stat_vars:type_name -> datacommons.EntityInfo
+	51,  // 27: datacommons.SearchStatVarResponse.stat_var_groups:type_name -> datacommons.EntityInfo
+	83,  // 28: datacommons.StatVarSummary.place_type_summary:type_name -> datacommons.StatVarSummary.PlaceTypeSummaryEntry
+	84,  // 29: datacommons.GetStatVarSummaryResponse.stat_var_summary:type_name -> datacommons.GetStatVarSummaryResponse.StatVarSummaryEntry
+	26,  // 30: datacommons.GetPlaceAncestorsResponse.AncestorsEntry.value:type_name -> datacommons.Places
+	59,  // 31: datacommons.GetLocationsRankingsResponse.PayloadEntry.value:type_name -> datacommons.RelatedPlacesInfo
+	85,  // 32: datacommons.GetLandingPageDataResponse.StatVarSeriesEntry.value:type_name -> datacommons.StatVarSeries
+	26,  // 33: datacommons.GetLandingPageDataResponse.AllChildPlacesEntry.value:type_name -> datacommons.Places
+	35,  // 34: datacommons.GetPlaceStatsVarResponse.PlacesEntry.value:type_name -> datacommons.StatsVars
+	38,  // 35: datacommons.GetPlaceStatVarsResponse.PlacesEntry.value:type_name -> datacommons.StatVars
+	45,  // 36: datacommons.StatVarGroups.StatVarGroupsEntry.value:type_name -> datacommons.StatVarGroupNode
+	80,  // 37: datacommons.RelatedPlacesInfo.Ranking.info:type_name -> datacommons.RelatedPlacesInfo.Ranking.RankInfo
+	81,  // 38: datacommons.StatVarSummary.PlaceTypeSummary.top_places:type_name -> datacommons.StatVarSummary.Place
+	82,  // 39: datacommons.StatVarSummary.PlaceTypeSummaryEntry.value:type_name -> datacommons.StatVarSummary.PlaceTypeSummary
+	65,  // 40: datacommons.GetStatVarSummaryResponse.StatVarSummaryEntry.value:type_name -> datacommons.StatVarSummary
+	0,   // 41: datacommons.Mixer.Query:input_type -> datacommons.QueryRequest
+	6,   // 42: datacommons.Mixer.GetPropertyLabels:input_type -> datacommons.GetPropertyLabelsRequest
+	8,   // 43: datacommons.Mixer.GetPropertyValues:input_type -> datacommons.GetPropertyValuesRequest
+	10,  // 44: datacommons.Mixer.GetTriples:input_type -> datacommons.GetTriplesRequest
+	14,  // 45: datacommons.Mixer.GetPlacesIn:input_type -> datacommons.GetPlacesInRequest
+	13,  // 46: datacommons.Mixer.GetPlaceObs:input_type -> datacommons.GetPlaceObsRequest
+	86,  // 47: datacommons.Mixer.GetStats:input_type -> datacommons.GetStatsRequest
+	87,  // 48: datacommons.Mixer.GetStatSetSeries:input_type -> datacommons.GetStatSetSeriesRequest
+	88,  // 49: datacommons.Mixer.GetStatValue:input_type -> datacommons.GetStatValueRequest
+	89,  // 50: datacommons.Mixer.GetStatSeries:input_type -> datacommons.GetStatSeriesRequest
+	90,  // 51: datacommons.Mixer.GetStatAll:input_type -> datacommons.GetStatAllRequest
+	91,  // 52: datacommons.Mixer.GetStatSetWithinPlace:input_type -> datacommons.GetStatSetWithinPlaceRequest
+	92,  // 53: datacommons.Mixer.GetStatSeriesWithinPlace:input_type -> datacommons.GetStatSeriesWithinPlaceRequest
+	93,  // 54: datacommons.Mixer.GetStatSet:input_type -> datacommons.GetStatSetRequest
+	94,  // 55: datacommons.Mixer.GetStatFormula:input_type -> datacommons.GetStatFormulaRequest
+	22,  // 56: datacommons.Mixer.GetLocationsRankings:input_type -> datacommons.GetLocationsRankingsRequest
+	16,  // 57: datacommons.Mixer.GetRelatedLocations:input_type -> datacommons.GetRelatedLocationsRequest
+	17,  // 58: datacommons.Mixer.GetPlacesNearby:input_type -> datacommons.GetPlacesNearbyRequest
+	20,  // 59: datacommons.Mixer.GetPlaceAncestors:input_type -> datacommons.GetPlaceAncestorsRequest
+	27,  // 60: datacommons.Mixer.GetLandingPageData:input_type -> datacommons.GetLandingPageDataRequest
+	4,   // 61: datacommons.Mixer.Translate:input_type -> datacommons.TranslateRequest
+	29,  // 62: datacommons.Mixer.Search:input_type -> datacommons.SearchRequest
+	31,  // 63: datacommons.Mixer.GetVersion:input_type -> datacommons.GetVersionRequest
+	36,  // 64: datacommons.Mixer.GetPlaceStatsVar:input_type -> datacommons.GetPlaceStatsVarRequest
+	39,  // 65: datacommons.Mixer.GetPlaceStatVars:input_type -> datacommons.GetPlaceStatVarsRequest
+	41,  // 66: datacommons.Mixer.GetPlaceStatVarsUnionV1:input_type -> datacommons.GetPlaceStatVarsUnionRequest
+	41,  // 67: datacommons.Mixer.GetPlaceStatVarsUnion:input_type -> datacommons.GetPlaceStatVarsUnionRequest
+	95,  // 68: datacommons.Mixer.GetPlaceStatDateWithinPlace:input_type -> datacommons.GetPlaceStatDateWithinPlaceRequest
+	46,  // 69: datacommons.Mixer.GetStatVarGroup:input_type -> datacommons.GetStatVarGroupRequest
+	47,  // 70: datacommons.Mixer.GetStatVarGroupNode:input_type -> datacommons.GetStatVarGroupNodeRequest
+	61,  // 71: datacommons.Mixer.GetStatVarPath:input_type -> datacommons.GetStatVarPathRequest
+	63,  // 72: datacommons.Mixer.SearchStatVar:input_type -> datacommons.SearchStatVarRequest
+	96,  // 73: datacommons.Mixer.ExportStat:input_type -> datacommons.ExportStatRequest
+	97,  // 74: datacommons.Mixer.ScanPlaceStat:input_type -> datacommons.ScanPlaceStatRequest
+	66,  // 75: datacommons.Mixer.GetStatVarSummary:input_type -> datacommons.GetStatVarSummaryRequest
+	3,   // 76: datacommons.Mixer.Query:output_type -> datacommons.QueryResponse
+	7,   // 77: datacommons.Mixer.GetPropertyLabels:output_type -> datacommons.GetPropertyLabelsResponse
+	9,   // 78: datacommons.Mixer.GetPropertyValues:output_type -> datacommons.GetPropertyValuesResponse
+	11,  // 79: datacommons.Mixer.GetTriples:output_type -> datacommons.GetTriplesResponse
+	15,  // 80: datacommons.Mixer.GetPlacesIn:output_type -> datacommons.GetPlacesInResponse
+	50,  // 81: datacommons.Mixer.GetPlaceObs:output_type -> datacommons.SVOCollection
+	98,  // 82: datacommons.Mixer.GetStats:output_type -> datacommons.GetStatsResponse
+	99,  // 83: datacommons.Mixer.GetStatSetSeries:output_type -> datacommons.GetStatSetSeriesResponse
+	100, // 84: datacommons.Mixer.GetStatValue:output_type -> datacommons.GetStatValueResponse
+	101, // 85: datacommons.Mixer.GetStatSeries:output_type -> datacommons.GetStatSeriesResponse
+	102, // 86: datacommons.Mixer.GetStatAll:output_type -> datacommons.GetStatAllResponse
+	103, // 87: datacommons.Mixer.GetStatSetWithinPlace:output_type -> datacommons.GetStatSetResponse
+	104, // 88: datacommons.Mixer.GetStatSeriesWithinPlace:output_type -> datacommons.GetStatSeriesWithinPlaceResponse
+	103, // 89: datacommons.Mixer.GetStatSet:output_type -> datacommons.GetStatSetResponse
+	105, // 90: datacommons.Mixer.GetStatFormula:output_type -> datacommons.GetStatFormulaResponse
+	23,  // 91: datacommons.Mixer.GetLocationsRankings:output_type -> datacommons.GetLocationsRankingsResponse
+	24,  // 92: datacommons.Mixer.GetRelatedLocations:output_type -> datacommons.GetRelatedLocationsResponse
+	19,  // 93: datacommons.Mixer.GetPlacesNearby:output_type -> datacommons.GetPlacesNearbyResponse
+	21,  // 94: datacommons.Mixer.GetPlaceAncestors:output_type -> datacommons.GetPlaceAncestorsResponse
+	28,  // 95: datacommons.Mixer.GetLandingPageData:output_type -> datacommons.GetLandingPageDataResponse
+	5,   // 96: datacommons.Mixer.Translate:output_type -> datacommons.TranslateResponse
+	30,  // 97: datacommons.Mixer.Search:output_type -> datacommons.SearchResponse
+	32,  // 98: datacommons.Mixer.GetVersion:output_type -> datacommons.GetVersionResponse
+	37,  // 99: datacommons.Mixer.GetPlaceStatsVar:output_type -> datacommons.GetPlaceStatsVarResponse
+	40,  // 100: datacommons.Mixer.GetPlaceStatVars:output_type -> datacommons.GetPlaceStatVarsResponse
+	43,  // 101: datacommons.Mixer.GetPlaceStatVarsUnionV1:output_type -> datacommons.GetPlaceStatVarsUnionResponseV1
+	42,  // 102: datacommons.Mixer.GetPlaceStatVarsUnion:output_type -> datacommons.GetPlaceStatVarsUnionResponse
+	106, // 103: datacommons.Mixer.GetPlaceStatDateWithinPlace:output_type -> datacommons.GetPlaceStatDateWithinPlaceResponse
+	44,  // 104: datacommons.Mixer.GetStatVarGroup:output_type -> datacommons.StatVarGroups
+	45,  // 105: datacommons.Mixer.GetStatVarGroupNode:output_type -> datacommons.StatVarGroupNode
+	62,  // 106: datacommons.Mixer.GetStatVarPath:output_type -> datacommons.GetStatVarPathResponse
+	64,  // 107: datacommons.Mixer.SearchStatVar:output_type -> datacommons.SearchStatVarResponse
+	107, // 108: datacommons.Mixer.ExportStat:output_type -> datacommons.ExportStatBatch
+	108, // 109: datacommons.Mixer.ScanPlaceStat:output_type -> datacommons.PlaceStat
+	67,  // 110: datacommons.Mixer.GetStatVarSummary:output_type -> datacommons.GetStatVarSummaryResponse
+	76,  // [76:111] is the sub-list for method output_type
+	41,  // [41:76] is the sub-list for method input_type
+	41,  // [41:41] is the sub-list for extension type_name
+	41,  // [41:41] is the sub-list for extension extendee
+	0,   // [0:41] is the sub-list for field type_name
 }
 
 func init() { file_mixer_proto_init() }
@@ -5564,7 +6016,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[17].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetLocationsRankingsRequest); i {
+			switch v := v.(*GetPlacesNearbyRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5576,7 +6028,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[18].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetLocationsRankingsResponse); i {
+			switch v := v.(*NearbyPlace); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5588,7 +6040,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[19].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetRelatedLocationsResponse); i {
+			switch v := v.(*GetPlacesNearbyResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5600,7 +6052,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[20].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Place); i {
+			switch v := v.(*GetPlaceAncestorsRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5612,7 +6064,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[21].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Places); i {
+			switch v := v.(*GetPlaceAncestorsResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5624,7 +6076,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[22].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetLandingPageDataRequest); i {
+			switch v := v.(*GetLocationsRankingsRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5636,7 +6088,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[23].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetLandingPageDataResponse); i {
+			switch v := v.(*GetLocationsRankingsResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5648,7 +6100,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[24].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*SearchRequest); i {
+			switch v := v.(*GetRelatedLocationsResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5660,7 +6112,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[25].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*SearchResponse); i {
+			switch v := v.(*Place); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5672,7 +6124,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[26].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetVersionRequest); i {
+			switch v := v.(*Places); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5684,7 +6136,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[27].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetVersionResponse); i {
+			switch v := v.(*GetLandingPageDataRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5696,7 +6148,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[28].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*SearchResultSection); i {
+			switch v := v.(*GetLandingPageDataResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5708,7 +6160,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[29].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*SearchEntityResult); i {
+			switch v := v.(*SearchRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5720,7 +6172,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[30].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*StatsVars); i {
+			switch v := v.(*SearchResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5732,7 +6184,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[31].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetPlaceStatsVarRequest); i {
+			switch v := v.(*GetVersionRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5744,7 +6196,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[32].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetPlaceStatsVarResponse); i {
+			switch v := v.(*GetVersionResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5756,7 +6208,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[33].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*StatVars); i {
+			switch v := v.(*SearchResultSection); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5768,7 +6220,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[34].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetPlaceStatVarsRequest); i {
+			switch v := v.(*SearchEntityResult); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5780,7 +6232,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[35].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetPlaceStatVarsResponse); i {
+			switch v := v.(*StatsVars); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5792,7 +6244,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[36].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetPlaceStatVarsUnionRequest); i {
+			switch v := v.(*GetPlaceStatsVarRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5804,7 +6256,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[37].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetPlaceStatVarsUnionResponse); i {
+			switch v := v.(*GetPlaceStatsVarResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5816,7 +6268,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[38].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetPlaceStatVarsUnionResponseV1); i {
+			switch v := v.(*StatVars); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5828,7 +6280,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[39].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*StatVarGroups); i {
+			switch v := v.(*GetPlaceStatVarsRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5840,7 +6292,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[40].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*StatVarGroupNode); i {
+			switch v := v.(*GetPlaceStatVarsResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5852,7 +6304,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[41].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetStatVarGroupRequest); i {
+			switch v := v.(*GetPlaceStatVarsUnionRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5864,7 +6316,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[42].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetStatVarGroupNodeRequest); i {
+			switch v := v.(*GetPlaceStatVarsUnionResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5876,7 +6328,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[43].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*SVOPlace); i {
+			switch v := v.(*GetPlaceStatVarsUnionResponseV1); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5888,7 +6340,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[44].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*SVOObservation); i {
+			switch v := v.(*StatVarGroups); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5900,7 +6352,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[45].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*SVOCollection); i {
+			switch v := v.(*StatVarGroupNode); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5912,7 +6364,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[46].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*EntityInfo); i {
+			switch v := v.(*GetStatVarGroupRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5924,7 +6376,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[47].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*EntityInfoCollection); i {
+			switch v := v.(*GetStatVarGroupNodeRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5936,7 +6388,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[48].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*ContainedInPlaceRelation); i {
+			switch v := v.(*SVOPlace); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5948,7 +6400,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[49].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Triple); i {
+			switch v := v.(*SVOObservation); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5960,7 +6412,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[50].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Triples); i {
+			switch v := v.(*SVOCollection); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5972,7 +6424,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[51].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*ProvenanceInfo); i {
+			switch v := v.(*EntityInfo); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5984,7 +6436,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[52].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Provenances); i {
+			switch v := v.(*EntityInfoCollection); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -5996,7 +6448,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[53].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*PropertyLabels); i {
+			switch v := v.(*ContainedInPlaceRelation); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -6008,7 +6460,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[54].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*RelatedPlacesInfo); i {
+			switch v := v.(*Triple); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -6020,7 +6472,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[55].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*PlaceStatVarExistence); i {
+			switch v := v.(*Triples); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -6032,7 +6484,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[56].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetStatVarPathRequest); i {
+			switch v := v.(*ProvenanceInfo); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -6044,7 +6496,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[57].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetStatVarPathResponse); i {
+			switch v := v.(*Provenances); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -6056,7 +6508,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[58].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*SearchStatVarRequest); i {
+			switch v := v.(*PropertyLabels); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -6068,7 +6520,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[59].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*SearchStatVarResponse); i {
+			switch v := v.(*RelatedPlacesInfo); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -6080,7 +6532,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[60].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*StatVarSummary); i {
+			switch v := v.(*PlaceStatVarExistence); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -6092,7 +6544,7 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[61].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetStatVarSummaryRequest); i {
+			switch v := v.(*GetStatVarPathRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -6104,6 +6556,66 @@ func file_mixer_proto_init() {
 			}
 		}
 		file_mixer_proto_msgTypes[62].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*GetStatVarPathResponse); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_mixer_proto_msgTypes[63].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*SearchStatVarRequest); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_mixer_proto_msgTypes[64].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*SearchStatVarResponse); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_mixer_proto_msgTypes[65].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*StatVarSummary); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_mixer_proto_msgTypes[66].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*GetStatVarSummaryRequest); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_mixer_proto_msgTypes[67].Exporter = func(v interface{}, i int) interface{} {
 			switch v := v.(*GetStatVarSummaryResponse); i {
 			case 0:
 				return &v.state
@@ -6115,7 +6627,7 @@ func file_mixer_proto_init() {
 				return nil
 			}
 		}
-		file_mixer_proto_msgTypes[69].Exporter = func(v interface{}, i int) interface{} {
+		file_mixer_proto_msgTypes[75].Exporter = func(v interface{}, i int) interface{} {
 			switch v := v.(*StatVarGroupNode_ChildSVG); i {
 			case 0:
 				return &v.state
@@ -6127,7 +6639,7 @@ func file_mixer_proto_init() {
 				return nil
 			}
 		}
-		file_mixer_proto_msgTypes[70].Exporter = func(v interface{}, i int) interface{} {
+		file_mixer_proto_msgTypes[76].Exporter = func(v interface{}, i int) interface{} {
 			switch v := v.(*StatVarGroupNode_ChildSV); i {
 			case 0:
 				return &v.state
@@ -6139,7 +6651,7 @@ func file_mixer_proto_init() {
 				return nil
 			}
 		}
-		file_mixer_proto_msgTypes[71].Exporter = func(v interface{}, i int) interface{} {
+		file_mixer_proto_msgTypes[77].Exporter = func(v interface{}, i int) interface{} {
 			switch v := v.(*SVOPlace_Temp); i {
 			case 0:
 				return &v.state
@@ -6151,7 +6663,7 @@ func file_mixer_proto_init() {
 				return nil
 			}
 		}
-		file_mixer_proto_msgTypes[72].Exporter = func(v interface{}, i int) interface{} {
+		file_mixer_proto_msgTypes[78].Exporter = func(v interface{}, i int) interface{} {
 			switch v := v.(*SVOObservation_Temp); i {
 			case 0:
 				return &v.state
@@ -6163,7 +6675,7 @@ func file_mixer_proto_init() {
 				return nil
 			}
 		}
-		file_mixer_proto_msgTypes[73].Exporter = func(v interface{}, i int) interface{} {
+		file_mixer_proto_msgTypes[79].Exporter = func(v interface{}, i int) interface{} {
 			switch v := v.(*RelatedPlacesInfo_Ranking); i {
 			case 0:
 				return &v.state
@@ -6175,7 +6687,7 @@ func file_mixer_proto_init() {
 				return nil
 			}
 		}
-		file_mixer_proto_msgTypes[74].Exporter = func(v interface{}, i int) interface{} {
+		file_mixer_proto_msgTypes[80].Exporter = func(v interface{}, i int) interface{} {
 			switch v := v.(*RelatedPlacesInfo_Ranking_RankInfo); i {
 			case 0:
 				return &v.state
@@ -6187,7 +6699,7 @@ func file_mixer_proto_init() {
 				return nil
 			}
 		}
-		file_mixer_proto_msgTypes[75].Exporter = func(v interface{}, i int) interface{} {
+		file_mixer_proto_msgTypes[81].Exporter = func(v interface{}, i int) interface{} {
 			switch v := v.(*StatVarSummary_Place); i {
 			case 0:
 				return &v.state
@@ -6199,7 +6711,7 @@ func file_mixer_proto_init() {
 				return nil
 			}
 		}
-		file_mixer_proto_msgTypes[76].Exporter = func(v interface{}, i int) interface{} {
+		file_mixer_proto_msgTypes[82].Exporter = func(v interface{}, i int) interface{} {
 			switch v := v.(*StatVarSummary_PlaceTypeSummary); i {
 			case 0:
 				return &v.state
@@ -6212,7 +6724,7 @@ func file_mixer_proto_init() {
 			}
 		}
 	}
-	file_mixer_proto_msgTypes[44].OneofWrappers = []interface{}{
+	file_mixer_proto_msgTypes[49].OneofWrappers = []interface{}{
 		(*SVOObservation_StrValue)(nil),
 		(*SVOObservation_DblValue)(nil),
 	}
@@ -6222,7 +6734,7 @@ func file_mixer_proto_init() {
 			GoPackagePath: reflect.TypeOf(x{}).PkgPath(),
 			RawDescriptor: file_mixer_proto_rawDesc,
 			NumEnums:      0,
-			NumMessages:   79,
+			NumMessages:   85,
 			NumExtensions: 0,
 			NumServices:   1,
 		},
@@ -53,13 +53,23 @@ type MixerClient interface {
 	// Get the stat value for children places of certain place type at a given
 	// date.
 	GetStatSetWithinPlace(ctx context.Context, in *GetStatSetWithinPlaceRequest, opts ...grpc.CallOption) (*GetStatSetResponse, error)
+	// Get the best series of stat vars for the child places of a place, as
+	// place by date matrices.
+	GetStatSeriesWithinPlace(ctx context.Context, in *GetStatSeriesWithinPlaceRequest, opts ...grpc.CallOption) (*GetStatSeriesWithinPlaceResponse, error)
 	// Get the stat value for given places and stat vars. If date is not given,
 	// then the latest value for each <place, stat var> is returned.
 	GetStatSet(ctx context.Context, in *GetStatSetRequest, opts ...grpc.CallOption) (*GetStatSetResponse, error)
+	// Evaluate a formula over stat vars for a set of places.
+	GetStatFormula(ctx context.Context, in *GetStatFormulaRequest, opts ...grpc.CallOption) (*GetStatFormulaResponse, error)
 	// Get rankings for given stat var DCIDs.
 	GetLocationsRankings(ctx context.Context, in *GetLocationsRankingsRequest, opts ...grpc.CallOption) (*GetLocationsRankingsResponse, error)
 	// Get related locations for given stat var DCIDs.
 	GetRelatedLocations(ctx context.Context, in *GetRelatedLocationsRequest, opts ...grpc.CallOption) (*GetRelatedLocationsResponse, error)
+	// Get the places near a place or a location, within a radius or the k
+	// nearest.
+	GetPlacesNearby(ctx context.Context, in *GetPlacesNearbyRequest, opts ...grpc.CallOption) (*GetPlacesNearbyResponse, error)
+	// Get the ordered ancestor chains of places.
+	GetPlaceAncestors(ctx context.Context, in *GetPlaceAncestorsRequest, opts ...grpc.CallOption) (*GetPlaceAncestorsResponse, error)
 	// Get landing page info for a place.
 	GetLandingPageData(ctx context.Context, in *GetLandingPageDataRequest, opts ...grpc.CallOption) (*GetLandingPageDataResponse, error)
 	// Translate Sparql Query into translation results.
@@ -93,6 +103,11 @@ type MixerClient interface {
 	GetStatVarPath(ctx context.Context, in *GetStatVarPathRequest, opts ...grpc.CallOption) (*GetStatVarPathResponse, error)
 	// Search stat var and stat var groups.
 	SearchStatVar(ctx context.Context, in *SearchStatVarRequest, opts ...grpc.CallOption) (*SearchStatVarResponse, error)
+	// Stream all the observations of stat vars for a set of places, in batches
+	// of columns.
+	ExportStat(ctx context.Context, in *ExportStatRequest, opts ...grpc.CallOption) (Mixer_ExportStatClient, error)
+	// Stream all the stat series of a place, read in one scan of its rows.
+	ScanPlaceStat(ctx context.Context, in *ScanPlaceStatRequest, opts ...grpc.CallOption) (Mixer_ScanPlaceStatClient, error)
 	// Given a list of stat vars, get their summaries.
 	GetStatVarSummary(ctx context.Context, in *GetStatVarSummaryRequest, opts ...grpc.CallOption) (*GetStatVarSummaryResponse, error)
 }
@@ -213,6 +228,15 @@ func (c *mixerClient) GetStatSetWithinPlace(ctx context.Context, in *GetStatSetW
 	return out, nil
 }
 
+func (c *mixerClient) GetStatSeriesWithinPlace(ctx context.Context, in *GetStatSeriesWithinPlaceRequest, opts ...grpc.CallOption) (*GetStatSeriesWithinPlaceResponse, error) {
+	out := new(GetStatSeriesWithinPlaceResponse)
+	err := c.cc.Invoke(ctx, "/datacommons.Mixer/GetStatSeriesWithinPlace", in, out, opts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
 func (c *mixerClient) GetStatSet(ctx context.Context, in *GetStatSetRequest, opts ...grpc.CallOption) (*GetStatSetResponse, error) {
 	out := new(GetStatSetResponse)
 	err := c.cc.Invoke(ctx, "/datacommons.Mixer/GetStatSet", in, out, opts...)
@@ -222,6 +246,15 @@ func (c *mixerClient) GetStatSet(ctx context.Context, in *GetStatSetRequest, opt
 	return out, nil
 }
 
+func (c *mixerClient) GetStatFormula(ctx context.Context, in *GetStatFormulaRequest, opts ...grpc.CallOption) (*GetStatFormulaResponse, error) {
+	out := new(GetStatFormulaResponse)
+	err := c.cc.Invoke(ctx, "/datacommons.Mixer/GetStatFormula", in, out, opts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
 func (c *mixerClient) GetLocationsRankings(ctx context.Context, in *GetLocationsRankingsRequest, opts ...grpc.CallOption) (*GetLocationsRankingsResponse, error) {
 	out := new(GetLocationsRankingsResponse)
 	err := c.cc.Invoke(ctx, "/datacommons.Mixer/GetLocationsRankings", in, out, opts...)
@@ -240,6 +273,24 @@ func (c *mixerClient) GetRelatedLocations(ctx context.Context, in *GetRelatedLoc
 	return out, nil
 }
 
+func (c *mixerClient) GetPlacesNearby(ctx context.Context, in *GetPlacesNearbyRequest, opts ...grpc.CallOption) (*GetPlacesNearbyResponse, error) {
+	out := new(GetPlacesNearbyResponse)
+	err := c.cc.Invoke(ctx, "/datacommons.Mixer/GetPlacesNearby", in, out, opts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
+func (c *mixerClient) GetPlaceAncestors(ctx context.Context, in *GetPlaceAncestorsRequest, opts ...grpc.CallOption) (*GetPlaceAncestorsResponse, error) {
+	out := new(GetPlaceAncestorsResponse)
+	err := c.cc.Invoke(ctx, "/datacommons.Mixer/GetPlaceAncestors", in, out, opts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
 func (c *mixerClient) GetLandingPageData(ctx context.Context, in *GetLandingPageDataRequest, opts ...grpc.CallOption) (*GetLandingPageDataResponse, error) {
 	out := new(GetLandingPageDataResponse)
 	err := c.cc.Invoke(ctx, "/datacommons.Mixer/GetLandingPageData", in, out, opts...)
@@ -357,6 +408,70 @@ func (c *mixerClient) SearchStatVar(ctx context.Context, in *SearchStatVarReques
 	return out, nil
 }
 
+func (c *mixerClient) ExportStat(ctx context.Context, in *ExportStatRequest, opts ...grpc.CallOption) (Mixer_ExportStatClient, error) {
+	stream, err := c.cc.NewStream(ctx, &_Mixer_serviceDesc.Streams[0], "/datacommons.Mixer/ExportStat", opts...)
+	if err != nil {
+		return nil, err
+	}
+	x := &mixerExportStatClient{stream}
+	if err := x.ClientStream.SendMsg(in); err != nil {
+		return nil, err
+	}
+	if err := x.ClientStream.CloseSend(); err != nil {
+		return nil, err
+	}
+	return x, nil
+}
+
+type Mixer_ExportStatClient interface {
+	Recv() (*ExportStatBatch, error)
+	grpc.ClientStream
+}
+
+type mixerExportStatClient struct {
+	grpc.ClientStream
+}
+
+func (x *mixerExportStatClient) Recv() (*ExportStatBatch, error) {
+	m := new(ExportStatBatch)
+	if err := x.ClientStream.RecvMsg(m); err != nil {
+		return nil, err
+	}
+	return m, nil
+}
+
+func (c *mixerClient) ScanPlaceStat(ctx context.Context, in *ScanPlaceStatRequest, opts ...grpc.CallOption) (Mixer_ScanPlaceStatClient, error) {
+	stream, err := c.cc.NewStream(ctx, &_Mixer_serviceDesc.Streams[1], "/datacommons.Mixer/ScanPlaceStat", opts...)
+	if err != nil {
+		return nil, err
+	}
+	x := &mixerScanPlaceStatClient{stream}
+	if err := x.ClientStream.SendMsg(in); err != nil {
+		return nil, err
+	}
+	if err := x.ClientStream.CloseSend(); err != nil {
+		return nil, err
+	}
+	return x, nil
+}
+
+type Mixer_ScanPlaceStatClient interface {
+	Recv() (*PlaceStat, error)
+	grpc.ClientStream
+}
+
+type mixerScanPlaceStatClient struct {
+	grpc.ClientStream
+}
+
+func (x *mixerScanPlaceStatClient) Recv() (*PlaceStat, error) {
+	m := new(PlaceStat)
+	if err := x.ClientStream.RecvMsg(m); err != nil {
+		return nil, err
+	}
+	return m, nil
+}
+
 func (c *mixerClient) GetStatVarSummary(ctx context.Context, in *GetStatVarSummaryRequest, opts ...grpc.CallOption) (*GetStatVarSummaryResponse, error) {
 	out := new(GetStatVarSummaryResponse)
 	err := c.cc.Invoke(ctx, "/datacommons.Mixer/GetStatVarSummary", in, out, opts...)
@@ -406,13 +521,23 @@ type MixerServer interface {
 	// Get the stat value for children places of certain place type at a given
 	// date.
 	GetStatSetWithinPlace(context.Context, *GetStatSetWithinPlaceRequest) (*GetStatSetResponse, error)
+	// Get the best series of stat vars for the child places of a place, as
+	// place by date matrices.
+	GetStatSeriesWithinPlace(context.Context, *GetStatSeriesWithinPlaceRequest) (*GetStatSeriesWithinPlaceResponse, error)
 	// Get the stat value for given places and stat vars. If date is not given,
 	// then the latest value for each <place, stat var> is returned.
 	GetStatSet(context.Context, *GetStatSetRequest) (*GetStatSetResponse, error)
+	// Evaluate a formula over stat vars for a set of places.
+	GetStatFormula(context.Context, *GetStatFormulaRequest) (*GetStatFormulaResponse, error)
 	// Get rankings for given stat var DCIDs.
 	GetLocationsRankings(context.Context, *GetLocationsRankingsRequest) (*GetLocationsRankingsResponse, error)
 	// Get related locations for given stat var DCIDs.
 	GetRelatedLocations(context.Context, *GetRelatedLocationsRequest) (*GetRelatedLocationsResponse, error)
+	// Get the places near a place or a location, within a radius or the k
+	// nearest.
+	GetPlacesNearby(context.Context, *GetPlacesNearbyRequest) (*GetPlacesNearbyResponse, error)
+	// Get the ordered ancestor chains of places.
+	GetPlaceAncestors(context.Context, *GetPlaceAncestorsRequest) (*GetPlaceAncestorsResponse, error)
 	// Get landing page info for a place.
 	GetLandingPageData(context.Context, *GetLandingPageDataRequest) (*GetLandingPageDataResponse, error)
 	// Translate Sparql Query into translation results.
@@ -446,6 +571,11 @@ type MixerServer interface {
 	GetStatVarPath(context.Context, *GetStatVarPathRequest) (*GetStatVarPathResponse, error)
 	// Search stat var and stat var groups.
 	SearchStatVar(context.Context, *SearchStatVarRequest) (*SearchStatVarResponse, error)
+	// Stream all the observations of stat vars for a set of places, in batches
+	// of columns.
+	ExportStat(*ExportStatRequest, Mixer_ExportStatServer) error
+	// Stream all the stat series of a place, read in one scan of its rows.
+	ScanPlaceStat(*ScanPlaceStatRequest, Mixer_ScanPlaceStatServer) error
 	// Given a list of stat vars, get their summaries.
 	GetStatVarSummary(context.Context, *GetStatVarSummaryRequest) (*GetStatVarSummaryResponse, error)
 }
@@ -490,15 +620,27 @@ func (*UnimplementedMixerServer) GetStatAll(context.Context, *GetStatAllRequest)
 func (*UnimplementedMixerServer) GetStatSetWithinPlace(context.Context, *GetStatSetWithinPlaceRequest) (*GetStatSetResponse, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method GetStatSetWithinPlace not implemented")
 }
+func (*UnimplementedMixerServer) GetStatSeriesWithinPlace(context.Context, *GetStatSeriesWithinPlaceRequest) (*GetStatSeriesWithinPlaceResponse, error) {
+	return nil, status.Errorf(codes.Unimplemented, "method GetStatSeriesWithinPlace not implemented")
+}
 func (*UnimplementedMixerServer) GetStatSet(context.Context, *GetStatSetRequest) (*GetStatSetResponse, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method GetStatSet not implemented")
 }
+func (*UnimplementedMixerServer) GetStatFormula(context.Context, *GetStatFormulaRequest) (*GetStatFormulaResponse, error) {
+	return nil, status.Errorf(codes.Unimplemented, "method GetStatFormula not implemented")
+}
 func (*UnimplementedMixerServer) GetLocationsRankings(context.Context, *GetLocationsRankingsRequest) (*GetLocationsRankingsResponse, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method GetLocationsRankings not implemented")
 }
 func (*UnimplementedMixerServer) GetRelatedLocations(context.Context, *GetRelatedLocationsRequest) (*GetRelatedLocationsResponse, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method GetRelatedLocations not implemented")
 }
+func (*UnimplementedMixerServer) GetPlacesNearby(context.Context, *GetPlacesNearbyRequest) (*GetPlacesNearbyResponse, error) {
+	return nil, status.Errorf(codes.Unimplemented, "method GetPlacesNearby not implemented")
+}
+func (*UnimplementedMixerServer) GetPlaceAncestors(context.Context, *GetPlaceAncestorsRequest) (*GetPlaceAncestorsResponse, error) {
+	return nil, status.Errorf(codes.Unimplemented, "method GetPlaceAncestors not implemented")
+}
 func (*UnimplementedMixerServer) GetLandingPageData(context.Context, *GetLandingPageDataRequest) (*GetLandingPageDataResponse, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method GetLandingPageData not implemented")
 }
@@ -538,6 +680,12 @@ func (*UnimplementedMixerServer) GetStatVarPath(context.Context, *GetStatVarPath
 func (*UnimplementedMixerServer) SearchStatVar(context.Context, *SearchStatVarRequest) (*SearchStatVarResponse, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method SearchStatVar not implemented")
 }
+func (*UnimplementedMixerServer) ExportStat(*ExportStatRequest, Mixer_ExportStatServer) error {
+	return status.Errorf(codes.Unimplemented, "method ExportStat not implemented")
+}
+func (*UnimplementedMixerServer) ScanPlaceStat(*ScanPlaceStatRequest, Mixer_ScanPlaceStatServer) error {
+	return status.Errorf(codes.Unimplemented, "method ScanPlaceStat not implemented")
+}
 func (*UnimplementedMixerServer) GetStatVarSummary(context.Context, *GetStatVarSummaryRequest) (*GetStatVarSummaryResponse, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method GetStatVarSummary not implemented")
 }
@@ -762,6 +910,24 @@ func _Mixer_GetStatSetWithinPlace_Handler(srv interface{}, ctx context.Context,
 	return interceptor(ctx, in, info, handler)
 }
 
+func _Mixer_GetStatSeriesWithinPlace_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(GetStatSeriesWithinPlaceRequest)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(MixerServer).GetStatSeriesWithinPlace(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: "/datacommons.Mixer/GetStatSeriesWithinPlace",
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(MixerServer).GetStatSeriesWithinPlace(ctx, req.(*GetStatSeriesWithinPlaceRequest))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
 func _Mixer_GetStatSet_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
 	in := new(GetStatSetRequest)
 	if err := dec(in); err != nil {
@@ -780,6 +946,24 @@ func _Mixer_GetStatSet_Handler(srv interface{}, ctx context.Context, dec func(in
 	return interceptor(ctx, in, info, handler)
 }
 
+func _Mixer_GetStatFormula_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(GetStatFormulaRequest)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(MixerServer).GetStatFormula(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: "/datacommons.Mixer/GetStatFormula",
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(MixerServer).GetStatFormula(ctx, req.(*GetStatFormulaRequest))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
 func _Mixer_GetLocationsRankings_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
 	in := new(GetLocationsRankingsRequest)
 	if err := dec(in); err != nil {
@@ -816,6 +1000,42 @@ func _Mixer_GetRelatedLocations_Handler(srv interface{}, ctx context.Context, de
 	return interceptor(ctx, in, info, handler)
 }
 
+func _Mixer_GetPlacesNearby_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(GetPlacesNearbyRequest)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(MixerServer).GetPlacesNearby(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: "/datacommons.Mixer/GetPlacesNearby",
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(MixerServer).GetPlacesNearby(ctx, req.(*GetPlacesNearbyRequest))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
+func _Mixer_GetPlaceAncestors_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(GetPlaceAncestorsRequest)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(MixerServer).GetPlaceAncestors(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: "/datacommons.Mixer/GetPlaceAncestors",
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(MixerServer).GetPlaceAncestors(ctx, req.(*GetPlaceAncestorsRequest))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
 func _Mixer_GetLandingPageData_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
 	in := new(GetLandingPageDataRequest)
 	if err := dec(in); err != nil {
@@ -1050,6 +1270,48 @@ func _Mixer_SearchStatVar_Handler(srv interface{}, ctx context.Context, dec func
 	return interceptor(ctx, in, info, handler)
 }
 
+func _Mixer_ExportStat_Handler(srv interface{}, stream grpc.ServerStream) error {
+	m := new(ExportStatRequest)
+	if err := stream.RecvMsg(m); err != nil {
+		return err
+	}
+	return srv.(MixerServer).ExportStat(m, &mixerExportStatServer{stream})
+}
+
+type Mixer_ExportStatServer interface {
+	Send(*ExportStatBatch) error
+	grpc.ServerStream
+}
+
+type mixerExportStatServer struct {
+	grpc.ServerStream
+}
+
+func (x *mixerExportStatServer) Send(m *ExportStatBatch) error {
+	return x.ServerStream.SendMsg(m)
+}
+
+func _Mixer_ScanPlaceStat_Handler(srv interface{}, stream grpc.ServerStream) error {
+	m := new(ScanPlaceStatRequest)
+	if err := stream.RecvMsg(m); err != nil {
+		return err
+	}
+	return srv.(MixerServer).ScanPlaceStat(m, &mixerScanPlaceStatServer{stream})
+}
+
+type Mixer_ScanPlaceStatServer interface {
+	Send(*PlaceStat) error
+	grpc.ServerStream
+}
+
+type mixerScanPlaceStatServer struct {
+	grpc.ServerStream
+}
+
+func (x *mixerScanPlaceStatServer) Send(m *PlaceStat) error {
+	return x.ServerStream.SendMsg(m)
+}
+
 func _Mixer_GetStatVarSummary_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
 	in := new(GetStatVarSummaryRequest)
 	if err := dec(in); err != nil {
@@ -1120,10 +1382,18 @@ var _Mixer_serviceDesc = grpc.ServiceDesc{
 			MethodName: "GetStatSetWithinPlace",
 			Handler:    _Mixer_GetStatSetWithinPlace_Handler,
 		},
+		{
+			MethodName: "GetStatSeriesWithinPlace",
+			Handler:    _Mixer_GetStatSeriesWithinPlace_Handler,
+		},
 		{
 			MethodName: "GetStatSet",
 			Handler:    _Mixer_GetStatSet_Handler,
 		},
+		{
+			MethodName: "GetStatFormula",
+			Handler:    _Mixer_GetStatFormula_Handler,
+		},
 		{
 			MethodName: "GetLocationsRankings",
 			Handler:    _Mixer_GetLocationsRankings_Handler,
@@ -1132,6 +1402,14 @@ var _Mixer_serviceDesc = grpc.ServiceDesc{
 			MethodName: "GetRelatedLocations",
 			Handler:    _Mixer_GetRelatedLocations_Handler,
 		},
+		{
+			MethodName: "GetPlacesNearby",
+			Handler:    _Mixer_GetPlacesNearby_Handler,
+		},
+		{
+			MethodName: "GetPlaceAncestors",
+			Handler:    _Mixer_GetPlaceAncestors_Handler,
+		},
 		{
 			MethodName: "GetLandingPageData",
 			Handler:    _Mixer_GetLandingPageData_Handler,
@@ -1189,6 +1467,17 @@ var _Mixer_serviceDesc = grpc.ServiceDesc{
 			Handler:    _Mixer_GetStatVarSummary_Handler,
 		},
 	},
-	Streams:  []grpc.StreamDesc{},
+	Streams: []grpc.StreamDesc{
+		{
+			StreamName:    "ExportStat",
+			Handler:       _Mixer_ExportStat_Handler,
+			ServerStreams: true,
+		},
+		{
+			StreamName:    "ScanPlaceStat",
+			Handler:       _Mixer_ScanPlaceStat_Handler,
+			ServerStreams: true,
+		},
+	},
 	Metadata: "mixer.proto",
 }
@@ -0,0 +1,90 @@
+// Code generated by protoc-gen-go-grpc. DO NOT EDIT.
+
+package proto
+
+import (
+	context "context"
+	grpc "google.golang.org/grpc"
+	codes "google.golang.org/grpc/codes"
+	status "google.golang.org/grpc/status"
+)
+
+// This is a compile-time assertion to ensure that this generated file
+// is compatible with the grpc package it is being compiled against.
+const _ = grpc.SupportPackageIsVersion6
+
+// MixerPeerClient is the client API for MixerPeer service.
+//
+// For semantics around ctx use and closing/ending streaming RPCs, please refer to https://pkg.go.dev/google.golang.org/grpc/?tab=doc#ClientConn.NewStream.
+type MixerPeerClient interface {
+	// Read rows owned by the replica, from its row cache or Bigtable.
+	ReadRows(ctx context.Context, in *PeerReadRowsRequest, opts ...grpc.CallOption) (*PeerReadRowsResponse, error)
+}
+
+type mixerPeerClient struct {
+	cc grpc.ClientConnInterface
+}
+
+func NewMixerPeerClient(cc grpc.ClientConnInterface) MixerPeerClient {
+	return &mixerPeerClient{cc}
+}
+
+func (c *mixerPeerClient) ReadRows(ctx context.Context, in *PeerReadRowsRequest, opts ...grpc.CallOption) (*PeerReadRowsResponse, error) {
+	out := new(PeerReadRowsResponse)
+	err := c.cc.Invoke(ctx, "/datacommons.MixerPeer/ReadRows", in, out, opts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
+// MixerPeerServer is the server API for MixerPeer service.
+// All implementations should embed UnimplementedMixerPeerServer
+// for forward compatibility
+type MixerPeerServer interface {
+	// Read rows owned by the replica, from its row cache or Bigtable.
+	ReadRows(context.Context, *PeerReadRowsRequest) (*PeerReadRowsResponse, error)
+}
+
+// UnimplementedMixerPeerServer should be embedded to have forward compatible implementations.
+type UnimplementedMixerPeerServer struct {
+}
+
+func (*UnimplementedMixerPeerServer) ReadRows(context.Context, *PeerReadRowsRequest) (*PeerReadRowsResponse, error) {
+	return nil, status.Errorf(codes.Unimplemented, "method ReadRows not implemented")
+}
+
+func RegisterMixerPeerServer(s *grpc.Server, srv MixerPeerServer) {
+	s.RegisterService(&_MixerPeer_serviceDesc, srv)
+}
+
+func _MixerPeer_ReadRows_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(PeerReadRowsRequest)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(MixerPeerServer).ReadRows(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: "/datacommons.MixerPeer/ReadRows",
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(MixerPeerServer).ReadRows(ctx, req.(*PeerReadRowsRequest))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
+var _MixerPeer_serviceDesc = grpc.ServiceDesc{
+	ServiceName: "datacommons.MixerPeer",
+	HandlerType: (*MixerPeerServer)(nil),
+	Methods: []grpc.MethodDesc{
+		{
+			MethodName: "ReadRows",
+			Handler:    _MixerPeer_ReadRows_Handler,
+		},
+	},
+	Streams:  []grpc.StreamDesc{},
+	Metadata: "peer.proto",
+}
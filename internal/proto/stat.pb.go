@@ -15,7 +15,7 @@
 // Code generated by protoc-gen-go. DO NOT EDIT.
 // versions:
 // 	protoc-gen-go v1.26.0
-// 	protoc        v3.17.0
+// 	protoc        v3.21.12
 // source: stat.proto
 
 package proto
@@ -34,6 +34,206 @@ const (
 	_ = protoimpl.EnforceVersion(protoimpl.MaxVersion - 20)
 )
 
+type AlignOptions_Period int32
+
+const (
+	AlignOptions_PERIOD_NONE  AlignOptions_Period = 0
+	AlignOptions_PERIOD_YEAR  AlignOptions_Period = 1
+	AlignOptions_PERIOD_MONTH AlignOptions_Period = 2
+)
+
+// Enum value maps for AlignOptions_Period.
+var (
+	AlignOptions_Period_name = map[int32]string{
+		0: "PERIOD_NONE",
+		1: "PERIOD_YEAR",
+		2: "PERIOD_MONTH",
+	}
+	AlignOptions_Period_value = map[string]int32{
+		"PERIOD_NONE":  0,
+		"PERIOD_YEAR":  1,
+		"PERIOD_MONTH": 2,
+	}
+)
+
+func (x AlignOptions_Period) Enum() *AlignOptions_Period {
+	p := new(AlignOptions_Period)
+	*p = x
+	return p
+}
+
+func (x AlignOptions_Period) String() string {
+	return protoimpl.X.EnumStringOf(x.Descriptor(), protoreflect.EnumNumber(x))
+}
+
+func (AlignOptions_Period) Descriptor() protoreflect.EnumDescriptor {
+	return file_stat_proto_enumTypes[0].Descriptor()
+}
+
+func (AlignOptions_Period) Type() protoreflect.EnumType {
+	return &file_stat_proto_enumTypes[0]
+}
+
+func (x AlignOptions_Period) Number() protoreflect.EnumNumber {
+	return protoreflect.EnumNumber(x)
+}
+
+// Deprecated: Use AlignOptions_Period.Descriptor instead.
+func (AlignOptions_Period) EnumDescriptor() ([]byte, []int) {
+	return file_stat_proto_rawDescGZIP(), []int{6, 0}
+}
+
+type AlignOptions_Aggregation int32
+
+const (
+	AlignOptions_AGGREGATION_LAST AlignOptions_Aggregation = 0
+	AlignOptions_AGGREGATION_MEAN AlignOptions_Aggregation = 1
+	AlignOptions_AGGREGATION_SUM  AlignOptions_Aggregation = 2
+)
+
+// Enum value maps for AlignOptions_Aggregation.
+var (
+	AlignOptions_Aggregation_name = map[int32]string{
+		0: "AGGREGATION_LAST",
+		1: "AGGREGATION_MEAN",
+		2: "AGGREGATION_SUM",
+	}
+	AlignOptions_Aggregation_value = map[string]int32{
+		"AGGREGATION_LAST": 0,
+		"AGGREGATION_MEAN": 1,
+		"AGGREGATION_SUM":  2,
+	}
+)
+
+func (x AlignOptions_Aggregation) Enum() *AlignOptions_Aggregation {
+	p := new(AlignOptions_Aggregation)
+	*p = x
+	return p
+}
+
+func (x AlignOptions_Aggregation) String() string {
+	return protoimpl.X.EnumStringOf(x.Descriptor(), protoreflect.EnumNumber(x))
+}
+
+func (AlignOptions_Aggregation) Descriptor() protoreflect.EnumDescriptor {
+	return file_stat_proto_enumTypes[1].Descriptor()
+}
+
+func (AlignOptions_Aggregation) Type() protoreflect.EnumType {
+	return &file_stat_proto_enumTypes[1]
+}
+
+func (x AlignOptions_Aggregation) Number() protoreflect.EnumNumber {
+	return protoreflect.EnumNumber(x)
+}
+
+// Deprecated: Use AlignOptions_Aggregation.Descriptor instead.
+func (AlignOptions_Aggregation) EnumDescriptor() ([]byte, []int) {
+	return file_stat_proto_rawDescGZIP(), []int{6, 1}
+}
+
+type AlignOptions_Grid int32
+
+const (
+	AlignOptions_GRID_NONE AlignOptions_Grid = 0
+	// Only keep the dates that all the series have.
+	AlignOptions_GRID_INTERSECTION AlignOptions_Grid = 1
+	// Use the dates of any series.
+	AlignOptions_GRID_UNION AlignOptions_Grid = 2
+)
+
+// Enum value maps for AlignOptions_Grid.
+var (
+	AlignOptions_Grid_name = map[int32]string{
+		0: "GRID_NONE",
+		1: "GRID_INTERSECTION",
+		2: "GRID_UNION",
+	}
+	AlignOptions_Grid_value = map[string]int32{
+		"GRID_NONE":         0,
+		"GRID_INTERSECTION": 1,
+		"GRID_UNION":        2,
+	}
+)
+
+func (x AlignOptions_Grid) Enum() *AlignOptions_Grid {
+	p := new(AlignOptions_Grid)
+	*p = x
+	return p
+}
+
+func (x AlignOptions_Grid) String() string {
+	return protoimpl.X.EnumStringOf(x.Descriptor(), protoreflect.EnumNumber(x))
+}
+
+func (AlignOptions_Grid) Descriptor() protoreflect.EnumDescriptor {
+	return file_stat_proto_enumTypes[2].Descriptor()
+}
+
+func (AlignOptions_Grid) Type() protoreflect.EnumType {
+	return &file_stat_proto_enumTypes[2]
+}
+
+func (x AlignOptions_Grid) Number() protoreflect.EnumNumber {
+	return protoreflect.EnumNumber(x)
+}
+
+// Deprecated: Use AlignOptions_Grid.Descriptor instead.
+func (AlignOptions_Grid) EnumDescriptor() ([]byte, []int) {
+	return file_stat_proto_rawDescGZIP(), []int{6, 2}
+}
+
+type AlignOptions_Fill int32
+
+const (
+	AlignOptions_FILL_NONE AlignOptions_Fill = 0
+	// Use the value of the previous date.
+	AlignOptions_FILL_PREVIOUS AlignOptions_Fill = 1
+	// Interpolate between the previous and next dates.
+	AlignOptions_FILL_LINEAR AlignOptions_Fill = 2
+)
+
+// Enum value maps for AlignOptions_Fill.
+var (
+	AlignOptions_Fill_name = map[int32]string{
+		0: "FILL_NONE",
+		1: "FILL_PREVIOUS",
+		2: "FILL_LINEAR",
+	}
+	AlignOptions_Fill_value = map[string]int32{
+		"FILL_NONE":     0,
+		"FILL_PREVIOUS": 1,
+		"FILL_LINEAR":   2,
+	}
+)
+
+func (x AlignOptions_Fill) Enum() *AlignOptions_Fill {
+	p := new(AlignOptions_Fill)
+	*p = x
+	return p
+}
+
+func (x AlignOptions_Fill) String() string {
+	return protoimpl.X.EnumStringOf(x.Descriptor(), protoreflect.EnumNumber(x))
+}
+
+func (AlignOptions_Fill) Descriptor() protoreflect.EnumDescriptor {
+	return file_stat_proto_enumTypes[3].Descriptor()
+}
+
+func (AlignOptions_Fill) Type() protoreflect.EnumType {
+	return &file_stat_proto_enumTypes[3]
+}
+
+func (x AlignOptions_Fill) Number() protoreflect.EnumNumber {
+	return protoreflect.EnumNumber(x)
+}
+
+// Deprecated: Use AlignOptions_Fill.Descriptor instead.
+func (AlignOptions_Fill) EnumDescriptor() ([]byte, []int) {
+	return file_stat_proto_rawDescGZIP(), []int{6, 3}
+}
+
 // StatMetadata contains the source and measurement information for a
 // statistical observation.
 type StatMetadata struct {
@@ -460,6 +660,83 @@ func (x *Series) GetMetadata() *StatMetadata {
 	return nil
 }
 
+// Options to align time series with different observation periods.
+type AlignOptions struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Resample the dates to years or months. Dates that are coarser than the
+	// period are kept as is.
+	Period AlignOptions_Period `protobuf:"varint,1,opt,name=period,proto3,enum=datacommons.AlignOptions_Period" json:"period,omitempty"`
+	// How the values of a resampled period are combined.
+	Aggregation AlignOptions_Aggregation `protobuf:"varint,2,opt,name=aggregation,proto3,enum=datacommons.AlignOptions_Aggregation" json:"aggregation,omitempty"`
+	Grid        AlignOptions_Grid        `protobuf:"varint,3,opt,name=grid,proto3,enum=datacommons.AlignOptions_Grid" json:"grid,omitempty"`
+	// How the missing dates of the union grid are filled. Only the dates between
+	// the first and last observations of a series are filled.
+	Fill AlignOptions_Fill `protobuf:"varint,4,opt,name=fill,proto3,enum=datacommons.AlignOptions_Fill" json:"fill,omitempty"`
+}
+
+func (x *AlignOptions) Reset() {
+	*x = AlignOptions{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_stat_proto_msgTypes[6]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *AlignOptions) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*AlignOptions) ProtoMessage() {}
+
+func (x *AlignOptions) ProtoReflect() protoreflect.Message {
+	mi := &file_stat_proto_msgTypes[6]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use AlignOptions.ProtoReflect.Descriptor instead.
+func (*AlignOptions) Descriptor() ([]byte, []int) {
+	return file_stat_proto_rawDescGZIP(), []int{6}
+}
+
+func (x *AlignOptions) GetPeriod() AlignOptions_Period {
+	if x != nil {
+		return x.Period
+	}
+	return AlignOptions_PERIOD_NONE
+}
+
+func (x *AlignOptions) GetAggregation() AlignOptions_Aggregation {
+	if x != nil {
+		return x.Aggregation
+	}
+	return AlignOptions_AGGREGATION_LAST
+}
+
+func (x *AlignOptions) GetGrid() AlignOptions_Grid {
+	if x != nil {
+		return x.Grid
+	}
+	return AlignOptions_GRID_NONE
+}
+
+func (x *AlignOptions) GetFill() AlignOptions_Fill {
+	if x != nil {
+		return x.Fill
+	}
+	return AlignOptions_FILL_NONE
+}
+
 type SeriesMap struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
@@ -472,7 +749,7 @@ type SeriesMap struct {
 func (x *SeriesMap) Reset() {
 	*x = SeriesMap{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[6]
+		mi := &file_stat_proto_msgTypes[7]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -485,7 +762,7 @@ func (x *SeriesMap) String() string {
 func (*SeriesMap) ProtoMessage() {}
 
 func (x *SeriesMap) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[6]
+	mi := &file_stat_proto_msgTypes[7]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -498,7 +775,7 @@ func (x *SeriesMap) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use SeriesMap.ProtoReflect.Descriptor instead.
 func (*SeriesMap) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{6}
+	return file_stat_proto_rawDescGZIP(), []int{7}
 }
 
 func (x *SeriesMap) GetData() map[string]*Series {
@@ -525,7 +802,7 @@ type ObsTimeSeries struct {
 func (x *ObsTimeSeries) Reset() {
 	*x = ObsTimeSeries{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[7]
+		mi := &file_stat_proto_msgTypes[8]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -538,7 +815,7 @@ func (x *ObsTimeSeries) String() string {
 func (*ObsTimeSeries) ProtoMessage() {}
 
 func (x *ObsTimeSeries) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[7]
+	mi := &file_stat_proto_msgTypes[8]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -551,7 +828,7 @@ func (x *ObsTimeSeries) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use ObsTimeSeries.ProtoReflect.Descriptor instead.
 func (*ObsTimeSeries) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{7}
+	return file_stat_proto_rawDescGZIP(), []int{8}
 }
 
 func (x *ObsTimeSeries) GetData() map[string]float64 {
@@ -610,7 +887,7 @@ type ObsCollection struct {
 func (x *ObsCollection) Reset() {
 	*x = ObsCollection{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[8]
+		mi := &file_stat_proto_msgTypes[9]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -623,7 +900,7 @@ func (x *ObsCollection) String() string {
 func (*ObsCollection) ProtoMessage() {}
 
 func (x *ObsCollection) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[8]
+	mi := &file_stat_proto_msgTypes[9]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -636,7 +913,7 @@ func (x *ObsCollection) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use ObsCollection.ProtoReflect.Descriptor instead.
 func (*ObsCollection) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{8}
+	return file_stat_proto_rawDescGZIP(), []int{9}
 }
 
 func (x *ObsCollection) GetSourceCohorts() []*SourceSeries {
@@ -661,7 +938,7 @@ type ChartStore struct {
 func (x *ChartStore) Reset() {
 	*x = ChartStore{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[9]
+		mi := &file_stat_proto_msgTypes[10]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -674,7 +951,7 @@ func (x *ChartStore) String() string {
 func (*ChartStore) ProtoMessage() {}
 
 func (x *ChartStore) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[9]
+	mi := &file_stat_proto_msgTypes[10]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -687,7 +964,7 @@ func (x *ChartStore) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use ChartStore.ProtoReflect.Descriptor instead.
 func (*ChartStore) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{9}
+	return file_stat_proto_rawDescGZIP(), []int{10}
 }
 
 func (m *ChartStore) GetVal() isChartStore_Val {
@@ -741,7 +1018,7 @@ type PlaceStat struct {
 func (x *PlaceStat) Reset() {
 	*x = PlaceStat{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[10]
+		mi := &file_stat_proto_msgTypes[11]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -754,7 +1031,7 @@ func (x *PlaceStat) String() string {
 func (*PlaceStat) ProtoMessage() {}
 
 func (x *PlaceStat) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[10]
+	mi := &file_stat_proto_msgTypes[11]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -767,7 +1044,7 @@ func (x *PlaceStat) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use PlaceStat.ProtoReflect.Descriptor instead.
 func (*PlaceStat) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{10}
+	return file_stat_proto_rawDescGZIP(), []int{11}
 }
 
 func (x *PlaceStat) GetStatVarData() map[string]*ObsTimeSeries {
@@ -791,7 +1068,7 @@ type StatVarObsSeries struct {
 func (x *StatVarObsSeries) Reset() {
 	*x = StatVarObsSeries{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[11]
+		mi := &file_stat_proto_msgTypes[12]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -804,7 +1081,7 @@ func (x *StatVarObsSeries) String() string {
 func (*StatVarObsSeries) ProtoMessage() {}
 
 func (x *StatVarObsSeries) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[11]
+	mi := &file_stat_proto_msgTypes[12]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -817,7 +1094,7 @@ func (x *StatVarObsSeries) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use StatVarObsSeries.ProtoReflect.Descriptor instead.
 func (*StatVarObsSeries) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{11}
+	return file_stat_proto_rawDescGZIP(), []int{12}
 }
 
 func (x *StatVarObsSeries) GetData() map[string]*ObsTimeSeries {
@@ -842,7 +1119,7 @@ type StatVarSeries struct {
 func (x *StatVarSeries) Reset() {
 	*x = StatVarSeries{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[12]
+		mi := &file_stat_proto_msgTypes[13]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -855,7 +1132,7 @@ func (x *StatVarSeries) String() string {
 func (*StatVarSeries) ProtoMessage() {}
 
 func (x *StatVarSeries) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[12]
+	mi := &file_stat_proto_msgTypes[13]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -868,7 +1145,7 @@ func (x *StatVarSeries) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use StatVarSeries.ProtoReflect.Descriptor instead.
 func (*StatVarSeries) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{12}
+	return file_stat_proto_rawDescGZIP(), []int{13}
 }
 
 func (x *StatVarSeries) GetData() map[string]*Series {
@@ -902,7 +1179,7 @@ type GetStatsRequest struct {
 func (x *GetStatsRequest) Reset() {
 	*x = GetStatsRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[13]
+		mi := &file_stat_proto_msgTypes[14]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -915,7 +1192,7 @@ func (x *GetStatsRequest) String() string {
 func (*GetStatsRequest) ProtoMessage() {}
 
 func (x *GetStatsRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[13]
+	mi := &file_stat_proto_msgTypes[14]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -928,7 +1205,7 @@ func (x *GetStatsRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetStatsRequest.ProtoReflect.Descriptor instead.
 func (*GetStatsRequest) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{13}
+	return file_stat_proto_rawDescGZIP(), []int{14}
 }
 
 func (x *GetStatsRequest) GetPlace() []string {
@@ -979,7 +1256,7 @@ type GetStatsResponse struct {
 func (x *GetStatsResponse) Reset() {
 	*x = GetStatsResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[14]
+		mi := &file_stat_proto_msgTypes[15]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -992,7 +1269,7 @@ func (x *GetStatsResponse) String() string {
 func (*GetStatsResponse) ProtoMessage() {}
 
 func (x *GetStatsResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[14]
+	mi := &file_stat_proto_msgTypes[15]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1005,7 +1282,7 @@ func (x *GetStatsResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetStatsResponse.ProtoReflect.Descriptor instead.
 func (*GetStatsResponse) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{14}
+	return file_stat_proto_rawDescGZIP(), []int{15}
 }
 
 func (x *GetStatsResponse) GetPayload() string {
@@ -1028,12 +1305,22 @@ type GetStatSetSeriesRequest struct {
 	Places []string `protobuf:"bytes,1,rep,name=places,proto3" json:"places,omitempty"`
 	// The dcids of the statistical variables.
 	StatVars []string `protobuf:"bytes,2,rep,name=stat_vars,json=statVars,proto3" json:"stat_vars,omitempty"`
+	// (optional) how to align the series on common dates.
+	Align *AlignOptions `protobuf:"bytes,3,opt,name=align,proto3" json:"align,omitempty"`
+	// (optional) transforms applied in order to the aligned series, between
+	// consecutive dates. Supported transforms:
+	// - "diff": difference with the previous value.
+	// - "pct_change": ratio of change from the previous value.
+	// - "rolling_mean(n)": mean of the last n values.
+	// - "cumsum": cumulative sum.
+	// Dates without a value, like the first date of "diff", are dropped.
+	Transforms []string `protobuf:"bytes,4,rep,name=transforms,proto3" json:"transforms,omitempty"`
 }
 
 func (x *GetStatSetSeriesRequest) Reset() {
 	*x = GetStatSetSeriesRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[15]
+		mi := &file_stat_proto_msgTypes[16]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1046,7 +1333,7 @@ func (x *GetStatSetSeriesRequest) String() string {
 func (*GetStatSetSeriesRequest) ProtoMessage() {}
 
 func (x *GetStatSetSeriesRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[15]
+	mi := &file_stat_proto_msgTypes[16]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1059,7 +1346,7 @@ func (x *GetStatSetSeriesRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetStatSetSeriesRequest.ProtoReflect.Descriptor instead.
 func (*GetStatSetSeriesRequest) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{15}
+	return file_stat_proto_rawDescGZIP(), []int{16}
 }
 
 func (x *GetStatSetSeriesRequest) GetPlaces() []string {
@@ -1076,6 +1363,20 @@ func (x *GetStatSetSeriesRequest) GetStatVars() []string {
 	return nil
 }
 
+func (x *GetStatSetSeriesRequest) GetAlign() *AlignOptions {
+	if x != nil {
+		return x.Align
+	}
+	return nil
+}
+
+func (x *GetStatSetSeriesRequest) GetTransforms() []string {
+	if x != nil {
+		return x.Transforms
+	}
+	return nil
+}
+
 // Response of GetStatSetSeries
 type GetStatSetSeriesResponse struct {
 	state         protoimpl.MessageState
@@ -1089,7 +1390,7 @@ type GetStatSetSeriesResponse struct {
 func (x *GetStatSetSeriesResponse) Reset() {
 	*x = GetStatSetSeriesResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[16]
+		mi := &file_stat_proto_msgTypes[17]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1102,7 +1403,7 @@ func (x *GetStatSetSeriesResponse) String() string {
 func (*GetStatSetSeriesResponse) ProtoMessage() {}
 
 func (x *GetStatSetSeriesResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[16]
+	mi := &file_stat_proto_msgTypes[17]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1115,7 +1416,7 @@ func (x *GetStatSetSeriesResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetStatSetSeriesResponse.ProtoReflect.Descriptor instead.
 func (*GetStatSetSeriesResponse) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{16}
+	return file_stat_proto_rawDescGZIP(), []int{17}
 }
 
 func (x *GetStatSetSeriesResponse) GetData() map[string]*SeriesMap {
@@ -1150,7 +1451,7 @@ type GetStatValueRequest struct {
 func (x *GetStatValueRequest) Reset() {
 	*x = GetStatValueRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[17]
+		mi := &file_stat_proto_msgTypes[18]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1163,7 +1464,7 @@ func (x *GetStatValueRequest) String() string {
 func (*GetStatValueRequest) ProtoMessage() {}
 
 func (x *GetStatValueRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[17]
+	mi := &file_stat_proto_msgTypes[18]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1176,7 +1477,7 @@ func (x *GetStatValueRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetStatValueRequest.ProtoReflect.Descriptor instead.
 func (*GetStatValueRequest) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{17}
+	return file_stat_proto_rawDescGZIP(), []int{18}
 }
 
 func (x *GetStatValueRequest) GetPlace() string {
@@ -1239,7 +1540,7 @@ type GetStatValueResponse struct {
 func (x *GetStatValueResponse) Reset() {
 	*x = GetStatValueResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[18]
+		mi := &file_stat_proto_msgTypes[19]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1252,7 +1553,7 @@ func (x *GetStatValueResponse) String() string {
 func (*GetStatValueResponse) ProtoMessage() {}
 
 func (x *GetStatValueResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[18]
+	mi := &file_stat_proto_msgTypes[19]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1265,7 +1566,7 @@ func (x *GetStatValueResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetStatValueResponse.ProtoReflect.Descriptor instead.
 func (*GetStatValueResponse) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{18}
+	return file_stat_proto_rawDescGZIP(), []int{19}
 }
 
 func (x *GetStatValueResponse) GetValue() float64 {
@@ -1293,12 +1594,18 @@ type GetStatSeriesRequest struct {
 	Unit string `protobuf:"bytes,5,opt,name=unit,proto3" json:"unit,omitempty"`
 	// (optional) scaling factor of the observation.
 	ScalingFactor string `protobuf:"bytes,6,opt,name=scaling_factor,json=scalingFactor,proto3" json:"scaling_factor,omitempty"`
+	// (optional) how to resample and fill the series. The grid is not used for a
+	// single series.
+	Align *AlignOptions `protobuf:"bytes,7,opt,name=align,proto3" json:"align,omitempty"`
+	// (optional) transforms applied in order to the series. See
+	// GetStatSetSeriesRequest.
+	Transforms []string `protobuf:"bytes,8,rep,name=transforms,proto3" json:"transforms,omitempty"`
 }
 
 func (x *GetStatSeriesRequest) Reset() {
 	*x = GetStatSeriesRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[19]
+		mi := &file_stat_proto_msgTypes[20]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1311,7 +1618,7 @@ func (x *GetStatSeriesRequest) String() string {
 func (*GetStatSeriesRequest) ProtoMessage() {}
 
 func (x *GetStatSeriesRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[19]
+	mi := &file_stat_proto_msgTypes[20]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1324,7 +1631,7 @@ func (x *GetStatSeriesRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetStatSeriesRequest.ProtoReflect.Descriptor instead.
 func (*GetStatSeriesRequest) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{19}
+	return file_stat_proto_rawDescGZIP(), []int{20}
 }
 
 func (x *GetStatSeriesRequest) GetPlace() string {
@@ -1369,6 +1676,20 @@ func (x *GetStatSeriesRequest) GetScalingFactor() string {
 	return ""
 }
 
+func (x *GetStatSeriesRequest) GetAlign() *AlignOptions {
+	if x != nil {
+		return x.Align
+	}
+	return nil
+}
+
+func (x *GetStatSeriesRequest) GetTransforms() []string {
+	if x != nil {
+		return x.Transforms
+	}
+	return nil
+}
+
 // Response for GetStatSeries service.
 type GetStatSeriesResponse struct {
 	state         protoimpl.MessageState
@@ -1382,7 +1703,7 @@ type GetStatSeriesResponse struct {
 func (x *GetStatSeriesResponse) Reset() {
 	*x = GetStatSeriesResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[20]
+		mi := &file_stat_proto_msgTypes[21]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1395,7 +1716,7 @@ func (x *GetStatSeriesResponse) String() string {
 func (*GetStatSeriesResponse) ProtoMessage() {}
 
 func (x *GetStatSeriesResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[20]
+	mi := &file_stat_proto_msgTypes[21]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1408,7 +1729,7 @@ func (x *GetStatSeriesResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetStatSeriesResponse.ProtoReflect.Descriptor instead.
 func (*GetStatSeriesResponse) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{20}
+	return file_stat_proto_rawDescGZIP(), []int{21}
 }
 
 func (x *GetStatSeriesResponse) GetSeries() map[string]float64 {
@@ -1433,7 +1754,7 @@ type GetStatAllRequest struct {
 func (x *GetStatAllRequest) Reset() {
 	*x = GetStatAllRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[21]
+		mi := &file_stat_proto_msgTypes[22]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1446,7 +1767,7 @@ func (x *GetStatAllRequest) String() string {
 func (*GetStatAllRequest) ProtoMessage() {}
 
 func (x *GetStatAllRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[21]
+	mi := &file_stat_proto_msgTypes[22]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1459,7 +1780,7 @@ func (x *GetStatAllRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetStatAllRequest.ProtoReflect.Descriptor instead.
 func (*GetStatAllRequest) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{21}
+	return file_stat_proto_rawDescGZIP(), []int{22}
 }
 
 func (x *GetStatAllRequest) GetPlaces() []string {
@@ -1532,7 +1853,7 @@ type GetStatAllResponse struct {
 func (x *GetStatAllResponse) Reset() {
 	*x = GetStatAllResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[22]
+		mi := &file_stat_proto_msgTypes[23]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1545,7 +1866,7 @@ func (x *GetStatAllResponse) String() string {
 func (*GetStatAllResponse) ProtoMessage() {}
 
 func (x *GetStatAllResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[22]
+	mi := &file_stat_proto_msgTypes[23]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1558,7 +1879,7 @@ func (x *GetStatAllResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetStatAllResponse.ProtoReflect.Descriptor instead.
 func (*GetStatAllResponse) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{22}
+	return file_stat_proto_rawDescGZIP(), []int{23}
 }
 
 func (x *GetStatAllResponse) GetPlaceData() map[string]*PlaceStat {
@@ -1588,7 +1909,7 @@ type GetStatSetWithinPlaceRequest struct {
 func (x *GetStatSetWithinPlaceRequest) Reset() {
 	*x = GetStatSetWithinPlaceRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[23]
+		mi := &file_stat_proto_msgTypes[24]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1601,7 +1922,7 @@ func (x *GetStatSetWithinPlaceRequest) String() string {
 func (*GetStatSetWithinPlaceRequest) ProtoMessage() {}
 
 func (x *GetStatSetWithinPlaceRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[23]
+	mi := &file_stat_proto_msgTypes[24]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1614,7 +1935,7 @@ func (x *GetStatSetWithinPlaceRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetStatSetWithinPlaceRequest.ProtoReflect.Descriptor instead.
 func (*GetStatSetWithinPlaceRequest) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{23}
+	return file_stat_proto_rawDescGZIP(), []int{24}
 }
 
 func (x *GetStatSetWithinPlaceRequest) GetParentPlace() string {
@@ -1662,7 +1983,7 @@ type GetStatSetRequest struct {
 func (x *GetStatSetRequest) Reset() {
 	*x = GetStatSetRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[24]
+		mi := &file_stat_proto_msgTypes[25]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1675,7 +1996,7 @@ func (x *GetStatSetRequest) String() string {
 func (*GetStatSetRequest) ProtoMessage() {}
 
 func (x *GetStatSetRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[24]
+	mi := &file_stat_proto_msgTypes[25]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1688,7 +2009,7 @@ func (x *GetStatSetRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use GetStatSetRequest.ProtoReflect.Descriptor instead.
 func (*GetStatSetRequest) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{24}
+	return file_stat_proto_rawDescGZIP(), []int{25}
 }
 
 func (x *GetStatSetRequest) GetPlaces() []string {
@@ -1707,37 +2028,645 @@ func (x *GetStatSetRequest) GetStatVars() []string {
 
 func (x *GetStatSetRequest) GetDate() string {
 	if x != nil {
-		return x.Date
+		return x.Date
+	}
+	return ""
+}
+
+type GetStatSetResponse struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Keyed by statVar.
+	Data map[string]*PlacePointStat `protobuf:"bytes,1,rep,name=data,proto3" json:"data,omitempty" protobuf_key:"bytes,1,opt,name=key,proto3" protobuf_val:"bytes,2,opt,name=value,proto3"`
+}
+
+func (x *GetStatSetResponse) Reset() {
+	*x = GetStatSetResponse{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_stat_proto_msgTypes[26]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *GetStatSetResponse) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*GetStatSetResponse) ProtoMessage() {}
+
+func (x *GetStatSetResponse) ProtoReflect() protoreflect.Message {
+	mi := &file_stat_proto_msgTypes[26]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use GetStatSetResponse.ProtoReflect.Descriptor instead.
+func (*GetStatSetResponse) Descriptor() ([]byte, []int) {
+	return file_stat_proto_rawDescGZIP(), []int{26}
+}
+
+func (x *GetStatSetResponse) GetData() map[string]*PlacePointStat {
+	if x != nil {
+		return x.Data
+	}
+	return nil
+}
+
+type GetStatFormulaRequest struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Arithmetic expression over stat var DCIDs, with +, -, *, /, parentheses
+	// and numbers, ex: "Count_Person_Female / Count_Person". DCIDs with other
+	// characters than letters, digits, "_", "." and ":" are put in brackets, ex:
+	// "[dc/abc123] * 100".
+	Formula string `protobuf:"bytes,1,opt,name=formula,proto3" json:"formula,omitempty"`
+	// A list of place DCIDs.
+	Places []string `protobuf:"bytes,2,rep,name=places,proto3" json:"places,omitempty"`
+	// Instead of places, evaluate for the places of child_type contained in
+	// parent_place.
+	ParentPlace string `protobuf:"bytes,3,opt,name=parent_place,json=parentPlace,proto3" json:"parent_place,omitempty"`
+	ChildType   string `protobuf:"bytes,4,opt,name=child_type,json=childType,proto3" json:"child_type,omitempty"`
+	// (optional) date of the stat vars. If not specified, the latest date where
+	// all the stat vars have a value is used for each place.
+	Date string `protobuf:"bytes,5,opt,name=date,proto3" json:"date,omitempty"`
+}
+
+func (x *GetStatFormulaRequest) Reset() {
+	*x = GetStatFormulaRequest{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_stat_proto_msgTypes[27]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *GetStatFormulaRequest) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*GetStatFormulaRequest) ProtoMessage() {}
+
+func (x *GetStatFormulaRequest) ProtoReflect() protoreflect.Message {
+	mi := &file_stat_proto_msgTypes[27]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use GetStatFormulaRequest.ProtoReflect.Descriptor instead.
+func (*GetStatFormulaRequest) Descriptor() ([]byte, []int) {
+	return file_stat_proto_rawDescGZIP(), []int{27}
+}
+
+func (x *GetStatFormulaRequest) GetFormula() string {
+	if x != nil {
+		return x.Formula
+	}
+	return ""
+}
+
+func (x *GetStatFormulaRequest) GetPlaces() []string {
+	if x != nil {
+		return x.Places
+	}
+	return nil
+}
+
+func (x *GetStatFormulaRequest) GetParentPlace() string {
+	if x != nil {
+		return x.ParentPlace
+	}
+	return ""
+}
+
+func (x *GetStatFormulaRequest) GetChildType() string {
+	if x != nil {
+		return x.ChildType
+	}
+	return ""
+}
+
+func (x *GetStatFormulaRequest) GetDate() string {
+	if x != nil {
+		return x.Date
+	}
+	return ""
+}
+
+type GetStatFormulaResponse struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Keyed by place DCID. Places without a value for all the stat vars, or where
+	// the formula is not defined, are missing.
+	Data map[string]*PointStat `protobuf:"bytes,1,rep,name=data,proto3" json:"data,omitempty" protobuf_key:"bytes,1,opt,name=key,proto3" protobuf_val:"bytes,2,opt,name=value,proto3"`
+}
+
+func (x *GetStatFormulaResponse) Reset() {
+	*x = GetStatFormulaResponse{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_stat_proto_msgTypes[28]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *GetStatFormulaResponse) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*GetStatFormulaResponse) ProtoMessage() {}
+
+func (x *GetStatFormulaResponse) ProtoReflect() protoreflect.Message {
+	mi := &file_stat_proto_msgTypes[28]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use GetStatFormulaResponse.ProtoReflect.Descriptor instead.
+func (*GetStatFormulaResponse) Descriptor() ([]byte, []int) {
+	return file_stat_proto_rawDescGZIP(), []int{28}
+}
+
+func (x *GetStatFormulaResponse) GetData() map[string]*PointStat {
+	if x != nil {
+		return x.Data
+	}
+	return nil
+}
+
+type GetPlaceStatDateWithinPlaceRequest struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	AncestorPlace string   `protobuf:"bytes,1,opt,name=ancestor_place,json=ancestorPlace,proto3" json:"ancestor_place,omitempty"`
+	PlaceType     string   `protobuf:"bytes,2,opt,name=place_type,json=placeType,proto3" json:"place_type,omitempty"`
+	StatVars      []string `protobuf:"bytes,3,rep,name=stat_vars,json=statVars,proto3" json:"stat_vars,omitempty"`
+}
+
+func (x *GetPlaceStatDateWithinPlaceRequest) Reset() {
+	*x = GetPlaceStatDateWithinPlaceRequest{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_stat_proto_msgTypes[29]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *GetPlaceStatDateWithinPlaceRequest) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*GetPlaceStatDateWithinPlaceRequest) ProtoMessage() {}
+
+func (x *GetPlaceStatDateWithinPlaceRequest) ProtoReflect() protoreflect.Message {
+	mi := &file_stat_proto_msgTypes[29]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use GetPlaceStatDateWithinPlaceRequest.ProtoReflect.Descriptor instead.
+func (*GetPlaceStatDateWithinPlaceRequest) Descriptor() ([]byte, []int) {
+	return file_stat_proto_rawDescGZIP(), []int{29}
+}
+
+func (x *GetPlaceStatDateWithinPlaceRequest) GetAncestorPlace() string {
+	if x != nil {
+		return x.AncestorPlace
+	}
+	return ""
+}
+
+func (x *GetPlaceStatDateWithinPlaceRequest) GetPlaceType() string {
+	if x != nil {
+		return x.PlaceType
+	}
+	return ""
+}
+
+func (x *GetPlaceStatDateWithinPlaceRequest) GetStatVars() []string {
+	if x != nil {
+		return x.StatVars
+	}
+	return nil
+}
+
+type GetPlaceStatDateWithinPlaceResponse struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Keyed by statVar.
+	Data map[string]*DateList `protobuf:"bytes,1,rep,name=data,proto3" json:"data,omitempty" protobuf_key:"bytes,1,opt,name=key,proto3" protobuf_val:"bytes,2,opt,name=value,proto3"`
+}
+
+func (x *GetPlaceStatDateWithinPlaceResponse) Reset() {
+	*x = GetPlaceStatDateWithinPlaceResponse{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_stat_proto_msgTypes[30]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *GetPlaceStatDateWithinPlaceResponse) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*GetPlaceStatDateWithinPlaceResponse) ProtoMessage() {}
+
+func (x *GetPlaceStatDateWithinPlaceResponse) ProtoReflect() protoreflect.Message {
+	mi := &file_stat_proto_msgTypes[30]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use GetPlaceStatDateWithinPlaceResponse.ProtoReflect.Descriptor instead.
+func (*GetPlaceStatDateWithinPlaceResponse) Descriptor() ([]byte, []int) {
+	return file_stat_proto_rawDescGZIP(), []int{30}
+}
+
+func (x *GetPlaceStatDateWithinPlaceResponse) GetData() map[string]*DateList {
+	if x != nil {
+		return x.Data
+	}
+	return nil
+}
+
+type ExportStatRequest struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// A list of statistical variable DCIDs.
+	StatVars []string `protobuf:"bytes,1,rep,name=stat_vars,json=statVars,proto3" json:"stat_vars,omitempty"`
+	// A list of place DCIDs.
+	Places []string `protobuf:"bytes,2,rep,name=places,proto3" json:"places,omitempty"`
+	// Instead of places, export the places of child_type contained in
+	// parent_place.
+	ParentPlace string `protobuf:"bytes,3,opt,name=parent_place,json=parentPlace,proto3" json:"parent_place,omitempty"`
+	ChildType   string `protobuf:"bytes,4,opt,name=child_type,json=childType,proto3" json:"child_type,omitempty"`
+	// (Optional) maximum number of observations per batch.
+	BatchSize int32 `protobuf:"varint,5,opt,name=batch_size,json=batchSize,proto3" json:"batch_size,omitempty"`
+	// (Optional) the cursor of the last received batch, to resume an export.
+	Cursor string `protobuf:"bytes,6,opt,name=cursor,proto3" json:"cursor,omitempty"`
+	// (Optional) only export the preferred source of each series.
+	BestSource bool `protobuf:"varint,7,opt,name=best_source,json=bestSource,proto3" json:"best_source,omitempty"`
+}
+
+func (x *ExportStatRequest) Reset() {
+	*x = ExportStatRequest{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_stat_proto_msgTypes[31]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *ExportStatRequest) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*ExportStatRequest) ProtoMessage() {}
+
+func (x *ExportStatRequest) ProtoReflect() protoreflect.Message {
+	mi := &file_stat_proto_msgTypes[31]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use ExportStatRequest.ProtoReflect.Descriptor instead.
+func (*ExportStatRequest) Descriptor() ([]byte, []int) {
+	return file_stat_proto_rawDescGZIP(), []int{31}
+}
+
+func (x *ExportStatRequest) GetStatVars() []string {
+	if x != nil {
+		return x.StatVars
+	}
+	return nil
+}
+
+func (x *ExportStatRequest) GetPlaces() []string {
+	if x != nil {
+		return x.Places
+	}
+	return nil
+}
+
+func (x *ExportStatRequest) GetParentPlace() string {
+	if x != nil {
+		return x.ParentPlace
+	}
+	return ""
+}
+
+func (x *ExportStatRequest) GetChildType() string {
+	if x != nil {
+		return x.ChildType
+	}
+	return ""
+}
+
+func (x *ExportStatRequest) GetBatchSize() int32 {
+	if x != nil {
+		return x.BatchSize
+	}
+	return 0
+}
+
+func (x *ExportStatRequest) GetCursor() string {
+	if x != nil {
+		return x.Cursor
+	}
+	return ""
+}
+
+func (x *ExportStatRequest) GetBestSource() bool {
+	if x != nil {
+		return x.BestSource
+	}
+	return false
+}
+
+// A batch of observations in a columnar layout. The columns have one entry per
+// observation.
+//
+// Places, dates and sources are dictionary encoded: their columns hold indexes
+// into dictionaries that span the whole stream. Each batch only holds the new
+// dictionary entries, which are appended to the ones of the previous batches.
+type ExportStatBatch struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	PlaceDictionary  []string        `protobuf:"bytes,1,rep,name=place_dictionary,json=placeDictionary,proto3" json:"place_dictionary,omitempty"`
+	DateDictionary   []string        `protobuf:"bytes,2,rep,name=date_dictionary,json=dateDictionary,proto3" json:"date_dictionary,omitempty"`
+	SourceDictionary []*StatMetadata `protobuf:"bytes,3,rep,name=source_dictionary,json=sourceDictionary,proto3" json:"source_dictionary,omitempty"`
+	// Index of the stat var in the request.
+	StatVar []int32   `protobuf:"varint,4,rep,packed,name=stat_var,json=statVar,proto3" json:"stat_var,omitempty"`
+	Place   []int32   `protobuf:"varint,5,rep,packed,name=place,proto3" json:"place,omitempty"`
+	Date    []int32   `protobuf:"varint,6,rep,packed,name=date,proto3" json:"date,omitempty"`
+	Value   []float64 `protobuf:"fixed64,7,rep,packed,name=value,proto3" json:"value,omitempty"`
+	Source  []int32   `protobuf:"varint,8,rep,packed,name=source,proto3" json:"source,omitempty"`
+	// Resumes the export after this batch.
+	Cursor string `protobuf:"bytes,9,opt,name=cursor,proto3" json:"cursor,omitempty"`
+}
+
+func (x *ExportStatBatch) Reset() {
+	*x = ExportStatBatch{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_stat_proto_msgTypes[32]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *ExportStatBatch) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*ExportStatBatch) ProtoMessage() {}
+
+func (x *ExportStatBatch) ProtoReflect() protoreflect.Message {
+	mi := &file_stat_proto_msgTypes[32]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use ExportStatBatch.ProtoReflect.Descriptor instead.
+func (*ExportStatBatch) Descriptor() ([]byte, []int) {
+	return file_stat_proto_rawDescGZIP(), []int{32}
+}
+
+func (x *ExportStatBatch) GetPlaceDictionary() []string {
+	if x != nil {
+		return x.PlaceDictionary
+	}
+	return nil
+}
+
+func (x *ExportStatBatch) GetDateDictionary() []string {
+	if x != nil {
+		return x.DateDictionary
+	}
+	return nil
+}
+
+func (x *ExportStatBatch) GetSourceDictionary() []*StatMetadata {
+	if x != nil {
+		return x.SourceDictionary
+	}
+	return nil
+}
+
+func (x *ExportStatBatch) GetStatVar() []int32 {
+	if x != nil {
+		return x.StatVar
+	}
+	return nil
+}
+
+func (x *ExportStatBatch) GetPlace() []int32 {
+	if x != nil {
+		return x.Place
+	}
+	return nil
+}
+
+func (x *ExportStatBatch) GetDate() []int32 {
+	if x != nil {
+		return x.Date
+	}
+	return nil
+}
+
+func (x *ExportStatBatch) GetValue() []float64 {
+	if x != nil {
+		return x.Value
+	}
+	return nil
+}
+
+func (x *ExportStatBatch) GetSource() []int32 {
+	if x != nil {
+		return x.Source
+	}
+	return nil
+}
+
+func (x *ExportStatBatch) GetCursor() string {
+	if x != nil {
+		return x.Cursor
+	}
+	return ""
+}
+
+// The best series of a stat var for the child places of a parent place, as a
+// place by date matrix. This is also the content of the
+// d/s/<parent place>^<child type>^<stat var> cache rows.
+type SeriesMatrix struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// The child places with data.
+	Places []string `protobuf:"bytes,1,rep,name=places,proto3" json:"places,omitempty"`
+	// The dates of all the places, sorted.
+	Dates []string `protobuf:"bytes,2,rep,name=dates,proto3" json:"dates,omitempty"`
+	// The values, row by row: the value of places[i] at dates[j] is at
+	// i * len(dates) + j. NaN when the place has no value for the date.
+	Values []float64 `protobuf:"fixed64,3,rep,packed,name=values,proto3" json:"values,omitempty"`
+	// For each place, the index of the source of its series in metadata.
+	Source   []int32         `protobuf:"varint,4,rep,packed,name=source,proto3" json:"source,omitempty"`
+	Metadata []*StatMetadata `protobuf:"bytes,5,rep,name=metadata,proto3" json:"metadata,omitempty"`
+}
+
+func (x *SeriesMatrix) Reset() {
+	*x = SeriesMatrix{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_stat_proto_msgTypes[33]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *SeriesMatrix) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*SeriesMatrix) ProtoMessage() {}
+
+func (x *SeriesMatrix) ProtoReflect() protoreflect.Message {
+	mi := &file_stat_proto_msgTypes[33]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use SeriesMatrix.ProtoReflect.Descriptor instead.
+func (*SeriesMatrix) Descriptor() ([]byte, []int) {
+	return file_stat_proto_rawDescGZIP(), []int{33}
+}
+
+func (x *SeriesMatrix) GetPlaces() []string {
+	if x != nil {
+		return x.Places
+	}
+	return nil
+}
+
+func (x *SeriesMatrix) GetDates() []string {
+	if x != nil {
+		return x.Dates
+	}
+	return nil
+}
+
+func (x *SeriesMatrix) GetValues() []float64 {
+	if x != nil {
+		return x.Values
+	}
+	return nil
+}
+
+func (x *SeriesMatrix) GetSource() []int32 {
+	if x != nil {
+		return x.Source
+	}
+	return nil
+}
+
+func (x *SeriesMatrix) GetMetadata() []*StatMetadata {
+	if x != nil {
+		return x.Metadata
 	}
-	return ""
+	return nil
 }
 
-type GetStatSetResponse struct {
+type GetStatSeriesWithinPlaceRequest struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
 	unknownFields protoimpl.UnknownFields
 
-	// Keyed by statVar.
-	Data map[string]*PlacePointStat `protobuf:"bytes,1,rep,name=data,proto3" json:"data,omitempty" protobuf_key:"bytes,1,opt,name=key,proto3" protobuf_val:"bytes,2,opt,name=value,proto3"`
+	// The parent place DCID.
+	ParentPlace string `protobuf:"bytes,1,opt,name=parent_place,json=parentPlace,proto3" json:"parent_place,omitempty"`
+	// The type of the child places.
+	ChildType string `protobuf:"bytes,2,opt,name=child_type,json=childType,proto3" json:"child_type,omitempty"`
+	// A list of statistical variable DCIDs.
+	StatVars []string `protobuf:"bytes,3,rep,name=stat_vars,json=statVars,proto3" json:"stat_vars,omitempty"`
 }
 
-func (x *GetStatSetResponse) Reset() {
-	*x = GetStatSetResponse{}
+func (x *GetStatSeriesWithinPlaceRequest) Reset() {
+	*x = GetStatSeriesWithinPlaceRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[25]
+		mi := &file_stat_proto_msgTypes[34]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
 }
 
-func (x *GetStatSetResponse) String() string {
+func (x *GetStatSeriesWithinPlaceRequest) String() string {
 	return protoimpl.X.MessageStringOf(x)
 }
 
-func (*GetStatSetResponse) ProtoMessage() {}
+func (*GetStatSeriesWithinPlaceRequest) ProtoMessage() {}
 
-func (x *GetStatSetResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[25]
+func (x *GetStatSeriesWithinPlaceRequest) ProtoReflect() protoreflect.Message {
+	mi := &file_stat_proto_msgTypes[34]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1748,45 +2677,58 @@ func (x *GetStatSetResponse) ProtoReflect() protoreflect.Message {
 	return mi.MessageOf(x)
 }
 
-// Deprecated: Use GetStatSetResponse.ProtoReflect.Descriptor instead.
-func (*GetStatSetResponse) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{25}
+// Deprecated: Use GetStatSeriesWithinPlaceRequest.ProtoReflect.Descriptor instead.
+func (*GetStatSeriesWithinPlaceRequest) Descriptor() ([]byte, []int) {
+	return file_stat_proto_rawDescGZIP(), []int{34}
 }
 
-func (x *GetStatSetResponse) GetData() map[string]*PlacePointStat {
+func (x *GetStatSeriesWithinPlaceRequest) GetParentPlace() string {
 	if x != nil {
-		return x.Data
+		return x.ParentPlace
+	}
+	return ""
+}
+
+func (x *GetStatSeriesWithinPlaceRequest) GetChildType() string {
+	if x != nil {
+		return x.ChildType
+	}
+	return ""
+}
+
+func (x *GetStatSeriesWithinPlaceRequest) GetStatVars() []string {
+	if x != nil {
+		return x.StatVars
 	}
 	return nil
 }
 
-type GetPlaceStatDateWithinPlaceRequest struct {
+type GetStatSeriesWithinPlaceResponse struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
 	unknownFields protoimpl.UnknownFields
 
-	AncestorPlace string   `protobuf:"bytes,1,opt,name=ancestor_place,json=ancestorPlace,proto3" json:"ancestor_place,omitempty"`
-	PlaceType     string   `protobuf:"bytes,2,opt,name=place_type,json=placeType,proto3" json:"place_type,omitempty"`
-	StatVars      []string `protobuf:"bytes,3,rep,name=stat_vars,json=statVars,proto3" json:"stat_vars,omitempty"`
+	// Keyed by stat var DCID.
+	Data map[string]*SeriesMatrix `protobuf:"bytes,1,rep,name=data,proto3" json:"data,omitempty" protobuf_key:"bytes,1,opt,name=key,proto3" protobuf_val:"bytes,2,opt,name=value,proto3"`
 }
 
-func (x *GetPlaceStatDateWithinPlaceRequest) Reset() {
-	*x = GetPlaceStatDateWithinPlaceRequest{}
+func (x *GetStatSeriesWithinPlaceResponse) Reset() {
+	*x = GetStatSeriesWithinPlaceResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[26]
+		mi := &file_stat_proto_msgTypes[35]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
 }
 
-func (x *GetPlaceStatDateWithinPlaceRequest) String() string {
+func (x *GetStatSeriesWithinPlaceResponse) String() string {
 	return protoimpl.X.MessageStringOf(x)
 }
 
-func (*GetPlaceStatDateWithinPlaceRequest) ProtoMessage() {}
+func (*GetStatSeriesWithinPlaceResponse) ProtoMessage() {}
 
-func (x *GetPlaceStatDateWithinPlaceRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[26]
+func (x *GetStatSeriesWithinPlaceResponse) ProtoReflect() protoreflect.Message {
+	mi := &file_stat_proto_msgTypes[35]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1797,58 +2739,51 @@ func (x *GetPlaceStatDateWithinPlaceRequest) ProtoReflect() protoreflect.Message
 	return mi.MessageOf(x)
 }
 
-// Deprecated: Use GetPlaceStatDateWithinPlaceRequest.ProtoReflect.Descriptor instead.
-func (*GetPlaceStatDateWithinPlaceRequest) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{26}
-}
-
-func (x *GetPlaceStatDateWithinPlaceRequest) GetAncestorPlace() string {
-	if x != nil {
-		return x.AncestorPlace
-	}
-	return ""
-}
-
-func (x *GetPlaceStatDateWithinPlaceRequest) GetPlaceType() string {
-	if x != nil {
-		return x.PlaceType
-	}
-	return ""
+// Deprecated: Use GetStatSeriesWithinPlaceResponse.ProtoReflect.Descriptor instead.
+func (*GetStatSeriesWithinPlaceResponse) Descriptor() ([]byte, []int) {
+	return file_stat_proto_rawDescGZIP(), []int{35}
 }
 
-func (x *GetPlaceStatDateWithinPlaceRequest) GetStatVars() []string {
+func (x *GetStatSeriesWithinPlaceResponse) GetData() map[string]*SeriesMatrix {
 	if x != nil {
-		return x.StatVars
+		return x.Data
 	}
 	return nil
 }
 
-type GetPlaceStatDateWithinPlaceResponse struct {
+type ScanPlaceStatRequest struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
 	unknownFields protoimpl.UnknownFields
 
-	// Keyed by statVar.
-	Data map[string]*DateList `protobuf:"bytes,1,rep,name=data,proto3" json:"data,omitempty" protobuf_key:"bytes,1,opt,name=key,proto3" protobuf_val:"bytes,2,opt,name=value,proto3"`
+	// The place DCID.
+	Place string `protobuf:"bytes,1,opt,name=place,proto3" json:"place,omitempty"`
+	// (Optional) only these stat vars. All the stat vars of the place by
+	// default.
+	StatVars []string `protobuf:"bytes,2,rep,name=stat_vars,json=statVars,proto3" json:"stat_vars,omitempty"`
+	// (Optional) only the preferred source of each series.
+	BestSource bool `protobuf:"varint,3,opt,name=best_source,json=bestSource,proto3" json:"best_source,omitempty"`
+	// (Optional) maximum number of stat vars per batch.
+	BatchSize int32 `protobuf:"varint,4,opt,name=batch_size,json=batchSize,proto3" json:"batch_size,omitempty"`
 }
 
-func (x *GetPlaceStatDateWithinPlaceResponse) Reset() {
-	*x = GetPlaceStatDateWithinPlaceResponse{}
+func (x *ScanPlaceStatRequest) Reset() {
+	*x = ScanPlaceStatRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_stat_proto_msgTypes[27]
+		mi := &file_stat_proto_msgTypes[36]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
 }
 
-func (x *GetPlaceStatDateWithinPlaceResponse) String() string {
+func (x *ScanPlaceStatRequest) String() string {
 	return protoimpl.X.MessageStringOf(x)
 }
 
-func (*GetPlaceStatDateWithinPlaceResponse) ProtoMessage() {}
+func (*ScanPlaceStatRequest) ProtoMessage() {}
 
-func (x *GetPlaceStatDateWithinPlaceResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_stat_proto_msgTypes[27]
+func (x *ScanPlaceStatRequest) ProtoReflect() protoreflect.Message {
+	mi := &file_stat_proto_msgTypes[36]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1859,18 +2794,39 @@ func (x *GetPlaceStatDateWithinPlaceResponse) ProtoReflect() protoreflect.Messag
 	return mi.MessageOf(x)
 }
 
-// Deprecated: Use GetPlaceStatDateWithinPlaceResponse.ProtoReflect.Descriptor instead.
-func (*GetPlaceStatDateWithinPlaceResponse) Descriptor() ([]byte, []int) {
-	return file_stat_proto_rawDescGZIP(), []int{27}
+// Deprecated: Use ScanPlaceStatRequest.ProtoReflect.Descriptor instead.
+func (*ScanPlaceStatRequest) Descriptor() ([]byte, []int) {
+	return file_stat_proto_rawDescGZIP(), []int{36}
 }
 
-func (x *GetPlaceStatDateWithinPlaceResponse) GetData() map[string]*DateList {
+func (x *ScanPlaceStatRequest) GetPlace() string {
 	if x != nil {
-		return x.Data
+		return x.Place
+	}
+	return ""
+}
+
+func (x *ScanPlaceStatRequest) GetStatVars() []string {
+	if x != nil {
+		return x.StatVars
 	}
 	return nil
 }
 
+func (x *ScanPlaceStatRequest) GetBestSource() bool {
+	if x != nil {
+		return x.BestSource
+	}
+	return false
+}
+
+func (x *ScanPlaceStatRequest) GetBatchSize() int32 {
+	if x != nil {
+		return x.BatchSize
+	}
+	return 0
+}
+
 var File_stat_proto protoreflect.FileDescriptor
 
 var file_stat_proto_rawDesc = []byte{
@@ -1957,174 +2913,329 @@ var file_stat_proto_rawDesc = []byte{
 	0x1a, 0x36, 0x0a, 0x08, 0x56, 0x61, 0x6c, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03,
 	0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x14,
 	0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x01, 0x52, 0x05, 0x76,
-	0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0x8f, 0x01, 0x0a, 0x09, 0x53, 0x65, 0x72,
-	0x69, 0x65, 0x73, 0x4d, 0x61, 0x70, 0x12, 0x34, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x61, 0x18, 0x01,
-	0x20, 0x03, 0x28, 0x0b, 0x32, 0x20, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
-	0x6e, 0x73, 0x2e, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x4d, 0x61, 0x70, 0x2e, 0x44, 0x61, 0x74,
-	0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x04, 0x64, 0x61, 0x74, 0x61, 0x1a, 0x4c, 0x0a, 0x09,
-	0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79,
-	0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x29, 0x0a, 0x05, 0x76,
-	0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x13, 0x2e, 0x64, 0x61, 0x74,
-	0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52,
-	0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0xd4, 0x02, 0x0a, 0x0d, 0x4f,
-	0x62, 0x73, 0x54, 0x69, 0x6d, 0x65, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x12, 0x38, 0x0a, 0x04,
-	0x64, 0x61, 0x74, 0x61, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x24, 0x2e, 0x64, 0x61, 0x74,
-	0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x4f, 0x62, 0x73, 0x54, 0x69, 0x6d, 0x65,
-	0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x2e, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79,
-	0x52, 0x04, 0x64, 0x61, 0x74, 0x61, 0x12, 0x1d, 0x0a, 0x0a, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x5f,
-	0x6e, 0x61, 0x6d, 0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x09, 0x70, 0x6c, 0x61, 0x63,
-	0x65, 0x4e, 0x61, 0x6d, 0x65, 0x12, 0x1d, 0x0a, 0x0a, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x5f, 0x64,
-	0x63, 0x69, 0x64, 0x18, 0x05, 0x20, 0x01, 0x28, 0x09, 0x52, 0x09, 0x70, 0x6c, 0x61, 0x63, 0x65,
-	0x44, 0x63, 0x69, 0x64, 0x12, 0x3e, 0x0a, 0x0d, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73,
-	0x65, 0x72, 0x69, 0x65, 0x73, 0x18, 0x06, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x19, 0x2e, 0x64, 0x61,
-	0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65,
-	0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x0c, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x53, 0x65,
-	0x72, 0x69, 0x65, 0x73, 0x12, 0x2b, 0x0a, 0x11, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e,
-	0x63, 0x65, 0x5f, 0x64, 0x6f, 0x6d, 0x61, 0x69, 0x6e, 0x18, 0x07, 0x20, 0x01, 0x28, 0x09, 0x52,
-	0x10, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x44, 0x6f, 0x6d, 0x61, 0x69,
-	0x6e, 0x12, 0x25, 0x0a, 0x0e, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x5f,
-	0x75, 0x72, 0x6c, 0x18, 0x08, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0d, 0x70, 0x72, 0x6f, 0x76, 0x65,
-	0x6e, 0x61, 0x6e, 0x63, 0x65, 0x55, 0x72, 0x6c, 0x1a, 0x37, 0x0a, 0x09, 0x44, 0x61, 0x74, 0x61,
-	0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01,
-	0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x14, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65,
-	0x18, 0x02, 0x20, 0x01, 0x28, 0x01, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38,
-	0x01, 0x22, 0x51, 0x0a, 0x0d, 0x4f, 0x62, 0x73, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69,
-	0x6f, 0x6e, 0x12, 0x40, 0x0a, 0x0e, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x6f, 0x68,
-	0x6f, 0x72, 0x74, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x19, 0x2e, 0x64, 0x61, 0x74,
-	0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x53,
-	0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x0d, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x43, 0x6f, 0x68,
-	0x6f, 0x72, 0x74, 0x73, 0x22, 0x9e, 0x01, 0x0a, 0x0a, 0x43, 0x68, 0x61, 0x72, 0x74, 0x53, 0x74,
-	0x6f, 0x72, 0x65, 0x12, 0x44, 0x0a, 0x0f, 0x6f, 0x62, 0x73, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x5f,
-	0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1a, 0x2e, 0x64,
-	0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x4f, 0x62, 0x73, 0x54, 0x69,
-	0x6d, 0x65, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x48, 0x00, 0x52, 0x0d, 0x6f, 0x62, 0x73, 0x54,
-	0x69, 0x6d, 0x65, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x12, 0x43, 0x0a, 0x0e, 0x6f, 0x62, 0x73,
-	0x5f, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x18, 0x02, 0x20, 0x01, 0x28,
-	0x0b, 0x32, 0x1a, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e,
-	0x4f, 0x62, 0x73, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x48, 0x00, 0x52,
-	0x0d, 0x6f, 0x62, 0x73, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x42, 0x05,
-	0x0a, 0x03, 0x76, 0x61, 0x6c, 0x22, 0xb4, 0x01, 0x0a, 0x09, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x53,
-	0x74, 0x61, 0x74, 0x12, 0x4b, 0x0a, 0x0d, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x5f,
-	0x64, 0x61, 0x74, 0x61, 0x18, 0x03, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x27, 0x2e, 0x64, 0x61, 0x74,
-	0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74,
-	0x61, 0x74, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e,
-	0x74, 0x72, 0x79, 0x52, 0x0b, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x44, 0x61, 0x74, 0x61,
-	0x1a, 0x5a, 0x0a, 0x10, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x44, 0x61, 0x74, 0x61, 0x45,
-	0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28,
-	0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x30, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18,
-	0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1a, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d,
-	0x6f, 0x6e, 0x73, 0x2e, 0x4f, 0x62, 0x73, 0x54, 0x69, 0x6d, 0x65, 0x53, 0x65, 0x72, 0x69, 0x65,
-	0x73, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0xa4, 0x01, 0x0a,
-	0x10, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x4f, 0x62, 0x73, 0x53, 0x65, 0x72, 0x69, 0x65,
-	0x73, 0x12, 0x3b, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x61, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32,
-	0x27, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74,
-	0x61, 0x74, 0x56, 0x61, 0x72, 0x4f, 0x62, 0x73, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x2e, 0x44,
-	0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x04, 0x64, 0x61, 0x74, 0x61, 0x1a, 0x53,
-	0x0a, 0x09, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b,
-	0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x30, 0x0a,
-	0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1a, 0x2e, 0x64,
-	0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x4f, 0x62, 0x73, 0x54, 0x69,
-	0x6d, 0x65, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a,
-	0x02, 0x38, 0x01, 0x22, 0x97, 0x01, 0x0a, 0x0d, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53,
-	0x65, 0x72, 0x69, 0x65, 0x73, 0x12, 0x38, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x61, 0x18, 0x01, 0x20,
-	0x03, 0x28, 0x0b, 0x32, 0x24, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e,
-	0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x2e,
+	0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0x80, 0x04, 0x0a, 0x0c, 0x41, 0x6c, 0x69,
+	0x67, 0x6e, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x12, 0x38, 0x0a, 0x06, 0x70, 0x65, 0x72,
+	0x69, 0x6f, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0e, 0x32, 0x20, 0x2e, 0x64, 0x61, 0x74, 0x61,
+	0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x4f, 0x70, 0x74,
+	0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x50, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x52, 0x06, 0x70, 0x65, 0x72,
+	0x69, 0x6f, 0x64, 0x12, 0x47, 0x0a, 0x0b, 0x61, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x69,
+	0x6f, 0x6e, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0e, 0x32, 0x25, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63,
+	0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x4f, 0x70, 0x74, 0x69,
+	0x6f, 0x6e, 0x73, 0x2e, 0x41, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x52,
+	0x0b, 0x61, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x12, 0x32, 0x0a, 0x04,
+	0x67, 0x72, 0x69, 0x64, 0x18, 0x03, 0x20, 0x01, 0x28, 0x0e, 0x32, 0x1e, 0x2e, 0x64, 0x61, 0x74,
+	0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x4f, 0x70,
+	0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x72, 0x69, 0x64, 0x52, 0x04, 0x67, 0x72, 0x69, 0x64,
+	0x12, 0x32, 0x0a, 0x04, 0x66, 0x69, 0x6c, 0x6c, 0x18, 0x04, 0x20, 0x01, 0x28, 0x0e, 0x32, 0x1e,
+	0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x41, 0x6c, 0x69,
+	0x67, 0x6e, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x46, 0x69, 0x6c, 0x6c, 0x52, 0x04,
+	0x66, 0x69, 0x6c, 0x6c, 0x22, 0x3c, 0x0a, 0x06, 0x50, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x12, 0x0f,
+	0x0a, 0x0b, 0x50, 0x45, 0x52, 0x49, 0x4f, 0x44, 0x5f, 0x4e, 0x4f, 0x4e, 0x45, 0x10, 0x00, 0x12,
+	0x0f, 0x0a, 0x0b, 0x50, 0x45, 0x52, 0x49, 0x4f, 0x44, 0x5f, 0x59, 0x45, 0x41, 0x52, 0x10, 0x01,
+	0x12, 0x10, 0x0a, 0x0c, 0x50, 0x45, 0x52, 0x49, 0x4f, 0x44, 0x5f, 0x4d, 0x4f, 0x4e, 0x54, 0x48,
+	0x10, 0x02, 0x22, 0x4e, 0x0a, 0x0b, 0x41, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x69, 0x6f,
+	0x6e, 0x12, 0x14, 0x0a, 0x10, 0x41, 0x47, 0x47, 0x52, 0x45, 0x47, 0x41, 0x54, 0x49, 0x4f, 0x4e,
+	0x5f, 0x4c, 0x41, 0x53, 0x54, 0x10, 0x00, 0x12, 0x14, 0x0a, 0x10, 0x41, 0x47, 0x47, 0x52, 0x45,
+	0x47, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x5f, 0x4d, 0x45, 0x41, 0x4e, 0x10, 0x01, 0x12, 0x13, 0x0a,
+	0x0f, 0x41, 0x47, 0x47, 0x52, 0x45, 0x47, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x5f, 0x53, 0x55, 0x4d,
+	0x10, 0x02, 0x22, 0x3c, 0x0a, 0x04, 0x47, 0x72, 0x69, 0x64, 0x12, 0x0d, 0x0a, 0x09, 0x47, 0x52,
+	0x49, 0x44, 0x5f, 0x4e, 0x4f, 0x4e, 0x45, 0x10, 0x00, 0x12, 0x15, 0x0a, 0x11, 0x47, 0x52, 0x49,
+	0x44, 0x5f, 0x49, 0x4e, 0x54, 0x45, 0x52, 0x53, 0x45, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x10, 0x01,
+	0x12, 0x0e, 0x0a, 0x0a, 0x47, 0x52, 0x49, 0x44, 0x5f, 0x55, 0x4e, 0x49, 0x4f, 0x4e, 0x10, 0x02,
+	0x22, 0x39, 0x0a, 0x04, 0x46, 0x69, 0x6c, 0x6c, 0x12, 0x0d, 0x0a, 0x09, 0x46, 0x49, 0x4c, 0x4c,
+	0x5f, 0x4e, 0x4f, 0x4e, 0x45, 0x10, 0x00, 0x12, 0x11, 0x0a, 0x0d, 0x46, 0x49, 0x4c, 0x4c, 0x5f,
+	0x50, 0x52, 0x45, 0x56, 0x49, 0x4f, 0x55, 0x53, 0x10, 0x01, 0x12, 0x0f, 0x0a, 0x0b, 0x46, 0x49,
+	0x4c, 0x4c, 0x5f, 0x4c, 0x49, 0x4e, 0x45, 0x41, 0x52, 0x10, 0x02, 0x22, 0x8f, 0x01, 0x0a, 0x09,
+	0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x4d, 0x61, 0x70, 0x12, 0x34, 0x0a, 0x04, 0x64, 0x61, 0x74,
+	0x61, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x20, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f,
+	0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x4d, 0x61, 0x70, 0x2e,
 	0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x04, 0x64, 0x61, 0x74, 0x61, 0x1a,
 	0x4c, 0x0a, 0x09, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03,
 	0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x29,
 	0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x13, 0x2e,
 	0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x65, 0x72, 0x69,
-	0x65, 0x73, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0xb6, 0x01,
-	0x0a, 0x0f, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x73, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73,
-	0x74, 0x12, 0x14, 0x0a, 0x05, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09,
-	0x52, 0x05, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x12, 0x1b, 0x0a, 0x09, 0x73, 0x74, 0x61, 0x74, 0x73,
-	0x5f, 0x76, 0x61, 0x72, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x73, 0x74, 0x61, 0x74,
-	0x73, 0x56, 0x61, 0x72, 0x12, 0x2d, 0x0a, 0x12, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x6d,
-	0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x18, 0x04, 0x20, 0x01, 0x28, 0x09,
-	0x52, 0x11, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x4d, 0x65, 0x74,
-	0x68, 0x6f, 0x64, 0x12, 0x12, 0x0a, 0x04, 0x75, 0x6e, 0x69, 0x74, 0x18, 0x05, 0x20, 0x01, 0x28,
-	0x09, 0x52, 0x04, 0x75, 0x6e, 0x69, 0x74, 0x12, 0x2d, 0x0a, 0x12, 0x6f, 0x62, 0x73, 0x65, 0x72,
-	0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x18, 0x06, 0x20,
-	0x01, 0x28, 0x09, 0x52, 0x11, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-	0x50, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x22, 0x2c, 0x0a, 0x10, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61,
-	0x74, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x18, 0x0a, 0x07, 0x70, 0x61,
-	0x79, 0x6c, 0x6f, 0x61, 0x64, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x07, 0x70, 0x61, 0x79,
-	0x6c, 0x6f, 0x61, 0x64, 0x22, 0x4e, 0x0a, 0x17, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53,
-	0x65, 0x74, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12,
-	0x16, 0x0a, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52,
-	0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x12, 0x1b, 0x0a, 0x09, 0x73, 0x74, 0x61, 0x74, 0x5f,
-	0x76, 0x61, 0x72, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x09, 0x52, 0x08, 0x73, 0x74, 0x61, 0x74,
-	0x56, 0x61, 0x72, 0x73, 0x22, 0xb0, 0x01, 0x0a, 0x18, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74,
-	0x53, 0x65, 0x74, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73,
-	0x65, 0x12, 0x43, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x61, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32,
-	0x2f, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65,
+	0x65, 0x73, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0xd4, 0x02,
+	0x0a, 0x0d, 0x4f, 0x62, 0x73, 0x54, 0x69, 0x6d, 0x65, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x12,
+	0x38, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x61, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x24, 0x2e,
+	0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x4f, 0x62, 0x73, 0x54,
+	0x69, 0x6d, 0x65, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x2e, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e,
+	0x74, 0x72, 0x79, 0x52, 0x04, 0x64, 0x61, 0x74, 0x61, 0x12, 0x1d, 0x0a, 0x0a, 0x70, 0x6c, 0x61,
+	0x63, 0x65, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x09, 0x70,
+	0x6c, 0x61, 0x63, 0x65, 0x4e, 0x61, 0x6d, 0x65, 0x12, 0x1d, 0x0a, 0x0a, 0x70, 0x6c, 0x61, 0x63,
+	0x65, 0x5f, 0x64, 0x63, 0x69, 0x64, 0x18, 0x05, 0x20, 0x01, 0x28, 0x09, 0x52, 0x09, 0x70, 0x6c,
+	0x61, 0x63, 0x65, 0x44, 0x63, 0x69, 0x64, 0x12, 0x3e, 0x0a, 0x0d, 0x73, 0x6f, 0x75, 0x72, 0x63,
+	0x65, 0x5f, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x18, 0x06, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x19,
+	0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x0c, 0x73, 0x6f, 0x75, 0x72, 0x63,
+	0x65, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x12, 0x2b, 0x0a, 0x11, 0x70, 0x72, 0x6f, 0x76, 0x65,
+	0x6e, 0x61, 0x6e, 0x63, 0x65, 0x5f, 0x64, 0x6f, 0x6d, 0x61, 0x69, 0x6e, 0x18, 0x07, 0x20, 0x01,
+	0x28, 0x09, 0x52, 0x10, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x44, 0x6f,
+	0x6d, 0x61, 0x69, 0x6e, 0x12, 0x25, 0x0a, 0x0e, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e,
+	0x63, 0x65, 0x5f, 0x75, 0x72, 0x6c, 0x18, 0x08, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0d, 0x70, 0x72,
+	0x6f, 0x76, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x55, 0x72, 0x6c, 0x1a, 0x37, 0x0a, 0x09, 0x44,
+	0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18,
+	0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x14, 0x0a, 0x05, 0x76, 0x61,
+	0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x01, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65,
+	0x3a, 0x02, 0x38, 0x01, 0x22, 0x51, 0x0a, 0x0d, 0x4f, 0x62, 0x73, 0x43, 0x6f, 0x6c, 0x6c, 0x65,
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x12, 0x40, 0x0a, 0x0e, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x63, 0x6f, 0x68, 0x6f, 0x72, 0x74, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x19, 0x2e,
+	0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x6f, 0x75, 0x72,
+	0x63, 0x65, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x0d, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+	0x43, 0x6f, 0x68, 0x6f, 0x72, 0x74, 0x73, 0x22, 0x9e, 0x01, 0x0a, 0x0a, 0x43, 0x68, 0x61, 0x72,
+	0x74, 0x53, 0x74, 0x6f, 0x72, 0x65, 0x12, 0x44, 0x0a, 0x0f, 0x6f, 0x62, 0x73, 0x5f, 0x74, 0x69,
+	0x6d, 0x65, 0x5f, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32,
+	0x1a, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x4f, 0x62,
+	0x73, 0x54, 0x69, 0x6d, 0x65, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x48, 0x00, 0x52, 0x0d, 0x6f,
+	0x62, 0x73, 0x54, 0x69, 0x6d, 0x65, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x12, 0x43, 0x0a, 0x0e,
+	0x6f, 0x62, 0x73, 0x5f, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x18, 0x02,
+	0x20, 0x01, 0x28, 0x0b, 0x32, 0x1a, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
+	0x6e, 0x73, 0x2e, 0x4f, 0x62, 0x73, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+	0x48, 0x00, 0x52, 0x0d, 0x6f, 0x62, 0x73, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f,
+	0x6e, 0x42, 0x05, 0x0a, 0x03, 0x76, 0x61, 0x6c, 0x22, 0xb4, 0x01, 0x0a, 0x09, 0x50, 0x6c, 0x61,
+	0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x12, 0x4b, 0x0a, 0x0d, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76,
+	0x61, 0x72, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x18, 0x03, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x27, 0x2e,
+	0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x50, 0x6c, 0x61, 0x63,
+	0x65, 0x53, 0x74, 0x61, 0x74, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x44, 0x61, 0x74,
+	0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x0b, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x44,
+	0x61, 0x74, 0x61, 0x1a, 0x5a, 0x0a, 0x10, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x44, 0x61,
+	0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01,
+	0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x30, 0x0a, 0x05, 0x76, 0x61, 0x6c,
+	0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1a, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63,
+	0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x4f, 0x62, 0x73, 0x54, 0x69, 0x6d, 0x65, 0x53, 0x65,
+	0x72, 0x69, 0x65, 0x73, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22,
+	0xa4, 0x01, 0x0a, 0x10, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x4f, 0x62, 0x73, 0x53, 0x65,
+	0x72, 0x69, 0x65, 0x73, 0x12, 0x3b, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x61, 0x18, 0x01, 0x20, 0x03,
+	0x28, 0x0b, 0x32, 0x27, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73,
+	0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x4f, 0x62, 0x73, 0x53, 0x65, 0x72, 0x69, 0x65,
+	0x73, 0x2e, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x04, 0x64, 0x61, 0x74,
+	0x61, 0x1a, 0x53, 0x0a, 0x09, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10,
+	0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79,
+	0x12, 0x30, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32,
+	0x1a, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x4f, 0x62,
+	0x73, 0x54, 0x69, 0x6d, 0x65, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x05, 0x76, 0x61, 0x6c,
+	0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0x97, 0x01, 0x0a, 0x0d, 0x53, 0x74, 0x61, 0x74, 0x56,
+	0x61, 0x72, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x12, 0x38, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x61,
+	0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x24, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d,
+	0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x53, 0x65, 0x72, 0x69,
+	0x65, 0x73, 0x2e, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x04, 0x64, 0x61,
+	0x74, 0x61, 0x1a, 0x4c, 0x0a, 0x09, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12,
+	0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65,
+	0x79, 0x12, 0x29, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b,
+	0x32, 0x13, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53,
+	0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01,
+	0x22, 0xb6, 0x01, 0x0a, 0x0f, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x73, 0x52, 0x65, 0x71,
+	0x75, 0x65, 0x73, 0x74, 0x12, 0x14, 0x0a, 0x05, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x18, 0x01, 0x20,
+	0x03, 0x28, 0x09, 0x52, 0x05, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x12, 0x1b, 0x0a, 0x09, 0x73, 0x74,
+	0x61, 0x74, 0x73, 0x5f, 0x76, 0x61, 0x72, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x73,
+	0x74, 0x61, 0x74, 0x73, 0x56, 0x61, 0x72, 0x12, 0x2d, 0x0a, 0x12, 0x6d, 0x65, 0x61, 0x73, 0x75,
+	0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x18, 0x04, 0x20,
+	0x01, 0x28, 0x09, 0x52, 0x11, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+	0x4d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x12, 0x12, 0x0a, 0x04, 0x75, 0x6e, 0x69, 0x74, 0x18, 0x05,
+	0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x75, 0x6e, 0x69, 0x74, 0x12, 0x2d, 0x0a, 0x12, 0x6f, 0x62,
+	0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64,
+	0x18, 0x06, 0x20, 0x01, 0x28, 0x09, 0x52, 0x11, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74,
+	0x69, 0x6f, 0x6e, 0x50, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x22, 0x2c, 0x0a, 0x10, 0x47, 0x65, 0x74,
+	0x53, 0x74, 0x61, 0x74, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x18, 0x0a,
+	0x07, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x07,
+	0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x22, 0x9f, 0x01, 0x0a, 0x17, 0x47, 0x65, 0x74, 0x53,
+	0x74, 0x61, 0x74, 0x53, 0x65, 0x74, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x65, 0x71, 0x75,
+	0x65, 0x73, 0x74, 0x12, 0x16, 0x0a, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x01, 0x20,
+	0x03, 0x28, 0x09, 0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x12, 0x1b, 0x0a, 0x09, 0x73,
+	0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x09, 0x52, 0x08,
+	0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x12, 0x2f, 0x0a, 0x05, 0x61, 0x6c, 0x69, 0x67,
+	0x6e, 0x18, 0x03, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x19, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f,
+	0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x4f, 0x70, 0x74, 0x69, 0x6f,
+	0x6e, 0x73, 0x52, 0x05, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x12, 0x1e, 0x0a, 0x0a, 0x74, 0x72, 0x61,
+	0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x73, 0x18, 0x04, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0a, 0x74,
+	0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x73, 0x22, 0xb0, 0x01, 0x0a, 0x18, 0x47, 0x65,
 	0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x74, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x65,
-	0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79,
-	0x52, 0x04, 0x64, 0x61, 0x74, 0x61, 0x1a, 0x4f, 0x0a, 0x09, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e,
-	0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09,
-	0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x2c, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02,
-	0x20, 0x01, 0x28, 0x0b, 0x32, 0x16, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
-	0x6e, 0x73, 0x2e, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x4d, 0x61, 0x70, 0x52, 0x05, 0x76, 0x61,
-	0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0xf3, 0x01, 0x0a, 0x13, 0x47, 0x65, 0x74, 0x53,
-	0x74, 0x61, 0x74, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12,
-	0x14, 0x0a, 0x05, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x05,
-	0x70, 0x6c, 0x61, 0x63, 0x65, 0x12, 0x19, 0x0a, 0x08, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61,
-	0x72, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x07, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72,
-	0x12, 0x12, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04,
-	0x64, 0x61, 0x74, 0x65, 0x12, 0x2d, 0x0a, 0x12, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x6d,
-	0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x18, 0x04, 0x20, 0x01, 0x28, 0x09,
-	0x52, 0x11, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x4d, 0x65, 0x74,
-	0x68, 0x6f, 0x64, 0x12, 0x2d, 0x0a, 0x12, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69,
-	0x6f, 0x6e, 0x5f, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x18, 0x05, 0x20, 0x01, 0x28, 0x09, 0x52,
-	0x11, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x50, 0x65, 0x72, 0x69,
-	0x6f, 0x64, 0x12, 0x12, 0x0a, 0x04, 0x75, 0x6e, 0x69, 0x74, 0x18, 0x06, 0x20, 0x01, 0x28, 0x09,
-	0x52, 0x04, 0x75, 0x6e, 0x69, 0x74, 0x12, 0x25, 0x0a, 0x0e, 0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e,
-	0x67, 0x5f, 0x66, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x18, 0x07, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0d,
-	0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e, 0x67, 0x46, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x22, 0x2c, 0x0a,
-	0x14, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x65, 0x73,
-	0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x14, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x01,
-	0x20, 0x01, 0x28, 0x01, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0xe0, 0x01, 0x0a, 0x14,
-	0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x65, 0x71,
+	0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x43, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x61, 0x18, 0x01,
+	0x20, 0x03, 0x28, 0x0b, 0x32, 0x2f, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
+	0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x74, 0x53, 0x65, 0x72,
+	0x69, 0x65, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x44, 0x61, 0x74, 0x61,
+	0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x04, 0x64, 0x61, 0x74, 0x61, 0x1a, 0x4f, 0x0a, 0x09, 0x44,
+	0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18,
+	0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x2c, 0x0a, 0x05, 0x76, 0x61,
+	0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x16, 0x2e, 0x64, 0x61, 0x74, 0x61,
+	0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x4d, 0x61,
+	0x70, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0xf3, 0x01, 0x0a,
+	0x13, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x65, 0x71,
 	0x75, 0x65, 0x73, 0x74, 0x12, 0x14, 0x0a, 0x05, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x18, 0x01, 0x20,
 	0x01, 0x28, 0x09, 0x52, 0x05, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x12, 0x19, 0x0a, 0x08, 0x73, 0x74,
 	0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x07, 0x73, 0x74,
-	0x61, 0x74, 0x56, 0x61, 0x72, 0x12, 0x2d, 0x0a, 0x12, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65,
-	0x6d, 0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x18, 0x03, 0x20, 0x01, 0x28,
-	0x09, 0x52, 0x11, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x4d, 0x65,
-	0x74, 0x68, 0x6f, 0x64, 0x12, 0x2d, 0x0a, 0x12, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74,
-	0x69, 0x6f, 0x6e, 0x5f, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x18, 0x04, 0x20, 0x01, 0x28, 0x09,
-	0x52, 0x11, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x50, 0x65, 0x72,
-	0x69, 0x6f, 0x64, 0x12, 0x12, 0x0a, 0x04, 0x75, 0x6e, 0x69, 0x74, 0x18, 0x05, 0x20, 0x01, 0x28,
-	0x09, 0x52, 0x04, 0x75, 0x6e, 0x69, 0x74, 0x12, 0x25, 0x0a, 0x0e, 0x73, 0x63, 0x61, 0x6c, 0x69,
-	0x6e, 0x67, 0x5f, 0x66, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x18, 0x06, 0x20, 0x01, 0x28, 0x09, 0x52,
-	0x0d, 0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e, 0x67, 0x46, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x22, 0x9a,
-	0x01, 0x0a, 0x15, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73,
-	0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x46, 0x0a, 0x06, 0x73, 0x65, 0x72, 0x69,
-	0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x2e, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63,
-	0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65,
-	0x72, 0x69, 0x65, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x53, 0x65, 0x72,
-	0x69, 0x65, 0x73, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x06, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73,
-	0x1a, 0x39, 0x0a, 0x0b, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12,
-	0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65,
-	0x79, 0x12, 0x14, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x01,
-	0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0x48, 0x0a, 0x11, 0x47,
-	0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x41, 0x6c, 0x6c, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
+	0x61, 0x74, 0x56, 0x61, 0x72, 0x12, 0x12, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x65, 0x18, 0x03, 0x20,
+	0x01, 0x28, 0x09, 0x52, 0x04, 0x64, 0x61, 0x74, 0x65, 0x12, 0x2d, 0x0a, 0x12, 0x6d, 0x65, 0x61,
+	0x73, 0x75, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x18,
+	0x04, 0x20, 0x01, 0x28, 0x09, 0x52, 0x11, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x6d, 0x65,
+	0x6e, 0x74, 0x4d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x12, 0x2d, 0x0a, 0x12, 0x6f, 0x62, 0x73, 0x65,
+	0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x18, 0x05,
+	0x20, 0x01, 0x28, 0x09, 0x52, 0x11, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f,
+	0x6e, 0x50, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x12, 0x12, 0x0a, 0x04, 0x75, 0x6e, 0x69, 0x74, 0x18,
+	0x06, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x75, 0x6e, 0x69, 0x74, 0x12, 0x25, 0x0a, 0x0e, 0x73,
+	0x63, 0x61, 0x6c, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x18, 0x07, 0x20,
+	0x01, 0x28, 0x09, 0x52, 0x0d, 0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e, 0x67, 0x46, 0x61, 0x63, 0x74,
+	0x6f, 0x72, 0x22, 0x2c, 0x0a, 0x14, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x56, 0x61, 0x6c,
+	0x75, 0x65, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x14, 0x0a, 0x05, 0x76, 0x61,
+	0x6c, 0x75, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x01, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65,
+	0x22, 0xb1, 0x02, 0x0a, 0x14, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x72, 0x69,
+	0x65, 0x73, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x14, 0x0a, 0x05, 0x70, 0x6c, 0x61,
+	0x63, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x05, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x12,
+	0x19, 0x0a, 0x08, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x18, 0x02, 0x20, 0x01, 0x28,
+	0x09, 0x52, 0x07, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x12, 0x2d, 0x0a, 0x12, 0x6d, 0x65,
+	0x61, 0x73, 0x75, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64,
+	0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x11, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x6d,
+	0x65, 0x6e, 0x74, 0x4d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x12, 0x2d, 0x0a, 0x12, 0x6f, 0x62, 0x73,
+	0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x18,
+	0x04, 0x20, 0x01, 0x28, 0x09, 0x52, 0x11, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69,
+	0x6f, 0x6e, 0x50, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x12, 0x12, 0x0a, 0x04, 0x75, 0x6e, 0x69, 0x74,
+	0x18, 0x05, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x75, 0x6e, 0x69, 0x74, 0x12, 0x25, 0x0a, 0x0e,
+	0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x18, 0x06,
+	0x20, 0x01, 0x28, 0x09, 0x52, 0x0d, 0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e, 0x67, 0x46, 0x61, 0x63,
+	0x74, 0x6f, 0x72, 0x12, 0x2f, 0x0a, 0x05, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x18, 0x07, 0x20, 0x01,
+	0x28, 0x0b, 0x32, 0x19, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73,
+	0x2e, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x52, 0x05, 0x61,
+	0x6c, 0x69, 0x67, 0x6e, 0x12, 0x1e, 0x0a, 0x0a, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72,
+	0x6d, 0x73, 0x18, 0x08, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0a, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66,
+	0x6f, 0x72, 0x6d, 0x73, 0x22, 0x9a, 0x01, 0x0a, 0x15, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74,
+	0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x46,
+	0x0a, 0x06, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x2e,
+	0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74,
+	0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e,
+	0x73, 0x65, 0x2e, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x06,
+	0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x1a, 0x39, 0x0a, 0x0b, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73,
+	0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01,
+	0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x14, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65,
+	0x18, 0x02, 0x20, 0x01, 0x28, 0x01, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38,
+	0x01, 0x22, 0x48, 0x0a, 0x11, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x41, 0x6c, 0x6c, 0x52,
+	0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x16, 0x0a, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73,
+	0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x12, 0x1b,
+	0x0a, 0x09, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28,
+	0x09, 0x52, 0x08, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x22, 0xb9, 0x01, 0x0a, 0x12,
+	0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x41, 0x6c, 0x6c, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e,
+	0x73, 0x65, 0x12, 0x4d, 0x0a, 0x0a, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x5f, 0x64, 0x61, 0x74, 0x61,
+	0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x2e, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d,
+	0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x41, 0x6c, 0x6c, 0x52,
+	0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x44, 0x61, 0x74,
+	0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x09, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x44, 0x61, 0x74,
+	0x61, 0x1a, 0x54, 0x0a, 0x0e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e,
+	0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09,
+	0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x2c, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02,
+	0x20, 0x01, 0x28, 0x0b, 0x32, 0x16, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
+	0x6e, 0x73, 0x2e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x52, 0x05, 0x76, 0x61,
+	0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0x91, 0x01, 0x0a, 0x1c, 0x47, 0x65, 0x74, 0x53,
+	0x74, 0x61, 0x74, 0x53, 0x65, 0x74, 0x57, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x50, 0x6c, 0x61, 0x63,
+	0x65, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x21, 0x0a, 0x0c, 0x70, 0x61, 0x72, 0x65,
+	0x6e, 0x74, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0b,
+	0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x12, 0x1d, 0x0a, 0x0a, 0x63,
+	0x68, 0x69, 0x6c, 0x64, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52,
+	0x09, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x54, 0x79, 0x70, 0x65, 0x12, 0x1b, 0x0a, 0x09, 0x73, 0x74,
+	0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x73, 0x18, 0x03, 0x20, 0x03, 0x28, 0x09, 0x52, 0x08, 0x73,
+	0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x12, 0x12, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x65, 0x18,
+	0x04, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x64, 0x61, 0x74, 0x65, 0x22, 0x5c, 0x0a, 0x11, 0x47,
+	0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x74, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
 	0x12, 0x16, 0x0a, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09,
 	0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x73, 0x12, 0x1b, 0x0a, 0x09, 0x73, 0x74, 0x61, 0x74,
 	0x5f, 0x76, 0x61, 0x72, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x09, 0x52, 0x08, 0x73, 0x74, 0x61,
-	0x74, 0x56, 0x61, 0x72, 0x73, 0x22, 0xb9, 0x01, 0x0a, 0x12, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61,
-	0x74, 0x41, 0x6c, 0x6c, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x4d, 0x0a, 0x0a,
-	0x70, 0x6c, 0x61, 0x63, 0x65, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b,
-	0x32, 0x2e, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47,
-	0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x41, 0x6c, 0x6c, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73,
-	0x65, 0x2e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79,
-	0x52, 0x09, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x44, 0x61, 0x74, 0x61, 0x1a, 0x54, 0x0a, 0x0e, 0x50,
-	0x6c, 0x61, 0x63, 0x65, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a,
-	0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12,
-	0x2c, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x16,
-	0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x50, 0x6c, 0x61,
-	0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38,
-	0x01, 0x22, 0x91, 0x01, 0x0a, 0x1c, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x74,
+	0x74, 0x56, 0x61, 0x72, 0x73, 0x12, 0x12, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x65, 0x18, 0x03, 0x20,
+	0x01, 0x28, 0x09, 0x52, 0x04, 0x64, 0x61, 0x74, 0x65, 0x22, 0xa9, 0x01, 0x0a, 0x12, 0x47, 0x65,
+	0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x74, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65,
+	0x12, 0x3d, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x61, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x29,
+	0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74,
+	0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x74, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e,
+	0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x04, 0x64, 0x61, 0x74, 0x61, 0x1a,
+	0x54, 0x0a, 0x09, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03,
+	0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x31,
+	0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1b, 0x2e,
+	0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x50, 0x6c, 0x61, 0x63,
+	0x65, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x53, 0x74, 0x61, 0x74, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75,
+	0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0x9f, 0x01, 0x0a, 0x15, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61,
+	0x74, 0x46, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12,
+	0x18, 0x0a, 0x07, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09,
+	0x52, 0x07, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x12, 0x16, 0x0a, 0x06, 0x70, 0x6c, 0x61,
+	0x63, 0x65, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x09, 0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65,
+	0x73, 0x12, 0x21, 0x0a, 0x0c, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x70, 0x6c, 0x61, 0x63,
+	0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0b, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x50,
+	0x6c, 0x61, 0x63, 0x65, 0x12, 0x1d, 0x0a, 0x0a, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x5f, 0x74, 0x79,
+	0x70, 0x65, 0x18, 0x04, 0x20, 0x01, 0x28, 0x09, 0x52, 0x09, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x54,
+	0x79, 0x70, 0x65, 0x12, 0x12, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x65, 0x18, 0x05, 0x20, 0x01, 0x28,
+	0x09, 0x52, 0x04, 0x64, 0x61, 0x74, 0x65, 0x22, 0xac, 0x01, 0x0a, 0x16, 0x47, 0x65, 0x74, 0x53,
+	0x74, 0x61, 0x74, 0x46, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e,
+	0x73, 0x65, 0x12, 0x41, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x61, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b,
+	0x32, 0x2d, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47,
+	0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x46, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x52, 0x65, 0x73,
+	0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52,
+	0x04, 0x64, 0x61, 0x74, 0x61, 0x1a, 0x4f, 0x0a, 0x09, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74,
+	0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52,
+	0x03, 0x6b, 0x65, 0x79, 0x12, 0x2c, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20,
+	0x01, 0x28, 0x0b, 0x32, 0x16, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e,
+	0x73, 0x2e, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x53, 0x74, 0x61, 0x74, 0x52, 0x05, 0x76, 0x61, 0x6c,
+	0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0x87, 0x01, 0x0a, 0x22, 0x47, 0x65, 0x74, 0x50, 0x6c,
+	0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x44, 0x61, 0x74, 0x65, 0x57, 0x69, 0x74, 0x68, 0x69,
+	0x6e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x25, 0x0a,
+	0x0e, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x18,
+	0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0d, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x50,
+	0x6c, 0x61, 0x63, 0x65, 0x12, 0x1d, 0x0a, 0x0a, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x5f, 0x74, 0x79,
+	0x70, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x09, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x54,
+	0x79, 0x70, 0x65, 0x12, 0x1b, 0x0a, 0x09, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x73,
+	0x18, 0x03, 0x20, 0x03, 0x28, 0x09, 0x52, 0x08, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73,
+	0x22, 0xc5, 0x01, 0x0a, 0x23, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61,
+	0x74, 0x44, 0x61, 0x74, 0x65, 0x57, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x50, 0x6c, 0x61, 0x63, 0x65,
+	0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x4e, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x61,
+	0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x3a, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d,
+	0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61,
+	0x74, 0x44, 0x61, 0x74, 0x65, 0x57, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x50, 0x6c, 0x61, 0x63, 0x65,
+	0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74,
+	0x72, 0x79, 0x52, 0x04, 0x64, 0x61, 0x74, 0x61, 0x1a, 0x4e, 0x0a, 0x09, 0x44, 0x61, 0x74, 0x61,
+	0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01,
+	0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x2b, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65,
+	0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x15, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d,
+	0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x44, 0x61, 0x74, 0x65, 0x4c, 0x69, 0x73, 0x74, 0x52, 0x05, 0x76,
+	0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0xe2, 0x01, 0x0a, 0x11, 0x45, 0x78, 0x70,
+	0x6f, 0x72, 0x74, 0x53, 0x74, 0x61, 0x74, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x1b,
+	0x0a, 0x09, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28,
+	0x09, 0x52, 0x08, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x12, 0x16, 0x0a, 0x06, 0x70,
+	0x6c, 0x61, 0x63, 0x65, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x09, 0x52, 0x06, 0x70, 0x6c, 0x61,
+	0x63, 0x65, 0x73, 0x12, 0x21, 0x0a, 0x0c, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x70, 0x6c,
+	0x61, 0x63, 0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0b, 0x70, 0x61, 0x72, 0x65, 0x6e,
+	0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x12, 0x1d, 0x0a, 0x0a, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x5f,
+	0x74, 0x79, 0x70, 0x65, 0x18, 0x04, 0x20, 0x01, 0x28, 0x09, 0x52, 0x09, 0x63, 0x68, 0x69, 0x6c,
+	0x64, 0x54, 0x79, 0x70, 0x65, 0x12, 0x1d, 0x0a, 0x0a, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x73,
+	0x69, 0x7a, 0x65, 0x18, 0x05, 0x20, 0x01, 0x28, 0x05, 0x52, 0x09, 0x62, 0x61, 0x74, 0x63, 0x68,
+	0x53, 0x69, 0x7a, 0x65, 0x12, 0x16, 0x0a, 0x06, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x18, 0x06,
+	0x20, 0x01, 0x28, 0x09, 0x52, 0x06, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x12, 0x1f, 0x0a, 0x0b,
+	0x62, 0x65, 0x73, 0x74, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x18, 0x07, 0x20, 0x01, 0x28,
+	0x08, 0x52, 0x0a, 0x62, 0x65, 0x73, 0x74, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x22, 0xb8, 0x02,
+	0x0a, 0x0f, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x53, 0x74, 0x61, 0x74, 0x42, 0x61, 0x74, 0x63,
+	0x68, 0x12, 0x29, 0x0a, 0x10, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x5f, 0x64, 0x69, 0x63, 0x74, 0x69,
+	0x6f, 0x6e, 0x61, 0x72, 0x79, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0f, 0x70, 0x6c, 0x61,
+	0x63, 0x65, 0x44, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79, 0x12, 0x27, 0x0a, 0x0f,
+	0x64, 0x61, 0x74, 0x65, 0x5f, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79, 0x18,
+	0x02, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0e, 0x64, 0x61, 0x74, 0x65, 0x44, 0x69, 0x63, 0x74, 0x69,
+	0x6f, 0x6e, 0x61, 0x72, 0x79, 0x12, 0x46, 0x0a, 0x11, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x64, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79, 0x18, 0x03, 0x20, 0x03, 0x28, 0x0b,
+	0x32, 0x19, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53,
+	0x74, 0x61, 0x74, 0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61, 0x52, 0x10, 0x73, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x44, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79, 0x12, 0x19, 0x0a,
+	0x08, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x18, 0x04, 0x20, 0x03, 0x28, 0x05, 0x52,
+	0x07, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x12, 0x14, 0x0a, 0x05, 0x70, 0x6c, 0x61, 0x63,
+	0x65, 0x18, 0x05, 0x20, 0x03, 0x28, 0x05, 0x52, 0x05, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x12, 0x12,
+	0x0a, 0x04, 0x64, 0x61, 0x74, 0x65, 0x18, 0x06, 0x20, 0x03, 0x28, 0x05, 0x52, 0x04, 0x64, 0x61,
+	0x74, 0x65, 0x12, 0x14, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x07, 0x20, 0x03, 0x28,
+	0x01, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x12, 0x16, 0x0a, 0x06, 0x73, 0x6f, 0x75, 0x72,
+	0x63, 0x65, 0x18, 0x08, 0x20, 0x03, 0x28, 0x05, 0x52, 0x06, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+	0x12, 0x16, 0x0a, 0x06, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x18, 0x09, 0x20, 0x01, 0x28, 0x09,
+	0x52, 0x06, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x22, 0xa3, 0x01, 0x0a, 0x0c, 0x53, 0x65, 0x72,
+	0x69, 0x65, 0x73, 0x4d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x12, 0x16, 0x0a, 0x06, 0x70, 0x6c, 0x61,
+	0x63, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x06, 0x70, 0x6c, 0x61, 0x63, 0x65,
+	0x73, 0x12, 0x14, 0x0a, 0x05, 0x64, 0x61, 0x74, 0x65, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x09,
+	0x52, 0x05, 0x64, 0x61, 0x74, 0x65, 0x73, 0x12, 0x16, 0x0a, 0x06, 0x76, 0x61, 0x6c, 0x75, 0x65,
+	0x73, 0x18, 0x03, 0x20, 0x03, 0x28, 0x01, 0x52, 0x06, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x12,
+	0x16, 0x0a, 0x06, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x18, 0x04, 0x20, 0x03, 0x28, 0x05, 0x52,
+	0x06, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x12, 0x35, 0x0a, 0x08, 0x6d, 0x65, 0x74, 0x61, 0x64,
+	0x61, 0x74, 0x61, 0x18, 0x05, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x19, 0x2e, 0x64, 0x61, 0x74, 0x61,
+	0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x4d, 0x65, 0x74, 0x61,
+	0x64, 0x61, 0x74, 0x61, 0x52, 0x08, 0x6d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61, 0x22, 0x80,
+	0x01, 0x0a, 0x1f, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73,
 	0x57, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x52, 0x65, 0x71, 0x75, 0x65,
 	0x73, 0x74, 0x12, 0x21, 0x0a, 0x0c, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x70, 0x6c, 0x61,
 	0x63, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0b, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74,
@@ -2132,47 +3243,29 @@ var file_stat_proto_rawDesc = []byte{
 	0x79, 0x70, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x09, 0x63, 0x68, 0x69, 0x6c, 0x64,
 	0x54, 0x79, 0x70, 0x65, 0x12, 0x1b, 0x0a, 0x09, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72,
 	0x73, 0x18, 0x03, 0x20, 0x03, 0x28, 0x09, 0x52, 0x08, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72,
-	0x73, 0x12, 0x12, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x65, 0x18, 0x04, 0x20, 0x01, 0x28, 0x09, 0x52,
-	0x04, 0x64, 0x61, 0x74, 0x65, 0x22, 0x5c, 0x0a, 0x11, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74,
-	0x53, 0x65, 0x74, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x16, 0x0a, 0x06, 0x70, 0x6c,
-	0x61, 0x63, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x06, 0x70, 0x6c, 0x61, 0x63,
-	0x65, 0x73, 0x12, 0x1b, 0x0a, 0x09, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x73, 0x18,
-	0x02, 0x20, 0x03, 0x28, 0x09, 0x52, 0x08, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x12,
-	0x12, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x64,
-	0x61, 0x74, 0x65, 0x22, 0xa9, 0x01, 0x0a, 0x12, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53,
-	0x65, 0x74, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x3d, 0x0a, 0x04, 0x64, 0x61,
-	0x74, 0x61, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x29, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63,
-	0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65,
-	0x74, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e,
-	0x74, 0x72, 0x79, 0x52, 0x04, 0x64, 0x61, 0x74, 0x61, 0x1a, 0x54, 0x0a, 0x09, 0x44, 0x61, 0x74,
-	0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20,
-	0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x31, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75,
-	0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1b, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f,
-	0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x50, 0x6f, 0x69, 0x6e, 0x74,
-	0x53, 0x74, 0x61, 0x74, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22,
-	0x87, 0x01, 0x0a, 0x22, 0x47, 0x65, 0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74,
-	0x44, 0x61, 0x74, 0x65, 0x57, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x52,
-	0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x25, 0x0a, 0x0e, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x74,
-	0x6f, 0x72, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0d,
-	0x61, 0x6e, 0x63, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x12, 0x1d, 0x0a,
-	0x0a, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28,
-	0x09, 0x52, 0x09, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x12, 0x1b, 0x0a, 0x09,
-	0x73, 0x74, 0x61, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x73, 0x18, 0x03, 0x20, 0x03, 0x28, 0x09, 0x52,
-	0x08, 0x73, 0x74, 0x61, 0x74, 0x56, 0x61, 0x72, 0x73, 0x22, 0xc5, 0x01, 0x0a, 0x23, 0x47, 0x65,
-	0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x44, 0x61, 0x74, 0x65, 0x57, 0x69,
-	0x74, 0x68, 0x69, 0x6e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73,
-	0x65, 0x12, 0x4e, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x61, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32,
-	0x3a, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x47, 0x65,
-	0x74, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x44, 0x61, 0x74, 0x65, 0x57, 0x69,
-	0x74, 0x68, 0x69, 0x6e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73,
-	0x65, 0x2e, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x04, 0x64, 0x61, 0x74,
-	0x61, 0x1a, 0x4e, 0x0a, 0x09, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10,
-	0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79,
-	0x12, 0x2b, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32,
-	0x15, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x44, 0x61,
-	0x74, 0x65, 0x4c, 0x69, 0x73, 0x74, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38,
-	0x01, 0x42, 0x09, 0x5a, 0x07, 0x2e, 0x2f, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x62, 0x06, 0x70, 0x72,
-	0x6f, 0x74, 0x6f, 0x33,
+	0x73, 0x22, 0xc3, 0x01, 0x0a, 0x20, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x72,
+	0x69, 0x65, 0x73, 0x57, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x52, 0x65,
+	0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x4b, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x61, 0x18, 0x01,
+	0x20, 0x03, 0x28, 0x0b, 0x32, 0x37, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
+	0x6e, 0x73, 0x2e, 0x47, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73,
+	0x57, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x52, 0x65, 0x73, 0x70, 0x6f,
+	0x6e, 0x73, 0x65, 0x2e, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x04, 0x64,
+	0x61, 0x74, 0x61, 0x1a, 0x52, 0x0a, 0x09, 0x44, 0x61, 0x74, 0x61, 0x45, 0x6e, 0x74, 0x72, 0x79,
+	0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b,
+	0x65, 0x79, 0x12, 0x2f, 0x0a, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28,
+	0x0b, 0x32, 0x19, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e,
+	0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x4d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x52, 0x05, 0x76, 0x61,
+	0x6c, 0x75, 0x65, 0x3a, 0x02, 0x38, 0x01, 0x22, 0x89, 0x01, 0x0a, 0x14, 0x53, 0x63, 0x61, 0x6e,
+	0x50, 0x6c, 0x61, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
+	0x12, 0x14, 0x0a, 0x05, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52,
+	0x05, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x12, 0x1b, 0x0a, 0x09, 0x73, 0x74, 0x61, 0x74, 0x5f, 0x76,
+	0x61, 0x72, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x09, 0x52, 0x08, 0x73, 0x74, 0x61, 0x74, 0x56,
+	0x61, 0x72, 0x73, 0x12, 0x1f, 0x0a, 0x0b, 0x62, 0x65, 0x73, 0x74, 0x5f, 0x73, 0x6f, 0x75, 0x72,
+	0x63, 0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x08, 0x52, 0x0a, 0x62, 0x65, 0x73, 0x74, 0x53, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x12, 0x1d, 0x0a, 0x0a, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x73, 0x69,
+	0x7a, 0x65, 0x18, 0x04, 0x20, 0x01, 0x28, 0x05, 0x52, 0x09, 0x62, 0x61, 0x74, 0x63, 0x68, 0x53,
+	0x69, 0x7a, 0x65, 0x42, 0x09, 0x5a, 0x07, 0x2e, 0x2f, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x62, 0x06,
+	0x70, 0x72, 0x6f, 0x74, 0x6f, 0x33,
 }
 
 var (
@@ -2187,87 +3280,115 @@ func file_stat_proto_rawDescGZIP() []byte {
 	return file_stat_proto_rawDescData
 }
 
-var file_stat_proto_msgTypes = make([]protoimpl.MessageInfo, 42)
+var file_stat_proto_enumTypes = make([]protoimpl.EnumInfo, 4)
+var file_stat_proto_msgTypes = make([]protoimpl.MessageInfo, 53)
 var file_stat_proto_goTypes = []interface{}{
-	(*StatMetadata)(nil),                        // 0: datacommons.StatMetadata
-	(*PointStat)(nil),                           // 1: datacommons.PointStat
-	(*PlacePointStat)(nil),                      // 2: datacommons.PlacePointStat
-	(*DateList)(nil),                            // 3: datacommons.DateList
-	(*SourceSeries)(nil),                        // 4: datacommons.SourceSeries
-	(*Series)(nil),                              // 5: datacommons.Series
-	(*SeriesMap)(nil),                           // 6: datacommons.SeriesMap
-	(*ObsTimeSeries)(nil),                       // 7: datacommons.ObsTimeSeries
-	(*ObsCollection)(nil),                       // 8: datacommons.ObsCollection
-	(*ChartStore)(nil),                          // 9: datacommons.ChartStore
-	(*PlaceStat)(nil),                           // 10: datacommons.PlaceStat
-	(*StatVarObsSeries)(nil),                    // 11: datacommons.StatVarObsSeries
-	(*StatVarSeries)(nil),                       // 12: datacommons.StatVarSeries
-	(*GetStatsRequest)(nil),                     // 13: datacommons.GetStatsRequest
-	(*GetStatsResponse)(nil),                    // 14: datacommons.GetStatsResponse
-	(*GetStatSetSeriesRequest)(nil),             // 15: datacommons.GetStatSetSeriesRequest
-	(*GetStatSetSeriesResponse)(nil),            // 16: datacommons.GetStatSetSeriesResponse
-	(*GetStatValueRequest)(nil),                 // 17: datacommons.GetStatValueRequest
-	(*GetStatValueResponse)(nil),                // 18: datacommons.GetStatValueResponse
-	(*GetStatSeriesRequest)(nil),                // 19: datacommons.GetStatSeriesRequest
-	(*GetStatSeriesResponse)(nil),               // 20: datacommons.GetStatSeriesResponse
-	(*GetStatAllRequest)(nil),                   // 21: datacommons.GetStatAllRequest
-	(*GetStatAllResponse)(nil),                  // 22: datacommons.GetStatAllResponse
-	(*GetStatSetWithinPlaceRequest)(nil),        // 23: datacommons.GetStatSetWithinPlaceRequest
-	(*GetStatSetRequest)(nil),                   // 24: datacommons.GetStatSetRequest
-	(*GetStatSetResponse)(nil),                  // 25: datacommons.GetStatSetResponse
-	(*GetPlaceStatDateWithinPlaceRequest)(nil),  // 26: datacommons.GetPlaceStatDateWithinPlaceRequest
-	(*GetPlaceStatDateWithinPlaceResponse)(nil), // 27: datacommons.GetPlaceStatDateWithinPlaceResponse
-	nil, // 28: datacommons.PlacePointStat.StatEntry
-	nil, // 29: datacommons.PlacePointStat.MetadataEntry
-	nil, // 30: datacommons.SourceSeries.ValEntry
-	nil, // 31: datacommons.Series.ValEntry
-	nil, // 32: datacommons.SeriesMap.DataEntry
-	nil, // 33: datacommons.ObsTimeSeries.DataEntry
-	nil, // 34: datacommons.PlaceStat.StatVarDataEntry
-	nil, // 35: datacommons.StatVarObsSeries.DataEntry
-	nil, // 36: datacommons.StatVarSeries.DataEntry
-	nil, // 37: datacommons.GetStatSetSeriesResponse.DataEntry
-	nil, // 38: datacommons.GetStatSeriesResponse.SeriesEntry
-	nil, // 39: datacommons.GetStatAllResponse.PlaceDataEntry
-	nil, // 40: datacommons.GetStatSetResponse.DataEntry
-	nil, // 41: datacommons.GetPlaceStatDateWithinPlaceResponse.DataEntry
+	(AlignOptions_Period)(0),                    // 0: datacommons.AlignOptions.Period
+	(AlignOptions_Aggregation)(0),               // 1: datacommons.AlignOptions.Aggregation
+	(AlignOptions_Grid)(0),                      // 2: datacommons.AlignOptions.Grid
+	(AlignOptions_Fill)(0),                      // 3: datacommons.AlignOptions.Fill
+	(*StatMetadata)(nil),                        // 4: datacommons.StatMetadata
+	(*PointStat)(nil),                           // 5: datacommons.PointStat
+	(*PlacePointStat)(nil),                      // 6: datacommons.PlacePointStat
+	(*DateList)(nil),                            // 7: datacommons.DateList
+	(*SourceSeries)(nil),                        // 8: datacommons.SourceSeries
+	(*Series)(nil),                              // 9: datacommons.Series
+	(*AlignOptions)(nil),                        // 10: datacommons.AlignOptions
+	(*SeriesMap)(nil),                           // 11: datacommons.SeriesMap
+	(*ObsTimeSeries)(nil),                       // 12: datacommons.ObsTimeSeries
+	(*ObsCollection)(nil),                       // 13: datacommons.ObsCollection
+	(*ChartStore)(nil),                          // 14: datacommons.ChartStore
+	(*PlaceStat)(nil),                           // 15: datacommons.PlaceStat
+	(*StatVarObsSeries)(nil),                    // 16: datacommons.StatVarObsSeries
+	(*StatVarSeries)(nil),                       // 17: datacommons.StatVarSeries
+	(*GetStatsRequest)(nil),                     // 18: datacommons.GetStatsRequest
+	(*GetStatsResponse)(nil),                    // 19: datacommons.GetStatsResponse
+	(*GetStatSetSeriesRequest)(nil),             // 20: datacommons.GetStatSetSeriesRequest
+	(*GetStatSetSeriesResponse)(nil),            // 21: datacommons.GetStatSetSeriesResponse
+	(*GetStatValueRequest)(nil),                 // 22: datacommons.GetStatValueRequest
+	(*GetStatValueResponse)(nil),                // 23: datacommons.GetStatValueResponse
+	(*GetStatSeriesRequest)(nil),                // 24: datacommons.GetStatSeriesRequest
+	(*GetStatSeriesResponse)(nil),               // 25: datacommons.GetStatSeriesResponse
+	(*GetStatAllRequest)(nil),                   // 26: datacommons.GetStatAllRequest
+	(*GetStatAllResponse)(nil),                  // 27: datacommons.GetStatAllResponse
+	(*GetStatSetWithinPlaceRequest)(nil),        // 28: datacommons.GetStatSetWithinPlaceRequest
+	(*GetStatSetRequest)(nil),                   // 29: datacommons.GetStatSetRequest
+	(*GetStatSetResponse)(nil),                  // 30: datacommons.GetStatSetResponse
+	(*GetStatFormulaRequest)(nil),               // 31: datacommons.GetStatFormulaRequest
+	(*GetStatFormulaResponse)(nil),              // 32: datacommons.GetStatFormulaResponse
+	(*GetPlaceStatDateWithinPlaceRequest)(nil),  // 33: datacommons.GetPlaceStatDateWithinPlaceRequest
+	(*GetPlaceStatDateWithinPlaceResponse)(nil), // 34: datacommons.GetPlaceStatDateWithinPlaceResponse
+	(*ExportStatRequest)(nil),                   // 35: datacommons.ExportStatRequest
+	(*ExportStatBatch)(nil),                     // 36: datacommons.ExportStatBatch
+	(*SeriesMatrix)(nil),                        // 37: datacommons.SeriesMatrix
+	(*GetStatSeriesWithinPlaceRequest)(nil),     // 38: datacommons.GetStatSeriesWithinPlaceRequest
+	(*GetStatSeriesWithinPlaceResponse)(nil),    // 39: datacommons.GetStatSeriesWithinPlaceResponse
+	(*ScanPlaceStatRequest)(nil),                // 40: datacommons.ScanPlaceStatRequest
+	nil,                                         // 41: datacommons.PlacePointStat.StatEntry
+	nil,                                         // 42: datacommons.PlacePointStat.MetadataEntry
+	nil,                                         // 43: datacommons.SourceSeries.ValEntry
+	nil,                                         // 44: datacommons.Series.ValEntry
+	nil,                                         // 45: datacommons.SeriesMap.DataEntry
+	nil,                                         // 46: datacommons.ObsTimeSeries.DataEntry
+	nil,                                         // 47: datacommons.PlaceStat.StatVarDataEntry
+	nil,                                         // 48: datacommons.StatVarObsSeries.DataEntry
+	nil,                                         // 49: datacommons.StatVarSeries.DataEntry
+	nil,                                         // 50: datacommons.GetStatSetSeriesResponse.DataEntry
+	nil,                                         // 51: datacommons.GetStatSeriesResponse.SeriesEntry
+	nil,                                         // 52: datacommons.GetStatAllResponse.PlaceDataEntry
+	nil,                                         // 53: datacommons.GetStatSetResponse.DataEntry
+	nil,                                         // 54: datacommons.GetStatFormulaResponse.DataEntry
+	nil,                                         // 55: datacommons.GetPlaceStatDateWithinPlaceResponse.DataEntry
+	nil,                                         // 56: datacommons.GetStatSeriesWithinPlaceResponse.DataEntry
 }
 var file_stat_proto_depIdxs = []int32{
-	0,  // 0: datacommons.PointStat.metadata:type_name -> datacommons.StatMetadata
-	28, // 1: datacommons.PlacePointStat.stat:type_name -> datacommons.PlacePointStat.StatEntry
-	29, // 2: datacommons.PlacePointStat.metadata:type_name -> datacommons.PlacePointStat.MetadataEntry
-	30, // 3: datacommons.SourceSeries.val:type_name -> datacommons.SourceSeries.ValEntry
-	31, // 4: datacommons.Series.val:type_name -> datacommons.Series.ValEntry
-	0,  // 5: datacommons.Series.metadata:type_name -> datacommons.StatMetadata
-	32, // 6: datacommons.SeriesMap.data:type_name -> datacommons.SeriesMap.DataEntry
-	33, // 7: datacommons.ObsTimeSeries.data:type_name -> datacommons.ObsTimeSeries.DataEntry
-	4,  // 8: datacommons.ObsTimeSeries.source_series:type_name -> datacommons.SourceSeries
-	4,  // 9: datacommons.ObsCollection.source_cohorts:type_name -> datacommons.SourceSeries
-	7,  // 10: datacommons.ChartStore.obs_time_series:type_name -> datacommons.ObsTimeSeries
-	8,  // 11: datacommons.ChartStore.obs_collection:type_name -> datacommons.ObsCollection
-	34, // 12: datacommons.PlaceStat.stat_var_data:type_name -> datacommons.PlaceStat.StatVarDataEntry
-	35, // 13: datacommons.StatVarObsSeries.data:type_name -> datacommons.StatVarObsSeries.DataEntry
-	36, // 14: datacommons.StatVarSeries.data:type_name -> datacommons.StatVarSeries.DataEntry
-	37, // 15: datacommons.GetStatSetSeriesResponse.data:type_name -> datacommons.GetStatSetSeriesResponse.DataEntry
-	38, // 16: datacommons.GetStatSeriesResponse.series:type_name -> datacommons.GetStatSeriesResponse.SeriesEntry
-	39, // 17: datacommons.GetStatAllResponse.place_data:type_name -> datacommons.GetStatAllResponse.PlaceDataEntry
-	40, // 18: datacommons.GetStatSetResponse.data:type_name -> datacommons.GetStatSetResponse.DataEntry
-	41, // 19: datacommons.GetPlaceStatDateWithinPlaceResponse.data:type_name -> datacommons.GetPlaceStatDateWithinPlaceResponse.DataEntry
-	1,  // 20: datacommons.PlacePointStat.StatEntry.value:type_name -> datacommons.PointStat
-	0,  // 21: datacommons.PlacePointStat.MetadataEntry.value:type_name -> datacommons.StatMetadata
-	5,  // 22: datacommons.SeriesMap.DataEntry.value:type_name -> datacommons.Series
-	7,  // 23: datacommons.PlaceStat.StatVarDataEntry.value:type_name -> datacommons.ObsTimeSeries
-	7,  // 24: datacommons.StatVarObsSeries.DataEntry.value:type_name -> datacommons.ObsTimeSeries
-	5,  // 25: datacommons.StatVarSeries.DataEntry.value:type_name -> datacommons.Series
-	6,  // 26: datacommons.GetStatSetSeriesResponse.DataEntry.value:type_name -> datacommons.SeriesMap
-	10, // 27: datacommons.GetStatAllResponse.PlaceDataEntry.value:type_name -> datacommons.PlaceStat
-	2,  // 28: datacommons.GetStatSetResponse.DataEntry.value:type_name -> datacommons.PlacePointStat
-	3,  // 29: datacommons.GetPlaceStatDateWithinPlaceResponse.DataEntry.value:type_name -> datacommons.DateList
-	30, // [30:30] is the sub-list for method output_type
-	30, // [30:30] is the sub-list for method input_type
-	30, // [30:30] is the sub-list for extension type_name
-	30, // [30:30] is the sub-list for extension extendee
-	0,  // [0:30] is the sub-list for field type_name
+	4,  // 0: datacommons.PointStat.metadata:type_name -> datacommons.StatMetadata
+	41, // 1: datacommons.PlacePointStat.stat:type_name -> datacommons.PlacePointStat.StatEntry
+	42, // 2: datacommons.PlacePointStat.metadata:type_name -> datacommons.PlacePointStat.MetadataEntry
+	43, // 3: datacommons.SourceSeries.val:type_name -> datacommons.SourceSeries.ValEntry
+	44, // 4: datacommons.Series.val:type_name -> datacommons.Series.ValEntry
+	4,  // 5: datacommons.Series.metadata:type_name -> datacommons.StatMetadata
+	0,  // 6: datacommons.AlignOptions.period:type_name -> datacommons.AlignOptions.Period
+	1,  // 7: datacommons.AlignOptions.aggregation:type_name -> datacommons.AlignOptions.Aggregation
+	2,  // 8: datacommons.AlignOptions.grid:type_name -> datacommons.AlignOptions.Grid
+	3,  // 9: datacommons.AlignOptions.fill:type_name -> datacommons.AlignOptions.Fill
+	45, // 10: datacommons.SeriesMap.data:type_name -> datacommons.SeriesMap.DataEntry
+	46, // 11: datacommons.ObsTimeSeries.data:type_name -> datacommons.ObsTimeSeries.DataEntry
+	8,  // 12: datacommons.ObsTimeSeries.source_series:type_name -> datacommons.SourceSeries
+	8,  // 13: datacommons.ObsCollection.source_cohorts:type_name -> datacommons.SourceSeries
+	12, // 14: datacommons.ChartStore.obs_time_series:type_name -> datacommons.ObsTimeSeries
+	13, // 15: datacommons.ChartStore.obs_collection:type_name -> datacommons.ObsCollection
+	47, // 16: datacommons.PlaceStat.stat_var_data:type_name -> datacommons.PlaceStat.StatVarDataEntry
+	48, // 17: datacommons.StatVarObsSeries.data:type_name -> datacommons.StatVarObsSeries.DataEntry
+	49, // 18: datacommons.StatVarSeries.data:type_name -> datacommons.StatVarSeries.DataEntry
+	10, // 19: datacommons.GetStatSetSeriesRequest.align:type_name -> datacommons.AlignOptions
+	50, // 20: datacommons.GetStatSetSeriesResponse.data:type_name -> datacommons.GetStatSetSeriesResponse.DataEntry
+	10, // 21: datacommons.GetStatSeriesRequest.align:type_name -> datacommons.AlignOptions
+	51, // 22: datacommons.GetStatSeriesResponse.series:type_name -> datacommons.GetStatSeriesResponse.SeriesEntry
+	52, // 23: datacommons.GetStatAllResponse.place_data:type_name -> datacommons.GetStatAllResponse.PlaceDataEntry
+	53, // 24: datacommons.GetStatSetResponse.data:type_name -> datacommons.GetStatSetResponse.DataEntry
+	54, // 25: datacommons.GetStatFormulaResponse.data:type_name -> datacommons.GetStatFormulaResponse.DataEntry
+	55, // 26: datacommons.GetPlaceStatDateWithinPlaceResponse.data:type_name -> datacommons.GetPlaceStatDateWithinPlaceResponse.DataEntry
+	4,  // 27: datacommons.ExportStatBatch.source_dictionary:type_name -> datacommons.StatMetadata
+	4,  // 28: datacommons.SeriesMatrix.metadata:type_name -> datacommons.StatMetadata
+	56, // 29: datacommons.GetStatSeriesWithinPlaceResponse.data:type_name -> datacommons.GetStatSeriesWithinPlaceResponse.DataEntry
+	5,  // 30: datacommons.PlacePointStat.StatEntry.value:type_name -> datacommons.PointStat
+	4,  // 31: datacommons.PlacePointStat.MetadataEntry.value:type_name -> datacommons.StatMetadata
+	9,  // 32: datacommons.SeriesMap.DataEntry.value:type_name -> datacommons.Series
+	12, // 33: datacommons.PlaceStat.StatVarDataEntry.value:type_name -> datacommons.ObsTimeSeries
+	12, // 34: datacommons.StatVarObsSeries.DataEntry.value:type_name -> datacommons.ObsTimeSeries
+	9,  // 35: datacommons.StatVarSeries.DataEntry.value:type_name -> datacommons.Series
+	11, // 36: datacommons.GetStatSetSeriesResponse.DataEntry.value:type_name -> datacommons.SeriesMap
+	15, // 37: datacommons.GetStatAllResponse.PlaceDataEntry.value:type_name -> datacommons.PlaceStat
+	6,  // 38: datacommons.GetStatSetResponse.DataEntry.value:type_name -> datacommons.PlacePointStat
+	5,  // 39: datacommons.GetStatFormulaResponse.DataEntry.value:type_name -> datacommons.PointStat
+	7,  // 40: datacommons.GetPlaceStatDateWithinPlaceResponse.DataEntry.value:type_name -> datacommons.DateList
+	37, // 41: datacommons.GetStatSeriesWithinPlaceResponse.DataEntry.value:type_name -> datacommons.SeriesMatrix
+	42, // [42:42] is the sub-list for method output_type
+	42, // [42:42] is the sub-list for method input_type
+	42, // [42:42] is the sub-list for extension type_name
+	42, // [42:42] is the sub-list for extension extendee
+	0,  // [0:42] is the sub-list for field type_name
 }
 
 func init() { file_stat_proto_init() }
@@ -2349,7 +3470,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[6].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*SeriesMap); i {
+			switch v := v.(*AlignOptions); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2361,7 +3482,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[7].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*ObsTimeSeries); i {
+			switch v := v.(*SeriesMap); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2373,7 +3494,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[8].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*ObsCollection); i {
+			switch v := v.(*ObsTimeSeries); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2385,7 +3506,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[9].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*ChartStore); i {
+			switch v := v.(*ObsCollection); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2397,7 +3518,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[10].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*PlaceStat); i {
+			switch v := v.(*ChartStore); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2409,7 +3530,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[11].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*StatVarObsSeries); i {
+			switch v := v.(*PlaceStat); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2421,7 +3542,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[12].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*StatVarSeries); i {
+			switch v := v.(*StatVarObsSeries); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2433,7 +3554,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[13].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetStatsRequest); i {
+			switch v := v.(*StatVarSeries); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2445,7 +3566,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[14].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetStatsResponse); i {
+			switch v := v.(*GetStatsRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2457,7 +3578,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[15].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetStatSetSeriesRequest); i {
+			switch v := v.(*GetStatsResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2469,7 +3590,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[16].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetStatSetSeriesResponse); i {
+			switch v := v.(*GetStatSetSeriesRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2481,7 +3602,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[17].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetStatValueRequest); i {
+			switch v := v.(*GetStatSetSeriesResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2493,7 +3614,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[18].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetStatValueResponse); i {
+			switch v := v.(*GetStatValueRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2505,7 +3626,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[19].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetStatSeriesRequest); i {
+			switch v := v.(*GetStatValueResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2517,7 +3638,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[20].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetStatSeriesResponse); i {
+			switch v := v.(*GetStatSeriesRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2529,7 +3650,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[21].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetStatAllRequest); i {
+			switch v := v.(*GetStatSeriesResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2541,7 +3662,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[22].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetStatAllResponse); i {
+			switch v := v.(*GetStatAllRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2553,7 +3674,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[23].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetStatSetWithinPlaceRequest); i {
+			switch v := v.(*GetStatAllResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2565,7 +3686,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[24].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetStatSetRequest); i {
+			switch v := v.(*GetStatSetWithinPlaceRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2577,7 +3698,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[25].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetStatSetResponse); i {
+			switch v := v.(*GetStatSetRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2589,7 +3710,7 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[26].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*GetPlaceStatDateWithinPlaceRequest); i {
+			switch v := v.(*GetStatSetResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2601,6 +3722,42 @@ func file_stat_proto_init() {
 			}
 		}
 		file_stat_proto_msgTypes[27].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*GetStatFormulaRequest); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_stat_proto_msgTypes[28].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*GetStatFormulaResponse); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_stat_proto_msgTypes[29].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*GetPlaceStatDateWithinPlaceRequest); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_stat_proto_msgTypes[30].Exporter = func(v interface{}, i int) interface{} {
 			switch v := v.(*GetPlaceStatDateWithinPlaceResponse); i {
 			case 0:
 				return &v.state
@@ -2612,8 +3769,80 @@ func file_stat_proto_init() {
 				return nil
 			}
 		}
+		file_stat_proto_msgTypes[31].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*ExportStatRequest); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_stat_proto_msgTypes[32].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*ExportStatBatch); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_stat_proto_msgTypes[33].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*SeriesMatrix); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_stat_proto_msgTypes[34].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*GetStatSeriesWithinPlaceRequest); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_stat_proto_msgTypes[35].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*GetStatSeriesWithinPlaceResponse); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_stat_proto_msgTypes[36].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*ScanPlaceStatRequest); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
 	}
-	file_stat_proto_msgTypes[9].OneofWrappers = []interface{}{
+	file_stat_proto_msgTypes[10].OneofWrappers = []interface{}{
 		(*ChartStore_ObsTimeSeries)(nil),
 		(*ChartStore_ObsCollection)(nil),
 	}
@@ -2622,13 +3851,14 @@ func file_stat_proto_init() {
 		File: protoimpl.DescBuilder{
 			GoPackagePath: reflect.TypeOf(x{}).PkgPath(),
 			RawDescriptor: file_stat_proto_rawDesc,
-			NumEnums:      0,
-			NumMessages:   42,
+			NumEnums:      4,
+			NumMessages:   53,
 			NumExtensions: 0,
 			NumServices:   0,
 		},
 		GoTypes:           file_stat_proto_goTypes,
 		DependencyIndexes: file_stat_proto_depIdxs,
+		EnumInfos:         file_stat_proto_enumTypes,
 		MessageInfos:      file_stat_proto_msgTypes,
 	}.Build()
 	File_stat_proto = out.File
@@ -0,0 +1,142 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Package rowcache is an in-memory cache of raw Bigtable cells.
+package rowcache
+
+import (
+	"container/list"
+	"hash/fnv"
+	"sync"
+)
+
+const (
+	numShards = 16
+	// Approximate memory used by an entry besides the key and value.
+	entryOverhead = 64
+)
+
+// Cache is a size bounded LRU cache of raw Bigtable cells keyed by row key.
+//
+// A nil value records that the row does not exist. The cache is sharded to
+// reduce lock contention.
+type Cache struct {
+	shards  [numShards]*shard
+	onEvict func(key string, value []byte)
+}
+
+type shard struct {
+	mu       sync.Mutex
+	maxBytes int64
+	bytes    int64
+	ll       *list.List
+	items    map[string]*list.Element
+}
+
+type entry struct {
+	key   string
+	value []byte
+}
+
+func (e *entry) size() int64 {
+	return int64(len(e.key) + len(e.value) + entryOverhead)
+}
+
+// New creates a Cache holding up to about maxBytes of data. When it is not nil,
+// onEvict is called with the entries evicted to make room for new ones.
+func New(maxBytes int64, onEvict func(key string, value []byte)) *Cache {
+	c := &Cache{onEvict: onEvict}
+	for i := range c.shards {
+		c.shards[i] = &shard{
+			maxBytes: maxBytes / numShards,
+			ll:       list.New(),
+			items:    map[string]*list.Element{},
+		}
+	}
+	return c
+}
+
+func (c *Cache) shard(key string) *shard {
+	h := fnv.New32a()
+	_, _ = h.Write([]byte(key))
+	return c.shards[h.Sum32()%numShards]
+}
+
+// Get returns the cached value of a key and whether it is in the cache.
+func (c *Cache) Get(key string) ([]byte, bool) {
+	s := c.shard(key)
+	s.mu.Lock()
+	defer s.mu.Unlock()
+	if elem, ok := s.items[key]; ok {
+		s.ll.MoveToFront(elem)
+		return elem.Value.(*entry).value, true
+	}
+	return nil, false
+}
+
+// Add adds a value to the cache, evicting the least recently used entries when
+// the cache is full.
+func (c *Cache) Add(key string, value []byte) {
+	s := c.shard(key)
+	e := &entry{key, value}
+	if e.size() > s.maxBytes {
+		return
+	}
+	var evicted []*entry
+	s.mu.Lock()
+	if elem, ok := s.items[key]; ok {
+		s.bytes -= elem.Value.(*entry).size()
+		elem.Value = e
+		s.ll.MoveToFront(elem)
+	} else {
+		s.items[key] = s.ll.PushFront(e)
+	}
+	s.bytes += e.size()
+	for s.bytes > s.maxBytes {
+		elem := s.ll.Back()
+		old := elem.Value.(*entry)
+		s.ll.Remove(elem)
+		delete(s.items, old.key)
+		s.bytes -= old.size()
+		evicted = append(evicted, old)
+	}
+	s.mu.Unlock()
+	if c.onEvict != nil {
+		for _, old := range evicted {
+			c.onEvict(old.key, old.value)
+		}
+	}
+}
+
+// Clear removes all the entries without calling onEvict.
+func (c *Cache) Clear() {
+	for _, s := range c.shards {
+		s.mu.Lock()
+		s.ll.Init()
+		s.items = map[string]*list.Element{}
+		s.bytes = 0
+		s.mu.Unlock()
+	}
+}
+
+// Len returns the number of entries in the cache.
+func (c *Cache) Len() int {
+	n := 0
+	for _, s := range c.shards {
+		s.mu.Lock()
+		n += s.ll.Len()
+		s.mu.Unlock()
+	}
+	return n
+}
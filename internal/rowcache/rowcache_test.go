@@ -0,0 +1,61 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package rowcache
+
+import (
+	"fmt"
+	"testing"
+)
+
+func TestCache(t *testing.T) {
+	evicted := map[string]bool{}
+	// Each shard holds about 2 entries of 100 bytes.
+	c := New(numShards*250, func(key string, value []byte) {
+		evicted[key] = true
+	})
+	value := make([]byte, 100-entryOverhead-2)
+
+	c.Add("k0", value)
+	c.Add("k1", nil)
+	if got, ok := c.Get("k0"); !ok || len(got) != len(value) {
+		t.Errorf("Get(k0) = %d bytes, %v", len(got), ok)
+	}
+	if got, ok := c.Get("k1"); !ok || got != nil {
+		t.Errorf("Get(k1) = %v, %v, want a cached missing row", got, ok)
+	}
+	if _, ok := c.Get("k2"); ok {
+		t.Errorf("Get(k2) got a value")
+	}
+
+	for i := 0; i < 100; i++ {
+		c.Add(fmt.Sprintf("x%d", i), value)
+	}
+	if c.Len() > numShards*2+2 {
+		t.Errorf("Len() = %d, cache is not bounded", c.Len())
+	}
+	for key := range evicted {
+		if _, ok := c.Get(key); ok {
+			t.Errorf("Get(%s) got an evicted value", key)
+		}
+	}
+	if len(evicted) == 0 {
+		t.Errorf("No entry is evicted")
+	}
+
+	c.Clear()
+	if c.Len() != 0 {
+		t.Errorf("Len() = %d after Clear()", c.Len())
+	}
+}
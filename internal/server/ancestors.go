@@ -0,0 +1,80 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"context"
+
+	"github.com/datacommonsorg/mixer/internal/ancestor"
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/datacommonsorg/mixer/internal/util"
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/status"
+)
+
+// Maximum number of places in the ancestor index. A place with its parents
+// takes about 100 bytes.
+const maxAncestorIndexPlaces = 1000000
+
+// GetPlaceAncestors implements API for Mixer.GetPlaceAncestors.
+// Endpoint: /place/ancestors
+func (s *Server) GetPlaceAncestors(ctx context.Context, in *pb.GetPlaceAncestorsRequest) (
+	*pb.GetPlaceAncestorsResponse, error) {
+	if len(in.GetPlaces()) == 0 {
+		return nil, status.Errorf(codes.InvalidArgument, "Missing required argument: places")
+	}
+	if len(in.GetPlaces()) > util.BtBatchQuerySize {
+		return nil, status.Errorf(codes.InvalidArgument,
+			"Too many places: %d > %d", len(in.GetPlaces()), util.BtBatchQuerySize)
+	}
+	opts := ancestor.Options{Types: in.GetPlaceTypes()}
+	if !in.GetIncludeZipCodes() {
+		opts.ExcludeTypes = []string{"CensusZipCodeTabulationArea"}
+	}
+	chains, err := s.ancestors.Ancestors(ctx, in.GetPlaces(), opts)
+	if err != nil {
+		return nil, err
+	}
+	resp := &pb.GetPlaceAncestorsResponse{Ancestors: map[string]*pb.Places{}}
+	for dcid, chain := range chains {
+		places := &pb.Places{}
+		for _, p := range chain {
+			places.Places = append(places.Places, &pb.Place{Dcid: p.Dcid, Name: p.Name})
+		}
+		resp.Ancestors[dcid] = places
+	}
+	return resp, nil
+}
+
+// readParents reads the containedInPlace parents of places for the ancestor
+// index.
+func (s *Server) readParents(ctx context.Context, dcids []string) (
+	map[string][]ancestor.Place, error) {
+	nodes, err := getPropertyValuesHelper(ctx, s.store, dcids, "containedInPlace", true)
+	if err != nil {
+		return nil, err
+	}
+	result := make(map[string][]ancestor.Place, len(nodes))
+	for dcid, parents := range nodes {
+		for _, parent := range parents {
+			result[dcid] = append(result[dcid], ancestor.Place{
+				Dcid:  parent.Dcid,
+				Name:  parent.Name,
+				Types: parent.Types,
+			})
+		}
+	}
+	return result, nil
+}
@@ -16,8 +16,15 @@ package server
 
 import (
 	"context"
+	"errors"
+	"log"
+	"runtime"
+	"sync"
+	"sync/atomic"
+	"time"
 
 	"cloud.google.com/go/bigtable"
+	"github.com/datacommonsorg/mixer/internal/limiter"
 	"github.com/datacommonsorg/mixer/internal/store"
 	"github.com/datacommonsorg/mixer/internal/util"
 	"golang.org/x/sync/errgroup"
@@ -25,48 +32,282 @@ import (
 	"google.golang.org/grpc/status"
 )
 
+// decodeSlots bounds the goroutines that decode rows, across all the reads of
+// the process.
+var decodeSlots = make(chan struct{}, runtime.GOMAXPROCS(0))
+
 // Generates a function to be used as the callback function in Bigtable Read.
 // This utilizes the Golang closure so the arguments can be scoped in the
 // generated function.
 func readRowFn(
 	errCtx context.Context,
+	store *store.Store,
 	btTable *bigtable.Table,
+	tableName string,
 	rowSetPart bigtable.RowSet,
 	getToken func(string) (string, error),
 	action func(string, []byte) (interface{}, error),
+	filter *sourceFilter,
 	elemChan chan chanData,
 ) func() error {
+	if getToken == nil {
+		getToken = util.KeyToDcid
+	}
+	decode := func(rowKey string, raw []byte) (chanData, bool) {
+		token, err := getToken(rowKey)
+		if err != nil {
+			return chanData{}, false
+		}
+		jsonRaw, err := decodeRow(raw)
+		if err != nil {
+			return chanData{}, false
+		}
+		elem, err := action(token, jsonRaw)
+		if err != nil {
+			return chanData{}, false
+		}
+		return chanData{token, elem}, true
+	}
 	return func() error {
-		if err := btTable.ReadRows(errCtx, rowSetPart,
-			func(btRow bigtable.Row) bool {
-				if len(btRow[util.BtFamily]) == 0 {
-					return true
+		// Rows are decoded in goroutines while a slot is free, so the stream
+		// keeps being drained. Otherwise the read callback decodes the row,
+		// which holds back the stream.
+		var failed int32
+		var wg sync.WaitGroup
+		enqueue := func(rowKey string, raw []byte) bool {
+			if atomic.LoadInt32(&failed) != 0 {
+				return false
+			}
+			select {
+			case decodeSlots <- struct{}{}:
+				wg.Add(1)
+				go func() {
+					defer wg.Done()
+					elem, ok := decode(rowKey, raw)
+					<-decodeSlots
+					if !ok {
+						atomic.StoreInt32(&failed, 1)
+						return
+					}
+					elemChan <- elem
+				}()
+			default:
+				elem, ok := decode(rowKey, raw)
+				if !ok {
+					atomic.StoreInt32(&failed, 1)
+					return false
 				}
-				raw := btRow[util.BtFamily][0].Value
+				elemChan <- elem
+			}
+			return true
+		}
+		rowList, isRowList := rowSetPart.(bigtable.RowList)
+		var err error
+		if isRowList {
+			err = readRows(errCtx, store, btTable, tableName, rowList, true, filter, enqueue)
+		} else {
+			err = withLimit(errCtx, store.Limiter(btTable), func() (int, error) {
+				var n int
+				err := btTable.ReadRows(errCtx, rowSetPart,
+					func(btRow bigtable.Row) bool {
+						n++
+						raw := rowValue(btRow)
+						if raw == nil {
+							return true
+						}
+						return enqueue(btRow.Key(), raw)
+					}, readOptions(filter)...)
+				return n, err
+			})
+		}
+		wg.Wait()
+		return err
+	}
+}
+
+// readOptions returns the Bigtable read options of a source filter.
+func readOptions(filter *sourceFilter) []bigtable.ReadOption {
+	if filter == nil {
+		return nil
+	}
+	return []bigtable.ReadOption{bigtable.RowFilter(filter.btFilter())}
+}
 
-				if getToken == nil {
-					getToken = util.KeyToDcid
+// Reads of at most this number of rows are merged with the reads of other
+// requests when a batcher is set. Larger reads already amortize the cost of a
+// stream.
+const maxBatchedRows = 8
+
+// rowCacheKey is the key of a row in the row cache.
+func rowCacheKey(tableName, rowKey string) string {
+	return tableName + "\x00" + rowKey
+}
+
+// readRows reads the raw value of each row in a row list and calls f with it,
+// until f returns false. Rows that do not exist are skipped.
+//
+// Rows are read from the row cache first, then from the disk cache. When
+// forward is true, rows owned by other replicas are read from them, falling
+// back to Bigtable if a replica fails. The remaining rows are read from
+// Bigtable and added to the row cache.
+//
+// When filter is set, only the selected source columns are read. The rows are
+// cached per filter and are not forwarded, as replicas read whole rows.
+//
+// Small reads of whole rows are merged with the concurrent reads of other
+// requests when the store has a batcher.
+func readRows(
+	ctx context.Context,
+	store *store.Store,
+	btTable *bigtable.Table,
+	tableName string,
+	rowList bigtable.RowList,
+	forward bool,
+	filter *sourceFilter,
+	f func(rowKey string, raw []byte) bool,
+) error {
+	cache := store.RowCache
+	if tableName == "" {
+		// The cached data can not be tied to a table.
+		cache = nil
+	}
+	if filter != nil {
+		tableName += "\x00" + filter.key()
+		forward = false
+	}
+	misses := rowList
+	if cache != nil {
+		misses = nil
+		for _, rowKey := range rowList {
+			cacheKey := rowCacheKey(tableName, rowKey)
+			raw, ok := cache.Get(cacheKey)
+			if !ok && store.DiskCache != nil {
+				if raw, ok = store.DiskCache.Get(cacheKey); ok {
+					cache.Add(cacheKey, raw)
 				}
-				token, err := getToken(btRow.Key())
-				if err != nil {
-					return false
+			}
+			if !ok {
+				misses = append(misses, rowKey)
+				continue
+			}
+			store.Prefetcher.Used(rowKey)
+			if raw != nil && !f(rowKey, raw) {
+				return nil
+			}
+		}
+	}
+
+	if forward && store.Peers != nil && tableName != "" && len(misses) > 0 {
+		local, remote := store.Peers.Split(misses)
+		misses = local
+		type peerResult struct {
+			rowKeys []string
+			rows    map[string][]byte
+			err     error
+		}
+		results := make(chan peerResult, len(remote))
+		for peer, rowKeys := range remote {
+			peer, rowKeys := peer, rowKeys
+			go func() {
+				rows, err := store.Peers.ReadRows(ctx, peer, tableName, rowKeys)
+				results <- peerResult{rowKeys, rows, err}
+			}()
+		}
+		for range remote {
+			result := <-results
+			if result.err != nil {
+				// Fall back to Bigtable.
+				misses = append(misses, result.rowKeys...)
+				continue
+			}
+			for _, rowKey := range result.rowKeys {
+				if raw, ok := result.rows[rowKey]; ok && !f(rowKey, raw) {
+					return nil
 				}
+			}
+		}
+	}
 
-				jsonRaw, err := util.UnzipAndDecode(string(raw))
-				if err != nil {
-					return false
+	if len(misses) == 0 {
+		return nil
+	}
+	if store.Batcher != nil && filter == nil && tableName != "" &&
+		len(misses) <= maxBatchedRows {
+		rows, err := store.Batcher.Read(ctx, tableName, misses,
+			func(ctx context.Context, rowKeys []string) (map[string][]byte, error) {
+				var rows map[string][]byte
+				err := withLimit(ctx, store.Limiter(btTable), func() (int, error) {
+					var err error
+					rows, err = readRawRows(ctx, btTable, rowKeys)
+					return len(rows), err
+				})
+				return rows, err
+			})
+		if err != nil {
+			return err
+		}
+		for _, rowKey := range misses {
+			raw := rows[rowKey]
+			if cache != nil {
+				cache.Add(rowCacheKey(tableName, rowKey), raw)
+			}
+			if raw != nil && !f(rowKey, raw) {
+				return nil
+			}
+		}
+		return nil
+	}
+	found := map[string]struct{}{}
+	stopped := false
+	// Only the Bigtable read takes a slot of the limiter, the rows served from
+	// the caches and the replicas do not load the table.
+	err := withLimit(ctx, store.Limiter(btTable), func() (int, error) {
+		var n int
+		err := btTable.ReadRows(ctx, misses,
+			func(btRow bigtable.Row) bool {
+				n++
+				raw := rowValue(btRow)
+				if cache != nil {
+					found[btRow.Key()] = struct{}{}
+					cache.Add(rowCacheKey(tableName, btRow.Key()), raw)
+				}
+				if raw == nil {
+					return true
 				}
-				elem, err := action(token, jsonRaw)
-				if err != nil {
+				if !f(btRow.Key(), raw) {
+					stopped = true
 					return false
 				}
-				elemChan <- chanData{token, elem}
 				return true
-			}); err != nil {
-			return err
+			}, readOptions(filter)...)
+		return n, err
+	})
+	if err != nil {
+		return err
+	}
+	if cache != nil && !stopped {
+		// Remember the rows that do not exist.
+		for _, rowKey := range misses {
+			if _, ok := found[rowKey]; !ok {
+				cache.Add(rowCacheKey(tableName, rowKey), nil)
+			}
 		}
-		return nil
 	}
+	return nil
+}
+
+// readRawRows reads the raw value of each row in a row list. Rows that do not
+// exist are missing from the result.
+func readRawRows(
+	ctx context.Context, btTable *bigtable.Table, rowKeys []string) (
+	map[string][]byte, error) {
+	rows := make(map[string][]byte, len(rowKeys))
+	err := btTable.ReadRows(ctx, bigtable.RowList(rowKeys),
+		func(btRow bigtable.Row) bool {
+			rows[btRow.Key()] = rowValue(btRow)
+			return true
+		})
+	return rows, err
 }
 
 // bigTableReadRowsParallel reads BigTable rows from base Bigtable and branch
@@ -93,9 +334,46 @@ func bigTableReadRowsParallel(
 	readBranch bool,
 ) (
 	map[string]interface{}, map[string]interface{}, error,
+) {
+	return bigTableReadSources(ctx, store, rowSet, action, getToken, readBranch, nil)
+}
+
+// bigTableReadSources is bigTableReadRowsParallel that only reads the source
+// columns selected by filter, when it is not nil.
+func bigTableReadSources(
+	ctx context.Context,
+	store *store.Store,
+	rowSet bigtable.RowSet,
+	action func(string, []byte) (interface{}, error),
+	getToken func(string) (string, error),
+	readBranch bool,
+	filter *sourceFilter,
+) (
+	map[string]interface{}, map[string]interface{}, error,
+) {
+	return bigTableReadTables(ctx, store, rowSet, action, getToken, true, readBranch, filter)
+}
+
+// bigTableReadTables is bigTableReadSources that skips the base table when
+// readBase is false.
+func bigTableReadTables(
+	ctx context.Context,
+	store *store.Store,
+	rowSet bigtable.RowSet,
+	action func(string, []byte) (interface{}, error),
+	getToken func(string) (string, error),
+	readBase bool,
+	readBranch bool,
+	filter *sourceFilter,
+) (
+	map[string]interface{}, map[string]interface{}, error,
 ) {
 	baseBt := store.BaseBt()
+	if !readBase {
+		baseBt = nil
+	}
 	branchBt := store.BranchBt()
+	baseTableName, branchTableName := store.TableNames()
 	if baseBt == nil && branchBt == nil {
 		return nil, nil, status.Errorf(
 			codes.NotFound, "Bigtable instance is not specified")
@@ -123,7 +401,24 @@ func bigTableReadRowsParallel(
 	baseChan := make(chan chanData, rowSetSize)
 	branchChan := make(chan chanData, rowSetSize)
 
+	// The branch table is skipped when its circuit breaker is open. It is read
+	// in its own group, so its failures do not cancel the base table reads.
+	useBranch := readBranch && branchBt != nil
+	branchBreaker := store.BranchBreaker
+	if useBranch && branchBreaker != nil && !branchBreaker.Allow(time.Now()) {
+		useBranch = false
+		util.MarkStale(ctx)
+	}
 	errs, errCtx := errgroup.WithContext(ctx)
+	branchCtx, cancelBranch := context.WithCancel(ctx)
+	defer cancelBranch()
+	if useBranch && branchBreaker != nil {
+		var cancel context.CancelFunc
+		branchCtx, cancel = context.WithTimeout(branchCtx, branchBreaker.LatencyBudget())
+		defer cancel()
+	}
+	branchErrs, branchErrCtx := errgroup.WithContext(branchCtx)
+	branchStart := time.Now()
 	for i := 0; i <= rowSetSize/util.BtBatchQuerySize; i++ {
 		left := i * util.BtBatchQuerySize
 		right := (i + 1) * util.BtBatchQuerySize
@@ -138,16 +433,54 @@ func bigTableReadRowsParallel(
 		}
 		// Read from all the given tables.
 		if baseBt != nil {
-			errs.Go(readRowFn(errCtx, baseBt, rowSetPart, getToken, action, baseChan))
+			errs.Go(readRowFn(errCtx, store, baseBt, baseTableName, rowSetPart,
+				getToken, action, filter, baseChan))
 		}
-		if readBranch && branchBt != nil {
-			errs.Go(readRowFn(errCtx, branchBt, rowSetPart, getToken, action, branchChan))
+		if useBranch {
+			branchErrs.Go(readRowFn(branchErrCtx, store, branchBt, branchTableName,
+				rowSetPart, getToken, action, filter, branchChan))
 		}
 	}
+	// The branch reads are waited for concurrently with the base reads, so the
+	// breaker records their own latency.
+	var branchErr error
+	var branchEnd time.Time
+	branchDone := make(chan struct{})
+	if useBranch {
+		go func() {
+			branchErr = branchErrs.Wait()
+			branchEnd = time.Now()
+			close(branchDone)
+		}()
+	} else {
+		close(branchDone)
+	}
 	err := errs.Wait()
 	if err != nil {
+		// The branch reads are cancelled with the base reads.
+		if useBranch {
+			cancelBranch()
+			<-branchDone
+			if branchBreaker != nil {
+				branchBreaker.Cancel()
+			}
+		}
 		return nil, nil, err
 	}
+	<-branchDone
+	if useBranch {
+		if branchBreaker != nil {
+			branchBreaker.Record(branchEnd, branchEnd.Sub(branchStart), branchErr)
+			if branchErr != nil {
+				log.Printf("Serving base cache only, failed to read branch cache: %v",
+					branchErr)
+				useBranch = false
+				util.MarkStale(ctx)
+			}
+		} else if branchErr != nil {
+			return nil, nil, branchErr
+		}
+	}
 	close(baseChan)
 	close(branchChan)
 
@@ -159,12 +492,43 @@ func bigTableReadRowsParallel(
 	}
 
 	branchResult := map[string]interface{}{}
-	if readBranch {
-		if branchBt != nil {
-			for elem := range branchChan {
-				branchResult[elem.token] = elem.data
-			}
+	if useBranch {
+		for elem := range branchChan {
+			branchResult[elem.token] = elem.data
 		}
 	}
 	return baseResult, branchResult, nil
 }
+
+// withLimit runs a Bigtable read in a slot of a concurrency limiter, if it is
+// not nil. The read returns the number of rows it read.
+func withLimit(
+	ctx context.Context, l *limiter.Limiter, read func() (int, error)) error {
+	if l == nil {
+		_, err := read()
+		return err
+	}
+	token, err := l.Acquire(ctx)
+	if err != nil {
+		return err
+	}
+	rows, err := read()
+	token.Done(rows, isBackendFailure(err))
+	return err
+}
+
+// isBackendFailure returns whether an error is caused by an overloaded or
+// unavailable backend.
+func isBackendFailure(err error) bool {
+	if err == nil {
+		return false
+	}
+	if errors.Is(err, context.DeadlineExceeded) {
+		return true
+	}
+	switch status.Code(err) {
+	case codes.DeadlineExceeded, codes.Unavailable, codes.ResourceExhausted:
+		return true
+	}
+	return false
+}
@@ -16,10 +16,15 @@ package server
 
 import (
 	"context"
+	"fmt"
 	"testing"
+	"time"
 
 	"cloud.google.com/go/bigtable"
+	"github.com/datacommonsorg/mixer/internal/peer"
+	"github.com/datacommonsorg/mixer/internal/rowcache"
 	"github.com/datacommonsorg/mixer/internal/store"
+	"github.com/datacommonsorg/mixer/internal/util"
 	"github.com/google/go-cmp/cmp"
 )
 
@@ -102,3 +107,106 @@ func TestReadTwoTables(t *testing.T) {
 		}
 	}
 }
+
+func TestReadRowsWithCacheAndPeers(t *testing.T) {
+	ctx := context.Background()
+	keys := []string{
+		"d/f/geoId/06^Count_Person",
+		"d/f/geoId/07^Count_Person",
+		"d/f/geoId/08^Count_Person",
+	}
+	data := map[string]string{}
+	want := map[string]interface{}{}
+	for _, key := range keys[:2] {
+		value, err := util.ZipAndEncode([]byte(key))
+		if err != nil {
+			t.Fatalf("ZipAndEncode() = %v", err)
+		}
+		data[key] = value
+		want[key] = key
+	}
+	btTable, err := SetupBigtable(ctx, data)
+	if err != nil {
+		t.Fatalf("setupBigtable got error: %v", err)
+	}
+	st := store.NewStore(nil, btTable, nil)
+	st.SetTableNames("base", "")
+	st.RowCache = rowcache.New(1<<20, nil)
+	// The other replica is not reachable, so its rows are read from Bigtable.
+	st.Peers = peer.NewRouter("localhost:0", time.Second)
+	if err := st.Peers.SetPeers([]string{"localhost:0", "localhost:1"}); err != nil {
+		t.Fatalf("SetPeers() = %v", err)
+	}
+
+	for i := 0; i < 2; i++ {
+		baseDataMap, _, err := bigTableReadRowsParallel(
+			ctx,
+			st,
+			bigtable.RowList(keys),
+			func(token string, jsonRaw []byte) (interface{}, error) {
+				return string(jsonRaw), nil
+			},
+			func(key string) (string, error) {
+				return key, nil
+			},
+			false, /* readBranch */
+		)
+		if err != nil {
+			t.Fatalf("btReadRowsParallel got error: %v", err)
+		}
+		if diff := cmp.Diff(want, baseDataMap); diff != "" {
+			t.Errorf("read rows %d got diff %+v", i, diff)
+		}
+	}
+	// The missing row is cached too.
+	if got := st.RowCache.Len(); got != len(keys) {
+		t.Errorf("RowCache.Len() = %d, want %d", got, len(keys))
+	}
+}
+
+func TestReadRowsDecodeInParallel(t *testing.T) {
+	ctx := context.Background()
+	data := map[string]string{}
+	want := map[string]interface{}{}
+	var keys []string
+	for i := 0; i < 200; i++ {
+		key := fmt.Sprintf("d/f/geoId/%03d^Count_Person", i)
+		value, err := util.ZipAndEncode([]byte(key))
+		if err != nil {
+			t.Fatalf("ZipAndEncode() = %v", err)
+		}
+		data[key] = value
+		want[key] = key
+		keys = append(keys, key)
+	}
+	btTable, err := SetupBigtable(ctx, data)
+	if err != nil {
+		t.Fatalf("setupBigtable got error: %v", err)
+	}
+	st := store.NewStore(nil, btTable, nil)
+	for _, rowSet := range []bigtable.RowSet{
+		bigtable.RowList(keys),
+		bigtable.PrefixRange("d/f/"),
+	} {
+		elemChan := make(chan chanData, len(keys))
+		err := readRowFn(ctx, st, btTable, "", rowSet,
+			func(key string) (string, error) {
+				return key, nil
+			},
+			func(token string, jsonRaw []byte) (interface{}, error) {
+				return string(jsonRaw), nil
+			},
+			nil, elemChan)()
+		if err != nil {
+			t.Fatalf("readRowFn(%v) got error: %v", rowSet, err)
+		}
+		close(elemChan)
+		got := map[string]interface{}{}
+		for elem := range elemChan {
+			got[elem.token] = elem.data
+		}
+		if diff := cmp.Diff(want, got); diff != "" {
+			t.Errorf("readRowFn(%v) got diff %+v", rowSet, diff)
+		}
+	}
+}
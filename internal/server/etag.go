@@ -0,0 +1,159 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"context"
+	"crypto/sha256"
+	"encoding/hex"
+	"strings"
+	"time"
+
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/datacommonsorg/mixer/internal/util"
+	"google.golang.org/grpc"
+	"google.golang.org/grpc/metadata"
+	"google.golang.org/protobuf/proto"
+	"google.golang.org/protobuf/reflect/protoreflect"
+	"google.golang.org/protobuf/reflect/protoregistry"
+)
+
+// gRPC metadata keys for conditional requests. These mirror the HTTP headers.
+const (
+	etagHeader         = "etag"
+	ifNoneMatchHeader  = "if-none-match"
+	cacheControlHeader = "cache-control"
+	// Set in the response header when the RPC is not executed because the
+	// client already has the response.
+	notModifiedHeader = "x-not-modified"
+)
+
+// ETag returns a strong validator of the response to a request, or "" when the
+// response can not be cached.
+//
+// A response only depends on the request and the cache data, so the validator
+// is a hash of the method, the request and the names of the tables and
+// BigQuery dataset that are served. Only the Mixer service is cacheable.
+func (s *Server) ETag(fullMethod string, req proto.Message) string {
+	if s.store == nil || !strings.HasPrefix(fullMethod, "/datacommons.Mixer/") {
+		return ""
+	}
+	reqBytes, err := proto.MarshalOptions{Deterministic: true}.Marshal(req)
+	if err != nil {
+		return ""
+	}
+	baseTableName, branchTableName := s.store.TableNames()
+	var bqDataset string
+	if s.metadata != nil {
+		bqDataset = s.metadata.Bq
+	}
+	h := sha256.New()
+	for _, part := range []string{
+		fullMethod, baseTableName, branchTableName, bqDataset,
+	} {
+		h.Write([]byte(part))
+		h.Write([]byte{0})
+	}
+	// Related places without a seed are shuffled by the day of year.
+	if in, ok := req.(*pb.GetLandingPageDataRequest); ok && in.GetSeed() == 0 {
+		h.Write([]byte(time.Now().Format("2006-01-02")))
+		h.Write([]byte{0})
+	}
+	h.Write(reqBytes)
+	return `"` + hex.EncodeToString(h.Sum(nil)[:16]) + `"`
+}
+
+// ETagInterceptor is a gRPC unary interceptor for conditional requests.
+//
+// The entity tag and cache control are sent as response headers of successful
+// responses, errors are not cacheable. When the
+// "if-none-match" request metadata matches the entity tag, the RPC is not
+// executed and an empty response is returned with the "x-not-modified" header.
+// Stale responses are sent with the "x-data-stale" header and are not cached.
+func (s *Server) ETagInterceptor(
+	ctx context.Context,
+	req interface{},
+	info *grpc.UnaryServerInfo,
+	handler grpc.UnaryHandler,
+) (interface{}, error) {
+	var etag string
+	if m, ok := req.(proto.Message); ok {
+		etag = s.ETag(info.FullMethod, m)
+	}
+	if etag != "" {
+		if md, ok := metadata.FromIncomingContext(ctx); ok {
+			for _, ifNoneMatch := range md.Get(ifNoneMatchHeader) {
+				if !util.ETagMatch(ifNoneMatch, etag) {
+					continue
+				}
+				resp := emptyResponse(info.FullMethod)
+				if resp == nil {
+					break
+				}
+				_ = grpc.SetHeader(ctx, metadata.Pairs(
+					etagHeader, etag,
+					cacheControlHeader, util.CacheControl,
+					notModifiedHeader, "true",
+				))
+				return resp, nil
+			}
+		}
+	}
+	handlerCtx, isStale := util.WithStaleFlag(ctx)
+	resp, err := handler(handlerCtx, req)
+	if err != nil {
+		// Errors are not cacheable.
+		return resp, err
+	}
+	if isStale() {
+		_ = grpc.SetHeader(ctx, metadata.Pairs(
+			util.StaleHeader, "true",
+			cacheControlHeader, util.StaleCacheControl,
+		))
+	} else if etag != "" {
+		_ = grpc.SetHeader(ctx, metadata.Pairs(
+			etagHeader, etag,
+			cacheControlHeader, util.CacheControl,
+		))
+	}
+	return resp, nil
+}
+
+// emptyResponse creates an empty response message for a method name like
+// "/datacommons.Mixer/GetStats".
+func emptyResponse(fullMethod string) proto.Message {
+	parts := strings.Split(strings.TrimPrefix(fullMethod, "/"), "/")
+	if len(parts) != 2 {
+		return nil
+	}
+	desc, err := protoregistry.GlobalFiles.FindDescriptorByName(
+		protoreflect.FullName(parts[0]))
+	if err != nil {
+		return nil
+	}
+	sd, ok := desc.(protoreflect.ServiceDescriptor)
+	if !ok {
+		return nil
+	}
+	md := sd.Methods().ByName(protoreflect.Name(parts[1]))
+	if md == nil {
+		return nil
+	}
+	mt, err := protoregistry.GlobalTypes.FindMessageByName(md.Output().FullName())
+	if err != nil {
+		return nil
+	}
+	return mt.New().Interface()
+}
@@ -0,0 +1,96 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"context"
+	"testing"
+
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/datacommonsorg/mixer/internal/store"
+	"github.com/google/go-cmp/cmp"
+	"google.golang.org/grpc"
+	"google.golang.org/grpc/metadata"
+	"google.golang.org/protobuf/testing/protocmp"
+)
+
+const getStatValueMethod = "/datacommons.Mixer/GetStatValue"
+
+func TestETag(t *testing.T) {
+	s := &Server{
+		store:    store.NewStore(nil, nil, nil),
+		metadata: &Metadata{Bq: "dataset"},
+	}
+	s.SetTableNames("base1", "branch1")
+	req := &pb.GetStatValueRequest{Place: "geoId/06", StatVar: "Count_Person"}
+	etag := s.ETag(getStatValueMethod, req)
+	if etag == "" {
+		t.Fatalf("ETag() is empty")
+	}
+	if got := s.ETag(getStatValueMethod, &pb.GetStatValueRequest{
+		Place: "geoId/06", StatVar: "Count_Person"}); got != etag {
+		t.Errorf("ETag() of the same request = %s, want %s", got, etag)
+	}
+	if got := s.ETag(getStatValueMethod, &pb.GetStatValueRequest{
+		Place: "geoId/07", StatVar: "Count_Person"}); got == etag {
+		t.Errorf("ETag() of a different request should change")
+	}
+	s.SetTableNames("base1", "branch2")
+	if got := s.ETag(getStatValueMethod, req); got == etag {
+		t.Errorf("ETag() should change with the branch table")
+	}
+}
+
+func TestETagInterceptor(t *testing.T) {
+	s := &Server{store: store.NewStore(nil, nil, nil)}
+	s.SetTableNames("base", "branch")
+	req := &pb.GetStatValueRequest{Place: "geoId/06", StatVar: "Count_Person"}
+	etag := s.ETag(getStatValueMethod, req)
+	info := &grpc.UnaryServerInfo{FullMethod: getStatValueMethod}
+
+	for _, c := range []struct {
+		ifNoneMatch string
+		wantCalled  bool
+		want        *pb.GetStatValueResponse
+	}{
+		{"", true, &pb.GetStatValueResponse{Value: 1}},
+		{`"other"`, true, &pb.GetStatValueResponse{Value: 1}},
+		{etag, false, &pb.GetStatValueResponse{}},
+		{`"other", W/` + etag, false, &pb.GetStatValueResponse{}},
+	} {
+		ctx := context.Background()
+		if c.ifNoneMatch != "" {
+			ctx = metadata.NewIncomingContext(
+				ctx, metadata.Pairs(ifNoneMatchHeader, c.ifNoneMatch))
+		}
+		called := false
+		resp, err := s.ETagInterceptor(ctx, req, info,
+			func(ctx context.Context, req interface{}) (interface{}, error) {
+				called = true
+				return &pb.GetStatValueResponse{Value: 1}, nil
+			})
+		if err != nil {
+			t.Errorf("ETagInterceptor(%s) = %v", c.ifNoneMatch, err)
+			continue
+		}
+		if called != c.wantCalled {
+			t.Errorf("ETagInterceptor(%s) called handler: %t, want %t",
+				c.ifNoneMatch, called, c.wantCalled)
+		}
+		if diff := cmp.Diff(resp, c.want, protocmp.Transform()); diff != "" {
+			t.Errorf("ETagInterceptor(%s) got diff %v", c.ifNoneMatch, diff)
+		}
+	}
+}
@@ -0,0 +1,275 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"context"
+	"encoding/base64"
+	"fmt"
+	"hash/fnv"
+	"sort"
+	"strings"
+
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/status"
+)
+
+const (
+	defaultExportBatchSize = 10000
+	maxExportBatchSize     = 100000
+	// Number of Bigtable rows read at a time by an export.
+	exportReadRows = 1000
+)
+
+// ExportStat implements API for Mixer.ExportStat.
+//
+// The observations are exported by place, then by stat var in the order of the
+// request. The places are read a chunk at a time, and the next chunk is only
+// read once the batches of the previous one are sent. As Send blocks on the
+// flow control of the stream, a slow client holds back the reads.
+func (s *Server) ExportStat(
+	in *pb.ExportStatRequest, stream pb.Mixer_ExportStatServer) error {
+	ctx := stream.Context()
+	statVars := in.GetStatVars()
+	if len(statVars) == 0 {
+		return status.Errorf(codes.InvalidArgument,
+			"Missing required argument: stat_vars")
+	}
+	places, err := s.exportPlaces(ctx, in)
+	if err != nil {
+		return err
+	}
+	batchSize := int(in.GetBatchSize())
+	if batchSize <= 0 {
+		batchSize = defaultExportBatchSize
+	} else if batchSize > maxExportBatchSize {
+		batchSize = maxExportBatchSize
+	}
+	fingerprint := exportFingerprint(statVars, places)
+	pos, err := decodeExportCursor(in.GetCursor(), fingerprint)
+	if err != nil {
+		return err
+	}
+
+	total := len(places) * len(statVars)
+	if pos > total {
+		return status.Errorf(codes.InvalidArgument, "Invalid cursor")
+	}
+	chunk := exportReadRows / len(statVars)
+	if chunk < 1 {
+		chunk = 1
+	}
+	w := newExportWriter(batchSize, in.GetBestSource())
+	for pos < total {
+		first := pos / len(statVars)
+		last := first + chunk
+		if last > len(places) {
+			last = len(places)
+		}
+		rowList, keyTokens := buildStatsKey(places[first:last], statVars)
+		data, err := readStatsPb(ctx, s.store, rowList, keyTokens, nil)
+		if err != nil {
+			return err
+		}
+		for ; pos < last*len(statVars); pos++ {
+			place := places[pos/len(statVars)]
+			statVarIndex := pos % len(statVars)
+			w.add(statVarIndex, place, data[place][statVars[statVarIndex]])
+			if w.full() {
+				if err := stream.Send(w.flush(encodeExportCursor(fingerprint, pos+1))); err != nil {
+					return err
+				}
+			}
+		}
+	}
+	if w.rows() > 0 {
+		return stream.Send(w.flush(encodeExportCursor(fingerprint, total)))
+	}
+	return nil
+}
+
+// exportPlaces returns the places of an export request. The child places of a
+// parent place are sorted, so the cursors stay valid across requests.
+func (s *Server) exportPlaces(
+	ctx context.Context, in *pb.ExportStatRequest) ([]string, error) {
+	if len(in.GetPlaces()) > 0 {
+		return in.GetPlaces(), nil
+	}
+	parentPlace := in.GetParentPlace()
+	childType := in.GetChildType()
+	if parentPlace == "" || childType == "" {
+		return nil, status.Errorf(codes.InvalidArgument,
+			"Missing required argument: places, or parent_place and child_type")
+	}
+	places, err := readChildPlaces(ctx, s.store, parentPlace, childType)
+	if err != nil {
+		return nil, err
+	}
+	sort.Strings(places)
+	return places, nil
+}
+
+// exportFingerprint identifies the stat vars and places of an export, so a
+// cursor is not used with another request.
+func exportFingerprint(statVars, places []string) uint32 {
+	h := fnv.New32a()
+	for _, list := range [][]string{statVars, places} {
+		for _, s := range list {
+			h.Write([]byte(s))
+			h.Write([]byte{0})
+		}
+		h.Write([]byte{1})
+	}
+	return h.Sum32()
+}
+
+// encodeExportCursor encodes the position of the next <place, stat var> pair
+// to export.
+func encodeExportCursor(fingerprint uint32, pos int) string {
+	return base64.RawURLEncoding.EncodeToString(
+		[]byte(fmt.Sprintf("%08x:%d", fingerprint, pos)))
+}
+
+func decodeExportCursor(cursor string, fingerprint uint32) (int, error) {
+	if cursor == "" {
+		return 0, nil
+	}
+	raw, err := base64.RawURLEncoding.DecodeString(cursor)
+	if err != nil {
+		return 0, status.Errorf(codes.InvalidArgument, "Invalid cursor")
+	}
+	var got uint32
+	var pos int
+	if _, err := fmt.Sscanf(string(raw), "%x:%d", &got, &pos); err != nil || pos < 0 {
+		return 0, status.Errorf(codes.InvalidArgument, "Invalid cursor")
+	}
+	if got != fingerprint {
+		return 0, status.Errorf(codes.InvalidArgument,
+			"Cursor is from an export of other stat vars or places")
+	}
+	return pos, nil
+}
+
+// exportWriter builds the batches of an export, and keeps the dictionaries
+// across batches.
+type exportWriter struct {
+	batchSize  int
+	bestSource bool
+	places     map[string]int32
+	dates      map[string]int32
+	sources    map[string]int32
+	batch      *pb.ExportStatBatch
+}
+
+func newExportWriter(batchSize int, bestSource bool) *exportWriter {
+	return &exportWriter{
+		batchSize:  batchSize,
+		bestSource: bestSource,
+		places:     map[string]int32{},
+		dates:      map[string]int32{},
+		sources:    map[string]int32{},
+		batch:      &pb.ExportStatBatch{},
+	}
+}
+
+// add adds the observations of a series, by source rank then by date.
+func (w *exportWriter) add(statVarIndex int, place string, series *pb.ObsTimeSeries) {
+	if series == nil || len(series.SourceSeries) == 0 {
+		return
+	}
+	sourceSeries := append([]*pb.SourceSeries{}, series.SourceSeries...)
+	sort.Stable(SeriesByRank(sourceSeries))
+	if w.bestSource {
+		sourceSeries = sourceSeries[:1]
+	}
+	placeIndex := w.placeIndex(place)
+	for _, source := range sourceSeries {
+		sourceIndex := w.sourceIndex(source)
+		dates := make([]string, 0, len(source.Val))
+		for date := range source.Val {
+			dates = append(dates, date)
+		}
+		sort.Strings(dates)
+		for _, date := range dates {
+			w.batch.StatVar = append(w.batch.StatVar, int32(statVarIndex))
+			w.batch.Place = append(w.batch.Place, placeIndex)
+			w.batch.Date = append(w.batch.Date, w.dateIndex(date))
+			w.batch.Value = append(w.batch.Value, source.Val[date])
+			w.batch.Source = append(w.batch.Source, sourceIndex)
+		}
+	}
+}
+
+func (w *exportWriter) rows() int {
+	return len(w.batch.Value)
+}
+
+func (w *exportWriter) full() bool {
+	return w.rows() >= w.batchSize
+}
+
+// flush returns the current batch and starts a new one.
+func (w *exportWriter) flush(cursor string) *pb.ExportStatBatch {
+	batch := w.batch
+	batch.Cursor = cursor
+	w.batch = &pb.ExportStatBatch{}
+	return batch
+}
+
+func (w *exportWriter) placeIndex(place string) int32 {
+	if i, ok := w.places[place]; ok {
+		return i
+	}
+	i := int32(len(w.places))
+	w.places[place] = i
+	w.batch.PlaceDictionary = append(w.batch.PlaceDictionary, place)
+	return i
+}
+
+func (w *exportWriter) dateIndex(date string) int32 {
+	if i, ok := w.dates[date]; ok {
+		return i
+	}
+	i := int32(len(w.dates))
+	w.dates[date] = i
+	w.batch.DateDictionary = append(w.batch.DateDictionary, date)
+	return i
+}
+
+func (w *exportWriter) sourceIndex(source *pb.SourceSeries) int32 {
+	key := strings.Join([]string{
+		source.ImportName,
+		source.ProvenanceUrl,
+		source.MeasurementMethod,
+		source.ObservationPeriod,
+		source.ScalingFactor,
+		source.Unit,
+	}, "\x00")
+	if i, ok := w.sources[key]; ok {
+		return i
+	}
+	i := int32(len(w.sources))
+	w.sources[key] = i
+	w.batch.SourceDictionary = append(w.batch.SourceDictionary, &pb.StatMetadata{
+		ImportName:        source.ImportName,
+		ProvenanceUrl:     source.ProvenanceUrl,
+		MeasurementMethod: source.MeasurementMethod,
+		ObservationPeriod: source.ObservationPeriod,
+		ScalingFactor:     source.ScalingFactor,
+		Unit:              source.Unit,
+	})
+	return i
+}
@@ -0,0 +1,90 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"testing"
+
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/google/go-cmp/cmp"
+	"google.golang.org/protobuf/testing/protocmp"
+)
+
+func TestExportWriter(t *testing.T) {
+	pep := &pb.SourceSeries{
+		Val:               map[string]float64{"2019": 300, "2018": 200},
+		ImportName:        "CensusPEP",
+		MeasurementMethod: "CensusPEPSurvey",
+	}
+	acs := &pb.SourceSeries{
+		Val:               map[string]float64{"2018": 205},
+		ImportName:        "CensusACS5YearSurvey",
+		MeasurementMethod: "CensusACS5yrSurvey",
+	}
+	w := newExportWriter(3, false)
+	w.add(0, "geoId/06", &pb.ObsTimeSeries{SourceSeries: []*pb.SourceSeries{acs, pep}})
+	if !w.full() {
+		t.Fatalf("full() = false with %d rows", w.rows())
+	}
+	got := []*pb.ExportStatBatch{w.flush("c1")}
+	w.add(1, "geoId/06", nil)
+	w.add(1, "geoId/07", &pb.ObsTimeSeries{SourceSeries: []*pb.SourceSeries{pep}})
+	got = append(got, w.flush("c2"))
+
+	want := []*pb.ExportStatBatch{
+		{
+			PlaceDictionary: []string{"geoId/06"},
+			DateDictionary:  []string{"2018", "2019"},
+			SourceDictionary: []*pb.StatMetadata{
+				{ImportName: "CensusPEP", MeasurementMethod: "CensusPEPSurvey"},
+				{ImportName: "CensusACS5YearSurvey", MeasurementMethod: "CensusACS5yrSurvey"},
+			},
+			StatVar: []int32{0, 0, 0},
+			Place:   []int32{0, 0, 0},
+			Date:    []int32{0, 1, 0},
+			Value:   []float64{200, 300, 205},
+			Source:  []int32{0, 0, 1},
+			Cursor:  "c1",
+		},
+		{
+			// Only the new dictionary entries are sent.
+			PlaceDictionary: []string{"geoId/07"},
+			StatVar:         []int32{1, 1},
+			Place:           []int32{1, 1},
+			Date:            []int32{0, 1},
+			Value:           []float64{200, 300},
+			Source:          []int32{0, 0},
+			Cursor:          "c2",
+		},
+	}
+	if diff := cmp.Diff(want, got, protocmp.Transform()); diff != "" {
+		t.Errorf("exportWriter batches diff %v", diff)
+	}
+}
+
+func TestExportCursor(t *testing.T) {
+	fingerprint := exportFingerprint([]string{"Count_Person"}, []string{"geoId/06"})
+	cursor := encodeExportCursor(fingerprint, 42)
+	if pos, err := decodeExportCursor(cursor, fingerprint); err != nil || pos != 42 {
+		t.Errorf("decodeExportCursor() = %d, %v, want 42", pos, err)
+	}
+	other := exportFingerprint([]string{"Count_Person"}, []string{"geoId/07"})
+	if _, err := decodeExportCursor(cursor, other); err == nil {
+		t.Error("decodeExportCursor() accepted a cursor of another export")
+	}
+	if _, err := decodeExportCursor("not a cursor", fingerprint); err == nil {
+		t.Error("decodeExportCursor() accepted an invalid cursor")
+	}
+}
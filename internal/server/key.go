@@ -55,6 +55,34 @@ func buildStatsKey(
 	return rowList, keyToToken
 }
 
+func buildLatestStatsKey(
+	places []string, statVars []string) (
+	bigtable.RowList, map[string]*placeStatVar) {
+	rowList := bigtable.RowList{}
+	keyToToken := map[string]*placeStatVar{}
+	for _, sv := range statVars {
+		for _, place := range places {
+			rowKey := fmt.Sprintf("%s%s^%s", util.BtLatestStatPrefix, place, sv)
+			rowList = append(rowList, rowKey)
+			keyToToken[rowKey] = &placeStatVar{place, sv}
+		}
+	}
+	return rowList, keyToToken
+}
+
+func buildSeriesWithinPlaceKey(parentPlace, childType string, statVars []string) (
+	bigtable.RowList, map[string]string) {
+	rowList := bigtable.RowList{}
+	keyToToken := map[string]string{}
+	for _, sv := range statVars {
+		rowKey := util.BtSeriesWithinPlacePrefix + strings.Join(
+			[]string{parentPlace, childType, sv}, "^")
+		rowList = append(rowList, rowKey)
+		keyToToken[rowKey] = sv
+	}
+	return rowList, keyToToken
+}
+
 func buildStatSetWithinPlaceKey(parentPlace, childType, date string, statVars []string) (
 	bigtable.RowList, map[string]string) {
 
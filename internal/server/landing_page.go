@@ -16,7 +16,6 @@ package server
 
 import (
 	"context"
-	"encoding/json"
 	"fmt"
 	"hash/fnv"
 	"math/rand"
@@ -26,9 +25,9 @@ import (
 	"time"
 
 	"cloud.google.com/go/bigtable"
+	"github.com/datacommonsorg/mixer/internal/ancestor"
 	pb "github.com/datacommonsorg/mixer/internal/proto"
 	"github.com/datacommonsorg/mixer/internal/util"
-	"golang.org/x/sync/errgroup"
 	"google.golang.org/grpc/codes"
 	"google.golang.org/grpc/status"
 	"google.golang.org/protobuf/encoding/protojson"
@@ -182,21 +181,14 @@ func getLatestPop(ctx context.Context, s *Server, placeDcids []string) (
 	if len(placeDcids) == 0 {
 		return nil, nil
 	}
-	req := &pb.GetStatsRequest{
-		Place:    placeDcids,
-		StatsVar: "Count_Person",
-	}
-	resp, err := s.GetStats(ctx, req)
+	// The latest value of the best source, which the latest value cache does
+	// not hold: its point is the latest date across all sources.
+	stats, err := readRankedStats(ctx, s.store, placeDcids, "Count_Person", &ObsProp{})
 	if err != nil {
 		return nil, err
 	}
 	result := map[string]int32{}
-	tmp := map[string]*ObsTimeSeries{}
-	err = json.Unmarshal([]byte(resp.Payload), &tmp)
-	if err != nil {
-		return nil, err
-	}
-	for place, series := range tmp {
+	for place, series := range stats {
 		if series != nil {
 			latestDate := ""
 			latestValue := 0.0
@@ -268,16 +260,13 @@ func fetchBtData(
 
 	// Fetch additional stats as requested.
 	if len(statVars) > 0 {
-		resp, err := s.GetStatSetSeries(ctx, &pb.GetStatSetSeriesRequest{
-			Places:   places,
-			StatVars: statVars,
-		})
+		data, err := readBestSeries(ctx, s.store, places, statVars)
 		if err != nil {
 			return nil, err
 		}
 		// Add additional data to the cache result
-		for place, seriesMap := range resp.Data {
-			for statVar, series := range seriesMap.Data {
+		for place, seriesMap := range data {
+			for statVar, series := range seriesMap {
 				if result[place] == nil {
 					result[place] = &pb.StatVarSeries{Data: map[string]*pb.Series{}}
 				}
@@ -395,38 +384,21 @@ func getChildPlaces(ctx context.Context, s *Server, placedDcid, placeType string
 // Get parent places up to continent level.
 func getParentPlaces(ctx context.Context, s *Server, dcid string) (
 	[]string, error) {
-	result := []*pb.Place{}
-	for {
-		containedInPlaces, err := getPropertyValuesHelper(
-			ctx, s.store, []string{dcid}, "containedInPlace", true)
-		if err != nil {
-			return nil, err
-		}
-		if len(containedInPlaces) == 0 {
-			// There may be ancestors without any parents.
-			break
-		}
-		sort.SliceStable(containedInPlaces[dcid], func(i, j int) bool {
-			return containedInPlaces[dcid][i].Dcid > containedInPlaces[dcid][j].Dcid
-		})
-		for _, parent := range containedInPlaces[dcid] {
-			if parent.Types[0] == "CensusZipCodeTabulationArea" {
-				continue
-			}
-			result = append(result, &pb.Place{
-				Dcid: parent.Dcid,
-				Name: parent.Name,
-			})
-		}
-		if len(result) == 0 {
-			break
-		}
-		if _, ok := continents[result[len(result)-1].Name]; ok {
-			break
-		}
-		dcid = result[len(result)-1].Dcid
+	chains, err := s.ancestors.Ancestors(ctx, []string{dcid}, ancestor.Options{
+		ExcludeTypes: []string{"CensusZipCodeTabulationArea"},
+		StopAt: func(p ancestor.Place) bool {
+			_, ok := continents[p.Name]
+			return ok
+		},
+	})
+	if err != nil {
+		return nil, err
 	}
-	return getDcids(result), nil
+	result := []string{}
+	for _, parent := range chains[dcid] {
+		result = append(result, parent.Dcid)
+	}
+	return result, nil
 }
 
 // Get similar places.
@@ -533,53 +505,57 @@ func (s *Server) GetLandingPageData(
 	seed := in.GetSeed()
 	newStatVars := in.GetNewStatVars()
 
-	placeType, err := getPlaceType(ctx, s, placeDcid)
-	if err != nil {
-		return nil, err
-	}
-
-	// Fetch child and prarent places in go routines.
-	errs, errCtx := errgroup.WithContext(ctx)
+	// Related places are fetched in go routines. Their property value and
+	// population reads are merged by the loader.
+	ctx, l := withLoader(ctx, s.store)
 	relatedPlaceChan := make(chan *relatedPlace, 4)
 	allChildPlaceChan := make(chan map[string][]*pb.Place, 1)
 	var filteredChildPlaceType string
-	errs.Go(func() error {
-		childPlaces, err := getChildPlaces(errCtx, s, placeDcid, placeType)
-		if err != nil {
-			return err
-		}
-		allChildPlaceChan <- childPlaces
-		childPlaceType, childPlaceList := filterChildPlaces(childPlaces)
-		filteredChildPlaceType = childPlaceType
-		relatedPlaceChan <- &relatedPlace{category: childEnum, places: getDcids(childPlaceList)}
-		return nil
-	})
-	errs.Go(func() error {
-		parentPlaces, err := getParentPlaces(errCtx, s, placeDcid)
-		if err != nil {
-			return err
-		}
-		relatedPlaceChan <- &relatedPlace{category: parentEnum, places: parentPlaces}
-		return nil
-	})
-	errs.Go(func() error {
-		similarPlaces, err := getSimilarPlaces(errCtx, s, placeDcid, placeType, seed)
-		if err != nil {
-			return err
-		}
-		relatedPlaceChan <- &relatedPlace{category: similarEnum, places: similarPlaces}
-		return nil
-	})
-	errs.Go(func() error {
-		nearbyPlaces, err := getNearbyPlaces(errCtx, s, placeDcid)
-		if err != nil {
-			return err
-		}
-		relatedPlaceChan <- &relatedPlace{category: nearbyEnum, places: nearbyPlaces}
-		return nil
-	})
-
-	err = errs.Wait()
+	err := l.group(ctx,
+		func(ctx context.Context) error {
+			placeType, err := getPlaceType(ctx, s, placeDcid)
+			if err != nil {
+				return err
+			}
+			return l.group(ctx,
+				func(ctx context.Context) error {
+					childPlaces, err := getChildPlaces(ctx, s, placeDcid, placeType)
+					if err != nil {
+						return err
+					}
+					allChildPlaceChan <- childPlaces
+					childPlaceType, childPlaceList := filterChildPlaces(childPlaces)
+					filteredChildPlaceType = childPlaceType
+					relatedPlaceChan <- &relatedPlace{category: childEnum, places: getDcids(childPlaceList)}
+					return nil
+				},
+				func(ctx context.Context) error {
+					similarPlaces, err := getSimilarPlaces(ctx, s, placeDcid, placeType, seed)
+					if err != nil {
+						return err
+					}
+					relatedPlaceChan <- &relatedPlace{category: similarEnum, places: similarPlaces}
+					return nil
+				},
+			)
+		},
+		func(ctx context.Context) error {
+			parentPlaces, err := getParentPlaces(ctx, s, placeDcid)
+			if err != nil {
+				return err
+			}
+			relatedPlaceChan <- &relatedPlace{category: parentEnum, places: parentPlaces}
+			return nil
+		},
+		func(ctx context.Context) error {
+			nearbyPlaces, err := getNearbyPlaces(ctx, s, placeDcid)
+			if err != nil {
+				return err
+			}
+			relatedPlaceChan <- &relatedPlace{category: nearbyEnum, places: nearbyPlaces}
+			return nil
+		},
+	)
 	if err != nil {
 		return nil, err
 	}
@@ -618,5 +594,6 @@ func (s *Server) GetLandingPageData(
 		return nil, err
 	}
 	resp.StatVarSeries = statData
+	s.prefetchLandingPage(placeDcid, &resp)
 	return &resp, nil
 }
@@ -15,8 +15,10 @@
 package server
 
 import (
+	"context"
 	"testing"
 
+	"github.com/datacommonsorg/mixer/internal/ancestor"
 	"github.com/google/go-cmp/cmp"
 )
 
@@ -74,3 +76,57 @@ func TestGetCohort(t *testing.T) {
 		}
 	}
 }
+
+func TestGetParentPlaces(t *testing.T) {
+	graph := map[string][]ancestor.Place{
+		"geoId/0667000": {
+			{Dcid: "geoId/06", Types: []string{"State"}},
+			// Only places whose first type is a zip code are skipped.
+			{Dcid: "zip/94103", Types: []string{"Place", "CensusZipCodeTabulationArea"}},
+			{Dcid: "zip/94104", Types: []string{"CensusZipCodeTabulationArea"}},
+		},
+		// The chain goes on from country/USA, which is not a continent.
+		"geoId/06": {
+			{Dcid: "northamerica", Name: "North America", Types: []string{"Continent"}},
+			{Dcid: "country/USA", Name: "United States", Types: []string{"Country"}},
+		},
+		"country/USA": {{Dcid: "Earth", Types: []string{"Place"}}},
+		"country/FRA": {{Dcid: "europe", Name: "Europe", Types: []string{"Continent"}}},
+		"europe":      {{Dcid: "Earth", Types: []string{"Place"}}},
+	}
+	s := &Server{ancestors: ancestor.New(
+		func(ctx context.Context, dcids []string) (map[string][]ancestor.Place, error) {
+			result := map[string][]ancestor.Place{}
+			for _, dcid := range dcids {
+				if ps, ok := graph[dcid]; ok {
+					result[dcid] = append([]ancestor.Place{}, ps...)
+				}
+			}
+			return result, nil
+		}, 100)}
+	for _, c := range []struct {
+		dcid string
+		want []string
+	}{
+		{
+			"geoId/0667000",
+			[]string{"zip/94103", "geoId/06", "northamerica", "country/USA", "Earth"},
+		},
+		{
+			"country/FRA",
+			[]string{"europe"},
+		},
+		{
+			"Earth",
+			[]string{},
+		},
+	} {
+		got, err := getParentPlaces(context.Background(), s, c.dcid)
+		if err != nil {
+			t.Fatalf("getParentPlaces(%s) = %v", c.dcid, err)
+		}
+		if diff := cmp.Diff(c.want, got); diff != "" {
+			t.Errorf("getParentPlaces(%s) diff %v", c.dcid, diff)
+		}
+	}
+}
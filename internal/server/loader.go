@@ -0,0 +1,233 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"context"
+	"sync"
+	"time"
+
+	"cloud.google.com/go/bigtable"
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/datacommonsorg/mixer/internal/store"
+	"golang.org/x/sync/errgroup"
+	"google.golang.org/protobuf/proto"
+)
+
+// Longest time a read waits for the other goroutines of the request. It only
+// matters when a goroutine is blocked on something other than a loader read.
+const loaderMaxWait = 2 * time.Millisecond
+
+// loaderFamily is a cache family read by a loader.
+type loaderFamily struct {
+	action     func(string, []byte) (interface{}, error)
+	readBranch bool
+	// Returns a copy of a value of the family, so each goroutine of a merged
+	// read owns the values it gets.
+	clone func(interface{}) interface{}
+}
+
+var (
+	propertyValueFamily = &loaderFamily{action: convertToPropValues, clone: cloneNodes}
+	latestStatFamily    = &loaderFamily{action: convertToPointStat, readBranch: true, clone: clonePointStat}
+)
+
+func cloneNodes(v interface{}) interface{} {
+	nodes := v.([]*Node)
+	result := make([]*Node, len(nodes))
+	for i, node := range nodes {
+		n := *node
+		n.Types = append([]string(nil), node.Types...)
+		result[i] = &n
+	}
+	return result
+}
+
+func clonePointStat(v interface{}) interface{} {
+	return proto.Clone(v.(*pb.PointStat))
+}
+
+// loader merges the Bigtable reads of the goroutines of a request.
+//
+// A read waits until every goroutine started by group is waiting on a read,
+// then the rows of each cache family are read together. The handler code
+// stays sequential, and Bigtable sees one read per family in each round.
+type loader struct {
+	ctx   context.Context
+	store *store.Store
+	// Longest time a read waits for the other goroutines.
+	maxWait time.Duration
+
+	mu sync.Mutex
+	// Goroutines of the request that can read, and the ones waiting on a read.
+	active  int
+	waiting int
+	// Number of Bigtable reads started.
+	reads   int
+	pending map[*loaderFamily]*loaderBatch
+	timer   *time.Timer
+}
+
+type loaderBatch struct {
+	rowList bigtable.RowList
+	seen    map[string]struct{}
+
+	done   chan struct{}
+	base   map[string]interface{}
+	branch map[string]interface{}
+	err    error
+}
+
+type loaderKey struct{}
+
+// withLoader returns a context with a new loader, whose reads use the context.
+// The calling goroutine is the only active one until it starts a group.
+func withLoader(ctx context.Context, st *store.Store) (context.Context, *loader) {
+	l := &loader{
+		store:   st,
+		maxWait: loaderMaxWait,
+		active:  1,
+		pending: map[*loaderFamily]*loaderBatch{},
+	}
+	l.ctx = context.WithValue(ctx, loaderKey{}, l)
+	return l.ctx, l
+}
+
+// group runs fns in goroutines and waits for them, like an errgroup. The
+// calling goroutine does not read while it waits, so it is not active.
+func (l *loader) group(ctx context.Context, fns ...func(context.Context) error) error {
+	errs, errCtx := errgroup.WithContext(ctx)
+	l.mu.Lock()
+	l.active += len(fns) - 1
+	l.dispatch(false)
+	l.mu.Unlock()
+	for _, fn := range fns {
+		fn := fn
+		errs.Go(func() error {
+			defer func() {
+				l.mu.Lock()
+				l.active--
+				l.dispatch(false)
+				l.mu.Unlock()
+			}()
+			return fn(errCtx)
+		})
+	}
+	err := errs.Wait()
+	l.mu.Lock()
+	l.active++
+	l.mu.Unlock()
+	return err
+}
+
+// read reads the rows of a family with the reads of the other goroutines, and
+// returns the data of the base and branch tables keyed by row key. The maps
+// only have the rows of rowList, and the values are copies, so the caller can
+// modify them.
+func (l *loader) read(family *loaderFamily, rowList bigtable.RowList) (
+	map[string]interface{}, map[string]interface{}, error) {
+	l.mu.Lock()
+	b, ok := l.pending[family]
+	if !ok {
+		b = &loaderBatch{seen: map[string]struct{}{}, done: make(chan struct{})}
+		l.pending[family] = b
+	}
+	for _, rowKey := range rowList {
+		if _, ok := b.seen[rowKey]; !ok {
+			b.seen[rowKey] = struct{}{}
+			b.rowList = append(b.rowList, rowKey)
+		}
+	}
+	l.waiting++
+	if l.timer == nil {
+		l.timer = time.AfterFunc(l.maxWait, func() {
+			l.mu.Lock()
+			l.dispatch(true)
+			l.mu.Unlock()
+		})
+	}
+	l.dispatch(false)
+	l.mu.Unlock()
+
+	<-b.done
+	if b.err != nil {
+		return nil, nil, b.err
+	}
+	return family.copyRows(b.base, rowList), family.copyRows(b.branch, rowList), nil
+}
+
+// copyRows returns the data of the rows of rowList, with copied values.
+func (f *loaderFamily) copyRows(
+	data map[string]interface{}, rowList bigtable.RowList) map[string]interface{} {
+	result := map[string]interface{}{}
+	for _, rowKey := range rowList {
+		if v, ok := data[rowKey]; ok {
+			result[rowKey] = f.clone(v)
+		}
+	}
+	return result
+}
+
+// dispatch starts the pending reads once all the active goroutines wait on
+// them, or right away if force is true. l.mu must be held.
+func (l *loader) dispatch(force bool) {
+	if len(l.pending) == 0 || (!force && l.waiting < l.active) {
+		return
+	}
+	for family, b := range l.pending {
+		family, b := family, b
+		go func() {
+			b.base, b.branch, b.err = bigTableReadRowsParallel(
+				l.ctx, l.store, b.rowList, family.action,
+				func(rowKey string) (string, error) {
+					return rowKey, nil
+				},
+				family.readBranch,
+			)
+			close(b.done)
+		}()
+	}
+	l.reads += len(l.pending)
+	l.pending = map[*loaderFamily]*loaderBatch{}
+	// Every waiting goroutine waits on one of the reads.
+	l.waiting = 0
+	if l.timer != nil {
+		l.timer.Stop()
+		l.timer = nil
+	}
+}
+
+// loadRows reads the rows of a cache family and returns the data of the base
+// and branch tables keyed by row key. The read is merged with the reads of
+// the other goroutines of the request when the context has a loader.
+func loadRows(
+	ctx context.Context,
+	st *store.Store,
+	family *loaderFamily,
+	rowList bigtable.RowList) (map[string]interface{}, map[string]interface{}, error) {
+	if len(rowList) == 0 {
+		return map[string]interface{}{}, map[string]interface{}{}, nil
+	}
+	if l, ok := ctx.Value(loaderKey{}).(*loader); ok {
+		return l.read(family, rowList)
+	}
+	return bigTableReadRowsParallel(
+		ctx, st, rowList, family.action,
+		func(rowKey string) (string, error) {
+			return rowKey, nil
+		},
+		family.readBranch,
+	)
+}
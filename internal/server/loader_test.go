@@ -0,0 +1,105 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"context"
+	"testing"
+	"time"
+
+	"github.com/datacommonsorg/mixer/internal/store"
+	"github.com/datacommonsorg/mixer/internal/util"
+	"github.com/google/go-cmp/cmp"
+)
+
+func TestLoader(t *testing.T) {
+	ctx := context.Background()
+	data := map[string]string{}
+	for rowKey, jsonRaw := range map[string]string{
+		util.BtInPropValPrefix + "geoId/06^containedInPlace": `{"entities":[{"dcid":"geoId/06001"}]}`,
+		util.BtInPropValPrefix + "geoId/06^geoOverlaps":      `{"entities":[{"dcid":"geoId/0601"}]}`,
+		util.BtOutPropValPrefix + "geoId/06^typeOf":          `{"entities":[{"dcid":"State"}]}`,
+	} {
+		value, err := util.ZipAndEncode([]byte(jsonRaw))
+		if err != nil {
+			t.Fatalf("ZipAndEncode() = %v", err)
+		}
+		data[rowKey] = value
+	}
+	btTable, err := SetupBigtable(ctx, data)
+	if err != nil {
+		t.Fatalf("SetupBigtable() = %v", err)
+	}
+	st := store.NewStore(nil, btTable, nil)
+
+	ctx, l := withLoader(ctx, st)
+	// The reads are only merged by waiting for all the goroutines.
+	l.maxWait = time.Hour
+	reads := []struct {
+		prop   string
+		arcOut bool
+		want   string
+	}{
+		{"containedInPlace", false, "geoId/06001"},
+		// Reads the same row as the first goroutine.
+		{"containedInPlace", false, "geoId/06001"},
+		{"geoOverlaps", false, "geoId/0601"},
+		{"typeOf", true, "State"},
+	}
+	got := make([]string, len(reads))
+	rowCounts := make([]int, len(reads))
+	var fns []func(context.Context) error
+	for i, read := range reads {
+		i, read := i, read
+		fns = append(fns, func(ctx context.Context) error {
+			rowList := buildPropertyValuesKey([]string{"geoId/06"}, read.prop, read.arcOut)
+			rows, _, err := loadRows(ctx, st, propertyValueFamily, rowList)
+			if err != nil {
+				return err
+			}
+			rowCounts[i] = len(rows)
+			// The values are owned by the goroutine, so it can modify them.
+			node := rows[rowList[0]].([]*Node)[0]
+			got[i] = node.Dcid
+			node.Dcid = "modified"
+			nodes, err := getPropertyValuesHelper(ctx, st, []string{"geoId/06"}, read.prop, read.arcOut)
+			if err != nil {
+				return err
+			}
+			if nodes["geoId/06"][0].Dcid != read.want {
+				t.Errorf("getPropertyValuesHelper(%s) = %s, want %s",
+					read.prop, nodes["geoId/06"][0].Dcid, read.want)
+			}
+			return nil
+		})
+	}
+	if err := l.group(ctx, fns...); err != nil {
+		t.Fatalf("group() = %v", err)
+	}
+	for i, read := range reads {
+		if got[i] != read.want {
+			t.Errorf("loadRows(%s) = %s, want %s", read.prop, got[i], read.want)
+		}
+	}
+	// Each goroutine only gets its own rows.
+	if diff := cmp.Diff([]int{1, 1, 1, 1}, rowCounts); diff != "" {
+		t.Errorf("loadRows() rows diff %v", diff)
+	}
+	// The reads of the goroutines are merged, one Bigtable read for the
+	// loadRows calls and one for the getPropertyValuesHelper calls.
+	if l.reads != 2 {
+		t.Errorf("loader reads = %d, want 2", l.reads)
+	}
+}
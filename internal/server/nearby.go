@@ -0,0 +1,169 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"context"
+	"log"
+	"strconv"
+
+	"github.com/datacommonsorg/mixer/internal/geo"
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/status"
+)
+
+const (
+	defaultNearbyLimit = 10
+	maxNearbyLimit     = 1000
+	// Number of places filled from the graph at a time.
+	placeIndexBatchSize = 500
+)
+
+// GetPlacesNearby implements API for Mixer.GetPlacesNearby.
+// Endpoint: /place/nearby
+func (s *Server) GetPlacesNearby(ctx context.Context, in *pb.GetPlacesNearbyRequest) (
+	*pb.GetPlacesNearbyResponse, error) {
+	if s.placeIndex == nil {
+		return nil, status.Errorf(codes.FailedPrecondition, "Place index is not loaded")
+	}
+	q := geo.Query{
+		Latitude:      in.GetLatitude(),
+		Longitude:     in.GetLongitude(),
+		RadiusKm:      in.GetRadiusKm(),
+		K:             int(in.GetLimit()),
+		Type:          in.GetPlaceType(),
+		MinPopulation: in.GetMinPopulation(),
+	}
+	if place := in.GetPlace(); place != "" {
+		p, ok := s.placeIndex.Lookup(place)
+		if !ok {
+			return nil, status.Errorf(codes.NotFound, "No location for %s", place)
+		}
+		q.Latitude, q.Longitude = p.Latitude, p.Longitude
+		q.Exclude = place
+	} else if q.Latitude < -90 || q.Latitude > 90 || q.Longitude < -180 || q.Longitude > 180 {
+		return nil, status.Errorf(codes.InvalidArgument, "Invalid latitude or longitude")
+	}
+	if q.RadiusKm < 0 || q.K < 0 {
+		return nil, status.Errorf(codes.InvalidArgument, "Invalid radius_km or limit")
+	}
+	if q.K == 0 && q.RadiusKm == 0 {
+		q.K = defaultNearbyLimit
+	}
+	if q.K > maxNearbyLimit {
+		q.K = maxNearbyLimit
+	}
+	resp := &pb.GetPlacesNearbyResponse{}
+	for _, r := range s.placeIndex.Nearby(q) {
+		resp.Places = append(resp.Places, &pb.NearbyPlace{
+			Dcid:       r.Place.Dcid,
+			DistanceKm: r.DistanceKm,
+			Population: r.Place.Population,
+		})
+	}
+	return resp, nil
+}
+
+// LoadPlaceIndex builds the spatial index of place centroids from a snapshot.
+// The coordinates, types and populations missing from the snapshot are read
+// from the latitude, longitude and typeOf property values and the latest
+// Count_Person. The server should not serve traffic before this is done.
+func (s *Server) LoadPlaceIndex(ctx context.Context, path string) error {
+	places, err := geo.ReadSnapshot(path)
+	if err != nil {
+		return err
+	}
+	for i := 0; i < len(places); i += placeIndexBatchSize {
+		j := i + placeIndexBatchSize
+		if j > len(places) {
+			j = len(places)
+		}
+		if err := s.fillPlaces(ctx, places[i:j]); err != nil {
+			return err
+		}
+	}
+	located := places[:0]
+	for _, p := range places {
+		if p.HasLocation() {
+			if p.Population < 0 {
+				p.Population = 0
+			}
+			located = append(located, p)
+		}
+	}
+	s.placeIndex = geo.NewIndex(located)
+	log.Printf("Loaded %d places in the place index, %d without location",
+		len(located), len(places)-len(located))
+	return nil
+}
+
+// fillPlaces reads the missing fields of places from the graph.
+func (s *Server) fillPlaces(ctx context.Context, places []geo.Place) error {
+	var noLocation, noType, noPop []string
+	for _, p := range places {
+		if !p.HasLocation() {
+			noLocation = append(noLocation, p.Dcid)
+		}
+		if len(p.Types) == 0 {
+			noType = append(noType, p.Dcid)
+		}
+		if p.Population < 0 {
+			noPop = append(noPop, p.Dcid)
+		}
+	}
+	values := map[string]map[string][]*Node{}
+	for prop, dcids := range map[string][]string{
+		"latitude":  noLocation,
+		"longitude": noLocation,
+		"typeOf":    noType,
+	} {
+		if len(dcids) == 0 {
+			continue
+		}
+		nodes, err := getPropertyValuesHelper(ctx, s.store, dcids, prop, true)
+		if err != nil {
+			return err
+		}
+		values[prop] = nodes
+	}
+	pop, err := getLatestPop(ctx, s, noPop)
+	if err != nil {
+		return err
+	}
+	for i := range places {
+		p := &places[i]
+		if !p.HasLocation() {
+			lat := values["latitude"][p.Dcid]
+			lng := values["longitude"][p.Dcid]
+			if len(lat) > 0 && len(lng) > 0 {
+				latValue, latErr := strconv.ParseFloat(lat[0].Value, 64)
+				lngValue, lngErr := strconv.ParseFloat(lng[0].Value, 64)
+				if latErr == nil && lngErr == nil {
+					p.Latitude, p.Longitude = latValue, lngValue
+				}
+			}
+		}
+		if len(p.Types) == 0 {
+			for _, node := range values["typeOf"][p.Dcid] {
+				p.Types = append(p.Types, node.Dcid)
+			}
+		}
+		if v, ok := pop[p.Dcid]; ok {
+			p.Population = int64(v)
+		}
+	}
+	return nil
+}
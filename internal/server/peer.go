@@ -0,0 +1,60 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"context"
+
+	"cloud.google.com/go/bigtable"
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/datacommonsorg/mixer/internal/util"
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/status"
+)
+
+// ReadRows implements API for MixerPeer.ReadRows.
+//
+// The rows are read from the row cache or Bigtable, and never forwarded to
+// another replica.
+func (s *Server) ReadRows(ctx context.Context, in *pb.PeerReadRowsRequest) (
+	*pb.PeerReadRowsResponse, error) {
+	if len(in.GetRowKeys()) > util.BtBatchQuerySize {
+		return nil, status.Errorf(codes.InvalidArgument,
+			"Too many row keys: %d > %d", len(in.GetRowKeys()), util.BtBatchQuerySize)
+	}
+	baseTableName, branchTableName := s.store.TableNames()
+	var btTable *bigtable.Table
+	switch in.GetTable() {
+	case "":
+	case baseTableName:
+		btTable = s.store.BaseBt()
+	case branchTableName:
+		btTable = s.store.BranchBt()
+	}
+	if btTable == nil {
+		return nil, status.Errorf(codes.FailedPrecondition,
+			"Table %s is not served", in.GetTable())
+	}
+	rows := map[string][]byte{}
+	err := readRows(ctx, s.store, btTable, in.GetTable(), in.GetRowKeys(), false, nil,
+		func(rowKey string, raw []byte) bool {
+			rows[rowKey] = raw
+			return true
+		})
+	if err != nil {
+		return nil, err
+	}
+	return &pb.PeerReadRowsResponse{Rows: rows}, nil
+}
@@ -18,10 +18,7 @@ import (
 	"context"
 	"sort"
 
-	"encoding/json"
-
 	pb "github.com/datacommonsorg/mixer/internal/proto"
-	"github.com/datacommonsorg/mixer/internal/util"
 	"google.golang.org/grpc/codes"
 	"google.golang.org/grpc/status"
 )
@@ -32,14 +29,17 @@ func (s *Server) GetPlaceStatsVar(
 	ctx context.Context, in *pb.GetPlaceStatsVarRequest) (
 	*pb.GetPlaceStatsVarResponse, error) {
 
-	req := pb.GetPlaceStatVarsRequest{Dcids: in.GetDcids()}
-	resp, err := s.GetPlaceStatVars(ctx, &req)
+	dcids := in.GetDcids()
+	if len(dcids) == 0 {
+		return nil, status.Error(codes.InvalidArgument, "Missing required arguments: dcid")
+	}
+	places, err := readPlaceStatVars(ctx, s.store, dcids)
 	if err != nil {
 		return nil, err
 	}
 	out := pb.GetPlaceStatsVarResponse{Places: map[string]*pb.StatsVars{}}
-	for dcid, statVars := range resp.Places {
-		out.Places[dcid] = &pb.StatsVars{StatsVars: statVars.StatVars}
+	for dcid, statVars := range places {
+		out.Places[dcid] = &pb.StatsVars{StatsVars: statVars}
 	}
 	return &out, nil
 }
@@ -52,35 +52,13 @@ func (s *Server) GetPlaceStatVars(
 	if len(dcids) == 0 {
 		return nil, status.Error(codes.InvalidArgument, "Missing required arguments: dcid")
 	}
-	rowList := buildPlaceStatsVarKey(dcids)
-	baseDataMap, branchDataMap, err := bigTableReadRowsParallel(
-		ctx,
-		s.store,
-		rowList,
-		func(dcid string, jsonRaw []byte) (interface{}, error) {
-			var data PlaceStatsVar
-			err := json.Unmarshal(jsonRaw, &data)
-			if err != nil {
-				return nil, err
-			}
-			return data.StatVarIds, nil
-		},
-		nil,
-		true, /* readBranch */
-	)
+	places, err := readPlaceStatVars(ctx, s.store, dcids)
 	if err != nil {
 		return nil, err
 	}
 	resp := pb.GetPlaceStatVarsResponse{Places: map[string]*pb.StatVars{}}
-	for _, dcid := range dcids {
-		resp.Places[dcid] = &pb.StatVars{StatVars: []string{}}
-		if baseDataMap[dcid] != nil {
-			resp.Places[dcid].StatVars = baseDataMap[dcid].([]string)
-		}
-		if branchDataMap[dcid] != nil {
-			resp.Places[dcid].StatVars = util.MergeDedupe(
-				resp.Places[dcid].StatVars, baseDataMap[dcid].([]string))
-		}
+	for dcid, statVars := range places {
+		resp.Places[dcid] = &pb.StatVars{StatVars: statVars}
 	}
 	return &resp, nil
 }
@@ -106,28 +84,12 @@ func (s *Server) GetPlaceStatVarsUnion(
 		return nil, status.Error(
 			codes.InvalidArgument, "Missing required arguments: dcids")
 	}
-	resp, err := s.GetPlaceStatVars(ctx, &pb.GetPlaceStatVarsRequest{Dcids: dcids})
+	statVars, err := readPlaceStatVarsUnion(ctx, s.store, dcids)
 	if err != nil {
 		return nil, err
 	}
-	places := resp.GetPlaces()
-
-	// For single place, return directly.
-	if len(dcids[0]) == 1 {
-		return &pb.GetPlaceStatVarsUnionResponse{StatVars: places[dcids[0]]}, nil
-	}
-
-	// Get union of the statvars for multiple places.
-	set := map[string]bool{}
-	for _, statVars := range places {
-		for _, dcid := range statVars.GetStatVars() {
-			set[dcid] = true
-		}
-	}
 	return &pb.GetPlaceStatVarsUnionResponse{
-		StatVars: &pb.StatVars{
-			StatVars: keysToSlice(set),
-		},
+		StatVars: &pb.StatVars{StatVars: statVars},
 	}, nil
 }
 
@@ -154,11 +116,13 @@ func (s *Server) GetPlaceStatVarsUnionV1(
 		}
 		return result, nil
 	}
-	resp, err := s.GetPlaceStatVarsUnion(ctx, in)
+	if len(dcids) == 0 {
+		return nil, status.Error(
+			codes.InvalidArgument, "Missing required arguments: dcids")
+	}
+	union, err := readPlaceStatVarsUnion(ctx, s.store, dcids)
 	if err != nil {
 		return nil, err
 	}
-	return &pb.GetPlaceStatVarsUnionResponseV1{
-		StatVars: resp.StatVars.StatVars,
-	}, nil
+	return &pb.GetPlaceStatVarsUnionResponseV1{StatVars: union}, nil
 }
@@ -23,6 +23,7 @@ import (
 
 	"cloud.google.com/go/bigtable"
 	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/datacommonsorg/mixer/internal/store"
 	"github.com/datacommonsorg/mixer/internal/util"
 	"google.golang.org/grpc/codes"
 	"google.golang.org/grpc/status"
@@ -74,6 +75,31 @@ func (s *Server) GetPlacesIn(ctx context.Context, in *pb.GetPlacesInRequest) (
 	return &pb.GetPlacesInResponse{Payload: string(jsonRaw)}, nil
 }
 
+// readChildPlaces returns the places of childType contained in parentPlace.
+func readChildPlaces(
+	ctx context.Context, store *store.Store, parentPlace, childType string) (
+	[]string, error) {
+	rowList := buildPlaceInKey([]string{parentPlace}, childType)
+	// Place relations are from base geo imports. Only trust the base cache.
+	baseDataMap, _, err := bigTableReadRowsParallel(
+		ctx,
+		store,
+		rowList,
+		func(dcid string, jsonRaw []byte) (interface{}, error) {
+			return strings.Split(string(jsonRaw), ","), nil
+		},
+		nil,
+		false, /* readBranch */
+	)
+	if err != nil {
+		return nil, err
+	}
+	if baseDataMap[parentPlace] == nil {
+		return nil, nil
+	}
+	return append([]string{}, baseDataMap[parentPlace].([]string)...), nil
+}
+
 // RelatedLocationsPrefixMap is a map from different scenarios to key prefix for
 // RelatedLocations cache.
 //
@@ -0,0 +1,105 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"context"
+	"fmt"
+	"time"
+
+	"cloud.google.com/go/bigtable"
+	"github.com/datacommonsorg/mixer/internal/prefetch"
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/datacommonsorg/mixer/internal/util"
+)
+
+const (
+	// Maximum number of child places to prefetch after a landing page.
+	maxPrefetchChildPlaces = 20
+	// Number of hot stat vars to prefetch for the landing page places.
+	numPrefetchStatVars = 10
+	// Timeout of a prefetch read, so a slow table does not hold the prefetcher.
+	prefetchReadTimeout = 5 * time.Second
+)
+
+// SetPrefetcher sets the prefetcher that warms the row cache.
+func (s *Server) SetPrefetcher(p *prefetch.Prefetcher) {
+	s.store.Prefetcher = p
+}
+
+// PrefetchRead reads base table rows into the row cache. The rows that are
+// cached, or owned by another replica, are skipped. Returns the keys of the
+// rows that are read and exist, also when the read fails partway.
+func (s *Server) PrefetchRead(ctx context.Context, rowKeys []string) (
+	[]string, error) {
+	cache := s.store.RowCache
+	baseBt := s.store.BaseBt()
+	baseTableName, _ := s.store.TableNames()
+	if cache == nil || baseBt == nil || baseTableName == "" {
+		return nil, nil
+	}
+	var rowList bigtable.RowList
+	for _, rowKey := range rowKeys {
+		if s.store.Peers != nil && s.store.Peers.Owner(rowKey) != "" {
+			continue
+		}
+		if _, ok := cache.Get(rowCacheKey(baseTableName, rowKey)); ok {
+			continue
+		}
+		rowList = append(rowList, rowKey)
+	}
+	if len(rowList) == 0 {
+		return nil, nil
+	}
+	ctx, cancel := context.WithTimeout(ctx, prefetchReadTimeout)
+	defer cancel()
+	var fetched []string
+	err := readRows(ctx, s.store, baseBt, baseTableName, rowList, false, nil,
+		func(rowKey string, raw []byte) bool {
+			fetched = append(fetched, rowKey)
+			return true
+		})
+	return fetched, err
+}
+
+// prefetchLandingPage schedules the rows that are usually read after the
+// landing page of a place: the landing pages of the parent and child places,
+// and the hot stat vars of the place and its children.
+func (s *Server) prefetchLandingPage(
+	placeDcid string, resp *pb.GetLandingPageDataResponse) {
+	p := s.store.Prefetcher
+	if p == nil {
+		return
+	}
+	children := resp.GetChildPlaces()
+	if len(children) > maxPrefetchChildPlaces {
+		children = children[:maxPrefetchChildPlaces]
+	}
+	// Parents go first, as the budget drops the rows at the end.
+	places := append(append([]string{}, resp.GetParentPlaces()...), children...)
+	rowKeys := []string{}
+	for _, place := range places {
+		rowKeys = append(rowKeys, fmt.Sprintf("%s%s", util.BtLandingPagePrefix, place))
+	}
+	for _, prop := range []string{"typeOf", "containedInPlace"} {
+		rowKeys = append(rowKeys, buildPropertyValuesKey(places, prop, true)...)
+	}
+	if statVars := p.HotStatVars(numPrefetchStatVars); len(statVars) > 0 {
+		statsKeys, _ := buildStatsKey(
+			append([]string{placeDcid}, children...), statVars)
+		rowKeys = append(rowKeys, statsKeys...)
+	}
+	p.Schedule(rowKeys)
+}
@@ -0,0 +1,66 @@
+// Copyright 2020 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"context"
+	"testing"
+
+	"github.com/datacommonsorg/mixer/internal/rowcache"
+	"github.com/datacommonsorg/mixer/internal/util"
+	"github.com/google/go-cmp/cmp"
+)
+
+func TestPrefetchRead(t *testing.T) {
+	ctx := context.Background()
+	value, err := util.ZipAndEncode([]byte("{}"))
+	if err != nil {
+		t.Fatalf("ZipAndEncode() = %v", err)
+	}
+	btTable, err := SetupBigtable(ctx, map[string]string{
+		"d/f/geoId/06^Count_Person": value,
+		"d/f/geoId/07^Count_Person": value,
+	})
+	if err != nil {
+		t.Fatalf("SetupBigtable() = %v", err)
+	}
+	s := NewServer(nil, btTable, nil, nil, nil)
+	s.store.SetTableNames("base", "")
+	s.SetRowCache(rowcache.New(1<<20, nil))
+
+	// The missing row is read, but it is not prefetched.
+	got, err := s.PrefetchRead(ctx, []string{
+		"d/f/geoId/06^Count_Person",
+		"d/f/geoId/08^Count_Person",
+	})
+	if err != nil {
+		t.Fatalf("PrefetchRead() = %v", err)
+	}
+	if diff := cmp.Diff([]string{"d/f/geoId/06^Count_Person"}, got); diff != "" {
+		t.Errorf("PrefetchRead() got diff %v", diff)
+	}
+
+	// The cached rows are skipped.
+	got, err = s.PrefetchRead(ctx, []string{
+		"d/f/geoId/06^Count_Person",
+		"d/f/geoId/07^Count_Person",
+	})
+	if err != nil {
+		t.Fatalf("PrefetchRead() = %v", err)
+	}
+	if diff := cmp.Diff([]string{"d/f/geoId/07^Count_Person"}, got); diff != "" {
+		t.Errorf("PrefetchRead() got diff %v", diff)
+	}
+}
@@ -143,29 +143,31 @@ func readPropertyValues(
 ) (map[string][]*Node, error) {
 	// Only read property value from base cache.
 	// Branch cache only contains supplement data but not other properties yet.
-	baseDataMap, _, err := bigTableReadRowsParallel(
-		ctx,
-		store,
-		rowList,
-		func(dcid string, jsonRaw []byte) (interface{}, error) {
-			var propVals PropValueCache
-			err := json.Unmarshal(jsonRaw, &propVals)
-			if err != nil {
-				return nil, err
-			}
-			return propVals.Nodes, nil
-		},
-		nil,
-		false, /* readBranch */
-	)
+	baseDataMap, _, err := loadRows(ctx, store, propertyValueFamily, rowList)
 	if err != nil {
 		return nil, err
 	}
 	result := map[string][]*Node{}
-	for dcid, data := range baseDataMap {
-		if data != nil {
-			result[dcid] = data.([]*Node)
+	for _, rowKey := range rowList {
+		data := baseDataMap[rowKey]
+		if data == nil {
+			continue
+		}
+		dcid, err := util.KeyToDcid(rowKey)
+		if err != nil {
+			return nil, err
 		}
+		result[dcid] = data.([]*Node)
 	}
 	return result, nil
 }
+
+// convert the property value cache to a list of nodes
+func convertToPropValues(token string, jsonRaw []byte) (interface{}, error) {
+	var propVals PropValueCache
+	err := json.Unmarshal(jsonRaw, &propVals)
+	if err != nil {
+		return nil, err
+	}
+	return propVals.Nodes, nil
+}
@@ -19,6 +19,7 @@ import (
 	"fmt"
 
 	"cloud.google.com/go/bigquery"
+	"github.com/datacommonsorg/mixer/internal/base"
 	"github.com/datacommonsorg/mixer/internal/sparql"
 	"github.com/datacommonsorg/mixer/internal/translator"
 
@@ -34,7 +35,15 @@ func (s *Server) Query(
 	if err != nil {
 		return nil, err
 	}
+	return s.runQuery(ctx, nodes, queries, opts)
+}
 
+// runQuery translates a parsed datalog query to SQL and runs it in BigQuery.
+func (s *Server) runQuery(
+	ctx context.Context,
+	nodes []base.Node,
+	queries []*base.Query,
+	opts *base.QueryOptions) (*pb.QueryResponse, error) {
 	translation, err := translator.Translate(
 		s.metadata.Mappings, nodes, queries, s.metadata.SubTypeMap, opts)
 	if err != nil {
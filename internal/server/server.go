@@ -29,8 +29,15 @@ import (
 	"cloud.google.com/go/bigtable"
 	"cloud.google.com/go/pubsub"
 	"cloud.google.com/go/storage"
+	"github.com/datacommonsorg/mixer/internal/ancestor"
 	"github.com/datacommonsorg/mixer/internal/base"
+	"github.com/datacommonsorg/mixer/internal/batch"
+	"github.com/datacommonsorg/mixer/internal/diskcache"
+	"github.com/datacommonsorg/mixer/internal/geo"
+	"github.com/datacommonsorg/mixer/internal/limiter"
+	"github.com/datacommonsorg/mixer/internal/peer"
 	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/datacommonsorg/mixer/internal/rowcache"
 	"github.com/datacommonsorg/mixer/internal/store"
 	"github.com/datacommonsorg/mixer/internal/translator"
 	"github.com/datacommonsorg/mixer/internal/util"
@@ -62,6 +69,10 @@ type Server struct {
 	store    *store.Store
 	metadata *Metadata
 	cache    *Cache
+	// Spatial index of the place centroids, nil when not loaded.
+	placeIndex *geo.Index
+	// Ancestor chains of the places read so far.
+	ancestors *ancestor.Index
 }
 
 func (s *Server) updateBranchTable(ctx context.Context, branchTableName string) {
@@ -71,7 +82,48 @@ func (s *Server) updateBranchTable(ctx context.Context, branchTableName string)
 		log.Printf("Failed to udpate branch cache Bigtable client: %v", err)
 		return
 	}
-	s.store.UpdateBranchBt(branchTable)
+	s.store.UpdateBranchBt(branchTable, branchTableName)
+	// The containedInPlace edges may differ in the new table.
+	s.ancestors.Reset()
+}
+
+// SetTableNames sets the names of the base and branch tables being served.
+func (s *Server) SetTableNames(baseTableName, branchTableName string) {
+	s.store.SetTableNames(baseTableName, branchTableName)
+}
+
+// SetRowCache sets the cache of raw Bigtable rows.
+func (s *Server) SetRowCache(cache *rowcache.Cache) {
+	s.store.RowCache = cache
+}
+
+// SetDiskCache sets the local disk cache of raw Bigtable rows. The rows evicted
+// from the row cache are added to it.
+func (s *Server) SetDiskCache(cache *diskcache.Cache) {
+	s.store.DiskCache = cache
+}
+
+// SetPeers sets the router of Bigtable reads to the other replicas.
+func (s *Server) SetPeers(router *peer.Router) {
+	s.store.Peers = router
+}
+
+// SetBatcher sets the batcher that merges the small Bigtable reads of
+// concurrent requests.
+func (s *Server) SetBatcher(batcher *batch.Batcher) {
+	s.store.Batcher = batcher
+}
+
+// SetLimiters sets the concurrency limiters of the base and branch table reads.
+func (s *Server) SetLimiters(base, branch *limiter.Limiter) {
+	s.store.BaseLimiter = base
+	s.store.BranchLimiter = branch
+}
+
+// SetBranchBreaker sets the circuit breaker of the branch table. Requests are
+// served from the base table only while it is open.
+func (s *Server) SetBranchBreaker(breaker *limiter.Breaker) {
+	s.store.BranchBreaker = breaker
 }
 
 // ReadBranchTableName reads branch cache folder from GCS.
@@ -208,9 +260,11 @@ func NewServer(
 	branchTable *bigtable.Table,
 	metadata *Metadata,
 	cache *Cache) *Server {
-	return &Server{
+	s := &Server{
 		store:    store.NewStore(bqClient, baseTable, branchTable),
 		metadata: metadata,
 		cache:    cache,
 	}
+	s.ancestors = ancestor.New(s.readParents, maxAncestorIndexPlaces)
+	return s
 }
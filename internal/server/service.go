@@ -0,0 +1,141 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+// Typed reads shared by the RPC handlers. Handlers that need the data of
+// another API call these directly instead of calling the other RPC, which
+// would validate the request again and serialize the response.
+
+import (
+	"context"
+	"encoding/json"
+
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/datacommonsorg/mixer/internal/store"
+	"github.com/datacommonsorg/mixer/internal/util"
+)
+
+// readRankedStats returns the best series of a stat var for places, after
+// filtering the source series by prop. Places without data map to nil.
+func readRankedStats(
+	ctx context.Context,
+	st *store.Store,
+	places []string,
+	statVar string,
+	prop *ObsProp) (map[string]*ObsTimeSeries, error) {
+	rowList, keyTokens := buildStatsKey(places, []string{statVar})
+	cacheData, err := readStats(ctx, st, rowList, keyTokens, statSourceFilter(prop, true))
+	if err != nil {
+		return nil, err
+	}
+	result := make(map[string]*ObsTimeSeries, len(places))
+	for _, place := range places {
+		series := cacheData[place][statVar]
+		series.filterAndRank(prop)
+		result[place] = series
+	}
+	return result, nil
+}
+
+// readBestSeries returns the best series of stat vars for places, keyed by
+// place and stat var. Pairs without data map to nil.
+func readBestSeries(
+	ctx context.Context,
+	st *store.Store,
+	places []string,
+	statVars []string) (map[string]map[string]*pb.Series, error) {
+	st.Prefetcher.ObserveStatVars(statVars)
+	rowList, keyTokens := buildStatsKey(places, statVars)
+	cacheData, err := readStatsPb(ctx, st, rowList, keyTokens, nil)
+	if err != nil {
+		return nil, err
+	}
+	result := make(map[string]map[string]*pb.Series, len(places))
+	for _, place := range places {
+		result[place] = make(map[string]*pb.Series, len(statVars))
+		for _, statVar := range statVars {
+			var series *pb.Series
+			if data := cacheData[place][statVar]; data != nil {
+				series = getBestSeries(data)
+			}
+			result[place][statVar] = series
+		}
+	}
+	return result, nil
+}
+
+// readPlaceStatVars returns the stat vars with data for each place, merged
+// from the base and branch caches.
+func readPlaceStatVars(
+	ctx context.Context,
+	st *store.Store,
+	dcids []string) (map[string][]string, error) {
+	rowList := buildPlaceStatsVarKey(dcids)
+	baseDataMap, branchDataMap, err := bigTableReadRowsParallel(
+		ctx,
+		st,
+		rowList,
+		func(dcid string, jsonRaw []byte) (interface{}, error) {
+			var data PlaceStatsVar
+			err := json.Unmarshal(jsonRaw, &data)
+			if err != nil {
+				return nil, err
+			}
+			return data.StatVarIds, nil
+		},
+		nil,
+		true, /* readBranch */
+	)
+	if err != nil {
+		return nil, err
+	}
+	result := make(map[string][]string, len(dcids))
+	for _, dcid := range dcids {
+		statVars := []string{}
+		if baseDataMap[dcid] != nil {
+			statVars = baseDataMap[dcid].([]string)
+		}
+		if branchDataMap[dcid] != nil {
+			// Copy first, the base list may be shared with a cache.
+			statVars = util.MergeDedupe(
+				append([]string{}, statVars...), branchDataMap[dcid].([]string))
+		}
+		result[dcid] = statVars
+	}
+	return result, nil
+}
+
+// readPlaceStatVarsUnion returns the sorted union of the stat vars with data
+// for places.
+func readPlaceStatVarsUnion(
+	ctx context.Context,
+	st *store.Store,
+	dcids []string) ([]string, error) {
+	places, err := readPlaceStatVars(ctx, st, dcids)
+	if err != nil {
+		return nil, err
+	}
+	// For single place, return directly.
+	if len(dcids) == 1 {
+		return places[dcids[0]], nil
+	}
+	set := map[string]bool{}
+	for _, statVars := range places {
+		for _, dcid := range statVars {
+			set[dcid] = true
+		}
+	}
+	return keysToSlice(set), nil
+}
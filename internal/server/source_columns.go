@@ -0,0 +1,179 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+// A ChartStore row of a place and stat var has one of two layouts in the
+// BtFamily column family:
+//
+//  - A single cell with the ChartStore of all the source series.
+//  - One column per source series, with the SourceSeries in the cell. The
+//    qualifier is "src/<rank>/<measurement method>", the rank zero padded so
+//    the columns are in rank order. The optional "series" column has the
+//    ObsTimeSeries without its sources, e.g. with the place name.
+//
+// With the column layout, reads can filter the sources in Bigtable. The raw
+// value of the row, that is cached and sent to peers, is the cells of the
+// source columns, each followed by a newline, which is not in the base64
+// alphabet, and then the cell of the series column.
+
+import (
+	"bytes"
+	"fmt"
+	"regexp"
+	"strings"
+
+	"cloud.google.com/go/bigtable"
+	"github.com/datacommonsorg/mixer/internal/util"
+)
+
+const (
+	sourceColumnPrefix = "src/"
+	// The smallest qualifier after all the source columns.
+	sourceColumnEnd = "src0"
+	// The column of the series fields other than the sources.
+	seriesColumn    = "series"
+	sourceSeparator = '\n'
+)
+
+// sourceColumn returns the qualifier of the source series of a rank.
+func sourceColumn(rank int, mmethod string) string {
+	return fmt.Sprintf("%s%04d/%s", sourceColumnPrefix, rank, mmethod)
+}
+
+// sourceFilter selects the source series read from rows with the column
+// layout. Rows with a single cell are always read whole.
+type sourceFilter struct {
+	// Only the sources with this measurement method when set.
+	mmethod string
+	// Only the top ranked sources when positive.
+	limit int
+}
+
+// key identifies the filter in the row cache.
+func (f *sourceFilter) key() string {
+	if f == nil {
+		return ""
+	}
+	return fmt.Sprintf("%d/%s", f.limit, f.mmethod)
+}
+
+// btFilter returns the Bigtable filter to read the selected sources.
+func (f *sourceFilter) btFilter() bigtable.Filter {
+	pattern := regexp.QuoteMeta(sourceColumnPrefix) + `\d+/`
+	if f.mmethod != "" {
+		pattern += regexp.QuoteMeta(f.mmethod)
+	} else {
+		pattern += `.*`
+	}
+	sources := bigtable.ColumnFilter(pattern)
+	if f.limit > 0 {
+		sources = bigtable.ChainFilters(sources, bigtable.CellsPerRowLimitFilter(f.limit))
+	}
+	return bigtable.ChainFilters(
+		bigtable.LatestNFilter(1),
+		bigtable.InterleaveFilters(
+			// Any single cell, before or after the source columns.
+			bigtable.ColumnRangeFilter(util.BtFamily, "", sourceColumnPrefix),
+			bigtable.ColumnRangeFilter(util.BtFamily, sourceColumnEnd, ""),
+			sources,
+		),
+	)
+}
+
+// rowValue returns the raw value of a row: the single cell, or the cells of
+// the source columns, each followed by a separator, and the series cell. Rows
+// with the column layout whose sources are all filtered out have no value.
+func rowValue(btRow bigtable.Row) []byte {
+	var single, series, sources []byte
+	sourcePrefix := util.BtFamily + ":" + sourceColumnPrefix
+	seriesQualifier := util.BtFamily + ":" + seriesColumn
+	for _, item := range btRow[util.BtFamily] {
+		switch {
+		case strings.HasPrefix(item.Column, sourcePrefix):
+			sources = append(sources, item.Value...)
+			sources = append(sources, sourceSeparator)
+		case item.Column == seriesQualifier:
+			series = item.Value
+		case single == nil:
+			single = item.Value
+		}
+	}
+	if sources == nil {
+		if series != nil {
+			return nil
+		}
+		return single
+	}
+	return append(sources, series...)
+}
+
+// decodeRow decodes the raw value of a row. The columns are decoded to the
+// JSON of a ChartStore with the series fields and the sources in rank order,
+// so both layouts are read by the same actions.
+func decodeRow(raw []byte) ([]byte, error) {
+	if bytes.IndexByte(raw, sourceSeparator) < 0 {
+		return util.UnzipAndDecode(string(raw))
+	}
+	cells := bytes.Split(raw, []byte{sourceSeparator})
+	// The JSON object of the series, without the closing brace.
+	series := []byte("{")
+	if cell := cells[len(cells)-1]; len(cell) > 0 {
+		jsonRaw, err := util.UnzipAndDecode(string(cell))
+		if err != nil {
+			return nil, err
+		}
+		jsonRaw = bytes.TrimSpace(jsonRaw)
+		if len(jsonRaw) < 2 || jsonRaw[0] != '{' || jsonRaw[len(jsonRaw)-1] != '}' {
+			return nil, fmt.Errorf("invalid series cell: %s", jsonRaw)
+		}
+		series = jsonRaw[:len(jsonRaw)-1]
+		if len(bytes.TrimSpace(series[1:])) > 0 {
+			series = append(series, ',')
+		}
+	}
+	buf := append([]byte(`{"obsTimeSeries":`), series...)
+	buf = append(buf, `"sourceSeries":[`...)
+	for i, cell := range cells[:len(cells)-1] {
+		jsonRaw, err := util.UnzipAndDecode(string(cell))
+		if err != nil {
+			return nil, err
+		}
+		if i > 0 {
+			buf = append(buf, ',')
+		}
+		buf = append(buf, jsonRaw...)
+	}
+	return append(buf, "]}}"...), nil
+}
+
+// statSourceFilter returns the source filter for a stat read with the
+// observation properties of prop, or nil if the request does not restrict the
+// measurement method. When best is true only the best source that matches is
+// needed.
+//
+// Reads with a filter are neither batched nor sent to peers, and are cached
+// apart from the whole rows, so the best source alone is read as a whole row.
+func statSourceFilter(prop *ObsProp, best bool) *sourceFilter {
+	if prop == nil || prop.Mmethod == "" {
+		return nil
+	}
+	f := &sourceFilter{mmethod: prop.Mmethod}
+	// The other properties are not in the qualifier, so the sources that
+	// match can not be limited.
+	if best && prop.Operiod == "" && prop.Unit == "" && prop.Sfactor == "" {
+		f.limit = 1
+	}
+	return f
+}
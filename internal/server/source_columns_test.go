@@ -0,0 +1,164 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"context"
+	"testing"
+
+	"cloud.google.com/go/bigtable"
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/datacommonsorg/mixer/internal/store"
+	"github.com/datacommonsorg/mixer/internal/util"
+	"github.com/google/go-cmp/cmp"
+	"google.golang.org/protobuf/encoding/protojson"
+	"google.golang.org/protobuf/proto"
+	"google.golang.org/protobuf/testing/protocmp"
+)
+
+func encodeCell(t *testing.T, m proto.Message) []byte {
+	jsonRaw, err := protojson.Marshal(m)
+	if err != nil {
+		t.Fatalf("protojson.Marshal() = %v", err)
+	}
+	raw, err := util.ZipAndEncode(jsonRaw)
+	if err != nil {
+		t.Fatalf("ZipAndEncode() = %v", err)
+	}
+	return []byte(raw)
+}
+
+func TestReadSourceColumns(t *testing.T) {
+	ctx := context.Background()
+	btTable, err := SetupBigtable(ctx, map[string]string{})
+	if err != nil {
+		t.Fatalf("SetupBigtable() = %v", err)
+	}
+	sources := []*pb.SourceSeries{
+		{ImportName: "a", MeasurementMethod: "CensusACS5yrSurvey", Val: map[string]float64{"2019": 1}},
+		{ImportName: "b", MeasurementMethod: "CensusPEPSurvey", Val: map[string]float64{"2019": 2}},
+		{ImportName: "c", MeasurementMethod: "CensusACS5yrSurvey", Val: map[string]float64{"2018": 3}},
+	}
+	rowList, keyTokens := buildStatsKey(
+		[]string{"geoId/06", "geoId/07"}, []string{"Count_Person"})
+	for _, rowKey := range rowList {
+		mut := bigtable.NewMutation()
+		if keyTokens[rowKey].place == "geoId/06" {
+			for i, source := range sources {
+				mut.Set(util.BtFamily, sourceColumn(i, source.MeasurementMethod),
+					bigtable.Now(), encodeCell(t, source))
+			}
+			mut.Set(util.BtFamily, seriesColumn, bigtable.Now(),
+				encodeCell(t, &pb.ObsTimeSeries{PlaceName: "California"}))
+		} else {
+			// A row with a single cell.
+			mut.Set(util.BtFamily, "value", bigtable.Now(), encodeCell(t, &pb.ChartStore{
+				Val: &pb.ChartStore_ObsTimeSeries{
+					ObsTimeSeries: &pb.ObsTimeSeries{PlaceName: "Alaska", SourceSeries: sources[:2]},
+				},
+			}))
+		}
+		if err := btTable.Apply(ctx, rowKey, mut); err != nil {
+			t.Fatalf("Apply() = %v", err)
+		}
+	}
+
+	for _, c := range []struct {
+		filter *sourceFilter
+		want   map[string][]string
+	}{
+		{nil, map[string][]string{"geoId/06": {"a", "b", "c"}, "geoId/07": {"a", "b"}}},
+		{&sourceFilter{limit: 1}, map[string][]string{"geoId/06": {"a"}, "geoId/07": {"a", "b"}}},
+		{&sourceFilter{mmethod: "CensusPEPSurvey"}, map[string][]string{"geoId/06": {"b"}, "geoId/07": {"a", "b"}}},
+		{&sourceFilter{mmethod: "CensusACS5yrSurvey", limit: 1}, map[string][]string{"geoId/06": {"a"}, "geoId/07": {"a", "b"}}},
+		// No source of geoId/06 matches.
+		{&sourceFilter{mmethod: "BLSSeasonallyAdjusted"}, map[string][]string{"geoId/07": {"a", "b"}}},
+	} {
+		data, err := readStatsPb(ctx, store.NewStore(nil, btTable, nil), rowList, keyTokens, c.filter)
+		if err != nil {
+			t.Fatalf("readStatsPb(%+v) = %v", c.filter, err)
+		}
+		got := map[string][]string{}
+		for place, placeData := range data {
+			for _, source := range placeData["Count_Person"].GetSourceSeries() {
+				got[place] = append(got[place], source.ImportName)
+			}
+		}
+		if diff := cmp.Diff(c.want, got); diff != "" {
+			t.Errorf("readStatsPb(%+v) diff %v", c.filter, diff)
+		}
+	}
+}
+
+func TestDecodeRow(t *testing.T) {
+	source := &pb.SourceSeries{ImportName: "a", Val: map[string]float64{"2019": 1}}
+	sourceCell := append(encodeCell(t, source), sourceSeparator)
+	for _, c := range []struct {
+		raw  []byte
+		want *pb.ObsTimeSeries
+	}{
+		{
+			encodeCell(t, &pb.ChartStore{Val: &pb.ChartStore_ObsTimeSeries{
+				ObsTimeSeries: &pb.ObsTimeSeries{PlaceName: "California", SourceSeries: []*pb.SourceSeries{source}},
+			}}),
+			&pb.ObsTimeSeries{PlaceName: "California", SourceSeries: []*pb.SourceSeries{source}},
+		},
+		{
+			// Without the series column.
+			sourceCell,
+			&pb.ObsTimeSeries{SourceSeries: []*pb.SourceSeries{source}},
+		},
+		{
+			append(append([]byte{}, sourceCell...), encodeCell(t, &pb.ObsTimeSeries{})...),
+			&pb.ObsTimeSeries{SourceSeries: []*pb.SourceSeries{source}},
+		},
+		{
+			append(append([]byte{}, sourceCell...), encodeCell(t, &pb.ObsTimeSeries{PlaceName: "California"})...),
+			&pb.ObsTimeSeries{PlaceName: "California", SourceSeries: []*pb.SourceSeries{source}},
+		},
+	} {
+		jsonRaw, err := decodeRow(c.raw)
+		if err != nil {
+			t.Fatalf("decodeRow(%s) = %v", c.raw, err)
+		}
+		got := &pb.ChartStore{}
+		if err := protojson.Unmarshal(jsonRaw, got); err != nil {
+			t.Fatalf("protojson.Unmarshal(%s) = %v", jsonRaw, err)
+		}
+		if diff := cmp.Diff(c.want, got.GetObsTimeSeries(), protocmp.Transform()); diff != "" {
+			t.Errorf("decodeRow(%s) diff %v", c.raw, diff)
+		}
+	}
+}
+
+func TestStatSourceFilter(t *testing.T) {
+	for _, c := range []struct {
+		prop *ObsProp
+		best bool
+		want *sourceFilter
+	}{
+		{nil, false, nil},
+		// The best source is read with the whole row.
+		{nil, true, nil},
+		{&ObsProp{Mmethod: "CensusPEPSurvey"}, false, &sourceFilter{mmethod: "CensusPEPSurvey"}},
+		{&ObsProp{Mmethod: "CensusPEPSurvey"}, true, &sourceFilter{mmethod: "CensusPEPSurvey", limit: 1}},
+		{&ObsProp{Unit: "USDollar"}, true, nil},
+	} {
+		got := statSourceFilter(c.prop, c.best)
+		if diff := cmp.Diff(c.want, got, cmp.AllowUnexported(sourceFilter{})); diff != "" {
+			t.Errorf("statSourceFilter(%+v, %v) diff %v", c.prop, c.best, diff)
+		}
+	}
+}
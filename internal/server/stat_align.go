@@ -0,0 +1,284 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"container/heap"
+	"sort"
+	"time"
+
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+)
+
+// Layouts of the observation dates.
+var dateLayouts = []string{"2006-01-02", "2006-01", "2006"}
+
+// alignPoint is an observation of a series.
+type alignPoint struct {
+	date  string
+	value float64
+}
+
+// alignSeries resamples the series, puts them on a common date grid and fills
+// the gaps. The series are updated in place, nil series are skipped.
+func alignSeries(series []*pb.Series, opts *pb.AlignOptions) {
+	if opts == nil {
+		return
+	}
+	points := make([][]alignPoint, len(series))
+	for i, s := range series {
+		if s != nil {
+			points[i] = resample(sortedPoints(s.Val), opts.Period, opts.Aggregation)
+		}
+	}
+	var grid []string
+	if opts.Grid != pb.AlignOptions_GRID_NONE {
+		grid = mergeDates(points, opts.Grid)
+		if opts.Fill != pb.AlignOptions_FILL_NONE {
+			grid = fillCalendar(grid, opts.Period)
+		}
+	}
+	for i, s := range series {
+		if s == nil {
+			continue
+		}
+		dates := grid
+		if opts.Grid == pb.AlignOptions_GRID_NONE {
+			dates = make([]string, len(points[i]))
+			for j, p := range points[i] {
+				dates[j] = p.date
+			}
+			if opts.Fill != pb.AlignOptions_FILL_NONE {
+				dates = fillCalendar(dates, opts.Period)
+			}
+		}
+		s.Val = alignToDates(points[i], dates, opts.Fill)
+	}
+}
+
+// sortedPoints returns the observations of a series sorted by date.
+func sortedPoints(val map[string]float64) []alignPoint {
+	points := make([]alignPoint, 0, len(val))
+	for date, value := range val {
+		points = append(points, alignPoint{date, value})
+	}
+	sort.Slice(points, func(i, j int) bool { return points[i].date < points[j].date })
+	return points
+}
+
+// periodKey returns the period of a date. Dates that are coarser than the
+// period are their own period.
+func periodKey(date string, period pb.AlignOptions_Period) string {
+	switch period {
+	case pb.AlignOptions_PERIOD_YEAR:
+		if len(date) > 4 {
+			return date[:4]
+		}
+	case pb.AlignOptions_PERIOD_MONTH:
+		if len(date) > 7 {
+			return date[:7]
+		}
+	}
+	return date
+}
+
+// resample combines the observations of each period. As the points are sorted,
+// the dates of a period are next to each other.
+func resample(
+	points []alignPoint,
+	period pb.AlignOptions_Period,
+	aggregation pb.AlignOptions_Aggregation) []alignPoint {
+	if period == pb.AlignOptions_PERIOD_NONE {
+		return points
+	}
+	result := make([]alignPoint, 0, len(points))
+	for i := 0; i < len(points); {
+		key := periodKey(points[i].date, period)
+		sum := 0.0
+		j := i
+		for ; j < len(points) && periodKey(points[j].date, period) == key; j++ {
+			sum += points[j].value
+		}
+		value := points[j-1].value
+		switch aggregation {
+		case pb.AlignOptions_AGGREGATION_MEAN:
+			value = sum / float64(j-i)
+		case pb.AlignOptions_AGGREGATION_SUM:
+			value = sum
+		}
+		result = append(result, alignPoint{key, value})
+		i = j
+	}
+	return result
+}
+
+// pointsCursor is the next date of a series in the merge.
+type pointsCursor struct {
+	points []alignPoint
+	pos    int
+}
+
+type cursorHeap []*pointsCursor
+
+func (h cursorHeap) Len() int { return len(h) }
+
+func (h cursorHeap) Less(i, j int) bool {
+	return h[i].points[h[i].pos].date < h[j].points[h[j].pos].date
+}
+
+func (h cursorHeap) Swap(i, j int) { h[i], h[j] = h[j], h[i] }
+
+func (h *cursorHeap) Push(x interface{}) { *h = append(*h, x.(*pointsCursor)) }
+
+func (h *cursorHeap) Pop() interface{} {
+	old := *h
+	n := len(old)
+	x := old[n-1]
+	*h = old[:n-1]
+	return x
+}
+
+// mergeDates merges the sorted dates of the series in one pass. It returns the
+// dates of any series for a union grid, and the dates of all the series for an
+// intersection grid. Empty series are ignored.
+func mergeDates(series [][]alignPoint, grid pb.AlignOptions_Grid) []string {
+	h := cursorHeap{}
+	for _, points := range series {
+		if len(points) > 0 {
+			h = append(h, &pointsCursor{points: points})
+		}
+	}
+	numSeries := len(h)
+	heap.Init(&h)
+	dates := []string{}
+	for h.Len() > 0 {
+		date := h[0].points[h[0].pos].date
+		count := 0
+		for h.Len() > 0 && h[0].points[h[0].pos].date == date {
+			count++
+			h[0].pos++
+			if h[0].pos < len(h[0].points) {
+				heap.Fix(&h, 0)
+			} else {
+				heap.Pop(&h)
+			}
+		}
+		if grid == pb.AlignOptions_GRID_UNION || count == numSeries {
+			dates = append(dates, date)
+		}
+	}
+	return dates
+}
+
+// fillCalendar adds every year or month between the first and last dates of
+// the period, so the gaps can be filled.
+func fillCalendar(dates []string, period pb.AlignOptions_Period) []string {
+	var layout string
+	var years, months int
+	switch period {
+	case pb.AlignOptions_PERIOD_YEAR:
+		layout, years = "2006", 1
+	case pb.AlignOptions_PERIOD_MONTH:
+		layout, months = "2006-01", 1
+	default:
+		return dates
+	}
+	var first, last time.Time
+	for _, date := range dates {
+		if len(date) != len(layout) {
+			continue
+		}
+		t, err := time.Parse(layout, date)
+		if err != nil {
+			continue
+		}
+		if first.IsZero() || t.Before(first) {
+			first = t
+		}
+		if t.After(last) {
+			last = t
+		}
+	}
+	if first.IsZero() {
+		return dates
+	}
+	result := make([]string, 0, len(dates))
+	i := 0
+	for t := first; !t.After(last); t = t.AddDate(years, months, 0) {
+		date := t.Format(layout)
+		for ; i < len(dates) && dates[i] < date; i++ {
+			result = append(result, dates[i])
+		}
+		if i < len(dates) && dates[i] == date {
+			i++
+		}
+		result = append(result, date)
+	}
+	return append(result, dates[i:]...)
+}
+
+// alignToDates returns the values of a series on sorted dates, in one pass
+// over both. Missing dates between the first and last observations are
+// filled.
+func alignToDates(
+	points []alignPoint, dates []string, fill pb.AlignOptions_Fill) map[string]float64 {
+	result := make(map[string]float64, len(dates))
+	j := 0
+	for _, date := range dates {
+		for j < len(points) && points[j].date < date {
+			j++
+		}
+		if j < len(points) && points[j].date == date {
+			result[date] = points[j].value
+			continue
+		}
+		if j == 0 || j == len(points) {
+			continue
+		}
+		prev, next := points[j-1], points[j]
+		switch fill {
+		case pb.AlignOptions_FILL_PREVIOUS:
+			result[date] = prev.value
+		case pb.AlignOptions_FILL_LINEAR:
+			result[date] = interpolate(prev, next, date)
+		}
+	}
+	return result
+}
+
+// interpolate returns the linear interpolation at a date between two
+// observations. It falls back to the previous value when the dates can not be
+// parsed.
+func interpolate(prev, next alignPoint, date string) float64 {
+	t0, ok0 := parseDate(prev.date)
+	t1, ok1 := parseDate(next.date)
+	t, ok := parseDate(date)
+	if !ok0 || !ok1 || !ok || !t1.After(t0) {
+		return prev.value
+	}
+	ratio := float64(t.Sub(t0)) / float64(t1.Sub(t0))
+	return prev.value + (next.value-prev.value)*ratio
+}
+
+func parseDate(date string) (time.Time, bool) {
+	for _, layout := range dateLayouts {
+		if len(date) == len(layout) {
+			if t, err := time.Parse(layout, date); err == nil {
+				return t, true
+			}
+		}
+	}
+	return time.Time{}, false
+}
@@ -0,0 +1,110 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"testing"
+
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/google/go-cmp/cmp"
+)
+
+func TestAlignSeries(t *testing.T) {
+	monthly := map[string]float64{
+		"2018-01": 4, "2018-06": 6, "2018-12": 8,
+		"2020-03": 3, "2020-09": 5,
+	}
+	yearly := map[string]float64{"2017": 100, "2018": 110, "2020": 130}
+	for _, c := range []struct {
+		name string
+		opts *pb.AlignOptions
+		want []map[string]float64
+	}{
+		{
+			"resample to year",
+			&pb.AlignOptions{
+				Period:      pb.AlignOptions_PERIOD_YEAR,
+				Aggregation: pb.AlignOptions_AGGREGATION_MEAN,
+			},
+			[]map[string]float64{
+				{"2018": 6, "2020": 4},
+				{"2017": 100, "2018": 110, "2020": 130},
+			},
+		},
+		{
+			"intersection",
+			&pb.AlignOptions{
+				Period: pb.AlignOptions_PERIOD_YEAR,
+				Grid:   pb.AlignOptions_GRID_INTERSECTION,
+			},
+			[]map[string]float64{
+				{"2018": 8, "2020": 5},
+				{"2018": 110, "2020": 130},
+			},
+		},
+		{
+			"union with previous values",
+			&pb.AlignOptions{
+				Period:      pb.AlignOptions_PERIOD_YEAR,
+				Aggregation: pb.AlignOptions_AGGREGATION_SUM,
+				Grid:        pb.AlignOptions_GRID_UNION,
+				Fill:        pb.AlignOptions_FILL_PREVIOUS,
+			},
+			[]map[string]float64{
+				// Not filled before the first observation.
+				{"2018": 18, "2019": 18, "2020": 8},
+				{"2017": 100, "2018": 110, "2019": 110, "2020": 130},
+			},
+		},
+		{
+			"linear fill",
+			&pb.AlignOptions{
+				Period: pb.AlignOptions_PERIOD_YEAR,
+				Fill:   pb.AlignOptions_FILL_LINEAR,
+			},
+			[]map[string]float64{
+				{"2018": 8, "2019": 6.5, "2020": 5},
+				{"2017": 100, "2018": 110, "2019": 120, "2020": 130},
+			},
+		},
+	} {
+		series := []*pb.Series{
+			{Val: copyVal(monthly)},
+			{Val: copyVal(yearly)},
+			nil,
+		}
+		alignSeries(series, c.opts)
+		got := []map[string]float64{series[0].Val, series[1].Val}
+		if diff := cmp.Diff(c.want, got); diff != "" {
+			t.Errorf("alignSeries(%s) diff %v", c.name, diff)
+		}
+	}
+}
+
+func TestFillCalendar(t *testing.T) {
+	got := fillCalendar([]string{"2019", "2019-11", "2020-02"}, pb.AlignOptions_PERIOD_MONTH)
+	want := []string{"2019", "2019-11", "2019-12", "2020-01", "2020-02"}
+	if diff := cmp.Diff(want, got); diff != "" {
+		t.Errorf("fillCalendar() diff %v", diff)
+	}
+}
+
+func copyVal(val map[string]float64) map[string]float64 {
+	result := map[string]float64{}
+	for k, v := range val {
+		result[k] = v
+	}
+	return result
+}
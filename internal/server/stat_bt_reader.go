@@ -20,20 +20,26 @@ import (
 	"cloud.google.com/go/bigtable"
 	pb "github.com/datacommonsorg/mixer/internal/proto"
 	"github.com/datacommonsorg/mixer/internal/store"
+	"github.com/datacommonsorg/mixer/internal/util"
 )
 
 // readStats reads and process BigTable rows in parallel.
 // Consider consolidate this function and bigTableReadRowsParallel.
+//
+// When filter is set, only the selected sources are read from rows with one
+// column per source.
 func readStats(
 	ctx context.Context,
 	store *store.Store,
 	rowList bigtable.RowList,
-	keyTokens map[string]*placeStatVar) (
+	keyTokens map[string]*placeStatVar,
+	filter *sourceFilter) (
 	map[string]map[string]*ObsTimeSeries, error) {
 
 	keyToTokenFn := tokenFn(keyTokens)
-	baseDataMap, branchDataMap, err := bigTableReadRowsParallel(
+	baseDataMap, branchDataMap, err := bigTableReadSources(
 		ctx, store, rowList, convertToObsSeries, tokenFn(keyTokens), true, /* readBranch */
+		filter,
 	)
 	if err != nil {
 		return nil, err
@@ -65,12 +71,14 @@ func readStatsPb(
 	ctx context.Context,
 	store *store.Store,
 	rowList bigtable.RowList,
-	keyTokens map[string]*placeStatVar) (
+	keyTokens map[string]*placeStatVar,
+	filter *sourceFilter) (
 	map[string]map[string]*pb.ObsTimeSeries, error) {
 
 	keyToTokenFn := tokenFn(keyTokens)
-	baseDataMap, branchDataMap, err := bigTableReadRowsParallel(
+	baseDataMap, branchDataMap, err := bigTableReadSources(
 		ctx, store, rowList, convertToObsSeriesPb, keyToTokenFn, true, /* readBranch */
+		filter,
 	)
 	if err != nil {
 		return nil, err
@@ -97,6 +105,93 @@ func readStatsPb(
 	return result, nil
 }
 
+// readLatestStats reads the latest value of stat vars for places, keyed by
+// place and stat var. Pairs without data map to nil.
+//
+// The values are read from the latest value cache, which has one small
+// PointStat per row. The metadata of the PointStat is the full metadata of
+// its source. A value is taken from, in order: the branch latest value, the
+// branch stat row, the base latest value and the base stat row, so a series
+// updated in the branch cache is not hidden by an older base latest value.
+func readLatestStats(
+	ctx context.Context,
+	store *store.Store,
+	places []string,
+	statVars []string) (
+	map[string]map[string]*pb.PointStat, error) {
+
+	rowList, keyTokens := buildLatestStatsKey(places, statVars)
+	baseDataMap, branchDataMap, err := loadRows(ctx, store, latestStatFamily, rowList)
+	if err != nil {
+		return nil, err
+	}
+	result := map[string]map[string]*pb.PointStat{}
+	for _, place := range places {
+		result[place] = map[string]*pb.PointStat{}
+	}
+	// The stat rows of the pairs without a branch latest value.
+	statRows := bigtable.RowList{}
+	statTokens := map[string]*placeStatVar{}
+	latestRows := map[string]string{}
+	for _, rowKey := range rowList {
+		psv := keyTokens[rowKey]
+		if data, ok := branchDataMap[rowKey]; ok && data != nil {
+			result[psv.place][psv.statVar] = data.(*pb.PointStat)
+			continue
+		}
+		result[psv.place][psv.statVar] = nil
+		statsKey := util.BtChartDataPrefix + psv.place + "^" + psv.statVar
+		statRows = append(statRows, statsKey)
+		statTokens[statsKey] = psv
+		latestRows[statsKey] = rowKey
+	}
+	if len(statRows) == 0 {
+		return result, nil
+	}
+	var branchStats map[string]interface{}
+	if store.BranchBt() != nil {
+		_, branchStats, err = bigTableReadTables(ctx, store, statRows, convertToObsSeriesPb,
+			tokenFn(statTokens), false /* readBase */, true /* readBranch */, nil)
+		if err != nil {
+			return nil, err
+		}
+	}
+	baseRows := bigtable.RowList{}
+	for _, statsKey := range statRows {
+		psv := statTokens[statsKey]
+		if data, ok := branchStats[psv.place+"^"+psv.statVar]; ok && data != nil {
+			if stat, meta := getValueFromBestSourcePb(data.(*pb.ObsTimeSeries), ""); stat != nil {
+				stat.Metadata = meta
+				result[psv.place][psv.statVar] = stat
+				continue
+			}
+		}
+		if data, ok := baseDataMap[latestRows[statsKey]]; ok && data != nil {
+			result[psv.place][psv.statVar] = data.(*pb.PointStat)
+			continue
+		}
+		baseRows = append(baseRows, statsKey)
+	}
+	if len(baseRows) == 0 || store.BaseBt() == nil {
+		return result, nil
+	}
+	baseStats, _, err := bigTableReadTables(ctx, store, baseRows, convertToObsSeriesPb,
+		tokenFn(statTokens), true /* readBase */, false /* readBranch */, nil)
+	if err != nil {
+		return nil, err
+	}
+	for _, statsKey := range baseRows {
+		psv := statTokens[statsKey]
+		if data, ok := baseStats[psv.place+"^"+psv.statVar]; ok && data != nil {
+			if stat, meta := getValueFromBestSourcePb(data.(*pb.ObsTimeSeries), ""); stat != nil {
+				stat.Metadata = meta
+				result[psv.place][psv.statVar] = stat
+			}
+		}
+	}
+	return result, nil
+}
+
 // readStatCollection reads and process ObsCollection cache from BigTable
 // in parallel.
 func readStatCollection(
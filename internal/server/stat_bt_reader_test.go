@@ -0,0 +1,113 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"context"
+	"testing"
+
+	"cloud.google.com/go/bigtable"
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/datacommonsorg/mixer/internal/store"
+	"github.com/datacommonsorg/mixer/internal/util"
+	"github.com/google/go-cmp/cmp"
+	"google.golang.org/protobuf/testing/protocmp"
+)
+
+func TestReadLatestStats(t *testing.T) {
+	ctx := context.Background()
+	pep := &pb.StatMetadata{ImportName: "CensusPEP", MeasurementMethod: "CensusPEPSurvey"}
+	acs := &pb.StatMetadata{ImportName: "CensusACS5YearSurvey", MeasurementMethod: "CensusACS5yrSurvey"}
+	btTable, err := SetupBigtable(ctx, map[string]string{})
+	if err != nil {
+		t.Fatalf("SetupBigtable() = %v", err)
+	}
+	branchTable, err := SetupBigtable(ctx, map[string]string{})
+	if err != nil {
+		t.Fatalf("SetupBigtable() = %v", err)
+	}
+	st := store.NewStore(nil, btTable, branchTable)
+	series := func(date string, value float64) []byte {
+		return encodeCell(t, &pb.ChartStore{
+			Val: &pb.ChartStore_ObsTimeSeries{
+				ObsTimeSeries: &pb.ObsTimeSeries{SourceSeries: []*pb.SourceSeries{{
+					ImportName:        pep.ImportName,
+					MeasurementMethod: pep.MeasurementMethod,
+					Val:               map[string]float64{date: value},
+				}}},
+			},
+		})
+	}
+	apply := func(table *bigtable.Table, rows map[string][]byte) {
+		for rowKey, cell := range rows {
+			mut := bigtable.NewMutation()
+			mut.Set(util.BtFamily, "value", bigtable.Now(), cell)
+			if err := table.Apply(ctx, rowKey, mut); err != nil {
+				t.Fatalf("Apply() = %v", err)
+			}
+		}
+	}
+	apply(branchTable, map[string][]byte{
+		// The branch stat row comes before the base latest value.
+		util.BtChartDataPrefix + "geoId/06^Count_Person": series("2021", 4),
+		// The branch latest value comes first.
+		util.BtLatestStatPrefix + "geoId/09^Count_Person": encodeCell(t, &pb.PointStat{
+			Date: "2021", Value: 5, Metadata: pep,
+		}),
+		util.BtChartDataPrefix + "geoId/09^Count_Person": series("2020", 6),
+	})
+	apply(btTable, map[string][]byte{
+		util.BtLatestStatPrefix + "geoId/06^Count_Person": encodeCell(t, &pb.PointStat{
+			Date: "2020", Value: 3, Metadata: pep,
+		}),
+		util.BtLatestStatPrefix + "geoId/10^Count_Person": encodeCell(t, &pb.PointStat{
+			Date: "2020", Value: 7, Metadata: pep,
+		}),
+		util.BtChartDataPrefix + "geoId/10^Count_Person": series("2019", 8),
+		// geoId/07 is not in the latest value cache.
+		util.BtChartDataPrefix + "geoId/07^Count_Person": encodeCell(t, &pb.ChartStore{
+			Val: &pb.ChartStore_ObsTimeSeries{
+				ObsTimeSeries: &pb.ObsTimeSeries{SourceSeries: []*pb.SourceSeries{
+					{
+						ImportName:        pep.ImportName,
+						MeasurementMethod: pep.MeasurementMethod,
+						Val:               map[string]float64{"2018": 1},
+					},
+					{
+						ImportName:        acs.ImportName,
+						MeasurementMethod: acs.MeasurementMethod,
+						Val:               map[string]float64{"2017": 1, "2019": 2},
+					},
+				}},
+			},
+		}),
+	})
+
+	got, err := readLatestStats(ctx, st,
+		[]string{"geoId/06", "geoId/07", "geoId/08", "geoId/09", "geoId/10"}, []string{"Count_Person"})
+	if err != nil {
+		t.Fatalf("readLatestStats() = %v", err)
+	}
+	want := map[string]map[string]*pb.PointStat{
+		"geoId/06": {"Count_Person": {Date: "2021", Value: 4, Metadata: pep}},
+		"geoId/07": {"Count_Person": {Date: "2019", Value: 2, Metadata: acs}},
+		"geoId/08": {"Count_Person": nil},
+		"geoId/09": {"Count_Person": {Date: "2021", Value: 5, Metadata: pep}},
+		"geoId/10": {"Count_Person": {Date: "2020", Value: 7, Metadata: pep}},
+	}
+	if diff := cmp.Diff(want, got, protocmp.Transform()); diff != "" {
+		t.Errorf("readLatestStats() diff %v", diff)
+	}
+}
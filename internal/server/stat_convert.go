@@ -93,3 +93,13 @@ func convertToObsCollection(token string, jsonRaw []byte) (
 			"ChartStore.Val has unexpected type %T", x)
 	}
 }
+
+// convert the latest value cache to pb.PointStat
+func convertToPointStat(token string, jsonRaw []byte) (
+	interface{}, error) {
+	ps := &pb.PointStat{}
+	if err := protojson.Unmarshal(jsonRaw, ps); err != nil {
+		return nil, err
+	}
+	return ps, nil
+}
@@ -0,0 +1,154 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"math"
+	"regexp"
+	"strconv"
+
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/status"
+)
+
+const (
+	transformDiff        = "diff"
+	transformPctChange   = "pct_change"
+	transformRollingMean = "rolling_mean"
+	transformCumsum      = "cumsum"
+	// Maximum window of rolling_mean.
+	maxRollingWindow = 1000
+)
+
+var transformRegex = regexp.MustCompile(`^\s*([a-z_]+)\s*(?:\(\s*(\d+)\s*\))?\s*$`)
+
+// transform is a parsed series transform.
+type transform struct {
+	op string
+	// Window of rolling_mean.
+	n int
+}
+
+// parseTransforms parses the transforms of a request.
+func parseTransforms(exprs []string) ([]transform, error) {
+	result := make([]transform, 0, len(exprs))
+	for _, expr := range exprs {
+		match := transformRegex.FindStringSubmatch(expr)
+		if match == nil {
+			return nil, status.Errorf(codes.InvalidArgument, "Invalid transform: %s", expr)
+		}
+		t := transform{op: match[1]}
+		switch t.op {
+		case transformDiff, transformPctChange, transformCumsum:
+			if match[2] != "" {
+				return nil, status.Errorf(codes.InvalidArgument,
+					"Transform %s does not take an argument", t.op)
+			}
+		case transformRollingMean:
+			n, err := strconv.Atoi(match[2])
+			if err != nil || n < 1 || n > maxRollingWindow {
+				return nil, status.Errorf(codes.InvalidArgument,
+					"Transform %s takes a window between 1 and %d", t.op, maxRollingWindow)
+			}
+			t.n = n
+		default:
+			return nil, status.Errorf(codes.InvalidArgument, "Unknown transform: %s", t.op)
+		}
+		result = append(result, t)
+	}
+	return result, nil
+}
+
+// deriveSeries applies the transforms to the series in place. Nil series are
+// skipped.
+func deriveSeries(series []*pb.Series, transforms []transform) {
+	if len(transforms) == 0 {
+		return
+	}
+	for _, s := range series {
+		if s == nil {
+			continue
+		}
+		points := sortedPoints(s.Val)
+		values := make([]float64, len(points))
+		for i, p := range points {
+			values[i] = p.value
+		}
+		for _, t := range transforms {
+			applyTransform(values, t)
+		}
+		val := make(map[string]float64, len(values))
+		for i, v := range values {
+			if !math.IsNaN(v) && !math.IsInf(v, 0) {
+				val[points[i].date] = v
+			}
+		}
+		s.Val = val
+	}
+}
+
+// applyTransform applies a transform to values sorted by date, in place and in
+// a single pass. Values that are not defined are set to NaN.
+func applyTransform(values []float64, t transform) {
+	switch t.op {
+	case transformDiff, transformPctChange:
+		prev := math.NaN()
+		for i, v := range values {
+			if t.op == transformDiff {
+				values[i] = v - prev
+			} else if prev == 0 {
+				values[i] = math.NaN()
+			} else {
+				values[i] = (v - prev) / prev
+			}
+			prev = v
+		}
+	case transformRollingMean:
+		// The window keeps the input values, as they are overwritten.
+		window := make([]float64, t.n)
+		sum := 0.0
+		numNaN := 0
+		for i, v := range values {
+			if i >= t.n {
+				old := window[i%t.n]
+				if math.IsNaN(old) {
+					numNaN--
+				} else {
+					sum -= old
+				}
+			}
+			window[i%t.n] = v
+			if math.IsNaN(v) {
+				numNaN++
+			} else {
+				sum += v
+			}
+			if i < t.n-1 || numNaN > 0 {
+				values[i] = math.NaN()
+			} else {
+				values[i] = sum / float64(t.n)
+			}
+		}
+	case transformCumsum:
+		sum := 0.0
+		for i, v := range values {
+			if !math.IsNaN(v) {
+				sum += v
+				values[i] = sum
+			}
+		}
+	}
+}
@@ -0,0 +1,99 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"testing"
+
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/google/go-cmp/cmp"
+)
+
+func TestDeriveSeries(t *testing.T) {
+	val := map[string]float64{
+		"2020-03-01": 2,
+		"2020-03-02": 4,
+		"2020-03-03": 10,
+		"2020-03-04": 0,
+		"2020-03-05": 6,
+	}
+	for _, c := range []struct {
+		transforms []string
+		want       map[string]float64
+	}{
+		{
+			[]string{"diff"},
+			map[string]float64{
+				"2020-03-02": 2,
+				"2020-03-03": 6,
+				"2020-03-04": -10,
+				"2020-03-05": 6,
+			},
+		},
+		{
+			// The change from 0 is not defined.
+			[]string{"pct_change"},
+			map[string]float64{
+				"2020-03-02": 1,
+				"2020-03-03": 1.5,
+				"2020-03-04": -1,
+			},
+		},
+		{
+			[]string{"rolling_mean(2)"},
+			map[string]float64{
+				"2020-03-02": 3,
+				"2020-03-03": 7,
+				"2020-03-04": 5,
+				"2020-03-05": 3,
+			},
+		},
+		{
+			[]string{"cumsum"},
+			map[string]float64{
+				"2020-03-01": 2,
+				"2020-03-02": 6,
+				"2020-03-03": 16,
+				"2020-03-04": 16,
+				"2020-03-05": 22,
+			},
+		},
+		{
+			[]string{"diff", " rolling_mean( 3 ) "},
+			map[string]float64{
+				"2020-03-04": -2.0 / 3,
+				"2020-03-05": 2.0 / 3,
+			},
+		},
+	} {
+		transforms, err := parseTransforms(c.transforms)
+		if err != nil {
+			t.Fatalf("parseTransforms(%v) = %v", c.transforms, err)
+		}
+		series := []*pb.Series{{Val: copyVal(val)}, nil}
+		deriveSeries(series, transforms)
+		if diff := cmp.Diff(c.want, series[0].Val); diff != "" {
+			t.Errorf("deriveSeries(%v) diff %v", c.transforms, diff)
+		}
+	}
+}
+
+func TestParseTransformsError(t *testing.T) {
+	for _, expr := range []string{"mean", "diff(2)", "rolling_mean", "rolling_mean(0)", "cumsum("} {
+		if _, err := parseTransforms([]string{expr}); err == nil {
+			t.Errorf("parseTransforms(%s) succeeded", expr)
+		}
+	}
+}
@@ -0,0 +1,401 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"context"
+	"fmt"
+	"math"
+	"sort"
+	"strconv"
+	"strings"
+
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/status"
+)
+
+const (
+	maxFormulaLength   = 1000
+	maxFormulaStatVars = 20
+)
+
+// GetStatFormula implements API for Mixer.GetStatFormula.
+// Endpoint: /stat/formula
+func (s *Server) GetStatFormula(ctx context.Context, in *pb.GetStatFormulaRequest) (
+	*pb.GetStatFormulaResponse, error) {
+	f, err := parseFormula(in.GetFormula())
+	if err != nil {
+		return nil, err
+	}
+	places := in.GetPlaces()
+	if len(places) == 0 {
+		parentPlace := in.GetParentPlace()
+		childType := in.GetChildType()
+		if parentPlace == "" || childType == "" {
+			return nil, status.Errorf(codes.InvalidArgument,
+				"Missing required argument: places, or parent_place and child_type")
+		}
+		places, err = readChildPlaces(ctx, s.store, parentPlace, childType)
+		if err != nil {
+			return nil, err
+		}
+	}
+	result := &pb.GetStatFormulaResponse{Data: map[string]*pb.PointStat{}}
+	if len(places) == 0 {
+		return result, nil
+	}
+
+	// All the stat vars of all the places are read in one batch.
+	rowList, keyTokens := buildStatsKey(places, f.statVars)
+	cacheData, err := readStatsPb(ctx, s.store, rowList, keyTokens, nil)
+	if err != nil {
+		return nil, err
+	}
+	dates, operands := formulaOperands(places, f.statVars, cacheData, in.GetDate())
+	values := f.eval(operands, len(places))
+	for i, place := range places {
+		v := values[i]
+		if dates[i] == "" || math.IsNaN(v) || math.IsInf(v, 0) {
+			continue
+		}
+		result.Data[place] = &pb.PointStat{Date: dates[i], Value: v}
+	}
+	return result, nil
+}
+
+// formulaOperands aligns the dates of the stat vars for each place, and
+// returns the date of each place and a place-ordered array of values for each
+// stat var. The values are NaN for the places without a date.
+func formulaOperands(
+	places, statVars []string,
+	data map[string]map[string]*pb.ObsTimeSeries,
+	date string) ([]string, [][]float64) {
+	dates := make([]string, len(places))
+	operands := make([][]float64, len(statVars))
+	for i := range operands {
+		operands[i] = make([]float64, len(places))
+	}
+	series := make([]map[string]float64, len(statVars))
+	for p, place := range places {
+		for i, statVar := range statVars {
+			series[i] = nil
+			if obs := data[place][statVar]; obs != nil {
+				if best := getBestSeries(obs); best != nil {
+					series[i] = best.Val
+				}
+			}
+		}
+		dates[p] = commonDate(series, date)
+		for i := range statVars {
+			if dates[p] == "" {
+				operands[i][p] = math.NaN()
+			} else {
+				operands[i][p] = series[i][dates[p]]
+			}
+		}
+	}
+	return dates, operands
+}
+
+// commonDate returns the given date if all the series have it, or the latest
+// date of all the series when no date is given.
+func commonDate(series []map[string]float64, date string) string {
+	shortest := -1
+	for i, s := range series {
+		if len(s) == 0 {
+			return ""
+		}
+		if shortest < 0 || len(s) < len(series[shortest]) {
+			shortest = i
+		}
+	}
+	hasDate := func(d string) bool {
+		for _, s := range series {
+			if _, ok := s[d]; !ok {
+				return false
+			}
+		}
+		return true
+	}
+	if date != "" {
+		if hasDate(date) {
+			return date
+		}
+		return ""
+	}
+	candidates := make([]string, 0, len(series[shortest]))
+	for d := range series[shortest] {
+		candidates = append(candidates, d)
+	}
+	sort.Sort(sort.Reverse(sort.StringSlice(candidates)))
+	for _, d := range candidates {
+		if hasDate(d) {
+			return d
+		}
+	}
+	return ""
+}
+
+// Instructions of a compiled formula.
+const (
+	opLoad = iota
+	opConst
+	opNeg
+	opAdd
+	opSub
+	opMul
+	opDiv
+)
+
+type instruction struct {
+	op int
+	// Index of the stat var for opLoad.
+	statVar int
+	// Value for opConst.
+	value float64
+}
+
+// formula is an arithmetic expression over stat vars, compiled to a postfix
+// program.
+type formula struct {
+	statVars []string
+	program  []instruction
+}
+
+// eval evaluates the formula over place-ordered arrays of values, one array
+// per stat var. Each instruction runs over all the places at once.
+func (f *formula) eval(operands [][]float64, n int) []float64 {
+	stack := [][]float64{}
+	for _, ins := range f.program {
+		switch ins.op {
+		case opLoad:
+			stack = append(stack, append([]float64{}, operands[ins.statVar]...))
+		case opConst:
+			values := make([]float64, n)
+			for i := range values {
+				values[i] = ins.value
+			}
+			stack = append(stack, values)
+		case opNeg:
+			values := stack[len(stack)-1]
+			for i := range values {
+				values[i] = -values[i]
+			}
+		default:
+			a, b := stack[len(stack)-2], stack[len(stack)-1]
+			stack = stack[:len(stack)-1]
+			switch ins.op {
+			case opAdd:
+				for i := range a {
+					a[i] += b[i]
+				}
+			case opSub:
+				for i := range a {
+					a[i] -= b[i]
+				}
+			case opMul:
+				for i := range a {
+					a[i] *= b[i]
+				}
+			case opDiv:
+				for i := range a {
+					a[i] /= b[i]
+				}
+			}
+		}
+	}
+	return stack[0]
+}
+
+// formulaParser is a recursive descent parser of formulas:
+//
+//	expr   = term {("+" | "-") term}
+//	term   = factor {("*" | "/") factor}
+//	factor = "-" factor | number | statVar | "[" statVar "]" | "(" expr ")"
+type formulaParser struct {
+	input string
+	pos   int
+	f     *formula
+	index map[string]int
+}
+
+// parseFormula parses and compiles a formula.
+func parseFormula(input string) (*formula, error) {
+	if strings.TrimSpace(input) == "" {
+		return nil, status.Errorf(codes.InvalidArgument, "Missing required argument: formula")
+	}
+	if len(input) > maxFormulaLength {
+		return nil, status.Errorf(codes.InvalidArgument,
+			"Formula is longer than %d characters", maxFormulaLength)
+	}
+	p := &formulaParser{input: input, f: &formula{}, index: map[string]int{}}
+	if err := p.expr(); err != nil {
+		return nil, err
+	}
+	if p.skipSpaces(); p.pos < len(p.input) {
+		return nil, p.errorf("unexpected %q", p.input[p.pos])
+	}
+	if len(p.f.statVars) == 0 {
+		return nil, status.Errorf(codes.InvalidArgument, "Formula has no stat var")
+	}
+	if len(p.f.statVars) > maxFormulaStatVars {
+		return nil, status.Errorf(codes.InvalidArgument,
+			"Formula has more than %d stat vars", maxFormulaStatVars)
+	}
+	return p.f, nil
+}
+
+func (p *formulaParser) errorf(format string, args ...interface{}) error {
+	return status.Errorf(codes.InvalidArgument, "Invalid formula at %d: %s",
+		p.pos, fmt.Sprintf(format, args...))
+}
+
+func (p *formulaParser) skipSpaces() {
+	for p.pos < len(p.input) && p.input[p.pos] == ' ' {
+		p.pos++
+	}
+}
+
+// peek returns the next character, or 0 at the end.
+func (p *formulaParser) peek() byte {
+	p.skipSpaces()
+	if p.pos < len(p.input) {
+		return p.input[p.pos]
+	}
+	return 0
+}
+
+func (p *formulaParser) emit(ins instruction) {
+	p.f.program = append(p.f.program, ins)
+}
+
+func (p *formulaParser) expr() error {
+	if err := p.term(); err != nil {
+		return err
+	}
+	for {
+		c := p.peek()
+		if c != '+' && c != '-' {
+			return nil
+		}
+		p.pos++
+		if err := p.term(); err != nil {
+			return err
+		}
+		if c == '+' {
+			p.emit(instruction{op: opAdd})
+		} else {
+			p.emit(instruction{op: opSub})
+		}
+	}
+}
+
+func (p *formulaParser) term() error {
+	if err := p.factor(); err != nil {
+		return err
+	}
+	for {
+		c := p.peek()
+		if c != '*' && c != '/' {
+			return nil
+		}
+		p.pos++
+		if err := p.factor(); err != nil {
+			return err
+		}
+		if c == '*' {
+			p.emit(instruction{op: opMul})
+		} else {
+			p.emit(instruction{op: opDiv})
+		}
+	}
+}
+
+func (p *formulaParser) factor() error {
+	c := p.peek()
+	switch {
+	case c == 0:
+		return p.errorf("unexpected end")
+	case c == '-':
+		p.pos++
+		if err := p.factor(); err != nil {
+			return err
+		}
+		p.emit(instruction{op: opNeg})
+		return nil
+	case c == '(':
+		p.pos++
+		if err := p.expr(); err != nil {
+			return err
+		}
+		if p.peek() != ')' {
+			return p.errorf("missing )")
+		}
+		p.pos++
+		return nil
+	case c == '[':
+		end := strings.IndexByte(p.input[p.pos:], ']')
+		if end < 0 {
+			return p.errorf("missing ]")
+		}
+		statVar := strings.TrimSpace(p.input[p.pos+1 : p.pos+end])
+		if statVar == "" {
+			return p.errorf("empty stat var")
+		}
+		p.pos += end + 1
+		p.load(statVar)
+		return nil
+	case c >= '0' && c <= '9' || c == '.':
+		start := p.pos
+		for p.pos < len(p.input) && (isDigit(p.input[p.pos]) || p.input[p.pos] == '.') {
+			p.pos++
+		}
+		v, err := strconv.ParseFloat(p.input[start:p.pos], 64)
+		if err != nil {
+			return p.errorf("invalid number %s", p.input[start:p.pos])
+		}
+		p.emit(instruction{op: opConst, value: v})
+		return nil
+	case isStatVarChar(c):
+		start := p.pos
+		for p.pos < len(p.input) && isStatVarChar(p.input[p.pos]) {
+			p.pos++
+		}
+		p.load(p.input[start:p.pos])
+		return nil
+	}
+	return p.errorf("unexpected %q", c)
+}
+
+// load emits the load of a stat var. Each stat var is only read once.
+func (p *formulaParser) load(statVar string) {
+	i, ok := p.index[statVar]
+	if !ok {
+		i = len(p.f.statVars)
+		p.index[statVar] = i
+		p.f.statVars = append(p.f.statVars, statVar)
+	}
+	p.emit(instruction{op: opLoad, statVar: i})
+}
+
+func isDigit(c byte) bool {
+	return c >= '0' && c <= '9'
+}
+
+func isStatVarChar(c byte) bool {
+	return c >= 'a' && c <= 'z' || c >= 'A' && c <= 'Z' || isDigit(c) ||
+		c == '_' || c == '.' || c == ':'
+}
@@ -0,0 +1,101 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"math"
+	"testing"
+
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/google/go-cmp/cmp"
+)
+
+func TestFormula(t *testing.T) {
+	places := []string{"geoId/01", "geoId/02", "geoId/03"}
+	series := func(val map[string]float64) *pb.ObsTimeSeries {
+		return &pb.ObsTimeSeries{SourceSeries: []*pb.SourceSeries{{Val: val}}}
+	}
+	data := map[string]map[string]*pb.ObsTimeSeries{
+		"geoId/01": {
+			"Count_Person_Female": series(map[string]float64{"2018": 50, "2019": 60}),
+			"Count_Person":        series(map[string]float64{"2018": 100, "2019": 120, "2020": 130}),
+			"dc/abc":              series(map[string]float64{"2019": 2}),
+		},
+		"geoId/02": {
+			"Count_Person_Female": series(map[string]float64{"2019": 10}),
+			"Count_Person":        series(map[string]float64{"2019": 0}),
+			"dc/abc":              series(map[string]float64{"2019": 1}),
+		},
+		"geoId/03": {
+			"Count_Person": series(map[string]float64{"2019": 40}),
+		},
+	}
+	for _, c := range []struct {
+		formula   string
+		date      string
+		wantDates []string
+		want      []float64
+	}{
+		{
+			"Count_Person_Female / Count_Person",
+			"",
+			[]string{"2019", "2019", ""},
+			[]float64{0.5, math.Inf(1), math.NaN()},
+		},
+		{
+			"(Count_Person - Count_Person_Female) * 100 / Count_Person",
+			"2018",
+			[]string{"2018", "", ""},
+			[]float64{50, math.NaN(), math.NaN()},
+		},
+		{
+			"-[dc/abc] + Count_Person_Female * 2",
+			"",
+			[]string{"2019", "2019", ""},
+			[]float64{118, 19, math.NaN()},
+		},
+	} {
+		f, err := parseFormula(c.formula)
+		if err != nil {
+			t.Fatalf("parseFormula(%s) = %v", c.formula, err)
+		}
+		dates, operands := formulaOperands(places, f.statVars, data, c.date)
+		if diff := cmp.Diff(c.wantDates, dates); diff != "" {
+			t.Errorf("formulaOperands(%s) dates diff %v", c.formula, diff)
+		}
+		got := f.eval(operands, len(places))
+		for i, want := range c.want {
+			if got[i] != want && !(math.IsNaN(got[i]) && math.IsNaN(want)) {
+				t.Errorf("eval(%s)[%d] = %v, want %v", c.formula, i, got[i], want)
+			}
+		}
+	}
+}
+
+func TestParseFormulaError(t *testing.T) {
+	for _, formula := range []string{
+		"",
+		"1 + 2",
+		"Count_Person /",
+		"(Count_Person",
+		"[dc/abc",
+		"Count_Person Count_Person_Female",
+		"Count_Person % 2",
+	} {
+		if _, err := parseFormula(formula); err == nil {
+			t.Errorf("parseFormula(%q) succeeded", formula)
+		}
+	}
+}
@@ -0,0 +1,172 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"context"
+	"math"
+	"sort"
+
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/status"
+	"google.golang.org/protobuf/encoding/protojson"
+)
+
+// GetStatSeriesWithinPlace implements API for Mixer.GetStatSeriesWithinPlace.
+// Endpoint: /stat/series/within-place
+//
+// The matrix of a stat var is read from a single cache row. When the row is
+// missing, the matrix is built from the series of each child place.
+func (s *Server) GetStatSeriesWithinPlace(
+	ctx context.Context, in *pb.GetStatSeriesWithinPlaceRequest) (
+	*pb.GetStatSeriesWithinPlaceResponse, error) {
+	parentPlace := in.GetParentPlace()
+	childType := in.GetChildType()
+	statVars := in.GetStatVars()
+	if parentPlace == "" {
+		return nil, status.Errorf(codes.InvalidArgument,
+			"Missing required argument: parent_place")
+	}
+	if childType == "" {
+		return nil, status.Errorf(codes.InvalidArgument,
+			"Missing required argument: child_type")
+	}
+	if len(statVars) == 0 {
+		return nil, status.Errorf(codes.InvalidArgument,
+			"Missing required argument: stat_vars")
+	}
+
+	rowList, keyTokens := buildSeriesWithinPlaceKey(parentPlace, childType, statVars)
+	baseDataMap, branchDataMap, err := bigTableReadRowsParallel(
+		ctx,
+		s.store,
+		rowList,
+		convertToSeriesMatrix,
+		func(rowKey string) (string, error) {
+			return keyTokens[rowKey], nil
+		},
+		true, /* readBranch */
+	)
+	if err != nil {
+		return nil, err
+	}
+	result := &pb.GetStatSeriesWithinPlaceResponse{
+		Data: map[string]*pb.SeriesMatrix{},
+	}
+	var missing []string
+	for _, sv := range statVars {
+		if data, ok := branchDataMap[sv]; ok && data != nil {
+			result.Data[sv] = data.(*pb.SeriesMatrix)
+		} else if data, ok := baseDataMap[sv]; ok && data != nil {
+			result.Data[sv] = data.(*pb.SeriesMatrix)
+		} else {
+			missing = append(missing, sv)
+		}
+	}
+	if len(missing) == 0 {
+		return result, nil
+	}
+
+	childPlaces, err := readChildPlaces(ctx, s.store, parentPlace, childType)
+	if err != nil {
+		return nil, err
+	}
+	var data map[string]map[string]*pb.Series
+	if len(childPlaces) > 0 {
+		if data, err = readBestSeries(ctx, s.store, childPlaces, missing); err != nil {
+			return nil, err
+		}
+	}
+	for _, sv := range missing {
+		series := make(map[string]*pb.Series, len(childPlaces))
+		for _, place := range childPlaces {
+			series[place] = data[place][sv]
+		}
+		result.Data[sv] = buildSeriesMatrix(series)
+	}
+	return result, nil
+}
+
+// buildSeriesMatrix returns the matrix of the series keyed by place. Places
+// without data are left out.
+func buildSeriesMatrix(series map[string]*pb.Series) *pb.SeriesMatrix {
+	m := &pb.SeriesMatrix{}
+	dateIndex := map[string]int{}
+	for place, s := range series {
+		if len(s.GetVal()) == 0 {
+			continue
+		}
+		m.Places = append(m.Places, place)
+		for date := range s.Val {
+			if _, ok := dateIndex[date]; !ok {
+				dateIndex[date] = 0
+				m.Dates = append(m.Dates, date)
+			}
+		}
+	}
+	sort.Strings(m.Places)
+	sort.Strings(m.Dates)
+	for i, date := range m.Dates {
+		dateIndex[date] = i
+	}
+
+	m.Values = make([]float64, len(m.Places)*len(m.Dates))
+	m.Source = make([]int32, len(m.Places))
+	sourceIndex := map[[6]string]int32{}
+	for i, place := range m.Places {
+		row := m.Values[i*len(m.Dates) : (i+1)*len(m.Dates)]
+		for j := range row {
+			row[j] = math.NaN()
+		}
+		s := series[place]
+		for date, value := range s.Val {
+			row[dateIndex[date]] = value
+		}
+		md := s.GetMetadata()
+		key := [6]string{
+			md.GetImportName(),
+			md.GetProvenanceUrl(),
+			md.GetMeasurementMethod(),
+			md.GetObservationPeriod(),
+			md.GetScalingFactor(),
+			md.GetUnit(),
+		}
+		index, ok := sourceIndex[key]
+		if !ok {
+			index = int32(len(m.Metadata))
+			sourceIndex[key] = index
+			m.Metadata = append(m.Metadata, &pb.StatMetadata{
+				ImportName:        key[0],
+				ProvenanceUrl:     key[1],
+				MeasurementMethod: key[2],
+				ObservationPeriod: key[3],
+				ScalingFactor:     key[4],
+				Unit:              key[5],
+			})
+		}
+		m.Source[i] = index
+	}
+	return m
+}
+
+// convert the cache row of a series matrix to pb.SeriesMatrix
+func convertToSeriesMatrix(token string, jsonRaw []byte) (interface{}, error) {
+	m := &pb.SeriesMatrix{}
+	if err := protojson.Unmarshal(jsonRaw, m); err != nil {
+		return nil, err
+	}
+	return m, nil
+}
@@ -0,0 +1,59 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"math"
+	"testing"
+
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/google/go-cmp/cmp"
+	"google.golang.org/protobuf/testing/protocmp"
+)
+
+func TestBuildSeriesMatrix(t *testing.T) {
+	pep := &pb.StatMetadata{ImportName: "CensusPEP", MeasurementMethod: "CensusPEPSurvey"}
+	acs := &pb.StatMetadata{ImportName: "CensusACS5YearSurvey", MeasurementMethod: "CensusACS5yrSurvey"}
+	got := buildSeriesMatrix(map[string]*pb.Series{
+		"geoId/06": {Val: map[string]float64{"2018": 1, "2019": 2}, Metadata: pep},
+		"geoId/01": {Val: map[string]float64{"2019": 3, "2020": 4}, Metadata: acs},
+		"geoId/02": {Val: map[string]float64{"2017": 5}, Metadata: pep},
+		"geoId/04": nil,
+	})
+	nan := math.NaN()
+	want := &pb.SeriesMatrix{
+		Places: []string{"geoId/01", "geoId/02", "geoId/06"},
+		Dates:  []string{"2017", "2018", "2019", "2020"},
+		Values: []float64{
+			nan, nan, 3, 4,
+			5, nan, nan, nan,
+			nan, 1, 2, nan,
+		},
+		Source:   []int32{0, 1, 1},
+		Metadata: []*pb.StatMetadata{acs, pep},
+	}
+	if len(got.Values) != len(want.Values) {
+		t.Fatalf("buildSeriesMatrix() has %d values, want %d", len(got.Values), len(want.Values))
+	}
+	for i, v := range want.Values {
+		if math.IsNaN(v) != math.IsNaN(got.Values[i]) || (!math.IsNaN(v) && v != got.Values[i]) {
+			t.Errorf("buildSeriesMatrix() Values[%d] = %v, want %v", i, got.Values[i], v)
+		}
+	}
+	want.Values, got.Values = nil, nil
+	if diff := cmp.Diff(want, got, protocmp.Transform()); diff != "" {
+		t.Errorf("buildSeriesMatrix() diff %v", diff)
+	}
+}
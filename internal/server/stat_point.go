@@ -48,9 +48,22 @@ func (s *Server) GetStatValue(ctx context.Context, in *pb.GetStatValueRequest) (
 		Sfactor: in.GetScalingFactor(),
 	}
 
+	if date == "" && *filterProp == (ObsProp{}) {
+		latest, err := readLatestStats(ctx, s.store, []string{place}, []string{statVar})
+		if err != nil {
+			return nil, err
+		}
+		if latest[place][statVar] == nil {
+			return nil, status.Errorf(
+				codes.NotFound, "No data for %s, %s", place, statVar)
+		}
+		return &pb.GetStatValueResponse{Value: latest[place][statVar].Value}, nil
+	}
+
 	rowList, keyTokens := buildStatsKey([]string{place}, []string{statVar})
 	var obsTimeSeries *ObsTimeSeries
-	btData, err := readStats(ctx, s.store, rowList, keyTokens)
+	btData, err := readStats(ctx, s.store, rowList, keyTokens,
+		statSourceFilter(filterProp, false))
 	if err != nil {
 		return nil, err
 	}
@@ -85,8 +98,34 @@ func getStatSet(
 		}
 	}
 
+	if date == "" {
+		latest, err := readLatestStats(ctx, s.store, places, statVars)
+		if err != nil {
+			return nil, err
+		}
+		for place, placeData := range latest {
+			for statVar, stat := range placeData {
+				if stat == nil {
+					continue
+				}
+				meta := stat.Metadata
+				result.Data[statVar].Stat[place] = &pb.PointStat{
+					Date:     stat.Date,
+					Value:    stat.Value,
+					Metadata: &pb.StatMetadata{ImportName: meta.GetImportName()},
+				}
+				if meta != nil {
+					result.Data[statVar].Metadata[meta.ImportName] = meta
+				}
+			}
+		}
+		log.Printf("getStatSet() completed for %d places, %d stat vars, in %s seconds",
+			len(places), len(statVars), time.Since(ts))
+		return result, nil
+	}
+
 	rowList, keyTokens := buildStatsKey(places, statVars)
-	cacheData, err := readStatsPb(ctx, s.store, rowList, keyTokens)
+	cacheData, err := readStatsPb(ctx, s.store, rowList, keyTokens, nil)
 	if err != nil {
 		return nil, err
 	}
@@ -0,0 +1,246 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"context"
+	"log"
+	"regexp"
+	"sort"
+	"strings"
+	"time"
+
+	"cloud.google.com/go/bigtable"
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/datacommonsorg/mixer/internal/util"
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/status"
+)
+
+const (
+	defaultScanBatchSize = 100
+	maxScanBatchSize     = 1000
+	// Larger stat var allowlists are checked after the read, to keep the row
+	// filter small.
+	maxScanFilterStatVars = 500
+)
+
+// ScanPlaceStat implements API for Mixer.ScanPlaceStat.
+//
+// The rows of a place, "d/f/<place>^<stat var>", are contiguous, so they are
+// read in one scan of the prefix instead of a lookup per stat var. Batches are
+// sent as the rows arrive, and Send blocking on the stream holds back the
+// scan.
+func (s *Server) ScanPlaceStat(
+	in *pb.ScanPlaceStatRequest, stream pb.Mixer_ScanPlaceStatServer) error {
+	ctx := stream.Context()
+	place := in.GetPlace()
+	if place == "" {
+		return status.Errorf(codes.InvalidArgument, "Missing required argument: place")
+	}
+	baseBt := s.store.BaseBt()
+	if baseBt == nil {
+		return status.Errorf(codes.NotFound, "Bigtable instance is not specified")
+	}
+	batchSize := int(in.GetBatchSize())
+	if batchSize <= 0 {
+		batchSize = defaultScanBatchSize
+	} else if batchSize > maxScanBatchSize {
+		batchSize = maxScanBatchSize
+	}
+	var allow map[string]bool
+	if len(in.GetStatVars()) > 0 {
+		allow = map[string]bool{}
+		for _, sv := range in.GetStatVars() {
+			allow[sv] = true
+		}
+	}
+	prefix := util.BtChartDataPrefix + place + "^"
+	opts := scanReadOptions(prefix, in.GetStatVars(), in.GetBestSource())
+
+	// The branch cache is small. It is read first, so its series replace the
+	// ones of the base cache as the base rows stream.
+	branch, err := s.scanBranch(ctx, prefix, opts)
+	if err != nil {
+		return err
+	}
+
+	batch := &pb.PlaceStat{StatVarData: map[string]*pb.ObsTimeSeries{}}
+	add := func(statVar string, series *pb.ObsTimeSeries) error {
+		if in.GetBestSource() {
+			keepBestSource(series)
+		}
+		batch.StatVarData[statVar] = series
+		if len(batch.StatVarData) < batchSize {
+			return nil
+		}
+		err := stream.Send(batch)
+		batch = &pb.PlaceStat{StatVarData: map[string]*pb.ObsTimeSeries{}}
+		return err
+	}
+	var scanErr error
+	// The base scan does not take a slot of the limiter: its length depends on
+	// how fast the client receives, and a slow client would hold the slot.
+	err = baseBt.ReadRows(ctx, bigtable.PrefixRange(prefix),
+		func(btRow bigtable.Row) bool {
+			statVar, ok := scanStatVar(btRow.Key(), prefix)
+			if !ok || (allow != nil && !allow[statVar]) {
+				return true
+			}
+			series, ok := branch[statVar]
+			if ok {
+				delete(branch, statVar)
+			} else if series, scanErr = decodeScanRow(btRow); scanErr != nil {
+				return false
+			}
+			if series == nil {
+				return true
+			}
+			scanErr = add(statVar, series)
+			return scanErr == nil
+		}, opts...)
+	if err != nil {
+		return err
+	}
+	if scanErr != nil {
+		return scanErr
+	}
+	// Stat vars only in the branch cache.
+	statVars := make([]string, 0, len(branch))
+	for statVar := range branch {
+		statVars = append(statVars, statVar)
+	}
+	sort.Strings(statVars)
+	for _, statVar := range statVars {
+		if allow != nil && !allow[statVar] {
+			continue
+		}
+		if err := add(statVar, branch[statVar]); err != nil {
+			return err
+		}
+	}
+	if len(batch.StatVarData) > 0 {
+		return stream.Send(batch)
+	}
+	return nil
+}
+
+// scanStatVar returns the stat var of a row under prefix, or false for the
+// rows of the stat collections of child places, "<prefix><type>^<stat var>".
+// The row filter excludes them too, but a larger stat var allowlist is not in
+// the filter.
+func scanStatVar(rowKey, prefix string) (string, bool) {
+	statVar := strings.TrimPrefix(rowKey, prefix)
+	return statVar, !strings.Contains(statVar, "^")
+}
+
+// scanReadOptions returns the options to read the stat rows under prefix.
+// The rows of stat collections of child places, which share the prefix of
+// the parent place, are filtered out.
+func scanReadOptions(prefix string, statVars []string, bestSource bool) []bigtable.ReadOption {
+	pattern := regexp.QuoteMeta(prefix)
+	if len(statVars) > 0 && len(statVars) <= maxScanFilterStatVars {
+		quoted := make([]string, len(statVars))
+		for i, sv := range statVars {
+			quoted[i] = regexp.QuoteMeta(sv)
+		}
+		pattern += "(?:" + strings.Join(quoted, "|") + ")"
+	} else {
+		pattern += `[^^]+`
+	}
+	filter := bigtable.RowKeyFilter(pattern)
+	if bestSource {
+		filter = bigtable.ChainFilters(filter, (&sourceFilter{limit: 1}).btFilter())
+	} else {
+		filter = bigtable.ChainFilters(filter, bigtable.LatestNFilter(1))
+	}
+	return []bigtable.ReadOption{bigtable.RowFilter(filter)}
+}
+
+// scanBranch reads the stat rows under prefix from the branch cache, keyed by
+// stat var. The branch cache is skipped when its circuit breaker is open or
+// the read fails with a breaker.
+func (s *Server) scanBranch(
+	ctx context.Context, prefix string, opts []bigtable.ReadOption) (
+	map[string]*pb.ObsTimeSeries, error) {
+	result := map[string]*pb.ObsTimeSeries{}
+	branchBt := s.store.BranchBt()
+	if branchBt == nil {
+		return result, nil
+	}
+	breaker := s.store.BranchBreaker
+	if breaker != nil && !breaker.Allow(time.Now()) {
+		return result, nil
+	}
+	start := time.Now()
+	var decodeErr error
+	err := withLimit(ctx, s.store.BranchLimiter, func() (int, error) {
+		err := branchBt.ReadRows(ctx, bigtable.PrefixRange(prefix),
+			func(btRow bigtable.Row) bool {
+				statVar, ok := scanStatVar(btRow.Key(), prefix)
+				if !ok {
+					return true
+				}
+				var series *pb.ObsTimeSeries
+				if series, decodeErr = decodeScanRow(btRow); decodeErr != nil {
+					return false
+				}
+				if series != nil {
+					result[statVar] = series
+				}
+				return true
+			}, opts...)
+		return len(result), err
+	})
+	if err == nil {
+		err = decodeErr
+	}
+	if breaker == nil {
+		return result, err
+	}
+	breaker.Record(time.Now(), time.Since(start), err)
+	if err != nil {
+		log.Printf("Scanning base cache only, failed to read branch cache: %v", err)
+		return map[string]*pb.ObsTimeSeries{}, nil
+	}
+	return result, nil
+}
+
+// decodeScanRow decodes the series of a stat row, or returns nil if the row
+// has no value.
+func decodeScanRow(btRow bigtable.Row) (*pb.ObsTimeSeries, error) {
+	raw := rowValue(btRow)
+	if raw == nil {
+		return nil, nil
+	}
+	jsonRaw, err := decodeRow(raw)
+	if err != nil {
+		return nil, status.Errorf(codes.Internal, "Invalid row %s: %v", btRow.Key(), err)
+	}
+	series, err := convertToObsSeriesPb("", jsonRaw)
+	if err != nil {
+		return nil, err
+	}
+	return series.(*pb.ObsTimeSeries), nil
+}
+
+// keepBestSource drops all the sources of a series but the best ranked one.
+func keepBestSource(series *pb.ObsTimeSeries) {
+	if len(series.SourceSeries) <= 1 {
+		return
+	}
+	sort.Sort(SeriesByRank(series.SourceSeries))
+	series.SourceSeries = series.SourceSeries[:1]
+}
@@ -0,0 +1,124 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"context"
+	"sort"
+	"testing"
+
+	"cloud.google.com/go/bigtable"
+	pb "github.com/datacommonsorg/mixer/internal/proto"
+	"github.com/datacommonsorg/mixer/internal/store"
+	"github.com/datacommonsorg/mixer/internal/util"
+	"github.com/google/go-cmp/cmp"
+	"google.golang.org/grpc"
+)
+
+type fakeScanStream struct {
+	grpc.ServerStream
+	batches []*pb.PlaceStat
+}
+
+func (s *fakeScanStream) Context() context.Context {
+	return context.Background()
+}
+
+func (s *fakeScanStream) Send(batch *pb.PlaceStat) error {
+	s.batches = append(s.batches, batch)
+	return nil
+}
+
+func TestScanPlaceStat(t *testing.T) {
+	ctx := context.Background()
+	btTable, err := SetupBigtable(ctx, map[string]string{})
+	if err != nil {
+		t.Fatalf("SetupBigtable() = %v", err)
+	}
+	pep := &pb.SourceSeries{
+		ImportName:        "CensusPEP",
+		MeasurementMethod: "CensusPEPSurvey",
+		Val:               map[string]float64{"2019": 2},
+	}
+	acs := &pb.SourceSeries{
+		ImportName:        "CensusACS5YearSurvey",
+		MeasurementMethod: "CensusACS5yrSurvey",
+		Val:               map[string]float64{"2019": 1},
+	}
+	chartStore := func(sources ...*pb.SourceSeries) *pb.ChartStore {
+		return &pb.ChartStore{Val: &pb.ChartStore_ObsTimeSeries{
+			ObsTimeSeries: &pb.ObsTimeSeries{SourceSeries: sources},
+		}}
+	}
+	for rowKey, cell := range map[string][]byte{
+		util.BtChartDataPrefix + "geoId/06^Count_Person":  encodeCell(t, chartStore(acs, pep)),
+		util.BtChartDataPrefix + "geoId/06^Median_Age":    encodeCell(t, chartStore(pep)),
+		util.BtChartDataPrefix + "geoId/061^Count_Person": encodeCell(t, chartStore(pep)),
+		// A stat collection of the child places, which is not a series of
+		// geoId/06.
+		util.BtChartDataPrefix + "geoId/06^County^Count_Person": encodeCell(t, chartStore(acs)),
+	} {
+		mut := bigtable.NewMutation()
+		mut.Set(util.BtFamily, "value", bigtable.Now(), cell)
+		if err := btTable.Apply(ctx, rowKey, mut); err != nil {
+			t.Fatalf("Apply() = %v", err)
+		}
+	}
+	s := &Server{store: store.NewStore(nil, btTable, nil)}
+
+	for _, c := range []struct {
+		req  *pb.ScanPlaceStatRequest
+		want [][]string
+	}{
+		{
+			&pb.ScanPlaceStatRequest{Place: "geoId/06", BatchSize: 1},
+			[][]string{
+				{"Count_Person/CensusACS5YearSurvey", "Count_Person/CensusPEP"},
+				{"Median_Age/CensusPEP"},
+			},
+		},
+		{
+			&pb.ScanPlaceStatRequest{Place: "geoId/06", BestSource: true},
+			[][]string{{"Count_Person/CensusPEP", "Median_Age/CensusPEP"}},
+		},
+		{
+			&pb.ScanPlaceStatRequest{Place: "geoId/06", StatVars: []string{"Median_Age", "Count_Household"}},
+			[][]string{{"Median_Age/CensusPEP"}},
+		},
+	} {
+		stream := &fakeScanStream{}
+		if err := s.ScanPlaceStat(c.req, stream); err != nil {
+			t.Fatalf("ScanPlaceStat(%v) = %v", c.req, err)
+		}
+		got := [][]string{}
+		for _, batch := range stream.batches {
+			sources := []string{}
+			statVars := make([]string, 0, len(batch.StatVarData))
+			for sv := range batch.StatVarData {
+				statVars = append(statVars, sv)
+			}
+			sort.Strings(statVars)
+			for _, sv := range statVars {
+				for _, source := range batch.StatVarData[sv].GetSourceSeries() {
+					sources = append(sources, sv+"/"+source.ImportName)
+				}
+			}
+			got = append(got, sources)
+		}
+		if diff := cmp.Diff(c.want, got); diff != "" {
+			t.Errorf("ScanPlaceStat(%v) diff %v", c.req, diff)
+		}
+	}
+}
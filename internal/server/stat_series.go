@@ -19,7 +19,6 @@ import (
 	"encoding/json"
 	"sort"
 
-	"cloud.google.com/go/bigtable"
 	pb "github.com/datacommonsorg/mixer/internal/proto"
 	"google.golang.org/grpc/codes"
 	"google.golang.org/grpc/status"
@@ -47,9 +46,14 @@ func (s *Server) GetStatSeries(
 		Unit:    in.GetUnit(),
 		Sfactor: in.GetScalingFactor(),
 	}
+	transforms, err := parseTransforms(in.GetTransforms())
+	if err != nil {
+		return nil, err
+	}
 
 	rowList, keyTokens := buildStatsKey([]string{place}, []string{statVar})
-	btData, err := readStats(ctx, s.store, rowList, keyTokens)
+	btData, err := readStats(ctx, s.store, rowList, keyTokens,
+		statSourceFilter(filterProp, true))
 	if err != nil {
 		return nil, err
 	}
@@ -65,6 +69,12 @@ func (s *Server) GetStatSeries(
 	if len(series) > 0 {
 		resp.Series = series[0].Val
 	}
+	if in.GetAlign() != nil || len(transforms) > 0 {
+		derived := []*pb.Series{{Val: resp.Series}}
+		alignSeries(derived, in.GetAlign())
+		deriveSeries(derived, transforms)
+		resp.Series = derived[0].Val
+	}
 	return &resp, nil
 }
 
@@ -98,8 +108,9 @@ func (s *Server) GetStatAll(ctx context.Context, in *pb.GetStatAllRequest) (
 		}
 	}
 
+	s.store.Prefetcher.ObserveStatVars(statVars)
 	rowList, keyTokens := buildStatsKey(places, statVars)
-	cacheData, err := readStatsPb(ctx, s.store, rowList, keyTokens)
+	cacheData, err := readStatsPb(ctx, s.store, rowList, keyTokens, nil)
 	if err != nil {
 		return nil, err
 	}
@@ -133,28 +144,10 @@ func (s *Server) GetStats(ctx context.Context, in *pb.GetStatsRequest) (
 		Operiod: in.GetObservationPeriod(),
 		Unit:    in.GetUnit(),
 	}
-	var rowList bigtable.RowList
-	var keyTokens map[string]*placeStatVar
-	rowList, keyTokens = buildStatsKey(placeDcids, []string{statsVarDcid})
-
-	result := map[string]*ObsTimeSeries{}
-	cacheData, err := readStats(ctx, s.store, rowList, keyTokens)
+	result, err := readRankedStats(ctx, s.store, placeDcids, statsVarDcid, filterProp)
 	if err != nil {
 		return nil, err
 	}
-	for place := range cacheData {
-		result[place] = cacheData[place][statsVarDcid]
-	}
-
-	// Fill missing place data and result result
-	for _, dcid := range placeDcids {
-		if _, ok := result[dcid]; !ok {
-			result[dcid] = nil
-		}
-	}
-	for _, obsSeries := range result {
-		obsSeries.filterAndRank(filterProp)
-	}
 	jsonRaw, err := json.Marshal(result)
 	if err != nil {
 		return nil, err
@@ -176,30 +169,30 @@ func (s *Server) GetStatSetSeries(ctx context.Context, in *pb.GetStatSetSeriesRe
 		return nil, status.Errorf(
 			codes.InvalidArgument, "Missing required argument: stat_vars")
 	}
-
-	rowList, keyTokens := buildStatsKey(places, statVars)
-	// Initialize result with place and stat var dcids.
-	result := &pb.GetStatSetSeriesResponse{
-		Data: make(map[string]*pb.SeriesMap),
-	}
-	for _, place := range places {
-		result.Data[place] = &pb.SeriesMap{
-			Data: make(map[string]*pb.Series),
-		}
-		for _, statVar := range statVars {
-			result.Data[place].Data[statVar] = nil
-		}
+	transforms, err := parseTransforms(in.GetTransforms())
+	if err != nil {
+		return nil, err
 	}
-	cacheData, err := readStatsPb(ctx, s.store, rowList, keyTokens)
+
+	data, err := readBestSeries(ctx, s.store, places, statVars)
 	if err != nil {
 		return nil, err
 	}
-	for place, placeData := range cacheData {
-		for statVar, data := range placeData {
-			if data != nil {
-				result.Data[place].Data[statVar] = getBestSeries(data)
+	result := &pb.GetStatSetSeriesResponse{
+		Data: make(map[string]*pb.SeriesMap, len(data)),
+	}
+	for place, seriesMap := range data {
+		result.Data[place] = &pb.SeriesMap{Data: seriesMap}
+	}
+	if in.GetAlign() != nil || len(transforms) > 0 {
+		series := []*pb.Series{}
+		for _, seriesMap := range result.Data {
+			for _, s := range seriesMap.Data {
+				series = append(series, s)
 			}
 		}
+		alignSeries(series, in.GetAlign())
+		deriveSeries(series, transforms)
 	}
 	return result, nil
 }
@@ -116,12 +116,11 @@ func (s *Server) GetStatVarGroup(
 	// User can provide any arbitrary dcid, which might not be associated with
 	// stat vars. In this case, an empty response is returned.
 	if len(places) > 0 {
-		svUnionResp, err := s.GetPlaceStatVarsUnion(
-			ctx, &pb.GetPlaceStatVarsUnionRequest{Dcids: places})
+		var err error
+		statVars, err = readPlaceStatVarsUnion(ctx, s.store, places)
 		if err != nil {
 			return nil, err
 		}
-		statVars = svUnionResp.StatVars.StatVars
 	}
 
 	// Read stat var group cache data
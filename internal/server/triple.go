@@ -22,6 +22,7 @@ import (
 	"strings"
 
 	"cloud.google.com/go/bigtable"
+	"github.com/datacommonsorg/mixer/internal/base"
 	pb "github.com/datacommonsorg/mixer/internal/proto"
 	"github.com/datacommonsorg/mixer/internal/store"
 	"github.com/datacommonsorg/mixer/internal/util"
@@ -49,42 +50,52 @@ var obsProps = []prop{
 
 func getObsTriples(
 	ctx context.Context, s *Server, obsDcids []string) (map[string][]*Triple, error) {
-	dcidList := ""
-	for _, dcid := range obsDcids {
-		dcidList += fmt.Sprintf("\"%s\" ", dcid)
+	// The query is built directly rather than as a SPARQL string. It selects
+	// ?o ?provenance and one node per obsProps, in this order.
+	nodes := []base.Node{base.NewNode("?o"), base.NewNode("?provenance")}
+	queries := []*base.Query{
+		base.NewQuery("typeOf", "?o", "StatVarObservation"),
+		base.NewQuery("provenance", "?o", base.NewNode("?provenance")),
 	}
-	selectStatment := "SELECT ?o ?provenance "
-	tripleStatment := "?o typeOf StatVarObservation . ?o provenance ?provenance . "
 	for _, prop := range obsProps {
-		selectStatment += fmt.Sprintf("?%s ", prop.name)
-		tripleStatment += fmt.Sprintf("?o %s ?%s . ", prop.name, prop.name)
-	}
-	tripleStatment += fmt.Sprintf("?o dcid (%s)", dcidList)
-	sparql := fmt.Sprintf(
-		`%s
-				WHERE {
-					%s
-				}
-				`, selectStatment, tripleStatment,
-	)
-	resp, err := s.Query(ctx, &pb.QueryRequest{Sparql: sparql})
+		alias := "?" + prop.name
+		nodes = append(nodes, base.NewNode(alias))
+		queries = append(queries, base.NewQuery(prop.name, "?o", base.NewNode(alias)))
+	}
+	quoted := make([]string, len(obsDcids))
+	for i, dcid := range obsDcids {
+		quoted[i] = fmt.Sprintf("\"%s\"", dcid)
+	}
+	var dcidObj interface{} = quoted
+	if len(quoted) == 1 {
+		dcidObj = quoted[0]
+	}
+	queries = append(queries, base.NewQuery("dcid", "?o", dcidObj))
+	resp, err := s.runQuery(ctx, nodes, queries, &base.QueryOptions{})
 	if err != nil {
 		return nil, err
 	}
+
 	result := map[string][]*Triple{}
+	// The object triples of each observation, sorted by object dcid.
+	objTriples := map[string][]*Triple{}
+	objDcids := []string{}
+	seen := map[string]bool{}
 	for _, row := range resp.GetRows() {
 		dcid := row.GetCells()[0].Value
 		prov := row.GetCells()[1].Value
-		objDcids := []string{}
-		objTriples := map[string]*Triple{}
+		rowTriples := map[string]*Triple{}
 		for i, prop := range obsProps {
 			objCell := row.GetCells()[i+2].Value
 			if objCell != "" {
 				if prop.isObj {
 					// The object is a node; need to fetch the name.
 					objDcid := objCell
-					objDcids = append(objDcids, objDcid)
-					objTriples[objDcid] = &Triple{
+					if !seen[objDcid] {
+						seen[objDcid] = true
+						objDcids = append(objDcids, objDcid)
+					}
+					rowTriples[objDcid] = &Triple{
 						SubjectID:    dcid,
 						Predicate:    prop.name,
 						ObjectID:     objDcid,
@@ -100,24 +111,31 @@ func getObsTriples(
 				}
 			}
 		}
-		nameNodes, err := getPropertyValuesHelper(ctx, s.store, objDcids, "name", true)
-		if err != nil {
-			return nil, err
-		}
-		for prop, nodes := range nameNodes {
-			if len(nodes) > 0 {
-				objTriples[prop].ObjectName = nodes[0].Value
-			}
-		}
 		// Sort the triples to get determinisic result.
-		keys := make([]string, 0)
-		for k := range objTriples {
+		keys := make([]string, 0, len(rowTriples))
+		for k := range rowTriples {
 			keys = append(keys, k)
 		}
 		sort.Strings(keys)
 		for _, key := range keys {
-			result[dcid] = append(result[dcid], objTriples[key])
+			objTriples[dcid] = append(objTriples[dcid], rowTriples[key])
+		}
+	}
+	if len(objDcids) == 0 {
+		return result, nil
+	}
+	// Names of the objects of all the rows in one read.
+	nameNodes, err := getPropertyValuesHelper(ctx, s.store, objDcids, "name", true)
+	if err != nil {
+		return nil, err
+	}
+	for dcid, triples := range objTriples {
+		for _, t := range triples {
+			if names := nameNodes[t.ObjectID]; len(names) > 0 {
+				t.ObjectName = names[0].Value
+			}
 		}
+		result[dcid] = append(result[dcid], triples...)
 	}
 	return result, nil
 }
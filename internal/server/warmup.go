@@ -0,0 +1,130 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package server
+
+import (
+	"bufio"
+	"context"
+	"log"
+	"os"
+	"strings"
+
+	"cloud.google.com/go/bigtable"
+	"github.com/datacommonsorg/mixer/internal/util"
+	"golang.org/x/sync/errgroup"
+)
+
+// The row key used to prime Bigtable connections. It does not need to exist.
+const primeRowKey = "mixer-warmup"
+
+// BuildCache builds the in-memory cache from the base table. The server should
+// not serve traffic before this is done.
+func (s *Server) BuildCache(ctx context.Context) error {
+	cache, err := NewCache(ctx, s.store.BaseBt())
+	if err != nil {
+		return err
+	}
+	s.cache = cache
+	return nil
+}
+
+// PrimeConnections sends concurrent point reads to the base and branch tables,
+// so the Bigtable connection pools are established before the first request.
+func (s *Server) PrimeConnections(ctx context.Context, numReads int) error {
+	errs, errCtx := errgroup.WithContext(ctx)
+	for _, table := range []*bigtable.Table{s.store.BaseBt(), s.store.BranchBt()} {
+		if table == nil {
+			continue
+		}
+		table := table
+		for i := 0; i < numReads; i++ {
+			errs.Go(func() error {
+				_, err := table.ReadRow(errCtx, primeRowKey)
+				return err
+			})
+		}
+	}
+	return errs.Wait()
+}
+
+// ReplayHotKeys reads the given row keys from the base and branch tables, so
+// the hot rows are served from warm Bigtable caches. The rows go through the
+// row cache like the reads of requests, so they are also served from memory,
+// or from the disk cache once evicted. Rows owned by other replicas are
+// skipped, as those replicas replay them.
+func (s *Server) ReplayHotKeys(ctx context.Context, rowKeys []string) error {
+	var rowList bigtable.RowList
+	for _, rowKey := range rowKeys {
+		if s.store.Peers != nil && s.store.Peers.Owner(rowKey) != "" {
+			continue
+		}
+		rowList = append(rowList, rowKey)
+	}
+	if len(rowList) == 0 {
+		return nil
+	}
+	baseTableName, branchTableName := s.store.TableNames()
+	errs, errCtx := errgroup.WithContext(ctx)
+	for _, table := range []struct {
+		bt   *bigtable.Table
+		name string
+	}{
+		{s.store.BaseBt(), baseTableName},
+		{s.store.BranchBt(), branchTableName},
+	} {
+		if table.bt == nil {
+			continue
+		}
+		table := table
+		for left := 0; left < len(rowList); left += util.BtBatchQuerySize {
+			right := left + util.BtBatchQuerySize
+			if right > len(rowList) {
+				right = len(rowList)
+			}
+			part := rowList[left:right]
+			errs.Go(func() error {
+				return readRows(errCtx, s.store, table.bt, table.name, part, false, nil,
+					func(rowKey string, raw []byte) bool {
+						return true
+					})
+			})
+		}
+	}
+	return errs.Wait()
+}
+
+// ReadHotKeys reads row keys from a file with one row key per line. Empty
+// lines and lines starting with "#" are skipped.
+func ReadHotKeys(path string) ([]string, error) {
+	file, err := os.Open(path)
+	if err != nil {
+		return nil, err
+	}
+	defer file.Close()
+	var result []string
+	scanner := bufio.NewScanner(file)
+	for scanner.Scan() {
+		line := strings.TrimSpace(scanner.Text())
+		if line == "" || strings.HasPrefix(line, "#") {
+			continue
+		}
+		result = append(result, line)
+	}
+	if err := scanner.Err(); err != nil {
+		return nil, err
+	}
+	log.Printf("Read %d hot keys from %s", len(result), path)
+	return result, nil
+}
@@ -19,6 +19,12 @@ import (
 
 	"cloud.google.com/go/bigquery"
 	"cloud.google.com/go/bigtable"
+	"github.com/datacommonsorg/mixer/internal/batch"
+	"github.com/datacommonsorg/mixer/internal/diskcache"
+	"github.com/datacommonsorg/mixer/internal/limiter"
+	"github.com/datacommonsorg/mixer/internal/peer"
+	"github.com/datacommonsorg/mixer/internal/prefetch"
+	"github.com/datacommonsorg/mixer/internal/rowcache"
 )
 
 // Store holds the handlers to BigQuery and Bigtable
@@ -27,6 +33,25 @@ type Store struct {
 	baseTable   *bigtable.Table
 	branchTable *bigtable.Table
 	branchLock  sync.RWMutex
+	// Names of the base and branch tables, which identify the cache data.
+	baseTableName   string
+	branchTableName string
+	// Cache of raw Bigtable cells, keyed by table name and row key. Optional.
+	RowCache *rowcache.Cache
+	// Local disk cache of the rows evicted from RowCache. Optional.
+	DiskCache *diskcache.Cache
+	// Warms RowCache with the rows that are likely read next. Optional.
+	Prefetcher *prefetch.Prefetcher
+	// Concurrency limits of the reads of each table. Optional.
+	BaseLimiter   *limiter.Limiter
+	BranchLimiter *limiter.Limiter
+	// Skips the branch table when it fails or is too slow, so responses are
+	// served from the base table only. Optional.
+	BranchBreaker *limiter.Breaker
+	// Routes row reads to the replicas that own them. Optional.
+	Peers *peer.Router
+	// Merges the small row reads of concurrent requests. Optional.
+	Batcher *batch.Batcher
 }
 
 // BaseBt is the accessor for base bigtable
@@ -41,11 +66,41 @@ func (st *Store) BranchBt() *bigtable.Table {
 	return st.branchTable
 }
 
+// Limiter returns the concurrency limiter of the reads of a table, or nil when
+// the reads are not limited.
+func (st *Store) Limiter(btTable *bigtable.Table) *limiter.Limiter {
+	switch {
+	case btTable == nil:
+		return nil
+	case btTable == st.baseTable:
+		return st.BaseLimiter
+	case btTable == st.BranchBt():
+		return st.BranchLimiter
+	}
+	return nil
+}
+
 // UpdateBranchBt updates the branch bigtable
-func (st *Store) UpdateBranchBt(branchTable *bigtable.Table) {
+func (st *Store) UpdateBranchBt(branchTable *bigtable.Table, branchTableName string) {
 	st.branchLock.Lock()
 	defer st.branchLock.Unlock()
 	st.branchTable = branchTable
+	st.branchTableName = branchTableName
+}
+
+// SetTableNames sets the names of the base and branch tables.
+func (st *Store) SetTableNames(baseTableName, branchTableName string) {
+	st.branchLock.Lock()
+	defer st.branchLock.Unlock()
+	st.baseTableName = baseTableName
+	st.branchTableName = branchTableName
+}
+
+// TableNames returns the names of the base and branch tables.
+func (st *Store) TableNames() (string, string) {
+	st.branchLock.RLock()
+	defer st.branchLock.RUnlock()
+	return st.baseTableName, st.branchTableName
 }
 
 // NewStore creates a new store.
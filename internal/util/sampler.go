@@ -0,0 +1,195 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package util
+
+import (
+	"sort"
+
+	"google.golang.org/protobuf/proto"
+	"google.golang.org/protobuf/reflect/protoreflect"
+)
+
+// Sampler is a SamplingStrategy compiled against a message descriptor.
+//
+// Field names, exclusions and child strategies are resolved once when the
+// sampler is built, so sampling a message only touches the fields that are
+// affected by the strategy. The output is the same as Sample() with the same
+// strategy.
+type Sampler struct {
+	// Fields cleared from the message.
+	exclude []protoreflect.FieldDescriptor
+	// Fields that are sampled.
+	fields []*fieldSampler
+}
+
+type fieldSampler struct {
+	fd        protoreflect.FieldDescriptor
+	maxSample int
+	// Map keys that are not sampled at all.
+	excludeKeys map[string]struct{}
+	// Sampler for the message value of the field. For a map field, this applies
+	// to every map value and is only set when the strategy has children.
+	child *Sampler
+}
+
+type samplerKey struct {
+	name     protoreflect.FullName
+	strategy *SamplingStrategy
+}
+
+// NewSampler compiles a sampling strategy for messages of the given type.
+func NewSampler(
+	md protoreflect.MessageDescriptor, strategy *SamplingStrategy) *Sampler {
+	return compileSampler(md, strategy, map[samplerKey]*Sampler{})
+}
+
+func compileSampler(
+	md protoreflect.MessageDescriptor,
+	strategy *SamplingStrategy,
+	compiled map[samplerKey]*Sampler,
+) *Sampler {
+	key := samplerKey{md.FullName(), strategy}
+	if s, ok := compiled[key]; ok {
+		return s
+	}
+	s := &Sampler{}
+	// Register before visiting the fields so recursive messages terminate.
+	compiled[key] = s
+
+	exclude := map[string]struct{}{}
+	for _, ex := range strategy.Exclude {
+		exclude[ex] = struct{}{}
+	}
+	fields := md.Fields()
+	for i := 0; i < fields.Len(); i++ {
+		fd := fields.Get(i)
+		fieldName := fd.JSONName()
+		if _, ok := exclude[fieldName]; ok {
+			s.exclude = append(s.exclude, fd)
+			continue
+		}
+		strat, ok := strategy.Children[fieldName]
+		if !ok {
+			continue
+		}
+		fs := &fieldSampler{fd: fd, maxSample: strat.MaxSample}
+		if fd.IsMap() {
+			if len(strat.Exclude) > 0 {
+				fs.excludeKeys = map[string]struct{}{}
+				for _, ex := range strat.Exclude {
+					fs.excludeKeys[ex] = struct{}{}
+				}
+			}
+			if len(strat.Children) > 0 &&
+				fd.MapValue().Kind() == protoreflect.MessageKind {
+				fs.child = compileSampler(fd.MapValue().Message(), strat, compiled)
+			}
+		} else if !fd.IsList() && fd.Kind() == protoreflect.MessageKind {
+			fs.child = compileSampler(fd.Message(), strat, compiled)
+		}
+		s.fields = append(s.fields, fs)
+	}
+	return s
+}
+
+// Sample samples the message in place and returns it.
+func (s *Sampler) Sample(m proto.Message) proto.Message {
+	s.sample(m.ProtoReflect())
+	return m
+}
+
+func (s *Sampler) sample(pr protoreflect.Message) {
+	for _, fd := range s.exclude {
+		pr.Clear(fd)
+	}
+	for _, fs := range s.fields {
+		if !pr.Has(fs.fd) {
+			continue
+		}
+		if fs.fd.IsList() {
+			fs.sampleList(pr.Mutable(fs.fd).List())
+		} else if fs.fd.IsMap() {
+			fs.sampleMap(pr.Mutable(fs.fd).Map())
+		} else if fs.child != nil {
+			fs.child.sample(pr.Mutable(fs.fd).Message())
+		}
+	}
+}
+
+func (fs *fieldSampler) sampleList(l protoreflect.List) {
+	indexes := sampleIndexes(l.Len(), fs.maxSample)
+	values := make([]protoreflect.Value, len(indexes))
+	for i, ind := range indexes {
+		values[i] = l.Get(ind)
+	}
+	l.Truncate(0)
+	for _, v := range values {
+		l.Append(v)
+	}
+}
+
+func (fs *fieldSampler) sampleMap(m protoreflect.Map) {
+	keys := make([]string, 0, m.Len())
+	m.Range(func(k protoreflect.MapKey, v protoreflect.Value) bool {
+		keyStr := k.String()
+		if _, ok := fs.excludeKeys[keyStr]; ok {
+			m.Clear(k)
+		} else {
+			keys = append(keys, keyStr)
+		}
+		return true
+	})
+	// Only sort the keys when some of them are dropped.
+	if fs.maxSample != -1 && fs.maxSample < len(keys) {
+		sort.Strings(keys)
+		sampleKeys := make(map[string]struct{}, fs.maxSample)
+		for _, ind := range sampleIndexes(len(keys), fs.maxSample) {
+			sampleKeys[keys[ind]] = struct{}{}
+		}
+		m.Range(func(k protoreflect.MapKey, v protoreflect.Value) bool {
+			if _, ok := sampleKeys[k.String()]; !ok {
+				m.Clear(k)
+			}
+			return true
+		})
+	}
+	if fs.child != nil {
+		m.Range(func(k protoreflect.MapKey, v protoreflect.Value) bool {
+			fs.child.sample(v.Message())
+			return true
+		})
+	}
+}
+
+// sampleIndexes returns the sampled indexes of a sequence, starting from the
+// last item. It follows the same rule as Sample().
+func sampleIndexes(length, maxSample int) []int {
+	if maxSample == -1 || maxSample > length {
+		maxSample = length
+	}
+	if maxSample <= 0 {
+		return nil
+	}
+	inc := (length + maxSample - 1) / maxSample
+	result := make([]int, 0, maxSample)
+	for i := 0; i < maxSample; i++ {
+		ind := length - 1 - i*inc
+		if ind < 0 {
+			break
+		}
+		result = append(result, ind)
+	}
+	return result
+}
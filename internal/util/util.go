@@ -17,6 +17,7 @@ package util
 import (
 	"bytes"
 	"compress/gzip"
+	"context"
 	"encoding/base64"
 	"encoding/json"
 	"fmt"
@@ -27,6 +28,7 @@ import (
 	"runtime"
 	"sort"
 	"strings"
+	"sync/atomic"
 	"time"
 
 	"google.golang.org/grpc/codes"
@@ -56,6 +58,10 @@ const (
 	BtPlacesInPrefix = "d/c/"
 	// BtChartDataPrefix for chart data.
 	BtChartDataPrefix = "d/f/"
+	// BtLatestStatPrefix for the latest value of a place and stat var.
+	BtLatestStatPrefix = "d/p/"
+	// BtSeriesWithinPlacePrefix for the series matrix of the child places.
+	BtSeriesWithinPlacePrefix = "d/s/"
 	// BtInPropValPrefix for in-arc prop value.
 	BtInPropValPrefix = "d/l/"
 	// BtOutPropValPrefix for out-arc prop value.
@@ -81,8 +87,35 @@ const (
 	LimitFactor = 1
 	// TextType represents text type.
 	TextType = "Text"
+	// CacheControl is the Cache-Control directive for cacheable responses.
+	// Responses are revalidated with the ETag before they are reused, so a
+	// new cache is served as soon as it is loaded.
+	CacheControl = "public, no-cache"
+	// StaleHeader is set in the response header when the branch cache is not
+	// read, so the response may miss the latest data.
+	StaleHeader = "x-data-stale"
+	// StaleCacheControl is the Cache-Control directive for stale responses.
+	StaleCacheControl = "no-cache"
 )
 
+type staleKey struct{}
+
+// WithStaleFlag returns a context where MarkStale records that the response is
+// stale, and a function that reports whether it is.
+func WithStaleFlag(ctx context.Context) (context.Context, func() bool) {
+	stale := new(int32)
+	return context.WithValue(ctx, staleKey{}, stale), func() bool {
+		return atomic.LoadInt32(stale) == 1
+	}
+}
+
+// MarkStale records that the response of a request is stale.
+func MarkStale(ctx context.Context) {
+	if stale, ok := ctx.Value(staleKey{}).(*int32); ok {
+		atomic.StoreInt32(stale, 1)
+	}
+}
+
 type typeInfo struct {
 	Predicate string `json:"predicate"`
 	SubType   string `json:"subType"`
@@ -251,6 +284,17 @@ func CheckValidDCIDs(dcids []string) bool {
 	return true
 }
 
+// ETagMatch checks if an If-None-Match header value matches the entity tag.
+func ETagMatch(ifNoneMatch, etag string) bool {
+	for _, tag := range strings.Split(ifNoneMatch, ",") {
+		tag = strings.TrimSpace(tag)
+		if tag == "*" || strings.TrimPrefix(tag, "W/") == etag {
+			return true
+		}
+	}
+	return false
+}
+
 // RandomString creates a random string with 16 runes.
 func RandomString() string {
 	rand.Seed(time.Now().UnixNano())
@@ -1,10 +1,12 @@
 package util
 
 import (
+	"fmt"
 	"testing"
 
 	pb "github.com/datacommonsorg/mixer/internal/proto"
 	"github.com/google/go-cmp/cmp"
+	"google.golang.org/protobuf/proto"
 	"google.golang.org/protobuf/reflect/protoreflect"
 	"google.golang.org/protobuf/testing/protocmp"
 )
@@ -65,6 +67,25 @@ func TestCheckValidDCIDs(t *testing.T) {
 	}
 }
 
+func TestETagMatch(t *testing.T) {
+	for _, c := range []struct {
+		ifNoneMatch string
+		etag        string
+		want        bool
+	}{
+		{`"abc"`, `"abc"`, true},
+		{`"xyz", "abc"`, `"abc"`, true},
+		{`W/"abc"`, `"abc"`, true},
+		{`*`, `"abc"`, true},
+		{`"xyz"`, `"abc"`, false},
+		{`abc`, `"abc"`, false},
+	} {
+		if got := ETagMatch(c.ifNoneMatch, c.etag); got != c.want {
+			t.Errorf("ETagMatch(%s, %s) = %t, want %t", c.ifNoneMatch, c.etag, got, c.want)
+		}
+	}
+}
+
 func TestMergeDedupe(t *testing.T) {
 	for _, c := range []struct {
 		s1   []string
@@ -200,3 +221,143 @@ func TestSample(t *testing.T) {
 	}
 
 }
+
+func TestSampler(t *testing.T) {
+	input := &pb.GetLandingPageDataResponse{
+		ChildPlacesType: "Country",
+		ChildPlaces:     []string{"geoId/12345", "geoId/54321"},
+		StatVarSeries: map[string]*pb.StatVarSeries{
+			"country/USA": {
+				Data: map[string]*pb.Series{
+					"stat-var-1": {
+						Val: map[string]float64{
+							"2011": 1010,
+							"2012": 1020,
+							"2013": 1030,
+							"2014": 1040,
+							"2015": 1050,
+							"2016": 1060,
+						},
+					},
+					"stat-var-2": {
+						Val: map[string]float64{"2019": 350},
+					},
+				},
+			},
+			"geoId/06": {
+				Data: map[string]*pb.Series{
+					"stat-var-1": {
+						Val: map[string]float64{
+							"2018": 300,
+							"2019": 400,
+							"2020": 500,
+						},
+					},
+				},
+			},
+			"geoId/11": {
+				Data: map[string]*pb.Series{
+					"stat-var-2": {
+						Val: map[string]float64{"2019": 350, "2020": 450},
+					},
+				},
+			},
+		},
+	}
+	for _, strategy := range []*SamplingStrategy{
+		{
+			Children: map[string]*SamplingStrategy{
+				"statVarSeries": {
+					MaxSample: -1,
+					Children: map[string]*SamplingStrategy{
+						"data": {
+							MaxSample: -1,
+							Children: map[string]*SamplingStrategy{
+								"val": {MaxSample: 3},
+							},
+						},
+					},
+				},
+			},
+		},
+		{
+			Children: map[string]*SamplingStrategy{
+				"statVarSeries": {MaxSample: 2},
+			},
+			Exclude: []string{"childPlaces"},
+		},
+		{
+			Children: map[string]*SamplingStrategy{
+				"statVarSeries": {
+					MaxSample: -1,
+					Exclude:   []string{"geoId/06"},
+					Children: map[string]*SamplingStrategy{
+						"data": {MaxSample: 1},
+					},
+				},
+			},
+		},
+	} {
+		want := Sample(proto.Clone(input), strategy)
+		sampler := NewSampler(input.ProtoReflect().Descriptor(), strategy)
+		got := sampler.Sample(proto.Clone(input))
+		if diff := cmp.Diff(got, want, protocmp.Transform()); diff != "" {
+			t.Errorf("Sampler.Sample() got diff %+v", diff)
+		}
+	}
+}
+
+func buildSampleBenchmarkData() *pb.GetLandingPageDataResponse {
+	resp := &pb.GetLandingPageDataResponse{
+		StatVarSeries: map[string]*pb.StatVarSeries{},
+	}
+	for p := 0; p < 200; p++ {
+		svs := &pb.StatVarSeries{Data: map[string]*pb.Series{}}
+		for sv := 0; sv < 20; sv++ {
+			series := &pb.Series{Val: map[string]float64{}}
+			for year := 1970; year < 2020; year++ {
+				series.Val[fmt.Sprintf("%d", year)] = float64(year)
+			}
+			svs.Data[fmt.Sprintf("sv%d", sv)] = series
+		}
+		resp.StatVarSeries[fmt.Sprintf("geoId/%d", p)] = svs
+	}
+	return resp
+}
+
+var benchmarkStrategy = &SamplingStrategy{
+	Children: map[string]*SamplingStrategy{
+		"statVarSeries": {
+			MaxSample: 50,
+			Children: map[string]*SamplingStrategy{
+				"data": {
+					MaxSample: -1,
+					Children: map[string]*SamplingStrategy{
+						"val": {MaxSample: 5},
+					},
+				},
+			},
+		},
+	},
+}
+
+func BenchmarkSample(b *testing.B) {
+	input := buildSampleBenchmarkData()
+	for i := 0; i < b.N; i++ {
+		b.StopTimer()
+		m := proto.Clone(input)
+		b.StartTimer()
+		Sample(m, benchmarkStrategy)
+	}
+}
+
+func BenchmarkSampler(b *testing.B) {
+	input := buildSampleBenchmarkData()
+	sampler := NewSampler(input.ProtoReflect().Descriptor(), benchmarkStrategy)
+	for i := 0; i < b.N; i++ {
+		b.StopTimer()
+		m := proto.Clone(input)
+		b.StartTimer()
+		sampler.Sample(m)
+	}
+}